@@ -0,0 +1,125 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+// Compares hashing fixed-width bucket keys one at a time with the scalar
+// MurmurHash3_x86_32 against the batched, SIMD hashing used by the bucket transform.
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "iceberg/util/murmurhash3_batch_internal.h"
+#include "iceberg/util/murmurhash3_internal.h"
+
+namespace iceberg {
+
+namespace {
+
+template <typename T>
+std::vector<T> RandomKeys(int64_t length) {
+  std::mt19937_64 rng(42);
+  std::vector<T> keys(length);
+  for (auto& key : keys) {
+    key = static_cast<T>(rng());
+  }
+  return keys;
+}
+
+void BM_HashLongsScalar(benchmark::State& state) {
+  const auto keys = RandomKeys<int64_t>(state.range(0));
+  std::vector<int32_t> out(keys.size());
+  for (auto _ : state) {
+    for (size_t i = 0; i < keys.size(); ++i) {
+      MurmurHash3_x86_32(&keys[i], sizeof(int64_t), 0, &out[i]);
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_HashLongsBatch(benchmark::State& state) {
+  const auto keys = RandomKeys<int64_t>(state.range(0));
+  std::vector<int32_t> out(keys.size());
+  for (auto _ : state) {
+    MurmurHash3_x86_32_Longs(keys, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetLabel(MurmurHash3BatchSimdLevel());
+}
+
+void BM_HashIntsScalar(benchmark::State& state) {
+  const auto keys = RandomKeys<int32_t>(state.range(0));
+  std::vector<int32_t> out(keys.size());
+  for (auto _ : state) {
+    for (size_t i = 0; i < keys.size(); ++i) {
+      const int64_t key = keys[i];
+      MurmurHash3_x86_32(&key, sizeof(int64_t), 0, &out[i]);
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_HashIntsBatch(benchmark::State& state) {
+  const auto keys = RandomKeys<int32_t>(state.range(0));
+  std::vector<int32_t> out(keys.size());
+  for (auto _ : state) {
+    MurmurHash3_x86_32_IntsAsLongs(keys, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetLabel(MurmurHash3BatchSimdLevel());
+}
+
+void BM_HashFixed16Scalar(benchmark::State& state) {
+  const auto keys = RandomKeys<uint8_t>(state.range(0) * 16);
+  std::vector<int32_t> out(state.range(0));
+  for (auto _ : state) {
+    for (size_t i = 0; i < out.size(); ++i) {
+      MurmurHash3_x86_32(keys.data() + i * 16, 16, 0, &out[i]);
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_HashFixed16Batch(benchmark::State& state) {
+  const auto keys = RandomKeys<uint8_t>(state.range(0) * 16);
+  std::vector<int32_t> out(state.range(0));
+  for (auto _ : state) {
+    MurmurHash3_x86_32_Fixed16(keys.data(), out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetLabel(MurmurHash3BatchSimdLevel());
+}
+
+}  // namespace
+
+BENCHMARK(BM_HashLongsScalar)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_HashLongsBatch)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_HashIntsScalar)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_HashIntsBatch)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_HashFixed16Scalar)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_HashFixed16Batch)->Arg(1 << 10)->Arg(1 << 16);
+
+}  // namespace iceberg
@@ -0,0 +1,204 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+// Compares the size and the write and scan speed of Parquet files written with
+// different compression and row group settings.
+
+#include <format>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <arrow/array/builder_binary.h>
+#include <arrow/array/builder_nested.h>
+#include <arrow/array/builder_primitive.h>
+#include <arrow/c/bridge.h>
+#include <arrow/type.h>
+#include <benchmark/benchmark.h>
+
+#include "iceberg/arrow/arrow_fs_file_io_internal.h"
+#include "iceberg/file_reader.h"
+#include "iceberg/file_writer.h"
+#include "iceberg/parquet/parquet_register.h"
+#include "iceberg/schema.h"
+#include "iceberg/schema_internal.h"
+#include "iceberg/type.h"
+
+namespace iceberg::parquet {
+
+namespace {
+
+constexpr int64_t kNumRows = 1 << 20;
+
+struct WriteSettings {
+  std::string name;
+  std::unordered_map<std::string, std::string> properties;
+};
+
+const std::vector<WriteSettings>& AllSettings() {
+  static const std::vector<WriteSettings> settings = {
+      {"uncompressed",
+       {{WriterProperties::kParquetCompressionCodec.key(), "uncompressed"}}},
+      {"snappy", {{WriterProperties::kParquetCompressionCodec.key(), "snappy"}}},
+      {"gzip", {{WriterProperties::kParquetCompressionCodec.key(), "gzip"}}},
+      {"zstd", {{WriterProperties::kParquetCompressionCodec.key(), "zstd"}}},
+      {"zstd-3/8MiB-row-groups",
+       {{WriterProperties::kParquetCompressionCodec.key(), "zstd"},
+        {WriterProperties::kParquetCompressionLevel.key(), "3"},
+        {WriterProperties::kParquetRowGroupSizeBytes.key(),
+         std::to_string(8 * 1024 * 1024)}}},
+  };
+  return settings;
+}
+
+std::shared_ptr<Schema> MakeSchema() {
+  return std::make_shared<Schema>(std::vector<SchemaField>{
+      SchemaField::MakeRequired(1, "id", int64()),
+      SchemaField::MakeOptional(2, "category", string()),
+      SchemaField::MakeOptional(3, "price", float64()),
+      SchemaField::MakeOptional(4, "ts", timestamp_tz()),
+  });
+}
+
+// A batch of sequential ids and timestamps, low-cardinality strings and random
+// doubles, which resembles a typical fact table.
+std::shared_ptr<::arrow::Array> MakeBatch(const Schema& schema) {
+  ArrowSchema c_schema;
+  if (!ToArrowSchema(schema, &c_schema).has_value()) {
+    return nullptr;
+  }
+  auto type = ::arrow::ImportType(&c_schema).ValueOrDie();
+
+  std::mt19937_64 random(42);
+  std::uniform_real_distribution<double> prices(0, 1000);
+  ::arrow::StructBuilder builder(
+      type, ::arrow::default_memory_pool(),
+      {std::make_shared<::arrow::Int64Builder>(),
+       std::make_shared<::arrow::StringBuilder>(),
+       std::make_shared<::arrow::DoubleBuilder>(),
+       std::make_shared<::arrow::TimestampBuilder>(type->field(3)->type(),
+                                                   ::arrow::default_memory_pool())});
+  auto* ids = static_cast<::arrow::Int64Builder*>(builder.field_builder(0));
+  auto* categories = static_cast<::arrow::StringBuilder*>(builder.field_builder(1));
+  auto* price_values = static_cast<::arrow::DoubleBuilder*>(builder.field_builder(2));
+  auto* timestamps = static_cast<::arrow::TimestampBuilder*>(builder.field_builder(3));
+  constexpr int64_t kStartMicros = 1'700'000'000'000'000;
+  for (int64_t i = 0; i < kNumRows; ++i) {
+    (void)builder.Append();
+    (void)ids->Append(i);
+    (void)categories->Append(std::format("category-{}", random() % 100));
+    (void)price_values->Append(prices(random));
+    (void)timestamps->Append(kStartMicros + i * 1000);
+  }
+  return builder.Finish().ValueOrDie();
+}
+
+// Writes the batch to `path` and returns the length of the file, or -1 on error.
+int64_t WriteFile(const WriteSettings& settings, const std::shared_ptr<Schema>& schema,
+                  const ::arrow::Array& batch, const std::shared_ptr<FileIO>& io,
+                  const std::string& path) {
+  auto writer = WriterFactoryRegistry::Open(FileFormatType::kParquet,
+                                            {.path = path,
+                                             .schema = schema,
+                                             .io = io,
+                                             .properties = settings.properties});
+  ArrowArray c_array;
+  if (!writer.has_value() || !::arrow::ExportArray(batch, &c_array).ok() ||
+      !writer.value()->Write(c_array).has_value() ||
+      !writer.value()->Close().has_value()) {
+    return -1;
+  }
+  return writer.value()->length().value();
+}
+
+void BM_WriteParquet(benchmark::State& state) {
+  RegisterAll();
+  const auto& settings = AllSettings()[state.range(0)];
+  state.SetLabel(settings.name);
+  auto schema = MakeSchema();
+  auto batch = MakeBatch(*schema);
+  auto io = std::shared_ptr<FileIO>(arrow::ArrowFileSystemFileIO::MakeMockFileIO());
+
+  int64_t file_size = 0;
+  for (auto _ : state) {
+    file_size = WriteFile(settings, schema, *batch, io, "benchmark.parquet");
+    if (file_size < 0) {
+      state.SkipWithError("Failed to write the Parquet file");
+      return;
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kNumRows);
+  state.counters["file_bytes"] = static_cast<double>(file_size);
+}
+
+void BM_ScanParquet(benchmark::State& state) {
+  RegisterAll();
+  const auto& settings = AllSettings()[state.range(0)];
+  state.SetLabel(settings.name);
+  auto schema = MakeSchema();
+  auto io = std::shared_ptr<FileIO>(arrow::ArrowFileSystemFileIO::MakeMockFileIO());
+  int64_t file_size =
+      WriteFile(settings, schema, *MakeBatch(*schema), io, "benchmark.parquet");
+  if (file_size < 0) {
+    state.SkipWithError("Failed to write the Parquet file");
+    return;
+  }
+
+  for (auto _ : state) {
+    auto reader = ReaderFactoryRegistry::Open(
+        FileFormatType::kParquet, {.path = "benchmark.parquet",
+                                   .length = static_cast<size_t>(file_size),
+                                   .io = io,
+                                   .projection = schema});
+    if (!reader.has_value()) {
+      state.SkipWithError("Failed to open the Parquet file");
+      return;
+    }
+    while (true) {
+      auto batch = reader.value()->Next();
+      if (!batch.has_value()) {
+        state.SkipWithError("Failed to read the Parquet file");
+        return;
+      }
+      if (!batch.value().has_value()) {
+        break;
+      }
+      auto& array = batch.value().value();
+      array.release(&array);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kNumRows);
+  state.SetBytesProcessed(state.iterations() * file_size);
+  state.counters["file_bytes"] = static_cast<double>(file_size);
+}
+
+void AllSettingsArgs(benchmark::internal::Benchmark* benchmark) {
+  for (size_t i = 0; i < AllSettings().size(); ++i) {
+    benchmark->Arg(static_cast<int64_t>(i));
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_WriteParquet)->Apply(AllSettingsArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ScanParquet)->Apply(AllSettingsArgs)->Unit(benchmark::kMillisecond);
+
+}  // namespace iceberg::parquet
@@ -0,0 +1,146 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+// Compares parsing the table metadata of a table with many snapshots through a DOM
+// of the whole document against the streaming parser used by TableMetadataUtil::Read.
+
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <nlohmann/json.hpp>
+
+#include "iceberg/json_internal.h"
+#include "iceberg/partition_spec.h"
+#include "iceberg/schema.h"
+#include "iceberg/snapshot.h"
+#include "iceberg/sort_order.h"
+#include "iceberg/table_metadata.h"
+#include "iceberg/type.h"
+
+namespace iceberg {
+
+namespace {
+
+/// \brief Returns the JSON of format v2 table metadata with `num_snapshots` append
+/// snapshots, each with a full summary and an entry in the snapshot log, and 100
+/// entries in the metadata log.
+std::string MakeMetadataJson(int64_t num_snapshots) {
+  TableMetadata metadata;
+  metadata.format_version = 2;
+  metadata.table_uuid = "9c12d441-03fe-4693-9a96-a0705ddf69c1";
+  metadata.location = "s3://bucket/warehouse/db/table";
+  metadata.last_column_id = 2;
+  metadata.schemas.push_back(std::make_shared<Schema>(
+      std::vector<SchemaField>{SchemaField::MakeRequired(1, "id", int64()),
+                               SchemaField::MakeOptional(2, "data", string())},
+      /*schema_id=*/0));
+  metadata.current_schema_id = 0;
+  metadata.partition_specs.push_back(PartitionSpec::Unpartitioned());
+  metadata.default_spec_id = PartitionSpec::Unpartitioned()->spec_id();
+  metadata.last_partition_id = PartitionSpec::Unpartitioned()->last_assigned_field_id();
+  metadata.sort_orders.push_back(SortOrder::Unsorted());
+  metadata.default_sort_order_id = SortOrder::Unsorted()->order_id();
+  metadata.last_updated_ms = TimePointMs{std::chrono::milliseconds(1700000000000)};
+
+  constexpr int64_t kFirstSnapshotId = 3051729675574597004;
+  for (int64_t i = 0; i < num_snapshots; ++i) {
+    auto timestamp_ms = TimePointMs{std::chrono::milliseconds(1600000000000 + i * 1000)};
+    auto snapshot_id = kFirstSnapshotId + i;
+    metadata.snapshots.push_back(std::make_shared<Snapshot>(Snapshot{
+        .snapshot_id = snapshot_id,
+        .parent_snapshot_id =
+            i == 0 ? std::nullopt : std::optional<int64_t>(snapshot_id - 1),
+        .sequence_number = i + 1,
+        .timestamp_ms = timestamp_ms,
+        .manifest_list = std::format(
+            "{}/metadata/snap-{}-1-aeffe099-3bac-4011-bc17-5875210d8dc0.avro",
+            metadata.location, snapshot_id),
+        .summary =
+            {
+                {SnapshotSummaryFields::kOperation, DataOperation::kAppend},
+                {SnapshotSummaryFields::kAddedDataFiles, "10"},
+                {SnapshotSummaryFields::kAddedRecords, "100000"},
+                {SnapshotSummaryFields::kAddedFileSize, "10485760"},
+                {SnapshotSummaryFields::kChangedPartitionCountProp, "1"},
+                {SnapshotSummaryFields::kTotalDataFiles, std::to_string(10 * (i + 1))},
+                {SnapshotSummaryFields::kTotalDeleteFiles, "0"},
+                {SnapshotSummaryFields::kTotalRecords,
+                 std::to_string(100000 * (i + 1))},
+                {SnapshotSummaryFields::kTotalFileSize,
+                 std::to_string(10485760 * (i + 1))},
+                {SnapshotSummaryFields::kTotalPosDeletes, "0"},
+                {SnapshotSummaryFields::kTotalEqDeletes, "0"},
+            },
+        .schema_id = 0,
+    }));
+    metadata.snapshot_log.push_back(
+        SnapshotLogEntry{.timestamp_ms = timestamp_ms, .snapshot_id = snapshot_id});
+  }
+  for (int64_t i = 0; i < 100; ++i) {
+    metadata.metadata_log.push_back(MetadataLogEntry{
+        .timestamp_ms = TimePointMs{std::chrono::milliseconds(1600000000000 + i)},
+        .metadata_file = std::format("{}/metadata/{:05d}-{}.metadata.json",
+                                     metadata.location, i, metadata.table_uuid)});
+  }
+  if (!metadata.snapshots.empty()) {
+    metadata.current_snapshot_id = metadata.snapshots.back()->snapshot_id;
+    metadata.last_sequence_number = num_snapshots;
+  }
+  return ToJsonString(ToJson(metadata)).value();
+}
+
+void BM_ParseTableMetadataDom(benchmark::State& state) {
+  const auto json_string = MakeMetadataJson(state.range(0));
+  for (auto _ : state) {
+    auto json = FromJsonString(json_string);
+    auto metadata = TableMetadataFromJson(json.value());
+    benchmark::DoNotOptimize(metadata);
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(json_string.size()));
+}
+
+void BM_ParseTableMetadataStreaming(benchmark::State& state) {
+  const auto json_string = MakeMetadataJson(state.range(0));
+  for (auto _ : state) {
+    auto metadata = TableMetadataFromJsonString(json_string);
+    benchmark::DoNotOptimize(metadata);
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(json_string.size()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_ParseTableMetadataDom)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ParseTableMetadataStreaming)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace iceberg
@@ -0,0 +1,146 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+// Compares the std::chrono civil calendar conversions that the temporal transforms
+// used per value against the integer arithmetic kernels that transform arrays.
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "iceberg/util/transform_kernels_internal.h"
+
+namespace iceberg {
+
+namespace {
+
+constexpr int64_t kNumValues = 1 << 16;
+
+/// \brief Random dates between 1900 and 2100.
+std::vector<int32_t> RandomDates() {
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int32_t> distribution(-25567, 47482);
+  std::vector<int32_t> dates(kNumValues);
+  for (auto& date : dates) {
+    date = distribution(rng);
+  }
+  return dates;
+}
+
+/// \brief Random timestamps in microseconds between 1900 and 2100.
+std::vector<int64_t> RandomMicros() {
+  std::mt19937_64 rng(42);
+  std::uniform_int_distribution<int64_t> distribution(
+      int64_t{-25567} * TransformKernels::kMicrosPerDay,
+      int64_t{47482} * TransformKernels::kMicrosPerDay);
+  std::vector<int64_t> micros(kNumValues);
+  for (auto& value : micros) {
+    value = distribution(rng);
+  }
+  return micros;
+}
+
+void BM_YearFromDaysChrono(benchmark::State& state) {
+  using namespace std::chrono;  // NOLINT
+  const auto dates = RandomDates();
+  std::vector<int32_t> out(dates.size());
+  for (auto _ : state) {
+    for (size_t i = 0; i < dates.size(); ++i) {
+      out[i] = static_cast<int32_t>(year_month_day(sys_days(days(dates[i]))).year());
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kNumValues);
+}
+
+void BM_YearFromDays(benchmark::State& state) {
+  const auto dates = RandomDates();
+  std::vector<int32_t> out(dates.size());
+  for (auto _ : state) {
+    TransformKernels::YearFromDays(dates, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kNumValues);
+}
+
+void BM_MonthFromMicrosChrono(benchmark::State& state) {
+  using namespace std::chrono;  // NOLINT
+  const auto micros = RandomMicros();
+  std::vector<int32_t> out(micros.size());
+  for (auto _ : state) {
+    for (size_t i = 0; i < micros.size(); ++i) {
+      auto ymd =
+          year_month_day(floor<days>(sys_time<microseconds>(microseconds(micros[i]))));
+      out[i] = (static_cast<int32_t>(ymd.year()) - 1970) * 12 +
+               static_cast<int32_t>(static_cast<unsigned>(ymd.month())) - 1;
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kNumValues);
+}
+
+void BM_MonthFromMicros(benchmark::State& state) {
+  const auto micros = RandomMicros();
+  std::vector<int32_t> out(micros.size());
+  for (auto _ : state) {
+    TransformKernels::MonthFromMicros(micros, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kNumValues);
+}
+
+void BM_HourFromMicrosChrono(benchmark::State& state) {
+  using namespace std::chrono;  // NOLINT
+  const auto micros = RandomMicros();
+  std::vector<int32_t> out(micros.size());
+  for (auto _ : state) {
+    for (size_t i = 0; i < micros.size(); ++i) {
+      out[i] = static_cast<int32_t>(
+          floor<hours>(sys_time<microseconds>(microseconds(micros[i])))
+              .time_since_epoch()
+              .count());
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kNumValues);
+}
+
+void BM_HourFromMicros(benchmark::State& state) {
+  const auto micros = RandomMicros();
+  std::vector<int32_t> out(micros.size());
+  for (auto _ : state) {
+    TransformKernels::HourFromMicros(micros, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kNumValues);
+}
+
+}  // namespace
+
+BENCHMARK(BM_YearFromDaysChrono);
+BENCHMARK(BM_YearFromDays);
+BENCHMARK(BM_MonthFromMicrosChrono);
+BENCHMARK(BM_MonthFromMicros);
+BENCHMARK(BM_HourFromMicrosChrono);
+BENCHMARK(BM_HourFromMicros);
+
+}  // namespace iceberg
@@ -80,6 +80,8 @@ function(resolve_arrow_dependency)
   set(ARROW_DEPENDENCY_SOURCE "BUNDLED")
   set(ARROW_WITH_ZLIB ON)
   set(ZLIB_SOURCE "SYSTEM")
+  # Default compression codec of Parquet data files.
+  set(ARROW_WITH_ZSTD ON)
   set(ARROW_VERBOSE_THIRDPARTY_BUILD OFF)
 
   fetchcontent_declare(VendoredArrow
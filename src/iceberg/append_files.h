@@ -0,0 +1,54 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+/// \file iceberg/append_files.h
+/// API for appending data files to a table.
+
+#include <memory>
+
+#include "iceberg/iceberg_export.h"
+#include "iceberg/result.h"
+#include "iceberg/type_fwd.h"
+
+namespace iceberg {
+
+/// \brief Appends new data files to a table.
+///
+/// The files are committed as a single "append" snapshot by Commit(). Appending files
+/// does not remove or replace any file, so it only conflicts with commits that change
+/// the table in place.
+class ICEBERG_EXPORT AppendFiles {
+ public:
+  virtual ~AppendFiles() = default;
+
+  /// \brief Append a data file to the table.
+  ///
+  /// \param file A data file of a partition spec of the table.
+  /// \return this for method chaining
+  virtual AppendFiles& AppendFile(std::shared_ptr<DataFile> file) = 0;
+
+  /// \brief Commit the appended files as a new snapshot of the table.
+  ///
+  /// \return ErrorKind::kCommitFailed if the table changed concurrently.
+  virtual Status Commit() = 0;
+};
+
+}  // namespace iceberg
@@ -0,0 +1,135 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include "iceberg/arrow/arrow_error_transform_internal.h"
+#include "iceberg/arrow/arrow_memory_pool.h"
+#include "iceberg/arrow/arrow_memory_pool_internal.h"
+#include "iceberg/util/checked_cast.h"
+
+namespace iceberg::arrow {
+
+namespace {
+
+/// \brief An Arrow memory pool that forwards allocations to a MemoryPool that is not
+/// backed by Arrow.
+class MemoryPoolAdapter : public ::arrow::MemoryPool,
+                          public iceberg::MemoryPool::Adapter {
+ public:
+  explicit MemoryPoolAdapter(iceberg::MemoryPool* pool) : pool_(pool) {}
+
+  using ::arrow::MemoryPool::Allocate;
+  using ::arrow::MemoryPool::Free;
+  using ::arrow::MemoryPool::Reallocate;
+
+  ::arrow::Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override {
+    auto buffer = pool_->Allocate(size, alignment);
+    if (!buffer.has_value()) {
+      return ::arrow::Status::OutOfMemory(buffer.error().message);
+    }
+    *out = buffer.value();
+    total_bytes_allocated_ += size;
+    ++num_allocations_;
+    return ::arrow::Status::OK();
+  }
+
+  ::arrow::Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                             uint8_t** ptr) override {
+    auto buffer = pool_->Reallocate(*ptr, old_size, new_size, alignment);
+    if (!buffer.has_value()) {
+      return ::arrow::Status::OutOfMemory(buffer.error().message);
+    }
+    *ptr = buffer.value();
+    total_bytes_allocated_ += std::max<int64_t>(new_size - old_size, 0);
+    ++num_allocations_;
+    return ::arrow::Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override {
+    pool_->Free(buffer, size, alignment);
+  }
+
+  int64_t bytes_allocated() const override { return pool_->bytes_allocated(); }
+
+  int64_t max_memory() const override { return pool_->max_memory(); }
+
+  int64_t total_bytes_allocated() const override { return total_bytes_allocated_; }
+
+  int64_t num_allocations() const override { return num_allocations_; }
+
+  std::string backend_name() const override { return pool_->backend_name(); }
+
+ private:
+  iceberg::MemoryPool* pool_;
+  std::atomic<int64_t> total_bytes_allocated_{0};
+  std::atomic<int64_t> num_allocations_{0};
+};
+
+/// \brief Returns the adapter of `pool`, which is created on first use.
+///
+/// Arrow buffers refer to their pool by a raw pointer, so the adapter is kept in `pool`
+/// and lives as long as it, which requires all of its buffers to be released already.
+::arrow::MemoryPool* AdapterOf(iceberg::MemoryPool& pool) {
+  auto* adapter = pool.GetOrCreateAdapter([&pool]() {
+    return std::unique_ptr<iceberg::MemoryPool::Adapter>(
+        std::make_unique<MemoryPoolAdapter>(&pool));
+  });
+  return internal::checked_cast<MemoryPoolAdapter*>(adapter);
+}
+
+}  // namespace
+
+Result<uint8_t*> ArrowMemoryPool::Allocate(int64_t size, int64_t alignment) {
+  uint8_t* buffer = nullptr;
+  ICEBERG_ARROW_RETURN_NOT_OK(pool_->Allocate(size, alignment, &buffer));
+  return buffer;
+}
+
+Result<uint8_t*> ArrowMemoryPool::Reallocate(uint8_t* buffer, int64_t old_size,
+                                             int64_t new_size, int64_t alignment) {
+  ICEBERG_ARROW_RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, alignment, &buffer));
+  return buffer;
+}
+
+void ArrowMemoryPool::Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+  pool_->Free(buffer, size, alignment);
+}
+
+Result<::arrow::MemoryPool*> ToArrowMemoryPool(const std::shared_ptr<MemoryPool>& pool) {
+  if (pool == nullptr) {
+    return ::arrow::default_memory_pool();
+  }
+  if (auto arrow_pool = std::dynamic_pointer_cast<ArrowMemoryPool>(pool)) {
+    return arrow_pool->pool();
+  }
+  return AdapterOf(*pool);
+}
+
+std::shared_ptr<MemoryPool> MakeArrowMemoryPool(::arrow::MemoryPool* pool) {
+  return std::make_shared<ArrowMemoryPool>(pool);
+}
+
+std::shared_ptr<MemoryPool> MakeDefaultArrowMemoryPool() {
+  return MakeArrowMemoryPool(::arrow::default_memory_pool());
+}
+
+}  // namespace iceberg::arrow
@@ -0,0 +1,46 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "iceberg/iceberg_bundle_export.h"
+#include "iceberg/memory_pool.h"
+
+namespace arrow {
+class MemoryPool;
+}  // namespace arrow
+
+namespace iceberg::arrow {
+
+/// \brief Make a MemoryPool backed by an Arrow memory pool.
+///
+/// The readers and writers of the `iceberg-bundle` library allocate from the Arrow
+/// pool of a memory pool created by this function directly, which allows to plug in any
+/// Arrow allocator such as `::arrow::jemalloc_memory_pool()` or a
+/// `::arrow::ProxyMemoryPool` to track usage. Other memory pools are called through an
+/// adapter. The Arrow pool is not owned and must outlive the returned pool.
+ICEBERG_BUNDLE_EXPORT std::shared_ptr<MemoryPool> MakeArrowMemoryPool(
+    ::arrow::MemoryPool* pool);
+
+/// \brief Make a MemoryPool backed by `::arrow::default_memory_pool()`.
+ICEBERG_BUNDLE_EXPORT std::shared_ptr<MemoryPool> MakeDefaultArrowMemoryPool();
+
+}  // namespace iceberg::arrow
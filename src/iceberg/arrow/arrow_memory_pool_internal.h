@@ -0,0 +1,66 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <arrow/memory_pool.h>
+
+#include "iceberg/iceberg_bundle_export.h"
+#include "iceberg/memory_pool.h"
+#include "iceberg/result.h"
+
+namespace iceberg::arrow {
+
+/// \brief A concrete implementation of MemoryPool for Arrow memory pools.
+class ICEBERG_BUNDLE_EXPORT ArrowMemoryPool : public MemoryPool {
+ public:
+  explicit ArrowMemoryPool(::arrow::MemoryPool* pool) : pool_(pool) {}
+
+  ~ArrowMemoryPool() override = default;
+
+  Result<uint8_t*> Allocate(int64_t size, int64_t alignment) override;
+
+  Result<uint8_t*> Reallocate(uint8_t* buffer, int64_t old_size, int64_t new_size,
+                              int64_t alignment) override;
+
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override;
+
+  int64_t bytes_allocated() const override { return pool_->bytes_allocated(); }
+
+  int64_t max_memory() const override { return pool_->max_memory(); }
+
+  std::string backend_name() const override { return pool_->backend_name(); }
+
+  /// \brief Get the Arrow memory pool.
+  ::arrow::MemoryPool* pool() const { return pool_; }
+
+ private:
+  ::arrow::MemoryPool* pool_;
+};
+
+/// \brief Get the Arrow memory pool to allocate from for the given pool.
+///
+/// \return `::arrow::default_memory_pool()` if `pool` is null, the Arrow pool of an
+/// ArrowMemoryPool, or else an Arrow pool that forwards allocations to `pool` and
+/// lives as long as `pool`.
+Result<::arrow::MemoryPool*> ToArrowMemoryPool(const std::shared_ptr<MemoryPool>& pool);
+
+}  // namespace iceberg::arrow
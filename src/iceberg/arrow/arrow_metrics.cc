@@ -0,0 +1,557 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/arrow/arrow_metrics_internal.h"
+
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <arrow/array.h>
+#include <arrow/util/bit_run_reader.h>
+
+#include "iceberg/arrow/arrow_error_transform_internal.h"
+#include "iceberg/schema.h"
+#include "iceberg/type.h"
+#include "iceberg/util/checked_cast.h"
+#include "iceberg/util/macros.h"
+
+namespace iceberg::arrow {
+
+/// \brief Collects the metrics of a field, and of the fields nested in it.
+class FieldMetricsCollector {
+ public:
+  virtual ~FieldMetricsCollector() = default;
+
+  /// \brief Update the metrics with the values of the field in a batch.
+  virtual Status Update(const ::arrow::Array& array) = 0;
+
+  /// \brief Add the collected metrics to `metrics`.
+  virtual void Finish(Metrics* metrics) const = 0;
+};
+
+namespace {
+
+Status CheckArrayType(const ::arrow::Array& array, ::arrow::Type::type expected,
+                      int32_t field_id) {
+  if (array.type_id() != expected) {
+    return InvalidArrowData("Cannot collect metrics of field {} from array of type {}",
+                            field_id, array.type()->ToString());
+  }
+  return {};
+}
+
+// Calls `visit(position, length)` for each run of non-null values of an array.
+template <typename Visit>
+void VisitValidRuns(const ::arrow::Array& array, Visit&& visit) {
+  if (array.null_count() == 0) {
+    visit(int64_t{0}, array.length());
+  } else if (array.null_count() < array.length()) {
+    ::arrow::internal::VisitSetBitRunsVoid(array.null_bitmap_data(), array.offset(),
+                                           array.length(), std::forward<Visit>(visit));
+  }
+}
+
+// Returns the values referenced by the entries of a list or map array.
+std::shared_ptr<::arrow::Array> ListValues(const ::arrow::ListArray& list_array) {
+  auto begin = list_array.value_offset(0);
+  auto end = list_array.value_offset(list_array.length());
+  return list_array.values()->Slice(begin, end - begin);
+}
+
+// Collects value and null counts, and no bounds.
+class CountsCollector : public FieldMetricsCollector {
+ public:
+  explicit CountsCollector(const SchemaField& field) : field_id_(field.field_id()) {}
+
+  Status Update(const ::arrow::Array& array) override {
+    UpdateCounts(array);
+    return {};
+  }
+
+  void Finish(Metrics* metrics) const override { FinishCounts(metrics); }
+
+ protected:
+  void UpdateCounts(const ::arrow::Array& array) {
+    value_count_ += array.length();
+    null_value_count_ += array.null_count();
+  }
+
+  void FinishCounts(Metrics* metrics) const {
+    metrics->value_counts[field_id_] = value_count_;
+    metrics->null_value_counts[field_id_] = null_value_count_;
+  }
+
+  int32_t field_id_;
+  int64_t value_count_ = 0;
+  int64_t null_value_count_ = 0;
+};
+
+// Bounds of a column before truncation.
+template <typename T>
+struct Bounds {
+  T min;
+  T max;
+};
+
+template <typename T>
+void UpdateBounds(const Bounds<T>& batch_bounds, std::optional<Bounds<T>>* bounds) {
+  if (!bounds->has_value()) {
+    *bounds = batch_bounds;
+    return;
+  }
+  (*bounds)->min = std::min((*bounds)->min, batch_bounds.min);
+  (*bounds)->max = std::max((*bounds)->max, batch_bounds.max);
+}
+
+// Adds the bounds of a column to `metrics`, truncated according to `mode`.
+void FinishBounds(int32_t field_id, const MetricsMode& mode, const Literal& min,
+                  const Literal& max, Metrics* metrics) {
+  if (auto lower = mode.LowerBound(min)) {
+    metrics->lower_bounds.emplace(field_id, std::move(lower.value()));
+  }
+  if (auto upper = mode.UpperBound(max)) {
+    metrics->upper_bounds.emplace(field_id, std::move(upper.value()));
+  }
+}
+
+// Collects the metrics of an integer column, whose values are stored in a buffer of
+// `CType` and converted to literals by `kMakeLiteral`.
+template <typename CType, Literal (*kMakeLiteral)(CType)>
+class IntegerCollector : public CountsCollector {
+ public:
+  IntegerCollector(const SchemaField& field, ::arrow::Type::type arrow_type,
+                   MetricsMode mode)
+      : CountsCollector(field), arrow_type_(arrow_type), mode_(mode) {}
+
+  Status Update(const ::arrow::Array& array) override {
+    ICEBERG_RETURN_UNEXPECTED(CheckArrayType(array, arrow_type_, field_id_));
+    UpdateCounts(array);
+
+    const CType* values = array.data()->GetValues<CType>(1);
+    Bounds<CType> batch_bounds{.min = std::numeric_limits<CType>::max(),
+                               .max = std::numeric_limits<CType>::lowest()};
+    bool has_values = false;
+    VisitValidRuns(array, [&](int64_t position, int64_t length) {
+      // A plain loop over the run, which compilers vectorize.
+      CType min = batch_bounds.min;
+      CType max = batch_bounds.max;
+      for (int64_t i = position; i < position + length; ++i) {
+        min = std::min(min, values[i]);
+        max = std::max(max, values[i]);
+      }
+      batch_bounds = {.min = min, .max = max};
+      has_values = true;
+    });
+    if (has_values) {
+      UpdateBounds(batch_bounds, &bounds_);
+    }
+    return {};
+  }
+
+  void Finish(Metrics* metrics) const override {
+    FinishCounts(metrics);
+    if (bounds_.has_value()) {
+      FinishBounds(field_id_, mode_, kMakeLiteral(bounds_->min),
+                   kMakeLiteral(bounds_->max), metrics);
+    }
+  }
+
+ private:
+  ::arrow::Type::type arrow_type_;
+  MetricsMode mode_;
+  std::optional<Bounds<CType>> bounds_;
+};
+
+// Collects the metrics of a float or double column. NaN values are counted and are
+// excluded from the bounds.
+template <typename CType, Literal (*kMakeLiteral)(CType)>
+class FloatingPointCollector : public CountsCollector {
+ public:
+  FloatingPointCollector(const SchemaField& field, ::arrow::Type::type arrow_type,
+                         MetricsMode mode, bool collect_bounds)
+      : CountsCollector(field),
+        arrow_type_(arrow_type),
+        mode_(mode),
+        collect_bounds_(collect_bounds) {}
+
+  Status Update(const ::arrow::Array& array) override {
+    ICEBERG_RETURN_UNEXPECTED(CheckArrayType(array, arrow_type_, field_id_));
+    UpdateCounts(array);
+
+    const CType* values = array.data()->GetValues<CType>(1);
+    Bounds<CType> batch_bounds{.min = std::numeric_limits<CType>::infinity(),
+                               .max = -std::numeric_limits<CType>::infinity()};
+    int64_t valid_count = 0;
+    int64_t nan_count = 0;
+    VisitValidRuns(array, [&](int64_t position, int64_t length) {
+      // Comparisons with NaN are false, so NaN values leave the bounds unchanged
+      // without a branch.
+      CType min = batch_bounds.min;
+      CType max = batch_bounds.max;
+      int64_t run_nan_count = 0;
+      for (int64_t i = position; i < position + length; ++i) {
+        CType value = values[i];
+        run_nan_count += std::isnan(value) ? 1 : 0;
+        min = value < min ? value : min;
+        max = value > max ? value : max;
+      }
+      batch_bounds = {.min = min, .max = max};
+      valid_count += length;
+      nan_count += run_nan_count;
+    });
+    nan_value_count_ += nan_count;
+    if (collect_bounds_ && valid_count > nan_count) {
+      UpdateBounds(batch_bounds, &bounds_);
+    }
+    return {};
+  }
+
+  void Finish(Metrics* metrics) const override {
+    FinishCounts(metrics);
+    metrics->nan_value_counts[field_id_] = nan_value_count_;
+    if (bounds_.has_value()) {
+      // -0.0 and 0.0 compare equal, widen zero bounds to cover both.
+      CType min = bounds_->min == 0 ? -CType{0} : bounds_->min;
+      CType max = bounds_->max == 0 ? CType{0} : bounds_->max;
+      FinishBounds(field_id_, mode_, kMakeLiteral(min), kMakeLiteral(max),
+                   metrics);
+    }
+  }
+
+ private:
+  ::arrow::Type::type arrow_type_;
+  MetricsMode mode_;
+  bool collect_bounds_;
+  int64_t nan_value_count_ = 0;
+  std::optional<Bounds<CType>> bounds_;
+};
+
+class BooleanCollector : public CountsCollector {
+ public:
+  BooleanCollector(const SchemaField& field, MetricsMode mode)
+      : CountsCollector(field), mode_(mode) {}
+
+  Status Update(const ::arrow::Array& array) override {
+    ICEBERG_RETURN_UNEXPECTED(CheckArrayType(array, ::arrow::Type::BOOL, field_id_));
+    UpdateCounts(array);
+
+    // Both counts are popcounts over the value and validity bitmaps.
+    const auto& boolean_array =
+        internal::checked_cast<const ::arrow::BooleanArray&>(array);
+    has_false_ = has_false_ || boolean_array.false_count() > 0;
+    has_true_ = has_true_ || boolean_array.true_count() > 0;
+    return {};
+  }
+
+  void Finish(Metrics* metrics) const override {
+    FinishCounts(metrics);
+    if (has_false_ || has_true_) {
+      FinishBounds(field_id_, mode_, Literal::Boolean(!has_false_),
+                   Literal::Boolean(has_true_), metrics);
+    }
+  }
+
+ private:
+  MetricsMode mode_;
+  bool has_false_ = false;
+  bool has_true_ = false;
+};
+
+// Collects the metrics of a string or binary column.
+class BinaryCollector : public CountsCollector {
+ public:
+  BinaryCollector(const SchemaField& field, ::arrow::Type::type arrow_type,
+                  MetricsMode mode)
+      : CountsCollector(field), arrow_type_(arrow_type), mode_(mode) {}
+
+  Status Update(const ::arrow::Array& array) override {
+    ICEBERG_RETURN_UNEXPECTED(CheckArrayType(array, arrow_type_, field_id_));
+    UpdateCounts(array);
+
+    // Compare views into the batch, and only copy the bounds of the batch.
+    const auto& binary_array = internal::checked_cast<const ::arrow::BinaryArray&>(array);
+    std::optional<Bounds<std::string_view>> batch_bounds;
+    VisitValidRuns(array, [&](int64_t position, int64_t length) {
+      int64_t i = position;
+      if (!batch_bounds.has_value()) {
+        auto value = binary_array.GetView(i++);
+        batch_bounds = Bounds<std::string_view>{.min = value, .max = value};
+      }
+      for (; i < position + length; ++i) {
+        auto value = binary_array.GetView(i);
+        if (value < batch_bounds->min) {
+          batch_bounds->min = value;
+        } else if (value > batch_bounds->max) {
+          batch_bounds->max = value;
+        }
+      }
+    });
+    if (batch_bounds.has_value()) {
+      UpdateBounds(Bounds<std::string>{.min = std::string(batch_bounds->min),
+                                       .max = std::string(batch_bounds->max)},
+                   &bounds_);
+    }
+    return {};
+  }
+
+  void Finish(Metrics* metrics) const override {
+    FinishCounts(metrics);
+    if (bounds_.has_value()) {
+      FinishBounds(field_id_, mode_, ToLiteral(bounds_->min),
+                   ToLiteral(bounds_->max), metrics);
+    }
+  }
+
+ private:
+  Literal ToLiteral(const std::string& value) const {
+    if (arrow_type_ == ::arrow::Type::STRING) {
+      return Literal::String(value);
+    }
+    return Literal::Binary(std::vector<uint8_t>(value.begin(), value.end()));
+  }
+
+  ::arrow::Type::type arrow_type_;
+  MetricsMode mode_;
+  std::optional<Bounds<std::string>> bounds_;
+};
+
+class StructCollector : public FieldMetricsCollector {
+ public:
+  StructCollector(const SchemaField& field,
+                  std::vector<std::unique_ptr<FieldMetricsCollector>> children)
+      : field_id_(field.field_id()), children_(std::move(children)) {}
+
+  Status Update(const ::arrow::Array& array) override {
+    ICEBERG_RETURN_UNEXPECTED(CheckArrayType(array, ::arrow::Type::STRUCT, field_id_));
+    const auto& struct_array = internal::checked_cast<const ::arrow::StructArray&>(array);
+    for (size_t i = 0; i < children_.size(); ++i) {
+      if (children_[i] != nullptr) {
+        // Child slots of null structs hold arbitrary values, so the child is read with
+        // the validity of the struct applied.
+        ICEBERG_ARROW_ASSIGN_OR_RETURN(
+            auto child, struct_array.GetFlattenedField(static_cast<int>(i)));
+        ICEBERG_RETURN_UNEXPECTED(children_[i]->Update(*child));
+      }
+    }
+    return {};
+  }
+
+  void Finish(Metrics* metrics) const override {
+    for (const auto& child : children_) {
+      if (child != nullptr) {
+        child->Finish(metrics);
+      }
+    }
+  }
+
+ private:
+  int32_t field_id_;
+  std::vector<std::unique_ptr<FieldMetricsCollector>> children_;
+};
+
+class ListCollector : public FieldMetricsCollector {
+ public:
+  ListCollector(const SchemaField& field, std::unique_ptr<FieldMetricsCollector> element)
+      : field_id_(field.field_id()), element_(std::move(element)) {}
+
+  Status Update(const ::arrow::Array& array) override {
+    ICEBERG_RETURN_UNEXPECTED(CheckArrayType(array, ::arrow::Type::LIST, field_id_));
+    const auto& list_array = internal::checked_cast<const ::arrow::ListArray&>(array);
+    return element_->Update(*ListValues(list_array));
+  }
+
+  void Finish(Metrics* metrics) const override { element_->Finish(metrics); }
+
+ private:
+  int32_t field_id_;
+  std::unique_ptr<FieldMetricsCollector> element_;
+};
+
+class MapCollector : public FieldMetricsCollector {
+ public:
+  MapCollector(const SchemaField& field, std::unique_ptr<FieldMetricsCollector> key,
+               std::unique_ptr<FieldMetricsCollector> value)
+      : field_id_(field.field_id()), key_(std::move(key)), value_(std::move(value)) {}
+
+  Status Update(const ::arrow::Array& array) override {
+    ICEBERG_RETURN_UNEXPECTED(CheckArrayType(array, ::arrow::Type::MAP, field_id_));
+    const auto& map_array = internal::checked_cast<const ::arrow::MapArray&>(array);
+    auto entries =
+        internal::checked_pointer_cast<::arrow::StructArray>(ListValues(map_array));
+    if (key_ != nullptr) {
+      ICEBERG_RETURN_UNEXPECTED(key_->Update(*entries->field(0)));
+    }
+    if (value_ != nullptr) {
+      ICEBERG_RETURN_UNEXPECTED(value_->Update(*entries->field(1)));
+    }
+    return {};
+  }
+
+  void Finish(Metrics* metrics) const override {
+    if (key_ != nullptr) {
+      key_->Finish(metrics);
+    }
+    if (value_ != nullptr) {
+      value_->Finish(metrics);
+    }
+  }
+
+ private:
+  int32_t field_id_;
+  std::unique_ptr<FieldMetricsCollector> key_;
+  std::unique_ptr<FieldMetricsCollector> value_;
+};
+
+// Returns the collector of a field, or nullptr if no metrics are collected for the
+// field or the fields nested in it.
+std::unique_ptr<FieldMetricsCollector> MakeCollector(const SchemaField& field,
+                                                     const MetricsConfig& config,
+                                                     bool repeated) {
+  const auto& type = *field.type();
+  switch (type.type_id()) {
+    case TypeId::kStruct: {
+      const auto& struct_type = internal::checked_cast<const StructType&>(type);
+      std::vector<std::unique_ptr<FieldMetricsCollector>> children;
+      bool has_children = false;
+      for (const auto& child_field : struct_type.fields()) {
+        auto& child = children.emplace_back(MakeCollector(child_field, config, repeated));
+        has_children = has_children || child != nullptr;
+      }
+      if (!has_children) {
+        return nullptr;
+      }
+      return std::make_unique<StructCollector>(field, std::move(children));
+    }
+    case TypeId::kList: {
+      const auto& list_type = internal::checked_cast<const ListType&>(type);
+      auto element = MakeCollector(list_type.fields()[0], config, /*repeated=*/true);
+      if (element == nullptr) {
+        return nullptr;
+      }
+      return std::make_unique<ListCollector>(field, std::move(element));
+    }
+    case TypeId::kMap: {
+      const auto& map_type = internal::checked_cast<const MapType&>(type);
+      auto key = MakeCollector(map_type.key(), config, /*repeated=*/true);
+      auto value = MakeCollector(map_type.value(), config, /*repeated=*/true);
+      if (key == nullptr && value == nullptr) {
+        return nullptr;
+      }
+      return std::make_unique<MapCollector>(field, std::move(key), std::move(value));
+    }
+    default:
+      break;
+  }
+
+  auto mode = config.ColumnMode(field.field_id());
+  if (mode.kind == MetricsMode::Kind::kNone) {
+    return nullptr;
+  }
+  // Bounds of values in lists and maps are not useful to prune files by rows.
+  bool collect_bounds = mode.kind != MetricsMode::Kind::kCounts && !repeated;
+  switch (type.type_id()) {
+    case TypeId::kFloat:
+      return std::make_unique<FloatingPointCollector<float, &Literal::Float>>(
+          field, ::arrow::Type::FLOAT, mode, collect_bounds);
+    case TypeId::kDouble:
+      return std::make_unique<FloatingPointCollector<double, &Literal::Double>>(
+          field, ::arrow::Type::DOUBLE, mode, collect_bounds);
+    default:
+      break;
+  }
+  if (!collect_bounds) {
+    return std::make_unique<CountsCollector>(field);
+  }
+  switch (type.type_id()) {
+    case TypeId::kBoolean:
+      return std::make_unique<BooleanCollector>(field, mode);
+    case TypeId::kInt:
+      return std::make_unique<IntegerCollector<int32_t, &Literal::Int>>(
+          field, ::arrow::Type::INT32, mode);
+    case TypeId::kDate:
+      return std::make_unique<IntegerCollector<int32_t, &Literal::Date>>(
+          field, ::arrow::Type::DATE32, mode);
+    case TypeId::kLong:
+      return std::make_unique<IntegerCollector<int64_t, &Literal::Long>>(
+          field, ::arrow::Type::INT64, mode);
+    case TypeId::kTime:
+      return std::make_unique<IntegerCollector<int64_t, &Literal::Time>>(
+          field, ::arrow::Type::TIME64, mode);
+    case TypeId::kTimestamp:
+      return std::make_unique<IntegerCollector<int64_t, &Literal::Timestamp>>(
+          field, ::arrow::Type::TIMESTAMP, mode);
+    case TypeId::kTimestampTz:
+      return std::make_unique<IntegerCollector<int64_t, &Literal::TimestampTz>>(
+          field, ::arrow::Type::TIMESTAMP, mode);
+    case TypeId::kString:
+      return std::make_unique<BinaryCollector>(field, ::arrow::Type::STRING, mode);
+    case TypeId::kBinary:
+      return std::make_unique<BinaryCollector>(field, ::arrow::Type::BINARY, mode);
+    default:
+      // Bounds of fixed, uuid and decimal columns are not collected until Literal can
+      // represent their values.
+      return std::make_unique<CountsCollector>(field);
+  }
+}
+
+}  // namespace
+
+ArrowMetricsCollector::ArrowMetricsCollector(const Schema& schema,
+                                             const MetricsConfig& config) {
+  for (const auto& field : schema.fields()) {
+    collectors_.push_back(MakeCollector(field, config, /*repeated=*/false));
+  }
+}
+
+ArrowMetricsCollector::~ArrowMetricsCollector() = default;
+
+Status ArrowMetricsCollector::Update(const ::arrow::Array& batch) {
+  if (batch.type_id() != ::arrow::Type::STRUCT ||
+      batch.num_fields() != static_cast<int>(collectors_.size())) {
+    return InvalidArrowData("Cannot collect metrics from batch of type {}",
+                            batch.type()->ToString());
+  }
+  const auto& struct_array = internal::checked_cast<const ::arrow::StructArray&>(batch);
+  for (size_t i = 0; i < collectors_.size(); ++i) {
+    if (collectors_[i] != nullptr) {
+      ICEBERG_ARROW_ASSIGN_OR_RETURN(auto column,
+                                     struct_array.GetFlattenedField(static_cast<int>(i)));
+      ICEBERG_RETURN_UNEXPECTED(collectors_[i]->Update(*column));
+    }
+  }
+  row_count_ += batch.length();
+  return {};
+}
+
+Metrics ArrowMetricsCollector::Finish() const {
+  Metrics metrics;
+  metrics.row_count = row_count_;
+  for (const auto& collector : collectors_) {
+    if (collector != nullptr) {
+      collector->Finish(&metrics);
+    }
+  }
+  return metrics;
+}
+
+}  // namespace iceberg::arrow
@@ -0,0 +1,71 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <arrow/type_fwd.h>
+
+#include "iceberg/iceberg_bundle_export.h"
+#include "iceberg/metrics.h"
+#include "iceberg/metrics_config.h"
+#include "iceberg/result.h"
+#include "iceberg/type_fwd.h"
+
+namespace iceberg::arrow {
+
+class FieldMetricsCollector;
+
+/// \brief Collects the column metrics of a data file from the Arrow batches written to
+/// it, for file formats that do not keep column statistics themselves.
+///
+/// Each batch is scanned once per primitive column by a kernel specialized for the
+/// column type, which reads the value buffers directly and skips null values by runs
+/// of the validity bitmap. Bounds are only collected for columns that are not nested
+/// in lists or maps, and are truncated according to the metrics mode of each column.
+/// Column sizes are not collected.
+class ICEBERG_BUNDLE_EXPORT ArrowMetricsCollector {
+ public:
+  /// \brief Make a collector for batches of `schema`.
+  ///
+  /// \param schema The Iceberg schema of the batches to collect.
+  /// \param config The metrics modes of the columns.
+  ArrowMetricsCollector(const Schema& schema, const MetricsConfig& config);
+
+  ~ArrowMetricsCollector();
+
+  ArrowMetricsCollector(const ArrowMetricsCollector&) = delete;
+  ArrowMetricsCollector& operator=(const ArrowMetricsCollector&) = delete;
+
+  /// \brief Update the metrics with a batch.
+  ///
+  /// \param batch A struct array whose fields are the columns of the schema.
+  Status Update(const ::arrow::Array& batch);
+
+  /// \brief Returns the metrics of all batches updated so far.
+  Metrics Finish() const;
+
+ private:
+  std::vector<std::unique_ptr<FieldMetricsCollector>> collectors_;
+  int64_t row_count_ = 0;
+};
+
+}  // namespace iceberg::arrow
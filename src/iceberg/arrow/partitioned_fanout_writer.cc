@@ -0,0 +1,679 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/arrow/partitioned_fanout_writer.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <list>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include <arrow/array.h>
+#include <arrow/buffer.h>
+#include <arrow/c/bridge.h>
+#include <arrow/compute/api.h>
+#include <arrow/record_batch.h>
+#include <arrow/type.h>
+
+#include "iceberg/arrow/arrow_error_transform_internal.h"
+#include "iceberg/arrow/source_column_internal.h"
+#include "iceberg/partition_field.h"
+#include "iceberg/partition_spec.h"
+#include "iceberg/schema.h"
+#include "iceberg/schema_internal.h"
+#include "iceberg/transform.h"
+#include "iceberg/transform_function.h"
+#include "iceberg/type.h"
+#include "iceberg/util/checked_cast.h"
+#include "iceberg/util/formatter.h"  // IWYU pragma: keep
+#include "iceberg/util/macros.h"
+#include "iceberg/util/partition_key_internal.h"
+#include "iceberg/util/transform_kernels_internal.h"
+
+namespace iceberg::arrow {
+
+namespace {
+
+// Keys that span fewer values than this, or than twice the batch length, are grouped
+// with a direct-address table instead of a hash table.
+constexpr uint64_t kMinDirectTableSize = 4096;
+
+/// \brief How the partition values of a field are represented for a batch.
+enum class KeyKind {
+  /// \brief int32 values, the result of a transform or the source values.
+  kInt32,
+  /// \brief int64 values, or the bit patterns of booleans and floating point values.
+  kInt64,
+  /// \brief A prefix of the values of a binary or string column.
+  kBinary,
+  /// \brief All values are null.
+  kNull,
+};
+
+Result<KeyKind> GetKeyKind(TransformType transform_type, const Type& type) {
+  const auto source_type = type.type_id();
+  switch (transform_type) {
+    case TransformType::kVoid:
+      return KeyKind::kNull;
+    case TransformType::kBucket:
+      return KeyKind::kInt32;
+    case TransformType::kYear:
+    case TransformType::kMonth:
+    case TransformType::kDay:
+    case TransformType::kHour:
+      if (source_type != TypeId::kDecimal) {
+        return KeyKind::kInt32;
+      }
+      break;
+    case TransformType::kIdentity:
+    case TransformType::kTruncate:
+      switch (source_type) {
+        case TypeId::kInt:
+        case TypeId::kDate:
+          return KeyKind::kInt32;
+        case TypeId::kBoolean:
+        case TypeId::kLong:
+        case TypeId::kFloat:
+        case TypeId::kDouble:
+        case TypeId::kTime:
+        case TypeId::kTimestamp:
+        case TypeId::kTimestampTz:
+          return KeyKind::kInt64;
+        case TypeId::kString:
+        case TypeId::kBinary:
+          return KeyKind::kBinary;
+        default:
+          break;
+      }
+      break;
+    default:
+      break;
+  }
+  return NotSupported("Partitioned writes with {} transform of {} are not supported",
+                      TransformTypeToString(transform_type), type.ToString());
+}
+
+/// \brief Make the partition value of a field from its int32 or int64 key.
+Literal MakeLiteral(TypeId type, int64_t key) {
+  switch (type) {
+    case TypeId::kBoolean:
+      return Literal::Boolean(key != 0);
+    case TypeId::kDate:
+      return Literal::Date(static_cast<int32_t>(key));
+    case TypeId::kLong:
+      return Literal::Long(key);
+    case TypeId::kFloat:
+      return Literal::Float(std::bit_cast<float>(static_cast<uint32_t>(key)));
+    case TypeId::kDouble:
+      return Literal::Double(std::bit_cast<double>(key));
+    case TypeId::kTime:
+      return Literal::Time(key);
+    case TypeId::kTimestamp:
+      return Literal::Timestamp(key);
+    case TypeId::kTimestampTz:
+      return Literal::TimestampTz(key);
+    default:
+      return Literal::Int(static_cast<int32_t>(key));
+  }
+}
+
+/// \brief Dense ids of the distinct keys of the rows of a batch.
+struct Groups {
+  /// \brief The id of the key of each row, numbered in order of first appearance.
+  std::vector<int32_t> ids;
+  /// \brief The first row of each id.
+  std::vector<int64_t> first_rows;
+};
+
+/// \brief Group integer keys. Rows for which `nulls` is null share one group.
+template <typename T>
+Groups GroupIntegers(std::span<const T> keys, const ::arrow::Array* nulls) {
+  const auto length = static_cast<int64_t>(keys.size());
+  const bool has_nulls = nulls != nullptr && nulls->null_count() > 0;
+  Groups groups;
+  groups.ids.resize(length);
+
+  int32_t null_id = -1;
+  auto assign_null = [&](int64_t row) {
+    if (null_id < 0) {
+      null_id = static_cast<int32_t>(groups.first_rows.size());
+      groups.first_rows.push_back(row);
+    }
+    groups.ids[row] = null_id;
+  };
+  auto assign = [&](int32_t& id, int64_t row) {
+    if (id < 0) {
+      id = static_cast<int32_t>(groups.first_rows.size());
+      groups.first_rows.push_back(row);
+    }
+    groups.ids[row] = id;
+  };
+
+  T min = std::numeric_limits<T>::max();
+  T max = std::numeric_limits<T>::lowest();
+  for (int64_t row = 0; row < length; ++row) {
+    if (!has_nulls || nulls->IsValid(row)) {
+      min = std::min(min, keys[row]);
+      max = std::max(max, keys[row]);
+    }
+  }
+  if (min > max) {
+    for (int64_t row = 0; row < length; ++row) {
+      assign_null(row);
+    }
+    return groups;
+  }
+
+  const uint64_t span = static_cast<uint64_t>(max) - static_cast<uint64_t>(min);
+  if (span < std::max(kMinDirectTableSize, 2 * static_cast<uint64_t>(length))) {
+    std::vector<int32_t> table(span + 1, -1);
+    for (int64_t row = 0; row < length; ++row) {
+      if (has_nulls && nulls->IsNull(row)) {
+        assign_null(row);
+      } else {
+        assign(table[static_cast<uint64_t>(keys[row]) - static_cast<uint64_t>(min)], row);
+      }
+    }
+  } else {
+    std::unordered_map<T, int32_t> table;
+    for (int64_t row = 0; row < length; ++row) {
+      if (has_nulls && nulls->IsNull(row)) {
+        assign_null(row);
+      } else {
+        assign(table.try_emplace(keys[row], -1).first->second, row);
+      }
+    }
+  }
+  return groups;
+}
+
+/// \brief Group the first `lengths[row]` bytes of binary values.
+Groups GroupBinary(const ::arrow::Array& values, std::span<const int32_t> offsets,
+                   const uint8_t* data, std::span<const int32_t> lengths) {
+  const int64_t length = values.length();
+  const bool has_nulls = values.null_count() > 0;
+  Groups groups;
+  groups.ids.resize(length);
+  int32_t null_id = -1;
+  std::unordered_map<std::string_view, int32_t> table;
+  for (int64_t row = 0; row < length; ++row) {
+    int32_t* id = &null_id;
+    if (!has_nulls || values.IsValid(row)) {
+      std::string_view key(reinterpret_cast<const char*>(data) + offsets[row],
+                           lengths[row]);
+      id = &table.try_emplace(key, -1).first->second;
+    }
+    if (*id < 0) {
+      *id = static_cast<int32_t>(groups.first_rows.size());
+      groups.first_rows.push_back(row);
+    }
+    groups.ids[row] = *id;
+  }
+  return groups;
+}
+
+/// \brief A partition field with the keys of its partition values in a batch.
+struct PartitionColumn {
+  std::vector<int> source_path;
+  std::unique_ptr<TransformFunction> transform;
+  std::shared_ptr<PrimitiveType> result_type;
+  KeyKind kind;
+
+  // The source values and keys of the current batch. The spans point either to the
+  // source buffers or to the owned vectors.
+  std::shared_ptr<::arrow::Array> source;
+  std::span<const int32_t> int32_keys;
+  std::span<const int64_t> int64_keys;
+  std::span<const int32_t> offsets;
+  const uint8_t* data = nullptr;
+  std::vector<int32_t> owned_int32;
+  std::vector<int64_t> owned_int64;
+  std::vector<int32_t> lengths;
+
+  Status Apply(std::shared_ptr<::arrow::Array> array);
+  Groups Group() const;
+  Literal ValueAt(int64_t row) const;
+};
+
+Status PartitionColumn::Apply(std::shared_ptr<::arrow::Array> array) {
+  source = std::move(array);
+  const auto length = static_cast<size_t>(source->length());
+  const auto& storage = *StorageOf(*source).data();
+  const auto source_type = transform->source_type()->type_id();
+  const auto transform_type = transform->transform_type();
+
+  switch (kind) {
+    case KeyKind::kNull:
+      return {};
+    case KeyKind::kBinary: {
+      offsets = std::span<const int32_t>(storage.GetValues<int32_t>(1), length + 1);
+      data = storage.buffers[2] ? storage.buffers[2]->data() : nullptr;
+      lengths.resize(length);
+      for (size_t i = 0; i < length; ++i) {
+        lengths[i] = offsets[i + 1] - offsets[i];
+      }
+      if (transform_type == TransformType::kTruncate) {
+        const int32_t width =
+            internal::checked_cast<const TruncateTransform&>(*transform).width();
+        if (source_type == TypeId::kString) {
+          TransformKernels::TruncateUTF8Lengths(offsets, data, width, lengths);
+        } else {
+          for (auto& value_length : lengths) {
+            value_length = std::min(value_length, width);
+          }
+        }
+      }
+      return {};
+    }
+    case KeyKind::kInt64: {
+      if (source_type == TypeId::kBoolean) {
+        const auto& booleans = internal::checked_cast<const ::arrow::BooleanArray&>(
+            StorageOf(*source));
+        owned_int64.resize(length);
+        for (size_t i = 0; i < length; ++i) {
+          owned_int64[i] = booleans.Value(static_cast<int64_t>(i)) ? 1 : 0;
+        }
+        int64_keys = owned_int64;
+      } else if (source_type == TypeId::kFloat || source_type == TypeId::kDouble) {
+        // Partition by bit pattern, so that -0.0 and 0.0 are distinct values and all
+        // NaNs are one value.
+        owned_int64.resize(length);
+        if (source_type == TypeId::kFloat) {
+          const auto* values = storage.GetValues<float>(1);
+          for (size_t i = 0; i < length; ++i) {
+            float value = std::isnan(values[i]) ? std::numeric_limits<float>::quiet_NaN()
+                                                : values[i];
+            owned_int64[i] = std::bit_cast<uint32_t>(value);
+          }
+        } else {
+          const auto* values = storage.GetValues<double>(1);
+          for (size_t i = 0; i < length; ++i) {
+            double value = std::isnan(values[i])
+                               ? std::numeric_limits<double>::quiet_NaN()
+                               : values[i];
+            owned_int64[i] = std::bit_cast<int64_t>(value);
+          }
+        }
+        int64_keys = owned_int64;
+      } else if (transform_type == TransformType::kTruncate) {
+        const int32_t width =
+            internal::checked_cast<const TruncateTransform&>(*transform).width();
+        owned_int64.resize(length);
+        TransformKernels::TruncateInt64(
+            std::span<const int64_t>(storage.GetValues<int64_t>(1), length), width,
+            owned_int64);
+        int64_keys = owned_int64;
+      } else {
+        int64_keys = std::span<const int64_t>(storage.GetValues<int64_t>(1), length);
+      }
+      return {};
+    }
+    case KeyKind::kInt32:
+      break;
+  }
+
+  if (transform_type == TransformType::kIdentity ||
+      (transform_type == TransformType::kDay && source_type == TypeId::kDate)) {
+    int32_keys = std::span<const int32_t>(storage.GetValues<int32_t>(1), length);
+    return {};
+  }
+
+  owned_int32.resize(length);
+  int32_keys = owned_int32;
+  std::span<const int32_t> int32_values;
+  std::span<const int64_t> int64_values;
+  switch (source_type) {
+    case TypeId::kInt:
+    case TypeId::kDate:
+      int32_values = std::span<const int32_t>(storage.GetValues<int32_t>(1), length);
+      break;
+    case TypeId::kLong:
+    case TypeId::kTime:
+    case TypeId::kTimestamp:
+    case TypeId::kTimestampTz:
+      int64_values = std::span<const int64_t>(storage.GetValues<int64_t>(1), length);
+      break;
+    default:
+      break;
+  }
+
+  switch (transform_type) {
+    case TransformType::kBucket: {
+      const int32_t num_buckets =
+          internal::checked_cast<const BucketTransform&>(*transform).num_buckets();
+      if (!int32_values.empty()) {
+        TransformKernels::BucketInt32(int32_values, num_buckets, owned_int32);
+      } else if (!int64_values.empty()) {
+        TransformKernels::BucketInt64(int64_values, num_buckets, owned_int32);
+      } else if (source_type == TypeId::kString || source_type == TypeId::kBinary) {
+        TransformKernels::BucketBinary(
+            std::span<const int32_t>(storage.GetValues<int32_t>(1), length + 1),
+            storage.buffers[2] ? storage.buffers[2]->data() : nullptr, num_buckets,
+            owned_int32);
+      } else if (source_type == TypeId::kDecimal) {
+        const auto& decimal =
+            internal::checked_cast<const ::arrow::Decimal128Array&>(*source);
+        TransformKernels::BucketDecimal128(decimal.raw_values(), num_buckets,
+                                           owned_int32);
+      } else {
+        const auto& fixed = internal::checked_cast<const ::arrow::FixedSizeBinaryArray&>(
+            StorageOf(*source));
+        TransformKernels::BucketFixedSize(fixed.raw_values(), fixed.byte_width(),
+                                          num_buckets, owned_int32);
+      }
+      return {};
+    }
+    case TransformType::kTruncate: {
+      const int32_t width =
+          internal::checked_cast<const TruncateTransform&>(*transform).width();
+      TransformKernels::TruncateInt32(int32_values, width, owned_int32);
+      return {};
+    }
+    case TransformType::kYear:
+      if (source_type == TypeId::kDate) {
+        TransformKernels::YearFromDays(int32_values, owned_int32);
+      } else {
+        TransformKernels::YearFromMicros(int64_values, owned_int32);
+      }
+      return {};
+    case TransformType::kMonth:
+      if (source_type == TypeId::kDate) {
+        TransformKernels::MonthFromDays(int32_values, owned_int32);
+      } else {
+        TransformKernels::MonthFromMicros(int64_values, owned_int32);
+      }
+      return {};
+    case TransformType::kDay:
+      TransformKernels::DayFromMicros(int64_values, owned_int32);
+      return {};
+    case TransformType::kHour:
+      TransformKernels::HourFromMicros(int64_values, owned_int32);
+      return {};
+    default:
+      return NotSupported("Partitioned writes with {} transform are not supported",
+                          TransformTypeToString(transform_type));
+  }
+}
+
+Groups PartitionColumn::Group() const {
+  switch (kind) {
+    case KeyKind::kInt32:
+      return GroupIntegers(int32_keys, source.get());
+    case KeyKind::kInt64:
+      return GroupIntegers(int64_keys, source.get());
+    case KeyKind::kBinary:
+      return GroupBinary(*source, offsets, data, lengths);
+    case KeyKind::kNull:
+      break;
+  }
+  Groups groups;
+  groups.ids.assign(source->length(), 0);
+  groups.first_rows.push_back(0);
+  return groups;
+}
+
+Literal PartitionColumn::ValueAt(int64_t row) const {
+  if (kind == KeyKind::kNull || source->IsNull(row)) {
+    return Literal::Null(result_type);
+  }
+  switch (kind) {
+    case KeyKind::kInt32:
+      return MakeLiteral(result_type->type_id(), int32_keys[row]);
+    case KeyKind::kInt64:
+      return MakeLiteral(result_type->type_id(), int64_keys[row]);
+    case KeyKind::kBinary: {
+      const auto* value = data + offsets[row];
+      if (result_type->type_id() == TypeId::kString) {
+        return Literal::String(
+            std::string(reinterpret_cast<const char*>(value), lengths[row]));
+      }
+      return Literal::Binary(std::vector<uint8_t>(value, value + lengths[row]));
+    }
+    case KeyKind::kNull:
+      break;
+  }
+  std::unreachable();
+}
+
+}  // namespace
+
+class PartitionedFanoutWriter::Impl {
+ public:
+  Impl(PartitionedFanoutWriterOptions options,
+       std::shared_ptr<::arrow::Schema> arrow_schema,
+       std::vector<PartitionColumn> columns)
+      : options_(std::move(options)),
+        arrow_schema_(std::move(arrow_schema)),
+        columns_(std::move(columns)) {}
+
+  Status Write(ArrowArray* data) {
+    ICEBERG_ARROW_ASSIGN_OR_RETURN(auto batch,
+                                   ::arrow::ImportRecordBatch(data, arrow_schema_));
+    const int64_t length = batch->num_rows();
+    if (length == 0) {
+      return {};
+    }
+
+    // Apply the transforms and combine the partition values of the fields into one
+    // dense id per row.
+    Groups groups;
+    for (size_t i = 0; i < columns_.size(); ++i) {
+      auto& column = columns_[i];
+      ICEBERG_ASSIGN_OR_RAISE(auto source, SourceColumn(*batch, column.source_path));
+      ICEBERG_RETURN_UNEXPECTED(column.Apply(std::move(source)));
+      auto field_groups = column.Group();
+      if (i == 0) {
+        groups = std::move(field_groups);
+        continue;
+      }
+      const auto num_field_groups = static_cast<int64_t>(field_groups.first_rows.size());
+      std::vector<int64_t> combined(length);
+      for (int64_t row = 0; row < length; ++row) {
+        combined[row] = groups.ids[row] * num_field_groups + field_groups.ids[row];
+      }
+      groups = GroupIntegers<int64_t>(combined, /*nulls=*/nullptr);
+    }
+    if (columns_.empty()) {
+      groups.ids.assign(length, 0);
+      groups.first_rows.assign(1, 0);
+    }
+
+    if (groups.first_rows.size() == 1) {
+      return WritePartition(groups.first_rows[0], *batch);
+    }
+
+    // Counting sort of the rows by partition, so that each partition is one slice of
+    // the reordered batch.
+    const size_t num_groups = groups.first_rows.size();
+    std::vector<int64_t> offsets(num_groups + 1, 0);
+    for (int32_t id : groups.ids) {
+      ++offsets[id + 1];
+    }
+    for (size_t id = 0; id < num_groups; ++id) {
+      offsets[id + 1] += offsets[id];
+    }
+    ICEBERG_ARROW_ASSIGN_OR_RETURN(
+        std::shared_ptr<::arrow::Buffer> indices_buffer,
+        ::arrow::AllocateBuffer(length * static_cast<int64_t>(sizeof(int64_t))));
+    auto* indices = indices_buffer->mutable_data_as<int64_t>();
+    std::vector<int64_t> positions(offsets.begin(), offsets.end() - 1);
+    for (int64_t row = 0; row < length; ++row) {
+      indices[positions[groups.ids[row]]++] = row;
+    }
+    auto indices_array =
+        std::make_shared<::arrow::Int64Array>(length, std::move(indices_buffer));
+    ICEBERG_ARROW_ASSIGN_OR_RETURN(
+        auto sorted,
+        ::arrow::compute::Take(batch, indices_array,
+                               ::arrow::compute::TakeOptions::NoBoundsCheck()));
+    const auto& sorted_batch = *sorted.record_batch();
+
+    for (size_t id = 0; id < num_groups; ++id) {
+      auto slice = sorted_batch.Slice(offsets[id], offsets[id + 1] - offsets[id]);
+      ICEBERG_RETURN_UNEXPECTED(WritePartition(groups.first_rows[id], *slice));
+    }
+    return {};
+  }
+
+  Status Close() {
+    Status status;
+    while (!lru_.empty()) {
+      auto result = CloseWriter(lru_.front());
+      if (!result.has_value() && status.has_value()) {
+        status = std::move(result);
+      }
+    }
+    return status;
+  }
+
+  std::vector<DataFile> data_files() const {
+    std::vector<DataFile> data_files = closed_files_;
+    for (const auto& key : lru_) {
+      const auto& files = writers_.at(key).writer->data_files();
+      data_files.insert(data_files.end(), files.begin(), files.end());
+    }
+    return data_files;
+  }
+
+  int32_t open_writers() const { return static_cast<int32_t>(writers_.size()); }
+
+ private:
+  struct PartitionWriter {
+    std::unique_ptr<RollingFileWriter> writer;
+    std::list<std::string>::iterator lru_position;
+  };
+
+  Status WritePartition(int64_t first_row, const ::arrow::RecordBatch& rows) {
+    std::vector<Literal> partition;
+    partition.reserve(columns_.size());
+    for (const auto& column : columns_) {
+      partition.push_back(column.ValueAt(first_row));
+    }
+    ICEBERG_ASSIGN_OR_RAISE(auto key, PartitionKey(partition));
+
+    auto it = writers_.find(key);
+    if (it != writers_.end()) {
+      lru_.splice(lru_.end(), lru_, it->second.lru_position);
+    } else {
+      if (static_cast<int32_t>(writers_.size()) >= options_.max_open_writers) {
+        ICEBERG_RETURN_UNEXPECTED(CloseWriter(lru_.front()));
+      }
+      auto file_options = options_.file_options;
+      file_options.partition_spec_id = options_.spec->spec_id();
+      file_options.new_file_path = [new_file_path = options_.new_file_path,
+                                    partition]() { return new_file_path(partition); };
+      file_options.partition = std::move(partition);
+      ICEBERG_ASSIGN_OR_RAISE(auto writer, RollingFileWriter::Make(file_options));
+      auto position = lru_.insert(lru_.end(), key);
+      it = writers_
+               .emplace(std::move(key), PartitionWriter{.writer = std::move(writer),
+                                                        .lru_position = position})
+               .first;
+    }
+
+    ArrowArray array;
+    ICEBERG_ARROW_RETURN_NOT_OK(::arrow::ExportRecordBatch(rows, &array));
+    return it->second.writer->Write(array);
+  }
+
+  Status CloseWriter(std::string key) {
+    auto node = writers_.extract(key);
+    lru_.erase(node.mapped().lru_position);
+    auto status = node.mapped().writer->Close();
+    const auto& files = node.mapped().writer->data_files();
+    closed_files_.insert(closed_files_.end(), files.begin(), files.end());
+    return status;
+  }
+
+  PartitionedFanoutWriterOptions options_;
+  std::shared_ptr<::arrow::Schema> arrow_schema_;
+  std::vector<PartitionColumn> columns_;
+  // The writers of partitions with an open file, keyed by partition, and their keys
+  // from the least to the most recently written.
+  std::unordered_map<std::string, PartitionWriter> writers_;
+  std::list<std::string> lru_;
+  std::vector<DataFile> closed_files_;
+};
+
+PartitionedFanoutWriter::PartitionedFanoutWriter(std::unique_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+PartitionedFanoutWriter::~PartitionedFanoutWriter() = default;
+
+Result<std::unique_ptr<PartitionedFanoutWriter>> PartitionedFanoutWriter::Make(
+    PartitionedFanoutWriterOptions options) {
+  if (options.spec == nullptr) {
+    return InvalidArgument("Partitioned writer requires a partition spec");
+  }
+  if (!options.new_file_path) {
+    return InvalidArgument("Partitioned writer requires a file path generator");
+  }
+  if (options.max_open_writers <= 0) {
+    return InvalidArgument("Invalid maximum number of open writers: {}",
+                           options.max_open_writers);
+  }
+  const auto& schema = options.file_options.writer_options.schema;
+  if (schema == nullptr) {
+    return InvalidArgument("Partitioned writer requires a schema");
+  }
+
+  std::vector<PartitionColumn> columns;
+  for (const auto& field : options.spec->fields()) {
+    PartitionColumn column;
+    const auto* source = FindSourceField(*schema, field.source_id(), &column.source_path);
+    if (source == nullptr) {
+      return InvalidArgument("Cannot find source field {} of partition field {}",
+                             field.source_id(), field.name());
+    }
+    ICEBERG_ASSIGN_OR_RAISE(column.transform, field.transform()->Bind(source->type()));
+    auto result_type = column.transform->ResultType();
+    if (!result_type->is_primitive()) {
+      return NotSupported("Cannot partition by {} of type {}", field.name(),
+                          result_type->ToString());
+    }
+    column.result_type = internal::checked_pointer_cast<PrimitiveType>(result_type);
+    ICEBERG_ASSIGN_OR_RAISE(
+        column.kind, GetKeyKind(column.transform->transform_type(), *source->type()));
+    columns.push_back(std::move(column));
+  }
+
+  ArrowSchema c_schema;
+  ICEBERG_RETURN_UNEXPECTED(ToArrowSchema(*schema, &c_schema));
+  ICEBERG_ARROW_ASSIGN_OR_RETURN(auto arrow_schema, ::arrow::ImportSchema(&c_schema));
+
+  return std::unique_ptr<PartitionedFanoutWriter>(
+      new PartitionedFanoutWriter(std::make_unique<Impl>(
+          std::move(options), std::move(arrow_schema), std::move(columns))));
+}
+
+Status PartitionedFanoutWriter::Write(ArrowArray data) { return impl_->Write(&data); }
+
+Status PartitionedFanoutWriter::Close() { return impl_->Close(); }
+
+std::vector<DataFile> PartitionedFanoutWriter::data_files() const {
+  return impl_->data_files();
+}
+
+int32_t PartitionedFanoutWriter::open_writers() const { return impl_->open_writers(); }
+
+}  // namespace iceberg::arrow
@@ -0,0 +1,93 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+/// \file iceberg/arrow/partitioned_fanout_writer.h
+/// A data file writer that routes rows to the partitions of a partition spec.
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "iceberg/arrow_c_data.h"
+#include "iceberg/expression/literal.h"
+#include "iceberg/iceberg_bundle_export.h"
+#include "iceberg/manifest_entry.h"
+#include "iceberg/result.h"
+#include "iceberg/rolling_file_writer.h"
+#include "iceberg/type_fwd.h"
+
+namespace iceberg::arrow {
+
+/// \brief Options for creating a PartitionedFanoutWriter.
+struct ICEBERG_BUNDLE_EXPORT PartitionedFanoutWriterOptions {
+  /// \brief The partition spec of the data files. This field is required.
+  std::shared_ptr<PartitionSpec> spec;
+  /// \brief Options of the rolling writer of each partition. `new_file_path`,
+  /// `partition_spec_id` and `partition` are ignored and set from the partition.
+  RollingFileWriterOptions file_options;
+  /// \brief Returns the path of the next data file of a partition. This field is
+  /// required.
+  std::function<std::string(std::span<const Literal> partition)> new_file_path;
+  /// \brief The maximum number of partitions with an open data file. When a batch
+  /// routes rows to another partition, the file of the least recently written
+  /// partition is closed first.
+  int32_t max_open_writers = 64;
+};
+
+/// \brief Writes data into files of the partitions of a partition spec.
+///
+/// The partition transforms are applied to whole columns of each batch. Rows are then
+/// grouped by partition with a counting sort, so that each partition receives one
+/// contiguous slice of the batch, and written by a RollingFileWriter of the partition.
+class ICEBERG_BUNDLE_EXPORT PartitionedFanoutWriter {
+ public:
+  /// \brief Make a partitioned writer. No file is created until data is written.
+  static Result<std::unique_ptr<PartitionedFanoutWriter>> Make(
+      PartitionedFanoutWriterOptions options);
+
+  ~PartitionedFanoutWriter();
+
+  PartitionedFanoutWriter(const PartitionedFanoutWriter&) = delete;
+  PartitionedFanoutWriter& operator=(const PartitionedFanoutWriter&) = delete;
+
+  /// \brief Write a batch of rows of the schema of the writer options.
+  Status Write(ArrowArray data);
+
+  /// \brief Close the files of all partitions.
+  Status Close();
+
+  /// \brief Returns the data files closed so far, with their partition values.
+  std::vector<DataFile> data_files() const;
+
+  /// \brief Returns the number of partitions with an open data file.
+  int32_t open_writers() const;
+
+ private:
+  class Impl;
+  explicit PartitionedFanoutWriter(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace iceberg::arrow
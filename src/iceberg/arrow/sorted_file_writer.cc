@@ -0,0 +1,765 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/arrow/sorted_file_writer.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <limits>
+#include <random>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#include <arrow/array.h>
+#include <arrow/buffer.h>
+#include <arrow/c/bridge.h>
+#include <arrow/compute/api.h>
+#include <arrow/extension_type.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/reader.h>
+#include <arrow/ipc/writer.h>
+#include <arrow/record_batch.h>
+#include <arrow/type.h>
+#include <arrow/util/byte_size.h>
+#include <arrow/util/decimal.h>
+
+#include "iceberg/arrow/arrow_error_transform_internal.h"
+#include "iceberg/arrow/source_column_internal.h"
+#include "iceberg/schema.h"
+#include "iceberg/schema_internal.h"
+#include "iceberg/sort_field.h"
+#include "iceberg/sort_order.h"
+#include "iceberg/transform.h"
+#include "iceberg/transform_function.h"
+#include "iceberg/type.h"
+#include "iceberg/util/checked_cast.h"
+#include "iceberg/util/formatter.h"  // IWYU pragma: keep
+#include "iceberg/util/macros.h"
+
+namespace iceberg::arrow {
+
+namespace {
+
+// The name of the column of sort keys appended to buffered batches and run files.
+constexpr std::string_view kSortKeyColumn = "_iceberg_sort_key";
+
+// The width of binary values in keys, which are escaped and terminated.
+constexpr int32_t kVariableWidth = -1;
+
+// The null markers of keys. Nulls sort before or after the marker of values.
+constexpr uint8_t kNullsFirstMarker = 0x00;
+constexpr uint8_t kValueMarker = 0x01;
+constexpr uint8_t kNullsLastMarker = 0x02;
+
+const ::arrow::DataType& StorageTypeOf(const ::arrow::DataType& type) {
+  if (type.id() == ::arrow::Type::EXTENSION) {
+    return *internal::checked_cast<const ::arrow::ExtensionType&>(type).storage_type();
+  }
+  return type;
+}
+
+/// \brief Returns the width of the encoded non-null values of a type, not counting
+/// the null marker, or kVariableWidth for binary values.
+Result<int32_t> KeyWidth(const ::arrow::DataType& type) {
+  const auto& storage_type = StorageTypeOf(type);
+  switch (storage_type.id()) {
+    case ::arrow::Type::BOOL:
+      return 1;
+    case ::arrow::Type::INT32:
+    case ::arrow::Type::DATE32:
+    case ::arrow::Type::FLOAT:
+      return 4;
+    case ::arrow::Type::INT64:
+    case ::arrow::Type::TIME64:
+    case ::arrow::Type::TIMESTAMP:
+    case ::arrow::Type::DOUBLE:
+      return 8;
+    case ::arrow::Type::DECIMAL128:
+      return 16;
+    case ::arrow::Type::FIXED_SIZE_BINARY:
+      return internal::checked_cast<const ::arrow::FixedSizeBinaryType&>(storage_type)
+          .byte_width();
+    case ::arrow::Type::STRING:
+    case ::arrow::Type::BINARY:
+      return kVariableWidth;
+    default:
+      return NotSupported("Cannot sort values of type {}", type.ToString());
+  }
+}
+
+template <typename T>
+void StoreBigEndian(T value, uint8_t* out) {
+  if constexpr (std::endian::native == std::endian::little) {
+    value = std::byteswap(value);
+  }
+  std::memcpy(out, &value, sizeof(T));
+}
+
+/// \brief Returns the bits of a floating point value that order as unsigned integers
+/// like the value: negative values have all bits flipped and the others the sign
+/// bit. All NaNs are ordered after positive infinity.
+template <typename Float, typename Bits>
+Bits OrderedBits(Float value) {
+  constexpr Bits kSignBit = Bits{1} << (sizeof(Bits) * 8 - 1);
+  if (std::isnan(value)) {
+    value = std::numeric_limits<Float>::quiet_NaN();
+  }
+  auto bits = std::bit_cast<Bits>(value);
+  return (bits & kSignBit) ? ~bits : bits | kSignBit;
+}
+
+/// \brief A sort field and the encoding of its values into the sort keys of a batch.
+struct SortColumn {
+  std::vector<int> source_path;
+  // The transform of the field, or null for the identity transform.
+  std::unique_ptr<TransformFunction> transform;
+  std::shared_ptr<::arrow::DataType> result_type;
+  int32_t width;
+  bool descending;
+  uint8_t null_marker;
+
+  Result<std::shared_ptr<::arrow::Array>> Apply(
+      std::shared_ptr<::arrow::Array> source) const;
+  void AddKeySizes(const ::arrow::Array& values, std::span<int64_t> sizes) const;
+  void Encode(const ::arrow::Array& values, std::span<int64_t> positions,
+              uint8_t* keys) const;
+  template <typename Store>
+  void EncodeFixedWidth(const ::arrow::Array& values, std::span<int64_t> positions,
+                        uint8_t* keys, Store&& store) const;
+};
+
+Result<std::shared_ptr<::arrow::Array>> SortColumn::Apply(
+    std::shared_ptr<::arrow::Array> source) const {
+  if (transform == nullptr) {
+    return source;
+  }
+  ArrowArray input;
+  ICEBERG_ARROW_RETURN_NOT_OK(::arrow::ExportArray(*source, &input));
+  auto output = transform->Transform(input);
+  input.release(&input);
+  ICEBERG_RETURN_UNEXPECTED(output);
+  ICEBERG_ARROW_ASSIGN_OR_RETURN(auto values,
+                                 ::arrow::ImportArray(&output.value(), result_type));
+  return values;
+}
+
+void SortColumn::AddKeySizes(const ::arrow::Array& values,
+                             std::span<int64_t> sizes) const {
+  const int64_t length = values.length();
+  const bool has_nulls = values.null_count() > 0;
+  if (width != kVariableWidth) {
+    for (int64_t row = 0; row < length; ++row) {
+      sizes[row] += (has_nulls && values.IsNull(row)) ? 1 : 1 + width;
+    }
+    return;
+  }
+  // Zero bytes are escaped with a second byte, and values end with two zero bytes.
+  const auto& binary =
+      internal::checked_cast<const ::arrow::BinaryArray&>(StorageOf(values));
+  for (int64_t row = 0; row < length; ++row) {
+    if (has_nulls && binary.IsNull(row)) {
+      sizes[row] += 1;
+      continue;
+    }
+    auto value = binary.GetView(row);
+    sizes[row] +=
+        3 + static_cast<int64_t>(value.size()) + std::ranges::count(value, '\0');
+  }
+}
+
+template <typename Store>
+void SortColumn::EncodeFixedWidth(const ::arrow::Array& values,
+                                  std::span<int64_t> positions, uint8_t* keys,
+                                  Store&& store) const {
+  const int64_t length = values.length();
+  const bool has_nulls = values.null_count() > 0;
+  for (int64_t row = 0; row < length; ++row) {
+    uint8_t* key = keys + positions[row];
+    if (has_nulls && values.IsNull(row)) {
+      key[0] = null_marker;
+      positions[row] += 1;
+      continue;
+    }
+    key[0] = kValueMarker;
+    store(row, key + 1);
+    if (descending) {
+      for (int32_t i = 1; i <= width; ++i) {
+        key[i] = ~key[i];
+      }
+    }
+    positions[row] += 1 + width;
+  }
+}
+
+void SortColumn::Encode(const ::arrow::Array& values, std::span<int64_t> positions,
+                        uint8_t* keys) const {
+  const auto& storage = StorageOf(values);
+  const auto& data = *storage.data();
+  switch (storage.type_id()) {
+    case ::arrow::Type::BOOL: {
+      const auto& booleans =
+          internal::checked_cast<const ::arrow::BooleanArray&>(storage);
+      EncodeFixedWidth(values, positions, keys, [&](int64_t row, uint8_t* out) {
+        *out = booleans.Value(row) ? 1 : 0;
+      });
+      return;
+    }
+    case ::arrow::Type::INT32:
+    case ::arrow::Type::DATE32: {
+      const auto* ints = data.GetValues<int32_t>(1);
+      EncodeFixedWidth(values, positions, keys, [&](int64_t row, uint8_t* out) {
+        StoreBigEndian(static_cast<uint32_t>(ints[row]) ^ 0x80000000u, out);
+      });
+      return;
+    }
+    case ::arrow::Type::INT64:
+    case ::arrow::Type::TIME64:
+    case ::arrow::Type::TIMESTAMP: {
+      const auto* longs = data.GetValues<int64_t>(1);
+      EncodeFixedWidth(values, positions, keys, [&](int64_t row, uint8_t* out) {
+        StoreBigEndian(static_cast<uint64_t>(longs[row]) ^ (uint64_t{1} << 63), out);
+      });
+      return;
+    }
+    case ::arrow::Type::FLOAT: {
+      const auto* floats = data.GetValues<float>(1);
+      EncodeFixedWidth(values, positions, keys, [&](int64_t row, uint8_t* out) {
+        StoreBigEndian(OrderedBits<float, uint32_t>(floats[row]), out);
+      });
+      return;
+    }
+    case ::arrow::Type::DOUBLE: {
+      const auto* doubles = data.GetValues<double>(1);
+      EncodeFixedWidth(values, positions, keys, [&](int64_t row, uint8_t* out) {
+        StoreBigEndian(OrderedBits<double, uint64_t>(doubles[row]), out);
+      });
+      return;
+    }
+    case ::arrow::Type::DECIMAL128: {
+      const auto& decimals =
+          internal::checked_cast<const ::arrow::Decimal128Array&>(storage);
+      EncodeFixedWidth(values, positions, keys, [&](int64_t row, uint8_t* out) {
+        ::arrow::Decimal128 value(decimals.GetValue(row));
+        StoreBigEndian(static_cast<uint64_t>(value.high_bits()) ^ (uint64_t{1} << 63),
+                       out);
+        StoreBigEndian(value.low_bits(), out + 8);
+      });
+      return;
+    }
+    case ::arrow::Type::FIXED_SIZE_BINARY: {
+      const auto& fixed =
+          internal::checked_cast<const ::arrow::FixedSizeBinaryArray&>(storage);
+      EncodeFixedWidth(values, positions, keys, [&](int64_t row, uint8_t* out) {
+        std::memcpy(out, fixed.GetValue(row), width);
+      });
+      return;
+    }
+    default:
+      break;
+  }
+
+  // Binary values, with each zero byte followed by 0xff and a terminator of two zero
+  // bytes, so that a value orders before the values it is a prefix of.
+  const auto& binary = internal::checked_cast<const ::arrow::BinaryArray&>(storage);
+  const int64_t length = values.length();
+  const bool has_nulls = values.null_count() > 0;
+  for (int64_t row = 0; row < length; ++row) {
+    uint8_t* key = keys + positions[row];
+    if (has_nulls && binary.IsNull(row)) {
+      key[0] = null_marker;
+      positions[row] += 1;
+      continue;
+    }
+    key[0] = kValueMarker;
+    uint8_t* out = key + 1;
+    for (char c : binary.GetView(row)) {
+      *out++ = static_cast<uint8_t>(c);
+      if (c == '\0') {
+        *out++ = 0xff;
+      }
+    }
+    *out++ = 0;
+    *out++ = 0;
+    if (descending) {
+      for (uint8_t* byte = key + 1; byte < out; ++byte) {
+        *byte = ~*byte;
+      }
+    }
+    positions[row] = out - keys;
+  }
+}
+
+/// \brief Returns the rows of a batch in the order of their keys, keeping the order of
+/// rows with equal keys.
+///
+/// Rows are sorted by the first 8 bytes of their keys with a least significant digit
+/// radix sort, which skips the bytes that are equal in all keys. Rows with equal
+/// prefixes and longer keys are then sorted by their whole keys with a merge sort. No
+/// key is a prefix of another, so keys of at most 8 bytes with equal prefixes are
+/// equal.
+std::vector<int64_t> SortRows(const ::arrow::LargeBinaryArray& keys) {
+  struct Entry {
+    uint64_t prefix;
+    int64_t row;
+  };
+  const int64_t length = keys.length();
+  std::vector<Entry> entries(length);
+  bool has_long_keys = false;
+  for (int64_t row = 0; row < length; ++row) {
+    auto key = keys.GetView(row);
+    uint64_t prefix = 0;
+    std::memcpy(&prefix, key.data(), std::min<size_t>(key.size(), sizeof(prefix)));
+    if constexpr (std::endian::native == std::endian::little) {
+      prefix = std::byteswap(prefix);
+    }
+    entries[row] = {.prefix = prefix, .row = row};
+    has_long_keys |= key.size() > sizeof(prefix);
+  }
+
+  std::vector<Entry> scratch(length);
+  for (int shift = 0; shift < 64; shift += 8) {
+    std::array<int64_t, 257> counts{};
+    for (const auto& entry : entries) {
+      ++counts[((entry.prefix >> shift) & 0xff) + 1];
+    }
+    if (std::ranges::find(counts, length) != counts.end()) {
+      continue;
+    }
+    for (size_t i = 1; i < counts.size(); ++i) {
+      counts[i] += counts[i - 1];
+    }
+    for (const auto& entry : entries) {
+      scratch[counts[(entry.prefix >> shift) & 0xff]++] = entry;
+    }
+    entries.swap(scratch);
+  }
+
+  if (has_long_keys) {
+    auto less = [&](const Entry& lhs, const Entry& rhs) {
+      return keys.GetView(lhs.row) < keys.GetView(rhs.row);
+    };
+    for (auto begin = entries.begin(); begin != entries.end();) {
+      auto end = std::find_if(begin + 1, entries.end(), [&](const Entry& entry) {
+        return entry.prefix != begin->prefix;
+      });
+      if (end - begin > 1) {
+        std::stable_sort(begin, end, less);
+      }
+      begin = end;
+    }
+  }
+
+  std::vector<int64_t> rows(length);
+  for (int64_t i = 0; i < length; ++i) {
+    rows[i] = entries[i].row;
+  }
+  return rows;
+}
+
+/// \brief Returns the first row from `begin` whose key is greater than `bound`, or
+/// equal to it if `inclusive` is false. The key of `begin` must not be past the bound.
+///
+/// The search gallops from `begin` with doubling steps, so that short runs of rows are
+/// found in few comparisons, and then bisects the last step.
+int64_t GallopPast(const ::arrow::LargeBinaryArray& keys, int64_t begin,
+                   std::string_view bound, bool inclusive) {
+  auto past = [&](int64_t row) {
+    auto key = keys.GetView(row);
+    return inclusive ? key > bound : key >= bound;
+  };
+  const int64_t length = keys.length();
+  int64_t low = begin;
+  int64_t high = begin + 1;
+  for (int64_t step = 1; high < length && !past(high); step *= 2) {
+    low = high;
+    high = low + step;
+  }
+  high = std::min(high, length);
+  // The first row past the bound is in (low, high].
+  int64_t first = low + 1;
+  while (first < high) {
+    int64_t middle = first + (high - first) / 2;
+    if (past(middle)) {
+      high = middle;
+    } else {
+      first = middle + 1;
+    }
+  }
+  return first;
+}
+
+/// \brief Returns a prefix of the names of run files that differs between writers.
+std::string MakeSpillPrefix() {
+  std::random_device device;
+  const uint64_t id = (static_cast<uint64_t>(device()) << 32) | device();
+  return std::format("iceberg-sort-{:016x}", id);
+}
+
+/// \brief A cursor over the sorted rows of a run file.
+struct Run {
+  std::shared_ptr<::arrow::ipc::RecordBatchFileReader> reader;
+  int next_batch = 0;
+  std::shared_ptr<::arrow::RecordBatch> batch;
+  const ::arrow::LargeBinaryArray* keys = nullptr;
+  int64_t row = 0;
+
+  std::string_view key() const { return keys->GetView(row); }
+
+  /// \brief Read the next batch with rows, or return false at the end of the run.
+  Result<bool> Next() {
+    while (next_batch < reader->num_record_batches()) {
+      ICEBERG_ARROW_ASSIGN_OR_RETURN(batch, reader->ReadRecordBatch(next_batch++));
+      if (batch->num_rows() > 0) {
+        keys = &internal::checked_cast<const ::arrow::LargeBinaryArray&>(
+            *batch->column(batch->num_columns() - 1));
+        row = 0;
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+}  // namespace
+
+class SortedFileWriter::Impl {
+ public:
+  Impl(SortedFileWriterOptions options, std::shared_ptr<::arrow::Schema> arrow_schema,
+       std::vector<SortColumn> columns, std::filesystem::path spill_directory,
+       std::unique_ptr<RollingFileWriter> writer)
+      : options_(std::move(options)),
+        arrow_schema_(std::move(arrow_schema)),
+        columns_(std::move(columns)),
+        spill_directory_(std::move(spill_directory)),
+        spill_prefix_(MakeSpillPrefix()),
+        writer_(std::move(writer)) {}
+
+  ~Impl() { RemoveRuns(); }
+
+  Status Write(ArrowArray* data) {
+    if (columns_.empty()) {
+      return writer_->Write(*data);
+    }
+    ICEBERG_ARROW_ASSIGN_OR_RETURN(auto batch,
+                                   ::arrow::ImportRecordBatch(data, arrow_schema_));
+    const int64_t length = batch->num_rows();
+    if (length == 0) {
+      return {};
+    }
+
+    // Apply the transforms, then size and encode the keys one field at a time.
+    std::vector<std::shared_ptr<::arrow::Array>> values;
+    values.reserve(columns_.size());
+    std::vector<int64_t> offsets(length + 1, 0);
+    for (const auto& column : columns_) {
+      ICEBERG_ASSIGN_OR_RAISE(auto source, SourceColumn(*batch, column.source_path));
+      ICEBERG_ASSIGN_OR_RAISE(auto value, column.Apply(std::move(source)));
+      column.AddKeySizes(*value, std::span(offsets).subspan(1));
+      values.push_back(std::move(value));
+    }
+    for (int64_t row = 0; row < length; ++row) {
+      offsets[row + 1] += offsets[row];
+    }
+    ICEBERG_ARROW_ASSIGN_OR_RETURN(std::shared_ptr<::arrow::Buffer> keys_buffer,
+                                   ::arrow::AllocateBuffer(offsets[length]));
+    std::vector<int64_t> positions(offsets.begin(), offsets.end() - 1);
+    for (size_t i = 0; i < columns_.size(); ++i) {
+      columns_[i].Encode(*values[i], positions, keys_buffer->mutable_data());
+    }
+    auto keys = std::make_shared<::arrow::LargeBinaryArray>(
+        length, ::arrow::Buffer::FromVector(std::move(offsets)), std::move(keys_buffer));
+    ICEBERG_ARROW_ASSIGN_OR_RETURN(
+        batch, batch->AddColumn(batch->num_columns(),
+                                ::arrow::field(std::string(kSortKeyColumn),
+                                               ::arrow::large_binary(),
+                                               /*nullable=*/false),
+                                std::move(keys)));
+
+    buffered_bytes_ += ::arrow::util::TotalBufferSize(*batch);
+    buffered_.push_back(std::move(batch));
+    if (buffered_bytes_ > options_.memory_budget_bytes) {
+      return Spill();
+    }
+    return {};
+  }
+
+  Status Close() {
+    if (closed_) {
+      return {};
+    }
+    closed_ = true;
+    auto status = [&]() -> Status {
+      if (runs_.empty()) {
+        if (!buffered_.empty()) {
+          ICEBERG_ASSIGN_OR_RAISE(auto sorted, SortBuffered());
+          ICEBERG_RETURN_UNEXPECTED(WriteRows(*sorted));
+        }
+        return {};
+      }
+      if (!buffered_.empty()) {
+        ICEBERG_RETURN_UNEXPECTED(Spill());
+      }
+      return Merge();
+    }();
+    RemoveRuns();
+    auto close_status = writer_->Close();
+    return status.has_value() ? close_status : status;
+  }
+
+  const std::vector<DataFile>& data_files() const { return writer_->data_files(); }
+
+  int32_t spilled_runs() const { return spilled_runs_; }
+
+ private:
+  /// \brief Sort the buffered rows, which are released.
+  Result<std::shared_ptr<::arrow::RecordBatch>> SortBuffered() {
+    ICEBERG_ARROW_ASSIGN_OR_RETURN(auto batch,
+                                   ::arrow::ConcatenateRecordBatches(buffered_));
+    buffered_.clear();
+    buffered_bytes_ = 0;
+    const auto& keys = internal::checked_cast<const ::arrow::LargeBinaryArray&>(
+        *batch->column(batch->num_columns() - 1));
+    auto rows = SortRows(keys);
+    auto indices = std::make_shared<::arrow::Int64Array>(
+        batch->num_rows(), ::arrow::Buffer::FromVector(std::move(rows)));
+    ICEBERG_ARROW_ASSIGN_OR_RETURN(
+        auto sorted, ::arrow::compute::Take(
+                         batch, indices, ::arrow::compute::TakeOptions::NoBoundsCheck()));
+    return sorted.record_batch();
+  }
+
+  /// \brief Sort the buffered rows and write them to a new run file.
+  Status Spill() {
+    ICEBERG_ASSIGN_OR_RAISE(auto sorted, SortBuffered());
+    auto path =
+        (spill_directory_ / std::format("{}-{}.arrow", spill_prefix_, spilled_runs_++))
+            .string();
+    ICEBERG_ARROW_ASSIGN_OR_RETURN(auto stream,
+                                   ::arrow::io::FileOutputStream::Open(path));
+    runs_.push_back(path);
+    ICEBERG_ARROW_ASSIGN_OR_RETURN(
+        auto writer, ::arrow::ipc::MakeFileWriter(stream, sorted->schema()));
+    for (int64_t offset = 0; offset < sorted->num_rows(); offset += options_.batch_rows) {
+      ICEBERG_ARROW_RETURN_NOT_OK(
+          writer->WriteRecordBatch(*sorted->Slice(offset, options_.batch_rows)));
+    }
+    ICEBERG_ARROW_RETURN_NOT_OK(writer->Close());
+    ICEBERG_ARROW_RETURN_NOT_OK(stream->Close());
+    return {};
+  }
+
+  /// \brief Merge the run files into the data files.
+  ///
+  /// The run with the smallest next key is taken from a heap, and all of its rows up to
+  /// the next key of the other runs are written as one slice. Equal keys are taken from
+  /// earlier runs first, so that the merge keeps the order of the rows written.
+  Status Merge() {
+    std::vector<Run> runs(runs_.size());
+    std::vector<size_t> heap;
+    for (size_t i = 0; i < runs_.size(); ++i) {
+      ICEBERG_ARROW_ASSIGN_OR_RETURN(auto file,
+                                     ::arrow::io::ReadableFile::Open(runs_[i]));
+      ICEBERG_ARROW_ASSIGN_OR_RETURN(runs[i].reader,
+                                     ::arrow::ipc::RecordBatchFileReader::Open(file));
+      ICEBERG_ASSIGN_OR_RAISE(bool has_rows, runs[i].Next());
+      if (has_rows) {
+        heap.push_back(i);
+      }
+    }
+    auto after = [&](size_t lhs, size_t rhs) {
+      auto lhs_key = runs[lhs].key();
+      auto rhs_key = runs[rhs].key();
+      return lhs_key != rhs_key ? lhs_key > rhs_key : lhs > rhs;
+    };
+    std::ranges::make_heap(heap, after);
+
+    ::arrow::RecordBatchVector pending;
+    int64_t pending_rows = 0;
+    while (!heap.empty()) {
+      std::ranges::pop_heap(heap, after);
+      const size_t index = heap.back();
+      heap.pop_back();
+      auto& run = runs[index];
+      int64_t end = run.batch->num_rows();
+      if (!heap.empty()) {
+        const size_t next = heap.front();
+        end = GallopPast(*run.keys, run.row, runs[next].key(),
+                         /*inclusive=*/index < next);
+      }
+      pending.push_back(run.batch->Slice(run.row, end - run.row));
+      pending_rows += end - run.row;
+      run.row = end;
+
+      bool has_rows = run.row < run.batch->num_rows();
+      if (!has_rows) {
+        ICEBERG_ASSIGN_OR_RAISE(has_rows, run.Next());
+      }
+      if (has_rows) {
+        heap.push_back(index);
+        std::ranges::push_heap(heap, after);
+      }
+      if (pending_rows >= options_.batch_rows) {
+        ICEBERG_RETURN_UNEXPECTED(WritePending(&pending));
+        pending_rows = 0;
+      }
+    }
+    return WritePending(&pending);
+  }
+
+  Status WritePending(::arrow::RecordBatchVector* pending) {
+    if (pending->empty()) {
+      return {};
+    }
+    ICEBERG_ARROW_ASSIGN_OR_RETURN(auto rows,
+                                   ::arrow::ConcatenateRecordBatches(*pending));
+    pending->clear();
+    return WriteRows(*rows);
+  }
+
+  /// \brief Write sorted rows without their keys to the data files.
+  Status WriteRows(const ::arrow::RecordBatch& sorted) {
+    ICEBERG_ARROW_ASSIGN_OR_RETURN(auto rows,
+                                   sorted.RemoveColumn(sorted.num_columns() - 1));
+    for (int64_t offset = 0; offset < rows->num_rows(); offset += options_.batch_rows) {
+      ArrowArray array;
+      ICEBERG_ARROW_RETURN_NOT_OK(::arrow::ExportRecordBatch(
+          *rows->Slice(offset, options_.batch_rows), &array));
+      ICEBERG_RETURN_UNEXPECTED(writer_->Write(array));
+    }
+    return {};
+  }
+
+  void RemoveRuns() {
+    for (const auto& path : runs_) {
+      std::error_code error;
+      std::filesystem::remove(path, error);
+    }
+    runs_.clear();
+  }
+
+  SortedFileWriterOptions options_;
+  std::shared_ptr<::arrow::Schema> arrow_schema_;
+  std::vector<SortColumn> columns_;
+  std::filesystem::path spill_directory_;
+  std::string spill_prefix_;
+  std::unique_ptr<RollingFileWriter> writer_;
+  // The buffered batches, with their keys as the last column, and their size.
+  ::arrow::RecordBatchVector buffered_;
+  int64_t buffered_bytes_ = 0;
+  // The paths of the run files that have not been removed.
+  std::vector<std::string> runs_;
+  int32_t spilled_runs_ = 0;
+  bool closed_ = false;
+};
+
+SortedFileWriter::SortedFileWriter(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+SortedFileWriter::~SortedFileWriter() = default;
+
+Result<std::unique_ptr<SortedFileWriter>> SortedFileWriter::Make(
+    SortedFileWriterOptions options) {
+  if (options.sort_order == nullptr) {
+    return InvalidArgument("Sorted writer requires a sort order");
+  }
+  if (options.memory_budget_bytes <= 0) {
+    return InvalidArgument("Invalid memory budget: {}", options.memory_budget_bytes);
+  }
+  if (options.batch_rows <= 0) {
+    return InvalidArgument("Invalid number of rows per batch: {}", options.batch_rows);
+  }
+  const auto& schema = options.file_options.writer_options.schema;
+  if (schema == nullptr) {
+    return InvalidArgument("Sorted writer requires a schema");
+  }
+
+  std::vector<SortColumn> columns;
+  for (const auto& field : options.sort_order->fields()) {
+    const auto transform_type = field.transform()->transform_type();
+    if (transform_type == TransformType::kVoid) {
+      // All values of a void transform are null and do not order rows.
+      continue;
+    }
+    SortColumn column;
+    const auto* source = FindSourceField(*schema, field.source_id(), &column.source_path);
+    if (source == nullptr) {
+      return InvalidArgument("Cannot find source field {} of sort field {}",
+                             field.source_id(), field.ToString());
+    }
+    ICEBERG_ASSIGN_OR_RAISE(column.transform, field.transform()->Bind(source->type()));
+    auto result_type = column.transform->ResultType();
+    if (!result_type->is_primitive()) {
+      return NotSupported("Cannot sort by {} of type {}", field.ToString(),
+                          result_type->ToString());
+    }
+    ArrowSchema c_schema;
+    ICEBERG_RETURN_UNEXPECTED(ToArrowSchema(
+        Schema({SchemaField::MakeOptional(/*field_id=*/0, "value", result_type)}),
+        &c_schema));
+    ICEBERG_ARROW_ASSIGN_OR_RETURN(auto result_schema, ::arrow::ImportSchema(&c_schema));
+    column.result_type = result_schema->field(0)->type();
+    ICEBERG_ASSIGN_OR_RAISE(column.width, KeyWidth(*column.result_type));
+    if (transform_type == TransformType::kIdentity) {
+      column.transform.reset();
+    }
+    column.descending = field.direction() == SortDirection::kDescending;
+    column.null_marker =
+        field.null_order() == NullOrder::kFirst ? kNullsFirstMarker : kNullsLastMarker;
+    columns.push_back(std::move(column));
+  }
+
+  std::filesystem::path spill_directory = options.spill_directory;
+  if (spill_directory.empty()) {
+    std::error_code error;
+    spill_directory = std::filesystem::temp_directory_path(error);
+    if (error) {
+      return IOError("Cannot find the temporary directory: {}", error.message());
+    }
+  }
+
+  ArrowSchema c_schema;
+  ICEBERG_RETURN_UNEXPECTED(ToArrowSchema(*schema, &c_schema));
+  ICEBERG_ARROW_ASSIGN_OR_RETURN(auto arrow_schema, ::arrow::ImportSchema(&c_schema));
+
+  auto file_options = options.file_options;
+  file_options.sort_order_id = options.sort_order->order_id();
+  ICEBERG_ASSIGN_OR_RAISE(auto writer, RollingFileWriter::Make(std::move(file_options)));
+
+  return std::unique_ptr<SortedFileWriter>(new SortedFileWriter(std::make_unique<Impl>(
+      std::move(options), std::move(arrow_schema), std::move(columns),
+      std::move(spill_directory), std::move(writer))));
+}
+
+Status SortedFileWriter::Write(ArrowArray data) { return impl_->Write(&data); }
+
+Status SortedFileWriter::Close() { return impl_->Close(); }
+
+std::vector<DataFile> SortedFileWriter::data_files() const {
+  return impl_->data_files();
+}
+
+int32_t SortedFileWriter::spilled_runs() const { return impl_->spilled_runs(); }
+
+}  // namespace iceberg::arrow
@@ -0,0 +1,99 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+/// \file iceberg/arrow/sorted_file_writer.h
+/// A data file writer that sorts rows by a sort order before writing them.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "iceberg/arrow_c_data.h"
+#include "iceberg/iceberg_bundle_export.h"
+#include "iceberg/manifest_entry.h"
+#include "iceberg/result.h"
+#include "iceberg/rolling_file_writer.h"
+#include "iceberg/type_fwd.h"
+
+namespace iceberg::arrow {
+
+/// \brief Options for creating a SortedFileWriter.
+struct ICEBERG_BUNDLE_EXPORT SortedFileWriterOptions {
+  /// \brief The sort order of the rows, usually the default sort order of the table.
+  /// This field is required.
+  std::shared_ptr<SortOrder> sort_order;
+  /// \brief Options of the rolling writer of the sorted rows. `sort_order_id` is
+  /// ignored and set from the sort order.
+  RollingFileWriterOptions file_options;
+  /// \brief The size of the rows and sort keys buffered in memory. When a batch
+  /// exceeds it, the buffered rows are sorted and spilled to a run file.
+  int64_t memory_budget_bytes = 256 * 1024 * 1024;
+  /// \brief The local directory of the run files. The temporary directory of the
+  /// system is used if empty.
+  std::string spill_directory;
+  /// \brief The number of rows of the batches written to data files and run files.
+  int64_t batch_rows = 64 * 1024;
+};
+
+/// \brief Writes data into files in the order of a sort order.
+///
+/// The sort transforms are applied to whole columns of each batch, and the sort
+/// values of each row are encoded into a normalized key that compares with memcmp in
+/// the order of the sort order: each field contributes a null marker placed by its
+/// null order, then its value as big-endian bytes with the sign bit flipped, inverted
+/// for descending fields. Rows are buffered with their keys and sorted with a radix
+/// sort of the first bytes of the keys. Rows that exceed the memory budget are spilled
+/// to sorted run files in the Arrow IPC format, which are merged when the writer is
+/// closed. Rows with equal keys keep the order in which they were written.
+class ICEBERG_BUNDLE_EXPORT SortedFileWriter {
+ public:
+  /// \brief Make a sorted writer. No file is created until the writer is closed or
+  /// rows are spilled.
+  static Result<std::unique_ptr<SortedFileWriter>> Make(SortedFileWriterOptions options);
+
+  ~SortedFileWriter();
+
+  SortedFileWriter(const SortedFileWriter&) = delete;
+  SortedFileWriter& operator=(const SortedFileWriter&) = delete;
+
+  /// \brief Buffer a batch of rows of the schema of the writer options, spilling the
+  /// buffered rows to a run file if they exceed the memory budget.
+  Status Write(ArrowArray data);
+
+  /// \brief Sort and write all rows, then close the data files and remove the run
+  /// files.
+  Status Close();
+
+  /// \brief Returns the data files closed so far.
+  std::vector<DataFile> data_files() const;
+
+  /// \brief Returns the number of run files spilled so far.
+  int32_t spilled_runs() const;
+
+ private:
+  class Impl;
+  explicit SortedFileWriter(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace iceberg::arrow
@@ -0,0 +1,72 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/arrow/source_column_internal.h"
+
+#include <arrow/array.h>
+#include <arrow/extension_type.h>
+#include <arrow/record_batch.h>
+
+#include "iceberg/arrow/arrow_error_transform_internal.h"
+#include "iceberg/schema_field.h"
+#include "iceberg/type.h"
+#include "iceberg/util/checked_cast.h"
+#include "iceberg/util/macros.h"
+
+namespace iceberg::arrow {
+
+const SchemaField* FindSourceField(const StructType& type, int32_t source_id,
+                                   std::vector<int>* path) {
+  auto fields = type.fields();
+  for (size_t i = 0; i < fields.size(); ++i) {
+    path->push_back(static_cast<int>(i));
+    if (fields[i].field_id() == source_id) {
+      return &fields[i];
+    }
+    if (fields[i].type()->type_id() == TypeId::kStruct) {
+      const auto& struct_type =
+          internal::checked_cast<const StructType&>(*fields[i].type());
+      if (const auto* field = FindSourceField(struct_type, source_id, path)) {
+        return field;
+      }
+    }
+    path->pop_back();
+  }
+  return nullptr;
+}
+
+Result<std::shared_ptr<::arrow::Array>> SourceColumn(const ::arrow::RecordBatch& batch,
+                                                     const std::vector<int>& path) {
+  auto array = batch.column(path[0]);
+  for (size_t i = 1; i < path.size(); ++i) {
+    ICEBERG_ARROW_ASSIGN_OR_RETURN(
+        array, internal::checked_cast<const ::arrow::StructArray&>(*array)
+                   .GetFlattenedField(path[i]));
+  }
+  return array;
+}
+
+const ::arrow::Array& StorageOf(const ::arrow::Array& array) {
+  if (array.type_id() == ::arrow::Type::EXTENSION) {
+    return *internal::checked_cast<const ::arrow::ExtensionArray&>(array).storage();
+  }
+  return array;
+}
+
+}  // namespace iceberg::arrow
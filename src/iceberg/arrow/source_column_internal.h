@@ -0,0 +1,52 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <arrow/type_fwd.h>
+
+#include "iceberg/result.h"
+#include "iceberg/type_fwd.h"
+
+namespace iceberg::arrow {
+
+/// \brief Find a field of a struct type, or of the structs nested in it, by id.
+///
+/// \param type The struct type to search.
+/// \param source_id The id of the field to find.
+/// \param path Receives the positions of the structs that lead to the field and of
+/// the field itself, if the field is found.
+/// \return The field, or nullptr if no field has the id.
+const SchemaField* FindSourceField(const StructType& type, int32_t source_id,
+                                   std::vector<int>* path);
+
+/// \brief Returns the column of a batch at a path returned by FindSourceField.
+///
+/// Flattening merges the validity of each struct into its fields, so that rows with a
+/// null struct are null in the returned column.
+Result<std::shared_ptr<::arrow::Array>> SourceColumn(const ::arrow::RecordBatch& batch,
+                                                     const std::vector<int>& path);
+
+/// \brief The storage of an extension array, such as uuid, or the array itself.
+const ::arrow::Array& StorageOf(const ::arrow::Array& array);
+
+}  // namespace iceberg::arrow
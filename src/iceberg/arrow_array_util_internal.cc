@@ -0,0 +1,307 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/arrow_array_util_internal.h"
+
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "iceberg/arrow_c_data_guard_internal.h"
+#include "iceberg/nanoarrow_error_transform_internal.h"
+#include "iceberg/util/macros.h"
+
+namespace iceberg::internal {
+
+namespace {
+
+bool HasValidityBuffer(const ArrowArrayView* view) {
+  return view->null_count != 0 && view->buffer_views[0].data.data != nullptr;
+}
+
+bool IsFixedWidth(const ArrowArrayView* view) {
+  return view->layout.buffer_type[1] == NANOARROW_BUFFER_TYPE_DATA &&
+         view->layout.buffer_type[2] == NANOARROW_BUFFER_TYPE_NONE &&
+         view->layout.element_size_bits[1] > 0 &&
+         view->layout.element_size_bits[1] % 8 == 0;
+}
+
+Status AppendValidity(const ArrowArrayView* view, std::span<const int64_t> indices,
+                      ArrowArray* out) {
+  if (!HasValidityBuffer(view)) {
+    return {};
+  }
+  ArrowBitmap* bitmap = ArrowArrayValidityBitmap(out);
+  ICEBERG_NANOARROW_RETURN_NOT_OK(
+      ArrowBitmapReserve(bitmap, static_cast<int64_t>(indices.size())));
+  const uint8_t* validity = view->buffer_views[0].data.as_uint8;
+  int64_t null_count = 0;
+  for (int64_t index : indices) {
+    const bool valid = ArrowBitGet(validity, view->offset + index) != 0;
+    ArrowBitmapAppendUnsafe(bitmap, valid ? 1 : 0, 1);
+    null_count += valid ? 0 : 1;
+  }
+  out->null_count += null_count;
+  return {};
+}
+
+template <typename T>
+void GatherFixedWidth(const uint8_t* values, std::span<const int64_t> indices,
+                      ArrowBuffer* out) {
+  const auto* typed_values = reinterpret_cast<const T*>(values);
+  auto* dest = reinterpret_cast<T*>(out->data + out->size_bytes);
+  for (size_t i = 0; i < indices.size(); ++i) {
+    dest[i] = typed_values[indices[i]];
+  }
+  out->size_bytes += static_cast<int64_t>(indices.size() * sizeof(T));
+}
+
+Status TakeFixedWidth(const ArrowArrayView* view, std::span<const int64_t> indices,
+                      ArrowArray* out) {
+  const int64_t width = view->layout.element_size_bits[1] / 8;
+  ArrowBuffer* data = ArrowArrayBuffer(out, 1);
+  ICEBERG_NANOARROW_RETURN_NOT_OK(
+      ArrowBufferReserve(data, width * static_cast<int64_t>(indices.size())));
+  const uint8_t* values = view->buffer_views[1].data.as_uint8 + view->offset * width;
+  switch (width) {
+    case 1:
+      GatherFixedWidth<uint8_t>(values, indices, data);
+      break;
+    case 2:
+      GatherFixedWidth<uint16_t>(values, indices, data);
+      break;
+    case 4:
+      GatherFixedWidth<uint32_t>(values, indices, data);
+      break;
+    case 8:
+      GatherFixedWidth<uint64_t>(values, indices, data);
+      break;
+    default:
+      for (int64_t index : indices) {
+        ArrowBufferAppendUnsafe(data, values + index * width, width);
+      }
+      break;
+  }
+  return {};
+}
+
+template <typename OffsetType>
+Status TakeBinary(const ArrowArrayView* view, std::span<const int64_t> indices,
+                  ArrowArray* out) {
+  const OffsetType* offsets =
+      reinterpret_cast<const OffsetType*>(view->buffer_views[1].data.data) +
+      view->offset;
+  const uint8_t* values = view->buffer_views[2].data.as_uint8;
+
+  int64_t total_bytes = 0;
+  for (int64_t index : indices) {
+    total_bytes += offsets[index + 1] - offsets[index];
+  }
+
+  ArrowBuffer* out_offsets = ArrowArrayBuffer(out, 1);
+  ArrowBuffer* out_values = ArrowArrayBuffer(out, 2);
+  // The builder starts with a single zero offset.
+  OffsetType current = reinterpret_cast<const OffsetType*>(
+      out_offsets->data)[out_offsets->size_bytes / sizeof(OffsetType) - 1];
+  if (total_bytes + current > std::numeric_limits<OffsetType>::max()) {
+    return InvalidArrowData(
+        "Cannot take {} bytes into a binary array with {}-bit offsets",
+        total_bytes + current, sizeof(OffsetType) * 8);
+  }
+  ICEBERG_NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(
+      out_offsets, static_cast<int64_t>(indices.size() * sizeof(OffsetType))));
+  ICEBERG_NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(out_values, total_bytes));
+  for (int64_t index : indices) {
+    const OffsetType length = offsets[index + 1] - offsets[index];
+    ArrowBufferAppendUnsafe(out_values, values + offsets[index], length);
+    current += length;
+    ArrowBufferAppendUnsafe(out_offsets, &current, sizeof(OffsetType));
+  }
+  return {};
+}
+
+Status TakeInto(const ArrowArrayView* view, std::span<const int64_t> indices,
+                ArrowArray* out);
+
+template <typename OffsetType>
+Status TakeList(const ArrowArrayView* view, std::span<const int64_t> indices,
+                ArrowArray* out) {
+  std::vector<int64_t> child_indices;
+  ArrowBuffer* out_offsets = ArrowArrayBuffer(out, 1);
+  ICEBERG_NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(
+      out_offsets, static_cast<int64_t>(indices.size() * sizeof(OffsetType))));
+  OffsetType current = reinterpret_cast<const OffsetType*>(
+      out_offsets->data)[out_offsets->size_bytes / sizeof(OffsetType) - 1];
+  for (int64_t index : indices) {
+    // Unlike the other accessors, the list offsets are not shifted by the array offset.
+    const int64_t begin = ArrowArrayViewListChildOffset(view, view->offset + index);
+    const int64_t end = ArrowArrayViewListChildOffset(view, view->offset + index + 1);
+    for (int64_t child_index = begin; child_index < end; ++child_index) {
+      child_indices.push_back(child_index);
+    }
+    current += static_cast<OffsetType>(end - begin);
+    ArrowBufferAppendUnsafe(out_offsets, &current, sizeof(OffsetType));
+  }
+  return TakeInto(view->children[0], child_indices, out->children[0]);
+}
+
+Status TakeFixedSizeList(const ArrowArrayView* view, std::span<const int64_t> indices,
+                         ArrowArray* out) {
+  const int64_t list_size = view->layout.child_size_elements;
+  std::vector<int64_t> child_indices;
+  child_indices.reserve(indices.size() * list_size);
+  for (int64_t index : indices) {
+    const int64_t begin = (view->offset + index) * list_size;
+    for (int64_t i = 0; i < list_size; ++i) {
+      child_indices.push_back(begin + i);
+    }
+  }
+  return TakeInto(view->children[0], child_indices, out->children[0]);
+}
+
+Status TakeStruct(const ArrowArrayView* view, std::span<const int64_t> indices,
+                  ArrowArray* out) {
+  // The offset of a struct array applies to its children as well.
+  std::vector<int64_t> shifted_indices;
+  std::span<const int64_t> child_indices = indices;
+  if (view->offset != 0) {
+    shifted_indices.reserve(indices.size());
+    for (int64_t index : indices) {
+      shifted_indices.push_back(index + view->offset);
+    }
+    child_indices = shifted_indices;
+  }
+  for (int64_t i = 0; i < view->n_children; ++i) {
+    ICEBERG_RETURN_UNEXPECTED(
+        TakeInto(view->children[i], child_indices, out->children[i]));
+  }
+  return {};
+}
+
+Status TakeBoolean(const ArrowArrayView* view, std::span<const int64_t> indices,
+                   ArrowArray* out) {
+  for (int64_t index : indices) {
+    if (ArrowArrayViewIsNull(view, index)) {
+      ICEBERG_NANOARROW_RETURN_NOT_OK(ArrowArrayAppendNull(out, 1));
+    } else {
+      ICEBERG_NANOARROW_RETURN_NOT_OK(
+          ArrowArrayAppendInt(out, ArrowArrayViewGetIntUnsafe(view, index)));
+    }
+  }
+  return {};
+}
+
+Status TakeInto(const ArrowArrayView* view, std::span<const int64_t> indices,
+                ArrowArray* out) {
+  if (view->storage_type == NANOARROW_TYPE_BOOL) {
+    // Boolean builders track validity and bit-packed values themselves.
+    return TakeBoolean(view, indices, out);
+  }
+
+  if (view->dictionary != nullptr && out->dictionary != nullptr &&
+      out->dictionary->length == 0 && view->dictionary->length > 0) {
+    std::vector<int64_t> all_indices(view->dictionary->length);
+    std::iota(all_indices.begin(), all_indices.end(), 0);
+    ICEBERG_RETURN_UNEXPECTED(TakeInto(view->dictionary, all_indices, out->dictionary));
+  }
+
+  ICEBERG_RETURN_UNEXPECTED(AppendValidity(view, indices, out));
+
+  switch (view->storage_type) {
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_BINARY:
+      ICEBERG_RETURN_UNEXPECTED(TakeBinary<int32_t>(view, indices, out));
+      break;
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_LARGE_BINARY:
+      ICEBERG_RETURN_UNEXPECTED(TakeBinary<int64_t>(view, indices, out));
+      break;
+    case NANOARROW_TYPE_LIST:
+    case NANOARROW_TYPE_MAP:
+      ICEBERG_RETURN_UNEXPECTED(TakeList<int32_t>(view, indices, out));
+      break;
+    case NANOARROW_TYPE_LARGE_LIST:
+      ICEBERG_RETURN_UNEXPECTED(TakeList<int64_t>(view, indices, out));
+      break;
+    case NANOARROW_TYPE_FIXED_SIZE_LIST:
+      ICEBERG_RETURN_UNEXPECTED(TakeFixedSizeList(view, indices, out));
+      break;
+    case NANOARROW_TYPE_STRUCT:
+      ICEBERG_RETURN_UNEXPECTED(TakeStruct(view, indices, out));
+      break;
+    case NANOARROW_TYPE_NA:
+      out->null_count += static_cast<int64_t>(indices.size());
+      break;
+    default:
+      if (!IsFixedWidth(view)) {
+        return NotSupported("Cannot take rows from arrow type {}",
+                            ArrowTypeString(view->storage_type));
+      }
+      ICEBERG_RETURN_UNEXPECTED(TakeFixedWidth(view, indices, out));
+      break;
+  }
+
+  out->length += static_cast<int64_t>(indices.size());
+  return {};
+}
+
+Status BuildTakenArray(const ArrowArrayView& view, std::span<const int64_t> indices,
+                       ArrowArray* out) {
+  ICEBERG_NANOARROW_RETURN_NOT_OK(ArrowArrayStartAppending(out));
+  ICEBERG_RETURN_UNEXPECTED(TakeInto(&view, indices, out));
+  ArrowError error;
+  if (ArrowArrayFinishBuildingDefault(out, &error) != NANOARROW_OK) {
+    return InvalidArrowData("Failed to finish building array: {}", error.message);
+  }
+  return {};
+}
+
+}  // namespace
+
+Result<ArrowArray> TakeArray(const ArrowSchema& schema, const ArrowArrayView& view,
+                             std::span<const int64_t> indices) {
+  ArrowError error;
+  ArrowArray out;
+  if (ArrowArrayInitFromSchema(&out, &schema, &error) != NANOARROW_OK) {
+    return InvalidArrowData("Failed to init array from schema: {}", error.message);
+  }
+  auto status = BuildTakenArray(view, indices, &out);
+  if (!status.has_value()) {
+    ArrowArrayRelease(&out);
+    return std::unexpected(status.error());
+  }
+  return out;
+}
+
+Result<ArrowArray> TakeArray(const ArrowSchema& schema, const ArrowArray& array,
+                             std::span<const int64_t> indices) {
+  ArrowError error;
+  ArrowArrayView view;
+  if (ArrowArrayViewInitFromSchema(&view, &schema, &error) != NANOARROW_OK) {
+    return InvalidArrowData("Failed to init array view from schema: {}", error.message);
+  }
+  ArrowArrayViewGuard view_guard(&view);
+  if (ArrowArrayViewSetArray(&view, &array, &error) != NANOARROW_OK) {
+    return InvalidArrowData("Failed to set array view: {}", error.message);
+  }
+  return TakeArray(schema, view, indices);
+}
+
+}  // namespace iceberg::internal
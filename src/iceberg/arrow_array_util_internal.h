@@ -0,0 +1,51 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+/// \file iceberg/arrow_array_util_internal.h
+/// Helpers to copy rows of Arrow C data arrays with nanoarrow.
+
+#include <span>
+
+#include <nanoarrow/nanoarrow.h>
+
+#include "iceberg/arrow_c_data.h"
+#include "iceberg/result.h"
+
+namespace iceberg::internal {
+
+/// \brief Gather the rows at `indices` of an array into a newly allocated array.
+///
+/// Fixed-width, binary, list and struct layouts are gathered column by column; any
+/// dictionary is copied as a whole so that indices remain valid.
+///
+/// \param schema The schema of the array, used to build the output array.
+/// \param view A view over the input array.
+/// \param indices Logical row indices into the input array, may be unordered or
+/// repeated.
+/// \return The gathered array which has the same type as the input.
+Result<ArrowArray> TakeArray(const ArrowSchema& schema, const ArrowArrayView& view,
+                             std::span<const int64_t> indices);
+
+/// \brief Same as above but creates a view over `array` first.
+Result<ArrowArray> TakeArray(const ArrowSchema& schema, const ArrowArray& array,
+                             std::span<const int64_t> indices);
+
+}  // namespace iceberg::internal
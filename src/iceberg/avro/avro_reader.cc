@@ -33,6 +33,7 @@
 
 #include "iceberg/arrow/arrow_error_transform_internal.h"
 #include "iceberg/arrow/arrow_fs_file_io_internal.h"
+#include "iceberg/arrow/arrow_memory_pool_internal.h"
 #include "iceberg/avro/avro_data_util_internal.h"
 #include "iceberg/avro/avro_register.h"
 #include "iceberg/avro/avro_schema_util_internal.h"
@@ -84,6 +85,8 @@ class AvroReader::Impl {
 
     batch_size_ = options.batch_size;
     read_schema_ = options.projection;
+    memory_pool_ = options.memory_pool;
+    ICEBERG_ASSIGN_OR_RAISE(pool_, arrow::ToArrowMemoryPool(memory_pool_));
 
     // Open the input stream and adapt to the avro interface.
     // TODO(gangwu): make this configurable
@@ -189,7 +192,7 @@ class AvroReader::Impl {
 
     auto arrow_struct_type =
         std::make_shared<::arrow::StructType>(context_->arrow_schema_->fields());
-    auto builder_result = ::arrow::MakeBuilder(arrow_struct_type);
+    auto builder_result = ::arrow::MakeBuilder(arrow_struct_type, pool_);
     if (!builder_result.ok()) {
       return InvalidSchema("Failed to make the arrow builder: {}",
                            builder_result.status().message());
@@ -227,6 +230,10 @@ class AvroReader::Impl {
   std::optional<int64_t> split_end_;
   // The schema to read.
   std::shared_ptr<::iceberg::Schema> read_schema_;
+  // The memory pool given by the reader options, which keeps `pool_` alive.
+  std::shared_ptr<MemoryPool> memory_pool_;
+  // The arrow memory pool to build record batches with.
+  ::arrow::MemoryPool* pool_ = ::arrow::default_memory_pool();
   // The projection result to apply to the read schema.
   SchemaProjection projection_;
   // The avro reader to read the data into a datum.
@@ -31,10 +31,12 @@
 
 #include "iceberg/arrow/arrow_error_transform_internal.h"
 #include "iceberg/arrow/arrow_fs_file_io_internal.h"
+#include "iceberg/arrow/arrow_metrics_internal.h"
 #include "iceberg/avro/avro_data_util_internal.h"
 #include "iceberg/avro/avro_register.h"
 #include "iceberg/avro/avro_schema_util_internal.h"
 #include "iceberg/avro/avro_stream_internal.h"
+#include "iceberg/metrics_config.h"
 #include "iceberg/schema.h"
 #include "iceberg/schema_internal.h"
 #include "iceberg/util/checked_cast.h"
@@ -57,6 +59,10 @@ class AvroWriter::Impl {
  public:
   Status Open(const WriterOptions& options) {
     write_schema_ = options.schema;
+    ICEBERG_ASSIGN_OR_RAISE(auto metrics_config,
+                            MetricsConfig::Make(options.properties, *write_schema_));
+    metrics_collector_ =
+        std::make_unique<arrow::ArrowMetricsCollector>(*write_schema_, metrics_config);
 
     ::avro::NodePtr root;
     ICEBERG_RETURN_UNEXPECTED(ToAvroNodeVisitor{}.Visit(*write_schema_, &root));
@@ -68,6 +74,7 @@ class AvroWriter::Impl {
     ICEBERG_ASSIGN_OR_RAISE(auto output_stream,
                             CreateOutputStream(options, kDefaultBufferSize));
     arrow_output_stream_ = output_stream->arrow_output_stream();
+    output_stream_ = output_stream.get();
     writer_ = std::make_unique<::avro::DataFileWriter<::avro::GenericDatum>>(
         std::move(output_stream), *avro_schema_);
     datum_ = std::make_unique<::avro::GenericDatum>(*avro_schema_);
@@ -78,6 +85,7 @@ class AvroWriter::Impl {
   Status Write(ArrowArray data) {
     ICEBERG_ARROW_ASSIGN_OR_RETURN(auto result,
                                    ::arrow::ImportArray(&data, &arrow_schema_));
+    ICEBERG_RETURN_UNEXPECTED(metrics_collector_->Update(*result));
 
     for (int64_t i = 0; i < result->length(); i++) {
       ICEBERG_RETURN_UNEXPECTED(ExtractDatumFromArray(*result, i, datum_.get()));
@@ -99,7 +107,15 @@ class AvroWriter::Impl {
 
   bool Closed() const { return writer_ == nullptr; }
 
-  int64_t length() { return total_bytes_; }
+  int64_t length() const {
+    if (writer_ == nullptr) {
+      return total_bytes_;
+    }
+    // Records of the current block, which is not yet serialized, are not counted.
+    return static_cast<int64_t>(output_stream_->byteCount());
+  }
+
+  Metrics metrics() const { return metrics_collector_->Finish(); }
 
  private:
   // The schema to write.
@@ -108,12 +124,16 @@ class AvroWriter::Impl {
   std::shared_ptr<::avro::ValidSchema> avro_schema_;
   // Arrow output stream of the Avro file to write
   std::shared_ptr<::arrow::io::OutputStream> arrow_output_stream_;
+  // The buffered stream owned by `writer_`, to estimate the length of the open file.
+  AvroOutputStream* output_stream_ = nullptr;
   // The avro writer to write the data into a datum.
   std::unique_ptr<::avro::DataFileWriter<::avro::GenericDatum>> writer_;
   // Reusable Avro datum for writing individual records.
   std::unique_ptr<::avro::GenericDatum> datum_;
   // Arrow schema to write data.
   ArrowSchema arrow_schema_;
+  // Collects the column metrics of the written batches.
+  std::unique_ptr<arrow::ArrowMetricsCollector> metrics_collector_;
   int64_t total_bytes_ = 0;
 };
 
@@ -135,18 +155,12 @@ Status AvroWriter::Close() {
 
 std::optional<Metrics> AvroWriter::metrics() {
   if (impl_->Closed()) {
-    // TODO(xiao.dong) implement metrics
-    return {};
+    return impl_->metrics();
   }
   return std::nullopt;
 }
 
-std::optional<int64_t> AvroWriter::length() {
-  if (impl_->Closed()) {
-    return impl_->length();
-  }
-  return std::nullopt;
-}
+std::optional<int64_t> AvroWriter::length() { return impl_->length(); }
 
 std::vector<int64_t> AvroWriter::split_offsets() { return {}; }
 
@@ -20,12 +20,17 @@
 #include "iceberg/catalog/in_memory_catalog.h"
 
 #include <algorithm>
+#include <charconv>
+#include <format>
 #include <iterator>  // IWYU pragma: keep
 
 #include "iceberg/exception.h"
+#include "iceberg/metadata_update.h"
 #include "iceberg/table.h"
 #include "iceberg/table_metadata.h"
+#include "iceberg/update_requirement.h"
 #include "iceberg/util/macros.h"
+#include "iceberg/util/uuid_util.h"
 
 namespace iceberg {
 
@@ -121,6 +126,15 @@ class ICEBERG_EXPORT InMemoryNamespace {
   /// \return The metadata location if the table exists; error otherwise.
   Result<std::string> GetTableMetadataLocation(const TableIdentifier& table_ident) const;
 
+  /// \brief Updates the metadata location of a registered table.
+  ///
+  /// \param table_ident The identifier of the table.
+  /// \param metadata_location The path to the new table metadata.
+  /// \return Status::OK if the location is updated;
+  ///         ErrorKind::kNotFound if the table does not exist.
+  Status UpdateTableMetadataLocation(const TableIdentifier& table_ident,
+                                     const std::string& metadata_location);
+
   /// \brief Internal utility for retrieving a namespace node pointer from the tree.
   ///
   /// \tparam NamespacePtr The type of the namespace node pointer.
@@ -314,6 +328,50 @@ Result<std::string> InMemoryNamespace::GetTableMetadataLocation(
   return it->second;
 }
 
+Status InMemoryNamespace::UpdateTableMetadataLocation(
+    TableIdentifier const& table_ident, const std::string& metadata_location) {
+  const auto ns = GetNamespace(this, table_ident.ns);
+  ICEBERG_RETURN_UNEXPECTED(ns);
+  const auto it = ns.value()->table_metadata_locations_.find(table_ident.name);
+  if (it == ns.value()->table_metadata_locations_.end()) {
+    return NotFound("{} does not exist", table_ident.name);
+  }
+  it->second = metadata_location;
+  return {};
+}
+
+namespace {
+
+/// \brief Returns the version of a metadata file named `<version>-<uuid>.metadata.json`,
+/// or -1 if the name has no version.
+int32_t ParseMetadataVersion(std::string_view metadata_location) {
+  auto file_name = metadata_location.substr(metadata_location.find_last_of('/') + 1);
+  auto version_end = file_name.find('-');
+  if (version_end == std::string_view::npos || version_end == 0) {
+    return -1;
+  }
+  int32_t version = 0;
+  auto [ptr, ec] =
+      std::from_chars(file_name.data(), file_name.data() + version_end, version);
+  if (ec != std::errc{} || ptr != file_name.data() + version_end) {
+    return -1;
+  }
+  return version;
+}
+
+/// \brief Returns the location of the metadata file that follows `base_location`.
+std::string NewMetadataLocation(const TableMetadata& metadata,
+                                std::string_view base_location) {
+  std::string_view table_location = metadata.location;
+  if (table_location.ends_with('/')) {
+    table_location.remove_suffix(1);
+  }
+  return std::format("{}/metadata/{:05d}-{}.metadata.json", table_location,
+                     ParseMetadataVersion(base_location) + 1, UuidUtils::GenerateV4());
+}
+
+}  // namespace
+
 std::shared_ptr<InMemoryCatalog> InMemoryCatalog::Make(
     std::string const& name, std::shared_ptr<FileIO> const& file_io,
     std::string const& warehouse_location,
@@ -394,7 +452,38 @@ Result<std::unique_ptr<Table>> InMemoryCatalog::UpdateTable(
     const TableIdentifier& identifier,
     const std::vector<std::unique_ptr<UpdateRequirement>>& requirements,
     const std::vector<std::unique_ptr<MetadataUpdate>>& updates) {
-  return NotImplemented("update table");
+  if (!file_io_) [[unlikely]] {
+    return InvalidArgument("file_io is not set for catalog {}", catalog_name_);
+  }
+
+  // Hold the lock from reading the base metadata until the new metadata location is
+  // swapped in, so that concurrent commits to the table are serialized.
+  std::unique_lock lock(mutex_);
+  ICEBERG_ASSIGN_OR_RAISE(auto base_location,
+                          root_namespace_->GetTableMetadataLocation(identifier));
+  ICEBERG_ASSIGN_OR_RAISE(auto base, TableMetadataUtil::Read(*file_io_, base_location));
+
+  for (const auto& requirement : requirements) {
+    ICEBERG_RETURN_UNEXPECTED(requirement->Validate(*base));
+  }
+
+  auto metadata = std::make_shared<TableMetadata>(*base);
+  for (const auto& update : updates) {
+    ICEBERG_RETURN_UNEXPECTED(update->ApplyTo(*metadata));
+  }
+  metadata->metadata_log.push_back(
+      MetadataLogEntry{.timestamp_ms = base->last_updated_ms,
+                       .metadata_file = base_location});
+
+  auto metadata_location = NewMetadataLocation(*metadata, base_location);
+  ICEBERG_RETURN_UNEXPECTED(
+      TableMetadataUtil::Write(*file_io_, metadata_location, *metadata));
+  ICEBERG_RETURN_UNEXPECTED(
+      root_namespace_->UpdateTableMetadataLocation(identifier, metadata_location));
+
+  return std::make_unique<Table>(identifier, std::move(metadata),
+                                 std::move(metadata_location), file_io_,
+                                 std::static_pointer_cast<Catalog>(shared_from_this()));
 }
 
 Result<std::shared_ptr<Transaction>> InMemoryCatalog::StageCreateTable(
@@ -0,0 +1,874 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/expression/evaluator.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+#include <variant>
+
+#include <nanoarrow/nanoarrow.h>
+
+#include "iceberg/arrow_c_data_guard_internal.h"
+#include "iceberg/expression/expression.h"
+#include "iceberg/expression/literal.h"
+#include "iceberg/expression/predicate.h"
+#include "iceberg/schema.h"
+#include "iceberg/schema_field.h"
+#include "iceberg/type.h"
+#include "iceberg/util/macros.h"
+#include "iceberg/util/string_util.h"
+
+namespace iceberg {
+
+// SelectionBitmap implementation
+
+SelectionBitmap::SelectionBitmap(int64_t length, bool selected)
+    : length_(length), words_((length + 63) / 64, selected ? ~uint64_t{0} : 0) {
+  ClearTrailingBits();
+}
+
+void SelectionBitmap::Set(int64_t i, bool selected) {
+  const uint64_t mask = uint64_t{1} << (i & 63);
+  if (selected) {
+    words_[i >> 6] |= mask;
+  } else {
+    words_[i >> 6] &= ~mask;
+  }
+}
+
+int64_t SelectionBitmap::CountSetBits() const {
+  int64_t count = 0;
+  for (uint64_t word : words_) {
+    count += std::popcount(word);
+  }
+  return count;
+}
+
+std::vector<int64_t> SelectionBitmap::ToIndices() const {
+  std::vector<int64_t> indices;
+  indices.reserve(CountSetBits());
+  for (size_t w = 0; w < words_.size(); ++w) {
+    uint64_t word = words_[w];
+    while (word != 0) {
+      indices.push_back(static_cast<int64_t>(w * 64 + std::countr_zero(word)));
+      word &= word - 1;
+    }
+  }
+  return indices;
+}
+
+SelectionBitmap& SelectionBitmap::operator&=(const SelectionBitmap& other) {
+  ICEBERG_DCHECK(length_ == other.length_, "Bitmap lengths must match");
+  for (size_t w = 0; w < words_.size(); ++w) {
+    words_[w] &= other.words_[w];
+  }
+  return *this;
+}
+
+SelectionBitmap& SelectionBitmap::operator|=(const SelectionBitmap& other) {
+  ICEBERG_DCHECK(length_ == other.length_, "Bitmap lengths must match");
+  for (size_t w = 0; w < words_.size(); ++w) {
+    words_[w] |= other.words_[w];
+  }
+  return *this;
+}
+
+void SelectionBitmap::Invert() {
+  for (uint64_t& word : words_) {
+    word = ~word;
+  }
+  ClearTrailingBits();
+}
+
+void SelectionBitmap::ClearTrailingBits() {
+  if (const int64_t tail = length_ & 63; tail != 0) {
+    words_.back() &= (uint64_t{1} << tail) - 1;
+  }
+}
+
+namespace {
+
+using Operation = Expression::Operation;
+
+/// \brief Physical representation used to evaluate a column.
+enum class ValueCategory {
+  kInteger,   // boolean, int, long, date, time, timestamp, timestamp_tz
+  kFloating,  // float, double
+  kBytes,     // string, binary, fixed, uuid
+};
+
+Result<ValueCategory> CategoryOf(const PrimitiveType& type) {
+  switch (type.type_id()) {
+    case TypeId::kBoolean:
+    case TypeId::kInt:
+    case TypeId::kLong:
+    case TypeId::kDate:
+    case TypeId::kTime:
+    case TypeId::kTimestamp:
+    case TypeId::kTimestampTz:
+      return ValueCategory::kInteger;
+    case TypeId::kFloat:
+    case TypeId::kDouble:
+      return ValueCategory::kFloating;
+    case TypeId::kString:
+    case TypeId::kBinary:
+    case TypeId::kFixed:
+    case TypeId::kUuid:
+      return ValueCategory::kBytes;
+    default:
+      return NotSupported("Cannot evaluate predicates on type {}", type.ToString());
+  }
+}
+
+/// \brief A column resolved to its position in the batch.
+struct BoundReference {
+  std::string name;
+  /// Child indices from the top-level struct down to the column.
+  std::vector<int32_t> path;
+  std::shared_ptr<PrimitiveType> type;
+};
+
+bool FindFieldPath(const StructType& struct_type, int32_t field_id,
+                   std::vector<int32_t>* path) {
+  const auto fields = struct_type.fields();
+  for (size_t i = 0; i < fields.size(); ++i) {
+    path->push_back(static_cast<int32_t>(i));
+    if (fields[i].field_id() == field_id) {
+      return true;
+    }
+    if (fields[i].type()->type_id() == TypeId::kStruct &&
+        FindFieldPath(static_cast<const StructType&>(*fields[i].type()), field_id,
+                      path)) {
+      return true;
+    }
+    path->pop_back();
+  }
+  return false;
+}
+
+Result<BoundReference> BindReference(const Schema& schema, const std::string& name,
+                                     bool case_sensitive) {
+  ICEBERG_ASSIGN_OR_RAISE(auto field, schema.FindFieldByName(name, case_sensitive));
+  if (!field.has_value()) {
+    return InvalidExpression("Cannot find field '{}' in struct: {}", name,
+                             schema.ToString());
+  }
+  const SchemaField& schema_field = field.value().get();
+  if (!schema_field.type()->is_primitive()) {
+    return InvalidExpression("Cannot bind predicate to non-primitive field '{}'", name);
+  }
+  BoundReference ref{
+      .name = name,
+      .type = std::static_pointer_cast<PrimitiveType>(schema_field.type())};
+  if (!FindFieldPath(schema, schema_field.field_id(), &ref.path)) {
+    return NotSupported(
+        "Cannot evaluate predicates on field '{}' nested in a list or map", name);
+  }
+  return ref;
+}
+
+/// \brief A literal converted to the physical representation of a column.
+struct BoundLiteral {
+  enum class Kind { kValue, kAboveMax, kBelowMin };
+  Kind kind = Kind::kValue;
+  std::variant<int64_t, double, std::string> value;
+};
+
+Result<BoundLiteral> BindLiteral(const Literal& literal,
+                                 const std::shared_ptr<PrimitiveType>& type,
+                                 const std::string& column_name) {
+  if (literal.IsNull()) {
+    return InvalidExpression("Invalid null literal for column '{}', use is_null instead",
+                             column_name);
+  }
+
+  const Literal* converted = &literal;
+  std::optional<Literal> cast;
+  if (literal.type()->type_id() != type->type_id()) {
+    // Fall back to the physical value below if the conversion is not supported, e.g.
+    // an int literal that is compared to a date column.
+    if (auto result = literal.CastTo(type); result.has_value()) {
+      cast = std::move(result.value());
+      converted = &cast.value();
+    }
+  }
+  if (converted->IsAboveMax()) {
+    return BoundLiteral{.kind = BoundLiteral::Kind::kAboveMax};
+  }
+  if (converted->IsBelowMin()) {
+    return BoundLiteral{.kind = BoundLiteral::Kind::kBelowMin};
+  }
+
+  ICEBERG_ASSIGN_OR_RAISE(auto category, CategoryOf(*type));
+  const auto& value = converted->value();
+  std::optional<BoundLiteral> bound;
+  switch (category) {
+    case ValueCategory::kInteger:
+      if (type->type_id() == TypeId::kBoolean) {
+        if (const auto* v = std::get_if<bool>(&value)) {
+          bound = BoundLiteral{.value = static_cast<int64_t>(*v)};
+        }
+      } else if (const auto* v = std::get_if<int32_t>(&value)) {
+        bound = BoundLiteral{.value = static_cast<int64_t>(*v)};
+      } else if (const auto* v = std::get_if<int64_t>(&value);
+                 v != nullptr && type->type_id() != TypeId::kInt &&
+                 type->type_id() != TypeId::kDate) {
+        bound = BoundLiteral{.value = *v};
+      }
+      break;
+    case ValueCategory::kFloating:
+      if (const auto* v = std::get_if<float>(&value)) {
+        bound = BoundLiteral{.value = static_cast<double>(*v)};
+      } else if (const auto* v = std::get_if<double>(&value)) {
+        bound = BoundLiteral{.value = *v};
+      }
+      if (bound.has_value() && std::isnan(std::get<double>(bound->value))) {
+        return InvalidExpression(
+            "Invalid NaN literal for column '{}', use is_nan instead", column_name);
+      }
+      break;
+    case ValueCategory::kBytes:
+      if (const auto* v = std::get_if<std::string>(&value);
+          v != nullptr && type->type_id() == TypeId::kString) {
+        bound = BoundLiteral{.value = *v};
+      } else if (const auto* v = std::get_if<std::vector<uint8_t>>(&value);
+                 v != nullptr && type->type_id() != TypeId::kString) {
+        bound = BoundLiteral{.value = std::string(v->begin(), v->end())};
+      } else if (const auto* v = std::get_if<std::array<uint8_t, 16>>(&value);
+                 v != nullptr && type->type_id() == TypeId::kUuid) {
+        bound = BoundLiteral{.value = std::string(v->begin(), v->end())};
+      }
+      if (bound.has_value() && type->type_id() == TypeId::kFixed) {
+        const auto& fixed_type = static_cast<const FixedType&>(*type);
+        if (std::get<std::string>(bound->value).size() !=
+            static_cast<size_t>(fixed_type.length())) {
+          return InvalidExpression("Invalid literal length for column '{}' of type {}",
+                                   column_name, type->ToString());
+        }
+      }
+      break;
+  }
+
+  if (!bound.has_value()) {
+    return InvalidExpression("Invalid literal of type {} for column '{}' of type {}",
+                             literal.type()->ToString(), column_name, type->ToString());
+  }
+  return std::move(bound.value());
+}
+
+// Helpers on Arrow validity bitmaps
+
+bool HasValidityBuffer(const ArrowArrayView* view) {
+  return view->null_count != 0 && view->buffer_views[0].data.data != nullptr;
+}
+
+/// \brief Load `n` (<= 64) bits starting at `bit_offset` into the low bits of a word.
+uint64_t LoadBits(const uint8_t* bitmap, int64_t bit_offset, int64_t n) {
+  const uint8_t* bytes = bitmap + bit_offset / 8;
+  const int shift = static_cast<int>(bit_offset % 8);
+  const int64_t num_bytes = (shift + n + 7) / 8;
+  uint64_t word = 0;
+  for (int64_t k = 0; k < std::min<int64_t>(num_bytes, 8); ++k) {
+    word |= static_cast<uint64_t>(bytes[k]) << (8 * k);
+  }
+  word >>= shift;
+  if (num_bytes > 8) {
+    word |= static_cast<uint64_t>(bytes[8]) << (64 - shift);
+  }
+  return n == 64 ? word : word & ((uint64_t{1} << n) - 1);
+}
+
+/// \brief Unselect the rows of `view` that are null.
+void AndValidity(const ArrowArrayView* view, int64_t base, SelectionBitmap* bitmap) {
+  if (!HasValidityBuffer(view)) {
+    return;
+  }
+  const uint8_t* validity = view->buffer_views[0].data.as_uint8;
+  const int64_t start = view->offset + base;
+  auto words = bitmap->mutable_words();
+  for (int64_t i = 0, w = 0; i < bitmap->length(); i += 64, ++w) {
+    words[w] &=
+        LoadBits(validity, start + i, std::min<int64_t>(64, bitmap->length() - i));
+  }
+}
+
+// Typed kernels
+
+template <typename Getter, typename Pred>
+void FillBits(int64_t length, const Getter& get, const Pred& pred, uint64_t* words) {
+  for (int64_t i = 0, w = 0; i < length; i += 64, ++w) {
+    const int64_t n = std::min<int64_t>(64, length - i);
+    uint64_t word = 0;
+    for (int64_t j = 0; j < n; ++j) {
+      word |= static_cast<uint64_t>(pred(get(i + j))) << j;
+    }
+    words[w] = word;
+  }
+}
+
+/// \brief Call `fn` with an accessor returning the values of `view` as int64_t, double
+/// or std::string_view according to the storage type.
+template <typename Fn>
+Status VisitValues(const ArrowArrayView* view, int64_t base, Fn&& fn) {
+  const int64_t start = view->offset + base;
+  switch (view->storage_type) {
+    case NANOARROW_TYPE_BOOL: {
+      const uint8_t* bits = view->buffer_views[1].data.as_uint8;
+      return fn(
+          [bits, start](int64_t i) -> int64_t { return ArrowBitGet(bits, start + i); });
+    }
+    case NANOARROW_TYPE_INT8: {
+      const int8_t* values = view->buffer_views[1].data.as_int8 + start;
+      return fn([values](int64_t i) -> int64_t { return values[i]; });
+    }
+    case NANOARROW_TYPE_INT16: {
+      const int16_t* values = view->buffer_views[1].data.as_int16 + start;
+      return fn([values](int64_t i) -> int64_t { return values[i]; });
+    }
+    case NANOARROW_TYPE_INT32: {
+      const int32_t* values = view->buffer_views[1].data.as_int32 + start;
+      return fn([values](int64_t i) -> int64_t { return values[i]; });
+    }
+    case NANOARROW_TYPE_INT64: {
+      const int64_t* values = view->buffer_views[1].data.as_int64 + start;
+      return fn([values](int64_t i) -> int64_t { return values[i]; });
+    }
+    case NANOARROW_TYPE_FLOAT: {
+      const float* values = view->buffer_views[1].data.as_float + start;
+      return fn([values](int64_t i) -> double { return values[i]; });
+    }
+    case NANOARROW_TYPE_DOUBLE: {
+      const double* values = view->buffer_views[1].data.as_double + start;
+      return fn([values](int64_t i) -> double { return values[i]; });
+    }
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_BINARY: {
+      const int32_t* offsets = view->buffer_views[1].data.as_int32 + start;
+      const char* data = view->buffer_views[2].data.as_char;
+      return fn([offsets, data](int64_t i) -> std::string_view {
+        return {data + offsets[i], static_cast<size_t>(offsets[i + 1] - offsets[i])};
+      });
+    }
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_LARGE_BINARY: {
+      const int64_t* offsets = view->buffer_views[1].data.as_int64 + start;
+      const char* data = view->buffer_views[2].data.as_char;
+      return fn([offsets, data](int64_t i) -> std::string_view {
+        return {data + offsets[i], static_cast<size_t>(offsets[i + 1] - offsets[i])};
+      });
+    }
+    case NANOARROW_TYPE_FIXED_SIZE_BINARY: {
+      const int64_t width = view->layout.element_size_bits[1] / 8;
+      const char* data = view->buffer_views[1].data.as_char + start * width;
+      return fn([data, width](int64_t i) -> std::string_view {
+        return {data + i * width, static_cast<size_t>(width)};
+      });
+    }
+    default:
+      return NotSupported("Cannot evaluate predicates on arrow type {}",
+                          ArrowTypeString(view->storage_type));
+  }
+}
+
+template <typename V>
+bool IsNaN(V value) {
+  if constexpr (std::is_floating_point_v<V>) {
+    return std::isnan(value);
+  } else {
+    return false;
+  }
+}
+
+template <typename V, typename Getter>
+void CompareKernel(Operation op, V literal, const Getter& get, int64_t length,
+                   uint64_t* words) {
+  // NaN sorts after every other value, like in the Iceberg value ordering.
+  switch (op) {
+    case Operation::kLt:
+      FillBits(length, get, [literal](V v) { return v < literal; }, words);
+      break;
+    case Operation::kLtEq:
+      FillBits(length, get, [literal](V v) { return v <= literal; }, words);
+      break;
+    case Operation::kGt:
+      FillBits(length, get, [literal](V v) { return v > literal || IsNaN(v); }, words);
+      break;
+    case Operation::kGtEq:
+      FillBits(length, get, [literal](V v) { return v >= literal || IsNaN(v); }, words);
+      break;
+    case Operation::kEq:
+      FillBits(length, get, [literal](V v) { return v == literal; }, words);
+      break;
+    case Operation::kNotEq:
+      FillBits(length, get, [literal](V v) { return !(v == literal); }, words);
+      break;
+    case Operation::kStartsWith:
+      if constexpr (std::is_same_v<V, std::string_view>) {
+        FillBits(length, get, [literal](V v) { return v.starts_with(literal); }, words);
+      }
+      break;
+    case Operation::kNotStartsWith:
+      if constexpr (std::is_same_v<V, std::string_view>) {
+        FillBits(length, get, [literal](V v) { return !v.starts_with(literal); }, words);
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+// Bound expression tree
+
+class BoundNode {
+ public:
+  virtual ~BoundNode() = default;
+
+  /// \brief Returns the result if the node selects all or no rows regardless of data.
+  virtual std::optional<bool> constant() const { return std::nullopt; }
+
+  virtual Result<SelectionBitmap> Eval(const ArrowArrayView& batch,
+                                       int64_t length) const = 0;
+};
+
+class ConstantNode : public BoundNode {
+ public:
+  explicit ConstantNode(bool value) : value_(value) {}
+
+  std::optional<bool> constant() const override { return value_; }
+
+  Result<SelectionBitmap> Eval(const ArrowArrayView& /*batch*/,
+                               int64_t length) const override {
+    return SelectionBitmap(length, value_);
+  }
+
+ private:
+  bool value_;
+};
+
+class AndNode : public BoundNode {
+ public:
+  AndNode(std::unique_ptr<BoundNode> left, std::unique_ptr<BoundNode> right)
+      : left_(std::move(left)), right_(std::move(right)) {}
+
+  Result<SelectionBitmap> Eval(const ArrowArrayView& batch,
+                               int64_t length) const override {
+    ICEBERG_ASSIGN_OR_RAISE(auto result, left_->Eval(batch, length));
+    if (result.CountSetBits() == 0) {
+      return result;
+    }
+    ICEBERG_ASSIGN_OR_RAISE(auto right, right_->Eval(batch, length));
+    result &= right;
+    return result;
+  }
+
+ private:
+  std::unique_ptr<BoundNode> left_;
+  std::unique_ptr<BoundNode> right_;
+};
+
+class OrNode : public BoundNode {
+ public:
+  OrNode(std::unique_ptr<BoundNode> left, std::unique_ptr<BoundNode> right)
+      : left_(std::move(left)), right_(std::move(right)) {}
+
+  Result<SelectionBitmap> Eval(const ArrowArrayView& batch,
+                               int64_t length) const override {
+    ICEBERG_ASSIGN_OR_RAISE(auto result, left_->Eval(batch, length));
+    if (result.CountSetBits() == length) {
+      return result;
+    }
+    ICEBERG_ASSIGN_OR_RAISE(auto right, right_->Eval(batch, length));
+    result |= right;
+    return result;
+  }
+
+ private:
+  std::unique_ptr<BoundNode> left_;
+  std::unique_ptr<BoundNode> right_;
+};
+
+/// \brief A predicate bound to a column, NOT is never present at this level.
+class PredicateNode : public BoundNode {
+ public:
+  PredicateNode(BoundReference ref, Operation op, ValueCategory category,
+                std::vector<BoundLiteral> literals)
+      : ref_(std::move(ref)), op_(op), category_(category) {
+    for (auto& literal : literals) {
+      std::visit(
+          [this](auto&& value) {
+            using T = std::decay_t<decltype(value)>;
+            if constexpr (std::is_same_v<T, int64_t>) {
+              int_values_.push_back(value);
+            } else if constexpr (std::is_same_v<T, double>) {
+              double_values_.push_back(value);
+            } else {
+              bytes_values_.push_back(std::move(value));
+            }
+          },
+          std::move(literal.value));
+    }
+    if (UnboundPredicate::IsSetOperation(op_)) {
+      int_set_.insert(int_values_.begin(), int_values_.end());
+      double_set_.insert(double_values_.begin(), double_values_.end());
+      bytes_set_.insert(bytes_values_.begin(), bytes_values_.end());
+    }
+  }
+
+  Result<SelectionBitmap> Eval(const ArrowArrayView& batch,
+                               int64_t length) const override {
+    // Resolve the column and remember the structs that contain it, a value in a null
+    // struct is null as well.
+    const ArrowArrayView* view = &batch;
+    int64_t base = 0;
+    std::vector<std::pair<const ArrowArrayView*, int64_t>> parents;
+    for (int32_t index : ref_.path) {
+      if (view->storage_type != NANOARROW_TYPE_STRUCT || index >= view->n_children) {
+        return InvalidArrowData("Cannot find column '{}' in the batch", ref_.name);
+      }
+      parents.emplace_back(view, base);
+      base += view->offset;
+      view = view->children[index];
+    }
+
+    SelectionBitmap result(length);
+    if (op_ == Operation::kIsNull || op_ == Operation::kNotNull) {
+      ICEBERG_ASSIGN_OR_RAISE(result, EvalValidity(view, base, length));
+    } else {
+      ICEBERG_ASSIGN_OR_RAISE(result, EvalValues(view, base, length));
+    }
+    for (const auto& [parent, parent_base] : parents) {
+      AndValidity(parent, parent_base, &result);
+    }
+    if (op_ == Operation::kIsNull) {
+      result.Invert();
+    }
+    return result;
+  }
+
+ private:
+  Result<SelectionBitmap> EvalValidity(const ArrowArrayView* view, int64_t base,
+                                       int64_t length) const {
+    SelectionBitmap result(length, /*selected=*/true);
+    if (view->dictionary != nullptr && HasValidityBuffer(view->dictionary)) {
+      ICEBERG_ASSIGN_OR_RAISE(
+          auto dictionary_validity,
+          EvalValidity(view->dictionary, 0, view->dictionary->length));
+      ICEBERG_RETURN_UNEXPECTED(MapDictionary(view, base, dictionary_validity, &result));
+    }
+    AndValidity(view, base, &result);
+    return result;
+  }
+
+  Result<SelectionBitmap> EvalValues(const ArrowArrayView* view, int64_t base,
+                                     int64_t length) const {
+    SelectionBitmap result(length);
+    if (view->dictionary != nullptr) {
+      // Evaluate the predicate once per distinct value.
+      ICEBERG_ASSIGN_OR_RAISE(auto dictionary_result,
+                              EvalValues(view->dictionary, 0, view->dictionary->length));
+      ICEBERG_RETURN_UNEXPECTED(MapDictionary(view, base, dictionary_result, &result));
+    } else {
+      ICEBERG_RETURN_UNEXPECTED(VisitValues(view, base, [&](const auto& get) -> Status {
+        using V = std::decay_t<decltype(get(0))>;
+        return Kernel<V>(get, length, result.mutable_words().data());
+      }));
+    }
+    AndValidity(view, base, &result);
+    return result;
+  }
+
+  /// \brief Select row i if the dictionary entry it refers to is selected.
+  static Status MapDictionary(const ArrowArrayView* view, int64_t base,
+                              const SelectionBitmap& dictionary_bitmap,
+                              SelectionBitmap* result) {
+    return VisitValues(view, base, [&](const auto& get) -> Status {
+      using V = std::decay_t<decltype(get(0))>;
+      if constexpr (!std::is_same_v<V, int64_t>) {
+        return InvalidArrowData("Invalid dictionary index type");
+      } else {
+        const int64_t dictionary_length = dictionary_bitmap.length();
+        FillBits(
+            result->length(), get,
+            [&](int64_t index) {
+              return index >= 0 && index < dictionary_length &&
+                     dictionary_bitmap.IsSet(index);
+            },
+            result->mutable_words().data());
+        return {};
+      }
+    });
+  }
+
+  template <typename V, typename Getter>
+  Status Kernel(const Getter& get, int64_t length, uint64_t* words) const {
+    if constexpr (std::is_same_v<V, int64_t>) {
+      if (category_ != ValueCategory::kInteger) {
+        return TypeMismatch();
+      }
+      return Dispatch<V>(int_values_, int_set_, get, length, words);
+    } else if constexpr (std::is_same_v<V, double>) {
+      if (category_ != ValueCategory::kFloating) {
+        return TypeMismatch();
+      }
+      if (op_ == Operation::kIsNan) {
+        FillBits(length, get, [](double v) { return std::isnan(v); }, words);
+        return {};
+      }
+      if (op_ == Operation::kNotNan) {
+        FillBits(length, get, [](double v) { return !std::isnan(v); }, words);
+        return {};
+      }
+      return Dispatch<V>(double_values_, double_set_, get, length, words);
+    } else {
+      if (category_ != ValueCategory::kBytes) {
+        return TypeMismatch();
+      }
+      return Dispatch<V>(bytes_values_, bytes_set_, get, length, words);
+    }
+  }
+
+  template <typename V, typename Values, typename Set, typename Getter>
+  Status Dispatch(const Values& values, const Set& set, const Getter& get,
+                  int64_t length, uint64_t* words) const {
+    if (op_ == Operation::kIn) {
+      FillBits(length, get, [&set](V v) { return set.contains(v); }, words);
+    } else if (op_ == Operation::kNotIn) {
+      FillBits(length, get, [&set](V v) { return !set.contains(v); }, words);
+    } else {
+      CompareKernel<V>(op_, V(values.front()), get, length, words);
+    }
+    return {};
+  }
+
+  Status TypeMismatch() const {
+    return InvalidArrowData("Arrow data of column '{}' does not match type {}", ref_.name,
+                            ref_.type->ToString());
+  }
+
+  BoundReference ref_;
+  Operation op_;
+  ValueCategory category_;
+  std::vector<int64_t> int_values_;
+  std::vector<double> double_values_;
+  std::vector<std::string> bytes_values_;
+  std::unordered_set<int64_t> int_set_;
+  std::unordered_set<double> double_set_;
+  std::unordered_set<std::string, StringHash, std::equal_to<>> bytes_set_;
+};
+
+/// \brief Result of comparing any value with a literal that is out of the column range.
+bool CompareOutOfRange(Operation op, BoundLiteral::Kind kind) {
+  const bool above_max = kind == BoundLiteral::Kind::kAboveMax;
+  switch (op) {
+    case Operation::kLt:
+    case Operation::kLtEq:
+      return above_max;
+    case Operation::kGt:
+    case Operation::kGtEq:
+      return !above_max;
+    case Operation::kNotEq:
+      return true;
+    default:
+      return false;
+  }
+}
+
+Result<std::unique_ptr<BoundNode>> BindPredicate(const Schema& schema,
+                                                 const UnboundPredicate& predicate,
+                                                 bool case_sensitive) {
+  ICEBERG_ASSIGN_OR_RAISE(auto ref,
+                          BindReference(schema, predicate.column_name(), case_sensitive));
+  ICEBERG_ASSIGN_OR_RAISE(auto category, CategoryOf(*ref.type));
+  const auto op = predicate.op();
+  const auto& literals = predicate.literals();
+
+  if (UnboundPredicate::IsUnaryOperation(op)) {
+    if (!literals.empty()) {
+      return InvalidExpression("Unary predicate cannot have literals: {}",
+                               predicate.ToString());
+    }
+    if ((op == Operation::kIsNan || op == Operation::kNotNan) &&
+        category != ValueCategory::kFloating) {
+      return InvalidExpression("{} is only valid for float and double columns: {}",
+                               op == Operation::kIsNan ? "is_nan" : "not_nan",
+                               predicate.ToString());
+    }
+    return std::make_unique<PredicateNode>(std::move(ref), op, category,
+                                           std::vector<BoundLiteral>{});
+  }
+
+  if (UnboundPredicate::IsLiteralOperation(op)) {
+    if (literals.size() != 1) {
+      return InvalidExpression("Predicate requires a single literal: {}",
+                               predicate.ToString());
+    }
+    if ((op == Operation::kStartsWith || op == Operation::kNotStartsWith) &&
+        ref.type->type_id() != TypeId::kString) {
+      return InvalidExpression("Starts with is only valid for string columns: {}",
+                               predicate.ToString());
+    }
+    ICEBERG_ASSIGN_OR_RAISE(auto literal, BindLiteral(literals[0], ref.type, ref.name));
+    if (literal.kind != BoundLiteral::Kind::kValue) {
+      if (!CompareOutOfRange(op, literal.kind)) {
+        return std::make_unique<ConstantNode>(false);
+      }
+      return std::make_unique<PredicateNode>(std::move(ref), Operation::kNotNull,
+                                             category, std::vector<BoundLiteral>{});
+    }
+    std::vector<BoundLiteral> bound;
+    bound.push_back(std::move(literal));
+    return std::make_unique<PredicateNode>(std::move(ref), op, category,
+                                           std::move(bound));
+  }
+
+  if (UnboundPredicate::IsSetOperation(op)) {
+    std::vector<BoundLiteral> bound;
+    bound.reserve(literals.size());
+    for (const auto& literal : literals) {
+      ICEBERG_ASSIGN_OR_RAISE(auto bound_literal,
+                              BindLiteral(literal, ref.type, ref.name));
+      // Values out of the column range never match.
+      if (bound_literal.kind == BoundLiteral::Kind::kValue) {
+        bound.push_back(std::move(bound_literal));
+      }
+    }
+    if (bound.empty()) {
+      if (op == Operation::kIn) {
+        return std::make_unique<ConstantNode>(false);
+      }
+      return std::make_unique<PredicateNode>(std::move(ref), Operation::kNotNull,
+                                             category, std::vector<BoundLiteral>{});
+    }
+    return std::make_unique<PredicateNode>(std::move(ref), op, category,
+                                           std::move(bound));
+  }
+
+  return InvalidExpression("Invalid predicate: {}", predicate.ToString());
+}
+
+Result<std::unique_ptr<BoundNode>> Bind(const Schema& schema, const Expression& expr,
+                                        bool case_sensitive) {
+  switch (expr.op()) {
+    case Operation::kTrue:
+      return std::make_unique<ConstantNode>(true);
+    case Operation::kFalse:
+      return std::make_unique<ConstantNode>(false);
+    case Operation::kNot: {
+      // Push NOT down to the predicates so that null values are never selected.
+      const auto& not_expr = static_cast<const Not&>(expr);
+      return Bind(schema, *not_expr.child()->Negate(), case_sensitive);
+    }
+    case Operation::kAnd: {
+      const auto& and_expr = static_cast<const And&>(expr);
+      ICEBERG_ASSIGN_OR_RAISE(auto left, Bind(schema, *and_expr.left(), case_sensitive));
+      ICEBERG_ASSIGN_OR_RAISE(auto right,
+                              Bind(schema, *and_expr.right(), case_sensitive));
+      if (left->constant().has_value()) {
+        return left->constant().value() ? std::move(right) : std::move(left);
+      }
+      if (right->constant().has_value()) {
+        return right->constant().value() ? std::move(left) : std::move(right);
+      }
+      return std::make_unique<AndNode>(std::move(left), std::move(right));
+    }
+    case Operation::kOr: {
+      const auto& or_expr = static_cast<const Or&>(expr);
+      ICEBERG_ASSIGN_OR_RAISE(auto left, Bind(schema, *or_expr.left(), case_sensitive));
+      ICEBERG_ASSIGN_OR_RAISE(auto right, Bind(schema, *or_expr.right(), case_sensitive));
+      if (left->constant().has_value()) {
+        return left->constant().value() ? std::move(left) : std::move(right);
+      }
+      if (right->constant().has_value()) {
+        return right->constant().value() ? std::move(right) : std::move(left);
+      }
+      return std::make_unique<OrNode>(std::move(left), std::move(right));
+    }
+    default:
+      break;
+  }
+
+  if (const auto* predicate = dynamic_cast<const UnboundPredicate*>(&expr)) {
+    return BindPredicate(schema, *predicate, case_sensitive);
+  }
+  return NotSupported("Cannot evaluate expression: {}", expr.ToString());
+}
+
+}  // namespace
+
+class Evaluator::Impl {
+ public:
+  explicit Impl(std::unique_ptr<BoundNode> root) : root_(std::move(root)) {}
+
+  const BoundNode& root() const { return *root_; }
+
+ private:
+  std::unique_ptr<BoundNode> root_;
+};
+
+Evaluator::Evaluator(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+Evaluator::~Evaluator() = default;
+
+Result<std::unique_ptr<Evaluator>> Evaluator::Make(
+    const Schema& schema, const std::shared_ptr<Expression>& expr, bool case_sensitive) {
+  if (!expr) {
+    return InvalidArgument("Cannot bind a null expression");
+  }
+  ICEBERG_ASSIGN_OR_RAISE(auto root, Bind(schema, *expr, case_sensitive));
+  return std::unique_ptr<Evaluator>(
+      new Evaluator(std::make_unique<Impl>(std::move(root))));
+}
+
+bool Evaluator::IsAlwaysTrue() const {
+  return impl_->root().constant() == std::optional<bool>(true);
+}
+
+bool Evaluator::IsAlwaysFalse() const {
+  return impl_->root().constant() == std::optional<bool>(false);
+}
+
+Result<SelectionBitmap> Evaluator::Evaluate(const ArrowSchema& schema,
+                                            const ArrowArray& batch) const {
+  if (auto constant = impl_->root().constant(); constant.has_value()) {
+    return SelectionBitmap(batch.length, constant.value());
+  }
+
+  ArrowError error;
+  ArrowArrayView view;
+  if (ArrowArrayViewInitFromSchema(&view, &schema, &error) != NANOARROW_OK) {
+    return InvalidArrowData("Failed to init array view from schema: {}", error.message);
+  }
+  internal::ArrowArrayViewGuard view_guard(&view);
+  if (ArrowArrayViewSetArray(&view, &batch, &error) != NANOARROW_OK) {
+    return InvalidArrowData("Failed to set array view: {}", error.message);
+  }
+  if (view.storage_type != NANOARROW_TYPE_STRUCT) {
+    return InvalidArrowData("Cannot evaluate expression on a non-struct array");
+  }
+  return impl_->root().Eval(view, batch.length);
+}
+
+}  // namespace iceberg
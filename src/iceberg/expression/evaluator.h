@@ -0,0 +1,122 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+/// \file iceberg/expression/evaluator.h
+/// Row-level evaluation of expressions over batches of Arrow data.
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "iceberg/arrow_c_data.h"
+#include "iceberg/iceberg_export.h"
+#include "iceberg/result.h"
+#include "iceberg/type_fwd.h"
+
+namespace iceberg {
+
+/// \brief A bitmap of selected rows in a batch, bit i is set if row i is selected.
+class ICEBERG_EXPORT SelectionBitmap {
+ public:
+  /// \brief Create a bitmap of `length` rows that are all selected or all unselected.
+  explicit SelectionBitmap(int64_t length, bool selected = false);
+
+  /// \brief Returns the number of rows covered by the bitmap.
+  int64_t length() const { return length_; }
+
+  /// \brief Returns whether row `i` is selected.
+  bool IsSet(int64_t i) const { return (words_[i >> 6] >> (i & 63)) & 1; }
+
+  /// \brief Select or unselect row `i`.
+  void Set(int64_t i, bool selected);
+
+  /// \brief Returns the number of selected rows.
+  int64_t CountSetBits() const;
+
+  /// \brief Returns the indices of all selected rows in ascending order.
+  std::vector<int64_t> ToIndices() const;
+
+  /// \brief Unselect rows that are not selected in `other`.
+  SelectionBitmap& operator&=(const SelectionBitmap& other);
+
+  /// \brief Select rows that are selected in `other`.
+  SelectionBitmap& operator|=(const SelectionBitmap& other);
+
+  /// \brief Flip the selection of every row.
+  void Invert();
+
+  /// \brief Returns the 64-bit words backing the bitmap, LSB first.
+  ///
+  /// Bits past `length()` in the last word are always zero.
+  std::span<const uint64_t> words() const { return words_; }
+  std::span<uint64_t> mutable_words() { return words_; }
+
+ private:
+  void ClearTrailingBits();
+
+  int64_t length_;
+  std::vector<uint64_t> words_;
+};
+
+/// \brief Evaluates an expression against rows of Arrow record batches.
+///
+/// The expression is bound to a schema once: column references are resolved to
+/// positions in the batch and literals are converted to the column types. NOT is pushed
+/// down to the predicates, which are then evaluated column-at-a-time by type-specialized
+/// kernels. A predicate on a null value is unknown and does not select the row, so
+/// rows are selected with SQL semantics.
+class ICEBERG_EXPORT Evaluator {
+ public:
+  /// \brief Bind an expression to a schema.
+  ///
+  /// \param schema The schema of the batches to evaluate.
+  /// \param expr The expression to bind.
+  /// \param case_sensitive Whether column names are matched case-sensitively.
+  static Result<std::unique_ptr<Evaluator>> Make(const Schema& schema,
+                                                 const std::shared_ptr<Expression>& expr,
+                                                 bool case_sensitive = true);
+
+  ~Evaluator();
+
+  /// \brief Returns true if the bound expression selects every row.
+  bool IsAlwaysTrue() const;
+
+  /// \brief Returns true if the bound expression selects no row.
+  bool IsAlwaysFalse() const;
+
+  /// \brief Evaluate the expression against a batch.
+  ///
+  /// \param schema Arrow schema of the batch, a struct whose children match the bound
+  /// schema.
+  /// \param batch The batch to evaluate.
+  /// \return The bitmap of rows matching the expression.
+  Result<SelectionBitmap> Evaluate(const ArrowSchema& schema,
+                                   const ArrowArray& batch) const;
+
+ private:
+  class Impl;
+  explicit Evaluator(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace iceberg
@@ -63,6 +63,21 @@ bool And::Equals(const Expression& expr) const {
   return false;
 }
 
+// Not implementation
+Not::Not(std::shared_ptr<Expression> child) : child_(std::move(child)) {}
+
+std::string Not::ToString() const { return std::format("not({})", child_->ToString()); }
+
+std::shared_ptr<Expression> Not::Negate() const { return child_; }
+
+bool Not::Equals(const Expression& expr) const {
+  if (expr.op() == Operation::kNot) {
+    const auto& other = static_cast<const Not&>(expr);
+    return child_->Equals(*other.child());
+  }
+  return false;
+}
+
 // Or implementation
 Or::Or(std::shared_ptr<Expression> left, std::shared_ptr<Expression> right)
     : left_(std::move(left)), right_(std::move(right)) {}
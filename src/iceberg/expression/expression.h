@@ -158,6 +158,34 @@ class ICEBERG_EXPORT And : public Expression {
   std::shared_ptr<Expression> right_;
 };
 
+/// \brief An Expression that represents a logical NOT operation on an expression.
+///
+/// This expression evaluates to true if and only if its child expression evaluates to
+/// false.
+class ICEBERG_EXPORT Not : public Expression {
+ public:
+  /// \brief Constructs a Not expression from a sub-expression.
+  ///
+  /// \param child The expression to negate
+  explicit Not(std::shared_ptr<Expression> child);
+
+  /// \brief Returns the child of the NOT expression.
+  ///
+  /// \return The negated expression
+  const std::shared_ptr<Expression>& child() const { return child_; }
+
+  Operation op() const override { return Operation::kNot; }
+
+  std::string ToString() const override;
+
+  std::shared_ptr<Expression> Negate() const override;
+
+  bool Equals(const Expression& other) const override;
+
+ private:
+  std::shared_ptr<Expression> child_;
+};
+
 /// \brief An Expression that represents a logical OR operation between two expressions.
 ///
 /// This expression evaluates to true if at least one of its child expressions
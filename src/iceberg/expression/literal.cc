@@ -19,10 +19,16 @@
 
 #include "iceberg/expression/literal.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <concepts>
+#include <cstring>
 
 #include "iceberg/exception.h"
+#include "iceberg/util/checked_cast.h"
+#include "iceberg/util/endian.h"
+#include "iceberg/util/macros.h"
 
 namespace iceberg {
 
@@ -149,13 +155,119 @@ Literal Literal::Binary(std::vector<uint8_t> value) {
   return {Value{std::move(value)}, binary()};
 }
 
+namespace {
+
+template <typename T>
+std::vector<uint8_t> WriteLittleEndian(T value) {
+  value = ToLittleEndian(value);
+  std::vector<uint8_t> data(sizeof(T));
+  std::memcpy(data.data(), &value, sizeof(T));
+  return data;
+}
+
+template <typename T>
+T ReadLittleEndian(std::span<const uint8_t> data) {
+  T value;
+  std::memcpy(&value, data.data(), sizeof(T));
+  return FromLittleEndian(value);
+}
+
+}  // namespace
+
 Result<Literal> Literal::Deserialize(std::span<const uint8_t> data,
                                      std::shared_ptr<PrimitiveType> type) {
-  return NotImplemented("Deserialization of Literal is not implemented yet");
+  auto check_size = [&](size_t size) -> Status {
+    if (data.size() != size) {
+      return InvalidArgument("Invalid serialized {} value of {} bytes",
+                             type->ToString(), data.size());
+    }
+    return {};
+  };
+  switch (type->type_id()) {
+    case TypeId::kBoolean:
+      ICEBERG_RETURN_UNEXPECTED(check_size(1));
+      return Literal(Value{data[0] != 0}, std::move(type));
+    case TypeId::kInt:
+    case TypeId::kDate:
+      ICEBERG_RETURN_UNEXPECTED(check_size(sizeof(int32_t)));
+      return Literal(Value{ReadLittleEndian<int32_t>(data)}, std::move(type));
+    case TypeId::kLong:
+    case TypeId::kTime:
+    case TypeId::kTimestamp:
+    case TypeId::kTimestampTz:
+      // Values of int columns promoted to long are stored in 4 bytes.
+      if (data.size() == sizeof(int32_t)) {
+        return Literal(Value{int64_t{ReadLittleEndian<int32_t>(data)}}, std::move(type));
+      }
+      ICEBERG_RETURN_UNEXPECTED(check_size(sizeof(int64_t)));
+      return Literal(Value{ReadLittleEndian<int64_t>(data)}, std::move(type));
+    case TypeId::kFloat:
+      ICEBERG_RETURN_UNEXPECTED(check_size(sizeof(float)));
+      return Literal(Value{ReadLittleEndian<float>(data)}, std::move(type));
+    case TypeId::kDouble:
+      // Values of float columns promoted to double are stored in 4 bytes.
+      if (data.size() == sizeof(float)) {
+        return Literal(Value{double{ReadLittleEndian<float>(data)}}, std::move(type));
+      }
+      ICEBERG_RETURN_UNEXPECTED(check_size(sizeof(double)));
+      return Literal(Value{ReadLittleEndian<double>(data)}, std::move(type));
+    case TypeId::kString:
+      return Literal(Value{std::string(data.begin(), data.end())}, std::move(type));
+    case TypeId::kBinary:
+      return Literal(Value{std::vector<uint8_t>(data.begin(), data.end())},
+                     std::move(type));
+    case TypeId::kFixed: {
+      const auto& fixed_type = internal::checked_cast<const FixedType&>(*type);
+      ICEBERG_RETURN_UNEXPECTED(check_size(static_cast<size_t>(fixed_type.length())));
+      return Literal(Value{std::vector<uint8_t>(data.begin(), data.end())},
+                     std::move(type));
+    }
+    case TypeId::kUuid: {
+      std::array<uint8_t, 16> uuid;
+      ICEBERG_RETURN_UNEXPECTED(check_size(uuid.size()));
+      std::ranges::copy(data, uuid.begin());
+      return Literal(Value{uuid}, std::move(type));
+    }
+    default:
+      return NotImplemented("Deserialization of {} literals is not implemented yet",
+                            type->ToString());
+  }
 }
 
 Result<std::vector<uint8_t>> Literal::Serialize() const {
-  return NotImplemented("Serialization of Literal is not implemented yet");
+  if (IsNull() || IsAboveMax() || IsBelowMin()) {
+    return Invalid("Cannot serialize literal {}", ToString());
+  }
+  switch (type_->type_id()) {
+    case TypeId::kBoolean:
+      return std::vector<uint8_t>{static_cast<uint8_t>(std::get<bool>(value_) ? 1 : 0)};
+    case TypeId::kInt:
+    case TypeId::kDate:
+      return WriteLittleEndian(std::get<int32_t>(value_));
+    case TypeId::kLong:
+    case TypeId::kTime:
+    case TypeId::kTimestamp:
+    case TypeId::kTimestampTz:
+      return WriteLittleEndian(std::get<int64_t>(value_));
+    case TypeId::kFloat:
+      return WriteLittleEndian(std::get<float>(value_));
+    case TypeId::kDouble:
+      return WriteLittleEndian(std::get<double>(value_));
+    case TypeId::kString: {
+      const auto& value = std::get<std::string>(value_);
+      return std::vector<uint8_t>(value.begin(), value.end());
+    }
+    case TypeId::kBinary:
+    case TypeId::kFixed:
+      return std::get<std::vector<uint8_t>>(value_);
+    case TypeId::kUuid: {
+      const auto& value = std::get<std::array<uint8_t, 16>>(value_);
+      return std::vector<uint8_t>(value.begin(), value.end());
+    }
+    default:
+      return NotImplemented("Serialization of {} literals is not implemented yet",
+                            type_->ToString());
+  }
 }
 
 // Getters
@@ -216,6 +328,7 @@ std::partial_ordering Literal::operator<=>(const Literal& other) const {
     }
 
     case TypeId::kLong:
+    case TypeId::kTime:
     case TypeId::kTimestamp:
     case TypeId::kTimestampTz: {
       auto this_val = std::get<int64_t>(value_);
@@ -0,0 +1,200 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/expression/predicate.h"
+
+#include <format>
+#include <iterator>
+
+namespace iceberg {
+
+namespace {
+
+/// \brief Format a literal without relying on type-specific rendering, which is not
+/// available for all primitive types yet.
+std::string FormatLiteral(const Literal& literal) {
+  return std::visit(
+      [](const auto& value) -> std::string {
+        using T = std::decay_t<decltype(value)>;
+        if constexpr (std::is_same_v<T, std::monostate>) {
+          return "null";
+        } else if constexpr (std::is_same_v<T, Literal::BelowMin>) {
+          return "belowMin";
+        } else if constexpr (std::is_same_v<T, Literal::AboveMax>) {
+          return "aboveMax";
+        } else if constexpr (std::is_same_v<T, bool>) {
+          return value ? "true" : "false";
+        } else if constexpr (std::is_same_v<T, std::string>) {
+          return std::format("\"{}\"", value);
+        } else if constexpr (std::is_arithmetic_v<T>) {
+          return std::format("{}", value);
+        } else {
+          std::string result = "X'";
+          for (uint8_t byte : value) {
+            std::format_to(std::back_inserter(result), "{:02X}", byte);
+          }
+          result.push_back('\'');
+          return result;
+        }
+      },
+      literal.value());
+}
+
+std::string_view OperationSymbol(Expression::Operation op) {
+  switch (op) {
+    case Expression::Operation::kIsNull:
+      return "is_null";
+    case Expression::Operation::kNotNull:
+      return "not_null";
+    case Expression::Operation::kIsNan:
+      return "is_nan";
+    case Expression::Operation::kNotNan:
+      return "not_nan";
+    case Expression::Operation::kLt:
+      return "<";
+    case Expression::Operation::kLtEq:
+      return "<=";
+    case Expression::Operation::kGt:
+      return ">";
+    case Expression::Operation::kGtEq:
+      return ">=";
+    case Expression::Operation::kEq:
+      return "==";
+    case Expression::Operation::kNotEq:
+      return "!=";
+    case Expression::Operation::kIn:
+      return "in";
+    case Expression::Operation::kNotIn:
+      return "not in";
+    case Expression::Operation::kStartsWith:
+      return "startsWith";
+    case Expression::Operation::kNotStartsWith:
+      return "notStartsWith";
+    default:
+      return "invalid";
+  }
+}
+
+Expression::Operation NegateOperation(Expression::Operation op) {
+  switch (op) {
+    case Expression::Operation::kIsNull:
+      return Expression::Operation::kNotNull;
+    case Expression::Operation::kNotNull:
+      return Expression::Operation::kIsNull;
+    case Expression::Operation::kIsNan:
+      return Expression::Operation::kNotNan;
+    case Expression::Operation::kNotNan:
+      return Expression::Operation::kIsNan;
+    case Expression::Operation::kLt:
+      return Expression::Operation::kGtEq;
+    case Expression::Operation::kLtEq:
+      return Expression::Operation::kGt;
+    case Expression::Operation::kGt:
+      return Expression::Operation::kLtEq;
+    case Expression::Operation::kGtEq:
+      return Expression::Operation::kLt;
+    case Expression::Operation::kEq:
+      return Expression::Operation::kNotEq;
+    case Expression::Operation::kNotEq:
+      return Expression::Operation::kEq;
+    case Expression::Operation::kIn:
+      return Expression::Operation::kNotIn;
+    case Expression::Operation::kNotIn:
+      return Expression::Operation::kIn;
+    case Expression::Operation::kStartsWith:
+      return Expression::Operation::kNotStartsWith;
+    case Expression::Operation::kNotStartsWith:
+      return Expression::Operation::kStartsWith;
+    default:
+      throw IcebergError(
+          std::format("No negation for operation {}", static_cast<int>(op)));
+  }
+}
+
+}  // namespace
+
+UnboundPredicate::UnboundPredicate(Operation op, std::string column_name)
+    : op_(op), column_name_(std::move(column_name)) {}
+
+UnboundPredicate::UnboundPredicate(Operation op, std::string column_name,
+                                   Literal literal)
+    : op_(op), column_name_(std::move(column_name)), literals_{std::move(literal)} {}
+
+UnboundPredicate::UnboundPredicate(Operation op, std::string column_name,
+                                   std::vector<Literal> literals)
+    : op_(op), column_name_(std::move(column_name)), literals_(std::move(literals)) {}
+
+bool UnboundPredicate::IsUnaryOperation(Operation op) {
+  return op == Operation::kIsNull || op == Operation::kNotNull ||
+         op == Operation::kIsNan || op == Operation::kNotNan;
+}
+
+bool UnboundPredicate::IsLiteralOperation(Operation op) {
+  switch (op) {
+    case Operation::kLt:
+    case Operation::kLtEq:
+    case Operation::kGt:
+    case Operation::kGtEq:
+    case Operation::kEq:
+    case Operation::kNotEq:
+    case Operation::kStartsWith:
+    case Operation::kNotStartsWith:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool UnboundPredicate::IsSetOperation(Operation op) {
+  return op == Operation::kIn || op == Operation::kNotIn;
+}
+
+std::string UnboundPredicate::ToString() const {
+  if (IsUnaryOperation(op_)) {
+    return std::format("{} {}", column_name_, OperationSymbol(op_));
+  }
+  if (IsSetOperation(op_)) {
+    std::string values;
+    for (const auto& literal : literals_) {
+      if (!values.empty()) {
+        values.append(", ");
+      }
+      values.append(FormatLiteral(literal));
+    }
+    return std::format("{} {} ({})", column_name_, OperationSymbol(op_), values);
+  }
+  return std::format("{} {} {}", column_name_, OperationSymbol(op_),
+                     literals_.empty() ? "null" : FormatLiteral(literals_.front()));
+}
+
+std::shared_ptr<Expression> UnboundPredicate::Negate() const {
+  return std::make_shared<UnboundPredicate>(NegateOperation(op_), column_name_,
+                                            literals_);
+}
+
+bool UnboundPredicate::Equals(const Expression& expr) const {
+  if (expr.op() != op_) {
+    return false;
+  }
+  const auto* other = dynamic_cast<const UnboundPredicate*>(&expr);
+  return other != nullptr && other->column_name_ == column_name_ &&
+         other->literals_ == literals_;
+}
+
+}  // namespace iceberg
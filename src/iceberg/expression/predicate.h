@@ -0,0 +1,93 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+/// \file iceberg/expression/predicate.h
+/// Predicates on a single column of an Iceberg table.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "iceberg/expression/expression.h"
+#include "iceberg/expression/literal.h"
+#include "iceberg/iceberg_export.h"
+
+namespace iceberg {
+
+/// \brief A predicate that references a column by name and has not been bound to a
+/// schema yet.
+///
+/// Depending on the operation, a predicate carries no literal (IS NULL, NOT NULL, IS
+/// NAN, NOT NAN), a single literal (comparisons, STARTS WITH, NOT STARTS WITH) or a set
+/// of literals (IN, NOT IN). Literals are converted to the column type when the
+/// predicate is bound.
+class ICEBERG_EXPORT UnboundPredicate : public Expression {
+ public:
+  /// \brief Constructs a unary predicate.
+  ///
+  /// \param op One of kIsNull, kNotNull, kIsNan or kNotNan
+  /// \param column_name The name of the referenced column
+  UnboundPredicate(Operation op, std::string column_name);
+
+  /// \brief Constructs a predicate with a single literal.
+  ///
+  /// \param op A comparison, kStartsWith or kNotStartsWith
+  /// \param column_name The name of the referenced column
+  /// \param literal The literal to compare against
+  UnboundPredicate(Operation op, std::string column_name, Literal literal);
+
+  /// \brief Constructs a set predicate.
+  ///
+  /// \param op One of kIn or kNotIn
+  /// \param column_name The name of the referenced column
+  /// \param literals The set of literals
+  UnboundPredicate(Operation op, std::string column_name, std::vector<Literal> literals);
+
+  /// \brief Returns the name of the referenced column.
+  const std::string& column_name() const { return column_name_; }
+
+  /// \brief Returns the literals of this predicate, empty for unary predicates.
+  const std::vector<Literal>& literals() const { return literals_; }
+
+  Operation op() const override { return op_; }
+
+  std::string ToString() const override;
+
+  std::shared_ptr<Expression> Negate() const override;
+
+  bool Equals(const Expression& other) const override;
+
+  /// \brief Returns whether the operation of a predicate does not take any literal.
+  static bool IsUnaryOperation(Operation op);
+
+  /// \brief Returns whether the operation of a predicate takes exactly one literal.
+  static bool IsLiteralOperation(Operation op);
+
+  /// \brief Returns whether the operation of a predicate takes a set of literals.
+  static bool IsSetOperation(Operation op);
+
+ private:
+  Operation op_;
+  std::string column_name_;
+  std::vector<Literal> literals_;
+};
+
+}  // namespace iceberg
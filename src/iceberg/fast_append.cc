@@ -0,0 +1,181 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/fast_append.h"
+
+#include <algorithm>
+#include <map>
+#include <unordered_set>
+
+#include "iceberg/expression/literal.h"
+#include "iceberg/manifest_entry.h"
+#include "iceberg/manifest_reader.h"
+#include "iceberg/parallel_manifest_writer.h"
+#include "iceberg/partition_spec.h"
+#include "iceberg/schema.h"
+#include "iceberg/snapshot.h"
+#include "iceberg/table_metadata.h"
+#include "iceberg/util/macros.h"
+#include "iceberg/util/partition_key_internal.h"
+
+namespace iceberg {
+
+namespace {
+
+/// \brief Returns a key that is equal for equal partition tuples of a partition spec.
+Result<std::string> PartitionKey(int32_t spec_id, const std::vector<Literal>& partition) {
+  std::string key(reinterpret_cast<const char*>(&spec_id), sizeof(spec_id));
+  ICEBERG_ASSIGN_OR_RAISE(auto partition_key, PartitionKey(partition));
+  return key + partition_key;
+}
+
+}  // namespace
+
+FastAppend::FastAppend(const Table& table) : SnapshotProducer(table) {}
+
+FastAppend& FastAppend::AppendFile(std::shared_ptr<DataFile> file) {
+  if (file != nullptr) {
+    added_records_ += file->record_count;
+    added_files_size_ += file->file_size_in_bytes;
+  }
+  files_.push_back(std::move(file));
+  return *this;
+}
+
+FastAppend& FastAppend::ValidateNoConflictingFiles() {
+  validate_no_conflicting_files_ = true;
+  return *this;
+}
+
+FastAppend& FastAppend::ValidateNoConflictingPartitions() {
+  validate_no_conflicting_partitions_ = true;
+  return *this;
+}
+
+std::string FastAppend::operation() const { return DataOperation::kAppend; }
+
+Status FastAppend::WriteNewManifests(const TableMetadata& base) {
+  std::map<int32_t, std::vector<ManifestEntry>> entries_by_spec;
+  partitions_.clear();
+  for (const auto& file : files_) {
+    if (file == nullptr) {
+      return InvalidArgument("Cannot append a null data file");
+    }
+    if (file->content != DataFile::Content::kData) {
+      return InvalidArgument("Cannot append delete file {} as a data file",
+                             file->file_path);
+    }
+    ICEBERG_ASSIGN_OR_RAISE(auto key,
+                            PartitionKey(file->partition_spec_id, file->partition));
+    partitions_.insert(std::move(key));
+    entries_by_spec[file->partition_spec_id].push_back(
+        ManifestEntry{.status = ManifestStatus::kAdded,
+                      .snapshot_id = snapshot_id(),
+                      .sequence_number = std::nullopt,
+                      .file_sequence_number = std::nullopt,
+                      .data_file = file});
+  }
+
+  for (const auto& [spec_id, entries] : entries_by_spec) {
+    auto spec = std::ranges::find_if(base.partition_specs, [spec_id](const auto& spec) {
+      return spec->spec_id() == spec_id;
+    });
+    if (spec == base.partition_specs.end()) {
+      return InvalidArgument("Cannot append files of unknown partition spec {}", spec_id);
+    }
+    ICEBERG_ASSIGN_OR_RAISE(auto partition_schema, (*spec)->PartitionSchema());
+    ParallelManifestWriterOptions options{
+        .format_version = base.format_version,
+        .snapshot_id = snapshot_id(),
+        .partition_spec_id = spec_id,
+        .partition_schema = std::move(partition_schema),
+        .io = io(),
+        .new_manifest_location = [this]() { return NewManifestLocation(); },
+        .properties = base.properties,
+    };
+    ICEBERG_ASSIGN_OR_RAISE(auto written,
+                            ParallelManifestWriter::Write(entries, options));
+    std::ranges::move(written, std::back_inserter(added_manifests_));
+  }
+  return {};
+}
+
+Result<std::vector<ManifestFile>> FastAppend::Apply(
+    const TableMetadata& base, const std::shared_ptr<Snapshot>& parent) {
+  // The new manifests do not depend on the base metadata, so they are written once and
+  // reused if the commit is retried.
+  if (added_manifests_.empty() && !files_.empty()) {
+    ICEBERG_RETURN_UNEXPECTED(WriteNewManifests(base));
+  }
+
+  std::vector<ManifestFile> manifests = added_manifests_;
+  if (parent != nullptr) {
+    ICEBERG_ASSIGN_OR_RAISE(auto manifest_list_reader,
+                            ManifestListReader::Make(parent->manifest_list, io()));
+    ICEBERG_ASSIGN_OR_RAISE(auto existing, manifest_list_reader->Files());
+    std::ranges::move(existing, std::back_inserter(manifests));
+  }
+  return manifests;
+}
+
+std::unordered_map<std::string, std::string> FastAppend::Summary() const {
+  return {
+      {SnapshotSummaryFields::kAddedDataFiles, std::to_string(files_.size())},
+      {SnapshotSummaryFields::kAddedRecords, std::to_string(added_records_)},
+      {SnapshotSummaryFields::kAddedFileSize, std::to_string(added_files_size_)},
+      {SnapshotSummaryFields::kChangedPartitionCountProp,
+       std::to_string(partitions_.size())},
+  };
+}
+
+Status FastAppend::Validate(const TableMetadata& current,
+                            const std::shared_ptr<Snapshot>& base_snapshot) {
+  if (!validate_no_conflicting_files_ && !validate_no_conflicting_partitions_) {
+    return {};
+  }
+  std::unordered_set<std::string_view> paths;
+  if (validate_no_conflicting_files_) {
+    for (const auto& file : files_) {
+      paths.insert(file->file_path);
+    }
+  }
+  return ForEachFileAddedSince(
+      current, base_snapshot, [&](const DataFile& file) -> Status {
+        if (paths.contains(file.file_path)) {
+          return ValidationFailed("Data file {} was added concurrently", file.file_path);
+        }
+        if (validate_no_conflicting_partitions_) {
+          ICEBERG_ASSIGN_OR_RAISE(auto key,
+                                  PartitionKey(file.partition_spec_id, file.partition));
+          if (partitions_.contains(key)) {
+            return ValidationFailed(
+                "Data file {} was added concurrently to a partition of the appended "
+                "files",
+                file.file_path);
+          }
+        }
+        return {};
+      });
+}
+
+void FastAppend::CleanUncommitted(const std::vector<ManifestFile>& committed) {
+  DeleteUncommittedManifests(added_manifests_, committed);
+}
+
+}  // namespace iceberg
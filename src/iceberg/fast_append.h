@@ -0,0 +1,105 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+/// \file iceberg/fast_append.h
+/// Appends data files by adding new manifests to the manifest list.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "iceberg/append_files.h"
+#include "iceberg/iceberg_export.h"
+#include "iceberg/manifest_list.h"
+#include "iceberg/result.h"
+#include "iceberg/snapshot_producer.h"
+#include "iceberg/type_fwd.h"
+
+namespace iceberg {
+
+/// \brief AppendFiles that writes the appended files into new manifests and keeps the
+/// manifests of the current snapshot as they are.
+///
+/// The manifests of the current snapshot are carried into the new manifest list by
+/// reference, without reading or rewriting them, and the totals of the snapshot
+/// summary are derived from the summary of the current snapshot. The cost of a commit
+/// is therefore proportional to the number of appended files rather than to the size
+/// of the table. New files of a partition spec are written into one manifest unless
+/// they exceed the target manifest size (ManifestWriterProperties::kTargetSizeBytes).
+///
+/// If the commit is retried after a concurrent commit, the written manifests are reused
+/// and only the manifest list is written again. Appends do not conflict with each other
+/// unless ValidateNoConflictingFiles() or ValidateNoConflictingPartitions() is set.
+///
+/// Since manifests are never merged, frequent appends accumulate small manifests that
+/// are compacted by RewriteManifests.
+class ICEBERG_EXPORT FastAppend : public AppendFiles, public SnapshotProducer {
+ public:
+  explicit FastAppend(const Table& table);
+
+  FastAppend& AppendFile(std::shared_ptr<DataFile> file) override;
+
+  /// \brief Fail the commit if a data file with the path of an appended file was added
+  /// concurrently.
+  FastAppend& ValidateNoConflictingFiles();
+
+  /// \brief Fail the commit if a data file was added concurrently to a partition that
+  /// files are appended to, e.g. when the partitions are overwritten by appending.
+  FastAppend& ValidateNoConflictingPartitions();
+
+  Status Commit() override { return SnapshotProducer::Commit(); }
+
+  /// \brief Returns the manifests written for the appended files.
+  const std::vector<ManifestFile>& added_manifests() const { return added_manifests_; }
+
+ protected:
+  std::string operation() const override;
+
+  Result<std::vector<ManifestFile>> Apply(
+      const TableMetadata& base, const std::shared_ptr<Snapshot>& parent) override;
+
+  std::unordered_map<std::string, std::string> Summary() const override;
+
+  Status Validate(const TableMetadata& current,
+                  const std::shared_ptr<Snapshot>& base_snapshot) override;
+
+  void CleanUncommitted(const std::vector<ManifestFile>& committed) override;
+
+  bool HasChanges() const override { return !files_.empty(); }
+
+ private:
+  /// \brief Write the appended files into new manifests.
+  Status WriteNewManifests(const TableMetadata& base);
+
+  std::vector<std::shared_ptr<DataFile>> files_;
+  std::vector<ManifestFile> added_manifests_;
+  int64_t added_records_ = 0;
+  int64_t added_files_size_ = 0;
+  /// \brief The partitions of the appended files, set by WriteNewManifests().
+  std::unordered_set<std::string> partitions_;
+  bool validate_no_conflicting_files_ = false;
+  bool validate_no_conflicting_partitions_ = false;
+};
+
+}  // namespace iceberg
@@ -0,0 +1,155 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/file_metadata_cache.h"
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace iceberg {
+
+class FileMetadataCache::Impl {
+ public:
+  explicit Impl(int64_t capacity_bytes) : capacity_bytes_(capacity_bytes) {}
+
+  std::shared_ptr<const Entry> Get(const std::string& key) {
+    std::lock_guard lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+      ++misses_;
+      return nullptr;
+    }
+    ++hits_;
+    lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+    return it->second.entry;
+  }
+
+  void Put(const std::string& key, std::shared_ptr<const Entry> entry, int64_t charge) {
+    std::lock_guard lock(mutex_);
+    Erase(key);
+    if (entry == nullptr || charge > capacity_bytes_) {
+      return;
+    }
+    lru_.push_front(key);
+    entries_.emplace(key, Slot{.entry = std::move(entry),
+                               .charge = charge,
+                               .lru_position = lru_.begin()});
+    size_bytes_ += charge;
+    while (size_bytes_ > capacity_bytes_) {
+      std::string victim = lru_.back();
+      Erase(victim);
+      ++evictions_;
+    }
+  }
+
+  void Clear() {
+    std::lock_guard lock(mutex_);
+    entries_.clear();
+    lru_.clear();
+    size_bytes_ = 0;
+  }
+
+  int64_t capacity_bytes() const { return capacity_bytes_; }
+
+  int64_t size_bytes() const {
+    std::lock_guard lock(mutex_);
+    return size_bytes_;
+  }
+
+  int64_t size() const {
+    std::lock_guard lock(mutex_);
+    return static_cast<int64_t>(entries_.size());
+  }
+
+  int64_t hits() const {
+    std::lock_guard lock(mutex_);
+    return hits_;
+  }
+
+  int64_t misses() const {
+    std::lock_guard lock(mutex_);
+    return misses_;
+  }
+
+  int64_t evictions() const {
+    std::lock_guard lock(mutex_);
+    return evictions_;
+  }
+
+ private:
+  struct Slot {
+    std::shared_ptr<const Entry> entry;
+    int64_t charge;
+    std::list<std::string>::iterator lru_position;
+  };
+
+  // Remove the entry of `key` if present. The mutex must be held.
+  void Erase(const std::string& key) {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+      return;
+    }
+    size_bytes_ -= it->second.charge;
+    lru_.erase(it->second.lru_position);
+    entries_.erase(it);
+  }
+
+  const int64_t capacity_bytes_;
+  mutable std::mutex mutex_;
+  // Keys from the most to the least recently used.
+  std::list<std::string> lru_;
+  std::unordered_map<std::string, Slot> entries_;
+  int64_t size_bytes_ = 0;
+  int64_t hits_ = 0;
+  int64_t misses_ = 0;
+  int64_t evictions_ = 0;
+};
+
+FileMetadataCache::FileMetadataCache(int64_t capacity_bytes)
+    : impl_(std::make_unique<Impl>(capacity_bytes)) {}
+
+FileMetadataCache::~FileMetadataCache() = default;
+
+std::shared_ptr<const FileMetadataCache::Entry> FileMetadataCache::Get(
+    const std::string& key) {
+  return impl_->Get(key);
+}
+
+void FileMetadataCache::Put(const std::string& key, std::shared_ptr<const Entry> entry,
+                            int64_t charge) {
+  impl_->Put(key, std::move(entry), charge);
+}
+
+void FileMetadataCache::Clear() { impl_->Clear(); }
+
+int64_t FileMetadataCache::capacity_bytes() const { return impl_->capacity_bytes(); }
+
+int64_t FileMetadataCache::size_bytes() const { return impl_->size_bytes(); }
+
+int64_t FileMetadataCache::size() const { return impl_->size(); }
+
+int64_t FileMetadataCache::hits() const { return impl_->hits(); }
+
+int64_t FileMetadataCache::misses() const { return impl_->misses(); }
+
+int64_t FileMetadataCache::evictions() const { return impl_->evictions(); }
+
+}  // namespace iceberg
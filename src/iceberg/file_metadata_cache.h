@@ -0,0 +1,92 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+/// \file iceberg/file_metadata_cache.h
+/// Cache of file metadata shared by readers across opens of the same file.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "iceberg/iceberg_export.h"
+
+namespace iceberg {
+
+/// \brief A thread-safe LRU cache of file metadata bounded by memory.
+///
+/// Readers given a cache in ReaderOptions store the metadata they parse when a file is
+/// opened, e.g. the Parquet footer, and reuse it the next time the same file is opened.
+/// Keys are chosen by the file format implementation and identify a version of a file,
+/// so entries never need to be invalidated. The least recently used entries are
+/// evicted once the total charge of the entries exceeds the capacity.
+class ICEBERG_EXPORT FileMetadataCache {
+ public:
+  /// \brief Format-specific metadata cached for a file.
+  struct Entry {
+    virtual ~Entry() = default;
+  };
+
+  /// \brief Create a cache holding entries with a total charge of `capacity_bytes`.
+  explicit FileMetadataCache(int64_t capacity_bytes);
+  ~FileMetadataCache();
+
+  FileMetadataCache(const FileMetadataCache&) = delete;
+  FileMetadataCache& operator=(const FileMetadataCache&) = delete;
+
+  /// \brief Returns the entry of `key` and marks it as most recently used, or null if
+  /// it is not cached.
+  std::shared_ptr<const Entry> Get(const std::string& key);
+
+  /// \brief Insert or replace the entry of `key`.
+  ///
+  /// \param key The key of the entry.
+  /// \param entry The entry to cache.
+  /// \param charge The approximate memory usage of the entry in bytes. Entries larger
+  /// than the capacity are not cached.
+  void Put(const std::string& key, std::shared_ptr<const Entry> entry, int64_t charge);
+
+  /// \brief Remove all entries.
+  void Clear();
+
+  /// \brief Returns the max total charge of the cached entries.
+  int64_t capacity_bytes() const;
+
+  /// \brief Returns the total charge of the cached entries.
+  int64_t size_bytes() const;
+
+  /// \brief Returns the number of cached entries.
+  int64_t size() const;
+
+  /// \brief Returns the number of lookups that found an entry.
+  int64_t hits() const;
+
+  /// \brief Returns the number of lookups that did not find an entry.
+  int64_t misses() const;
+
+  /// \brief Returns the number of entries evicted to stay within the capacity.
+  int64_t evictions() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace iceberg
@@ -37,6 +37,13 @@ ReaderFactory GetNotImplementedFactory(FileFormatType format_type) {
 
 }  // namespace
 
+ReaderProperties ReaderProperties::FromMap(
+    const std::unordered_map<std::string, std::string>& properties) {
+  ReaderProperties reader_properties;
+  reader_properties.configs_ = properties;
+  return reader_properties;
+}
+
 ReaderFactory& ReaderFactoryRegistry::GetFactory(FileFormatType format_type) {
   static std::unordered_map<FileFormatType, ReaderFactory> factories = {
       {FileFormatType::kAvro, GetNotImplementedFactory(FileFormatType::kAvro)},
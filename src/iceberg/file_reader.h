@@ -25,11 +25,14 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <string>
+#include <unordered_map>
 
 #include "iceberg/arrow_c_data.h"
 #include "iceberg/file_format.h"
 #include "iceberg/result.h"
 #include "iceberg/type_fwd.h"
+#include "iceberg/util/config.h"
 
 namespace iceberg {
 
@@ -64,6 +67,52 @@ struct ICEBERG_EXPORT Split {
   size_t length;
 };
 
+/// \brief Well-known entries of `ReaderOptions::properties`.
+///
+/// Reader implementations ignore entries that do not apply to their file format.
+class ICEBERG_EXPORT ReaderProperties : public ConfigBase<ReaderProperties> {
+ public:
+  template <typename T>
+  using Entry = const ConfigBase<ReaderProperties>::Entry<T>;
+
+  /// \brief Whether to issue the reads of all selected column chunks of a row group
+  /// up front instead of one read per column chunk when it is decoded.
+  inline static Entry<bool> kParquetPreBuffer{"read.parquet.pre-buffer", true};
+  /// \brief Number of bytes at the end of the file fetched by the first read when the
+  /// file is opened. The footer is parsed from them if it fits, so that opening a file
+  /// of known `ReaderOptions::length` takes a single request. Otherwise, the rest of the
+  /// footer is fetched by a second read.
+  inline static Entry<int64_t> kParquetFooterReadSize{"read.parquet.footer-read-size",
+                                                      64 * 1024};
+  /// \brief Two pre-buffered byte ranges closer than this are fetched in a single read,
+  /// reading the bytes in between as well.
+  inline static Entry<int64_t> kParquetIoCoalesceHoleSizeLimit{
+      "read.parquet.io-coalesce-hole-size-limit", 8 * 1024};
+  /// \brief Coalesced byte ranges are not extended beyond this size.
+  inline static Entry<int64_t> kParquetIoCoalesceRangeSizeLimit{
+      "read.parquet.io-coalesce-range-size-limit", 32 * 1024 * 1024};
+  /// \brief Number of threads to issue pre-buffered reads with. Readers with the same
+  /// number of threads share one thread pool. Zero or a negative value uses the
+  /// process-wide I/O thread pool shared by all readers.
+  inline static Entry<int32_t> kParquetIoThreads{"read.parquet.io-threads", 0};
+  /// \brief Whether to decode the columns of a row group in parallel.
+  inline static Entry<bool> kParquetUseThreads{"read.parquet.use-threads", false};
+  /// \brief Max number of row groups of a file that are read and decoded concurrently.
+  /// Batches are still returned in file order. Zero reads the row groups one by one
+  /// on the calling thread. Memory usage grows with the number of in-flight row groups.
+  inline static Entry<int32_t> kParquetMaxInFlightRowGroups{
+      "read.parquet.max-in-flight-row-groups", 0};
+  /// \brief String and binary columns to read as Arrow dictionary arrays, given as a
+  /// comma-separated list of field ids, or `*` for all of them. This avoids decoding
+  /// dictionary-encoded Parquet column chunks into plain arrays.
+  inline static Entry<std::string> kParquetReadDictionary{"read.parquet.read-dictionary",
+                                                          ""};
+
+  /// \brief Create the properties from `ReaderOptions::properties`.
+  static ReaderProperties FromMap(
+      const std::unordered_map<std::string, std::string>& properties);
+};
+
 /// \brief Options for creating a reader.
 struct ICEBERG_EXPORT ReaderOptions {
   static constexpr int64_t kDefaultBatchSize = 4096;
@@ -89,7 +138,18 @@ struct ICEBERG_EXPORT ReaderOptions {
   /// \brief Name mapping for schema evolution compatibility. Used when reading files
   /// that may have different field names than the current schema.
   std::shared_ptr<class NameMapping> name_mapping;
-  /// \brief Format-specific or implementation-specific properties.
+  /// \brief The memory pool to allocate the data read from. Reader implementations
+  /// should down cast it to the specific MemoryPool implementation. If null, the
+  /// default pool of the implementation is used.
+  std::shared_ptr<class MemoryPool> memory_pool;
+  /// \brief The cache of file metadata shared with other readers. If set, reader
+  /// implementations that support it reuse the metadata parsed by a previous open of
+  /// the same file. A file is identified by its path and `length`, or, if the length is
+  /// unknown, by the size and modification time reported by the file system. If null,
+  /// the metadata is read every time the file is opened.
+  std::shared_ptr<class FileMetadataCache> metadata_cache;
+  /// \brief Format-specific or implementation-specific properties. See
+  /// `ReaderProperties` for the well-known keys.
   std::unordered_map<std::string, std::string> properties;
 };
 
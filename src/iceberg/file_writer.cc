@@ -37,6 +37,13 @@ WriterFactory GetNotImplementedFactory(FileFormatType format_type) {
 
 }  // namespace
 
+WriterProperties WriterProperties::FromMap(
+    const std::unordered_map<std::string, std::string>& properties) {
+  WriterProperties writer_properties;
+  writer_properties.configs_ = properties;
+  return writer_properties;
+}
+
 WriterFactory& WriterFactoryRegistry::GetFactory(FileFormatType format_type) {
   static std::unordered_map<FileFormatType, WriterFactory> factories = {
       {FileFormatType::kAvro, GetNotImplementedFactory(FileFormatType::kAvro)},
@@ -25,15 +25,71 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 
 #include "iceberg/arrow_c_data.h"
 #include "iceberg/file_format.h"
 #include "iceberg/metrics.h"
 #include "iceberg/result.h"
 #include "iceberg/type_fwd.h"
+#include "iceberg/util/config.h"
 
 namespace iceberg {
 
+/// \brief Well-known entries of `WriterOptions::properties`.
+///
+/// The keys are the Iceberg table properties of the same name. Writer implementations
+/// ignore entries that do not apply to their file format.
+class ICEBERG_EXPORT WriterProperties : public ConfigBase<WriterProperties> {
+ public:
+  template <typename T>
+  using Entry = const ConfigBase<WriterProperties>::Entry<T>;
+
+  /// \brief Size at which RollingFileWriter closes a data file and starts a new one.
+  inline static Entry<int64_t> kTargetFileSizeBytes{"write.target-file-size-bytes",
+                                                    512 * 1024 * 1024};
+
+  /// \brief Compression codec of Parquet column chunks: "zstd", "snappy", "gzip",
+  /// "lz4", "brotli" or "uncompressed". "lz4" is written as Parquet's LZ4_RAW codec.
+  /// Setting a codec that is not available in the Arrow build is an error, while the
+  /// default falls back to "uncompressed" if ZSTD is not available.
+  inline static Entry<std::string> kParquetCompressionCodec{
+      "write.parquet.compression-codec", "zstd"};
+  /// \brief Compression level of the codec. Empty uses the default level of the codec.
+  inline static Entry<std::string> kParquetCompressionLevel{
+      "write.parquet.compression-level", ""};
+  /// \brief Target encoded size of a row group. The size of the buffered rows is
+  /// estimated from their in-memory size, scaled by the ratio of encoded to in-memory
+  /// size of the row groups written so far. Larger row groups compress better and need
+  /// fewer reads to scan, smaller ones take less memory to write and allow finer splits.
+  inline static Entry<int64_t> kParquetRowGroupSizeBytes{
+      "write.parquet.row-group-size-bytes", 128 * 1024 * 1024};
+  /// \brief Target size of a data page before compression.
+  inline static Entry<int64_t> kParquetPageSizeBytes{"write.parquet.page-size-bytes",
+                                                     1024 * 1024};
+  /// \brief Max size of a dictionary page. Column chunks whose dictionary grows larger
+  /// fall back to plain encoding.
+  inline static Entry<int64_t> kParquetDictSizeBytes{"write.parquet.dict-size-bytes",
+                                                     2 * 1024 * 1024};
+
+  /// \brief Prefix of the compression codec of a column, followed by the full name of
+  /// the column, e.g. "write.parquet.compression-codec.column.location.lat".
+  static constexpr std::string_view kParquetColumnCompressionCodecPrefix =
+      "write.parquet.compression-codec.column.";
+  /// \brief Prefix of the compression level of a column.
+  static constexpr std::string_view kParquetColumnCompressionLevelPrefix =
+      "write.parquet.compression-level.column.";
+  /// \brief Prefix of whether to dictionary-encode a column, "true" or "false".
+  static constexpr std::string_view kParquetColumnDictEnabledPrefix =
+      "write.parquet.dict-enabled.column.";
+
+  /// \brief Create the properties from `WriterOptions::properties`.
+  static WriterProperties FromMap(
+      const std::unordered_map<std::string, std::string>& properties);
+};
+
 /// \brief Options for creating a writer.
 struct ICEBERG_EXPORT WriterOptions {
   /// \brief The path to the file to write.
@@ -44,6 +100,10 @@ struct ICEBERG_EXPORT WriterOptions {
   /// to the specific FileIO implementation. By default, the `iceberg-bundle` library uses
   /// `ArrowFileSystemFileIO` as the default implementation.
   std::shared_ptr<class FileIO> io;
+  /// \brief The memory pool to allocate buffers for encoding and compressing data from.
+  /// Writer implementations should down cast it to the specific MemoryPool
+  /// implementation. If null, the default pool of the implementation is used.
+  std::shared_ptr<class MemoryPool> memory_pool;
   /// \brief Format-specific or implementation-specific properties.
   std::unordered_map<std::string, std::string> properties;
 };
@@ -72,7 +132,11 @@ class ICEBERG_EXPORT Writer {
   virtual std::optional<Metrics> metrics() = 0;
 
   /// \brief Get the file length.
-  /// Only valid after the file is closed.
+  ///
+  /// After the file is closed, returns its exact length. While the writer is open,
+  /// returns the estimated length of the file if the data written so far were flushed,
+  /// including the data buffered in memory, or std::nullopt if the writer cannot
+  /// estimate it.
   virtual std::optional<int64_t> length() = 0;
 
   /// \brief Returns a list of recommended split locations, if applicable, empty
@@ -0,0 +1,231 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/group_committer.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "iceberg/catalog.h"
+#include "iceberg/exception.h"
+#include "iceberg/fast_append.h"
+#include "iceberg/manifest_entry.h"
+#include "iceberg/partition_spec.h"
+#include "iceberg/table.h"
+#include "iceberg/table_metadata.h"
+#include "iceberg/util/macros.h"
+
+namespace iceberg {
+
+namespace {
+
+/// \brief Returns an error if a file does not belong to a partition spec of the table.
+Status ValidatePartitions(const TableMetadata& metadata,
+                          const std::vector<std::shared_ptr<DataFile>>& files) {
+  for (const auto& file : files) {
+    auto spec = std::ranges::find_if(metadata.partition_specs, [&](const auto& spec) {
+      return spec->spec_id() == file->partition_spec_id;
+    });
+    if (spec == metadata.partition_specs.end()) {
+      return InvalidArgument("Cannot append file {} of unknown partition spec {}",
+                             file->file_path, file->partition_spec_id);
+    }
+    if (file->partition.size() != (*spec)->fields().size()) {
+      return InvalidArgument(
+          "Cannot append file {} with {} partition values to partition spec {} of {} "
+          "fields",
+          file->file_path, file->partition.size(), file->partition_spec_id,
+          (*spec)->fields().size());
+    }
+  }
+  return {};
+}
+
+/// \brief AppendFiles that commits its files through a GroupCommitter.
+class GroupAppend : public AppendFiles {
+ public:
+  explicit GroupAppend(GroupCommitter& committer) : committer_(committer) {}
+
+  GroupAppend& AppendFile(std::shared_ptr<DataFile> file) override {
+    files_.push_back(std::move(file));
+    return *this;
+  }
+
+  Status Commit() override {
+    auto result = committer_.Submit(std::exchange(files_, {})).get();
+    ICEBERG_RETURN_UNEXPECTED(result);
+    return {};
+  }
+
+ private:
+  GroupCommitter& committer_;
+  std::vector<std::shared_ptr<DataFile>> files_;
+};
+
+}  // namespace
+
+GroupCommitter::GroupCommitter(std::shared_ptr<Catalog> catalog,
+                               TableIdentifier identifier, GroupCommitOptions options)
+    : catalog_(std::move(catalog)),
+      identifier_(std::move(identifier)),
+      options_(options) {
+  ICEBERG_CHECK(options_.max_batch_requests > 0,
+                "Max batch requests must be positive, got {}",
+                options_.max_batch_requests);
+  ICEBERG_CHECK(options_.max_batch_files > 0, "Max batch files must be positive, got {}",
+                options_.max_batch_files);
+  worker_ = std::jthread([this]() { Run(); });
+}
+
+GroupCommitter::~GroupCommitter() {
+  {
+    std::lock_guard lock(mutex_);
+    stopping_ = true;
+  }
+  cv_.notify_all();
+  worker_.join();
+}
+
+std::future<Result<std::shared_ptr<Snapshot>>> GroupCommitter::Submit(
+    std::vector<std::shared_ptr<DataFile>> files) {
+  std::promise<Result<std::shared_ptr<Snapshot>>> promise;
+  auto future = promise.get_future();
+  // Reject invalid files here so that they do not fail the commit of other requests.
+  if (files.empty()) {
+    promise.set_value(InvalidArgument("Cannot commit an append without files"));
+    return future;
+  }
+  for (const auto& file : files) {
+    if (file == nullptr) {
+      promise.set_value(InvalidArgument("Cannot append a null data file"));
+      return future;
+    }
+    if (file->content != DataFile::Content::kData) {
+      promise.set_value(InvalidArgument("Cannot append delete file {} as a data file",
+                                        file->file_path));
+      return future;
+    }
+  }
+
+  {
+    std::lock_guard lock(mutex_);
+    if (stopping_) {
+      promise.set_value(Invalid("Cannot submit to a closed group committer"));
+      return future;
+    }
+    if (pending_.empty()) {
+      oldest_pending_ = std::chrono::steady_clock::now();
+    }
+    pending_files_ += static_cast<int64_t>(files.size());
+    pending_.push_back(Request{.files = std::move(files), .promise = std::move(promise)});
+  }
+  cv_.notify_all();
+  return future;
+}
+
+std::unique_ptr<AppendFiles> GroupCommitter::NewAppend() {
+  return std::make_unique<GroupAppend>(*this);
+}
+
+void GroupCommitter::Flush() {
+  {
+    std::lock_guard lock(mutex_);
+    if (pending_.empty()) {
+      return;
+    }
+    flush_requested_ = true;
+  }
+  cv_.notify_all();
+}
+
+void GroupCommitter::Run() {
+  std::unique_lock lock(mutex_);
+  while (true) {
+    cv_.wait(lock, [this]() { return stopping_ || !pending_.empty(); });
+    if (pending_.empty()) {
+      break;
+    }
+
+    // Wait for more requests until the oldest one has waited for max_delay, unless
+    // the batch is already full.
+    cv_.wait_until(lock, oldest_pending_ + options_.max_delay, [this]() {
+      return stopping_ || flush_requested_ ||
+             std::cmp_greater_equal(pending_.size(), options_.max_batch_requests) ||
+             pending_files_ >= options_.max_batch_files;
+    });
+
+    std::vector<Request> batch;
+    int64_t batch_files = 0;
+    while (!pending_.empty() &&
+           std::cmp_less(batch.size(), options_.max_batch_requests)) {
+      auto request_files = static_cast<int64_t>(pending_.front().files.size());
+      if (!batch.empty() && batch_files + request_files > options_.max_batch_files) {
+        break;
+      }
+      batch_files += request_files;
+      batch.push_back(std::move(pending_.front()));
+      pending_.pop_front();
+    }
+    pending_files_ -= batch_files;
+    if (pending_.empty()) {
+      flush_requested_ = false;
+    }
+
+    lock.unlock();
+    Result<std::shared_ptr<Snapshot>> result;
+    try {
+      result = CommitBatch(batch);
+    } catch (const std::exception& e) {
+      // An exception would terminate the worker thread and leave the futures pending.
+      result = UnknownError("Failed to commit to table {}: {}", identifier_.name,
+                            e.what());
+    }
+    for (auto& request : batch) {
+      request.promise.set_value(result);
+    }
+    lock.lock();
+  }
+}
+
+Result<std::shared_ptr<Snapshot>> GroupCommitter::CommitBatch(
+    std::vector<Request>& batch) {
+  ICEBERG_ASSIGN_OR_RAISE(auto table, catalog_->LoadTable(identifier_));
+  std::erase_if(batch, [&](Request& request) {
+    auto status = ValidatePartitions(*table->metadata(), request.files);
+    if (status.has_value()) {
+      return false;
+    }
+    request.promise.set_value(std::unexpected(status.error()));
+    return true;
+  });
+  if (batch.empty()) {
+    return nullptr;
+  }
+
+  FastAppend append(*table);
+  for (const auto& request : batch) {
+    for (const auto& file : request.files) {
+      append.AppendFile(file);
+    }
+  }
+  ICEBERG_RETURN_UNEXPECTED(append.Commit());
+  return append.committed_snapshot();
+}
+
+}  // namespace iceberg
@@ -0,0 +1,123 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+/// \file iceberg/group_committer.h
+/// Coalesces concurrent appends to a table into shared commits.
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "iceberg/append_files.h"
+#include "iceberg/iceberg_export.h"
+#include "iceberg/result.h"
+#include "iceberg/table_identifier.h"
+#include "iceberg/type_fwd.h"
+
+namespace iceberg {
+
+/// \brief Options for GroupCommitter.
+struct ICEBERG_EXPORT GroupCommitOptions {
+  /// \brief How long a request waits for other requests to join its commit.
+  std::chrono::milliseconds max_delay{10};
+  /// \brief Max number of requests in one commit. A full batch is committed without
+  /// waiting for the rest of `max_delay`.
+  int32_t max_batch_requests = 1000;
+  /// \brief Max number of data files in one commit. A batch with this many files is
+  /// committed without waiting for the rest of `max_delay`.
+  int64_t max_batch_files = 100000;
+};
+
+/// \brief Commits the appends of many writers to one table as few snapshots.
+///
+/// Each append request is buffered for up to `max_delay`, or until the batch is
+/// full, and the files of all buffered requests are committed by one FastAppend. The
+/// batch therefore produces one manifest, one manifest list, one snapshot and one
+/// metadata file instead of one of each per request, and its requests do not conflict
+/// with each other. The future of every request in the batch is completed with the
+/// committed snapshot, or the error of the commit.
+///
+/// Requests with invalid files are rejected without failing the other requests of their
+/// batch: those without files, with null or delete files are rejected by Submit(), and
+/// those with files of an unknown partition spec, or with partition tuples that do not
+/// match their spec, are rejected before their batch is committed.
+///
+/// Commits run on a background thread, one batch at a time. Destroying the committer
+/// commits the requests that are still buffered.
+class ICEBERG_EXPORT GroupCommitter {
+ public:
+  /// \brief Create a committer for a table of a catalog.
+  ///
+  /// \throws IcebergError if `max_batch_requests` or `max_batch_files` is not positive.
+  GroupCommitter(std::shared_ptr<Catalog> catalog, TableIdentifier identifier,
+                 GroupCommitOptions options = {});
+
+  ~GroupCommitter();
+
+  GroupCommitter(const GroupCommitter&) = delete;
+  GroupCommitter& operator=(const GroupCommitter&) = delete;
+
+  /// \brief Buffer a request to append `files` and return the future result of its
+  /// commit.
+  std::future<Result<std::shared_ptr<Snapshot>>> Submit(
+      std::vector<std::shared_ptr<DataFile>> files);
+
+  /// \brief Create an AppendFiles whose Commit() submits its files to this committer
+  /// and waits for the result. It must not outlive the committer.
+  std::unique_ptr<AppendFiles> NewAppend();
+
+  /// \brief Commit the buffered requests without waiting for the rest of the window.
+  void Flush();
+
+ private:
+  struct Request {
+    std::vector<std::shared_ptr<DataFile>> files;
+    std::promise<Result<std::shared_ptr<Snapshot>>> promise;
+  };
+
+  void Run();
+
+  /// \brief Commit the files of the valid requests of `batch` as one snapshot.
+  /// Requests that are invalid for the table are completed with their error and
+  /// removed from `batch`.
+  Result<std::shared_ptr<Snapshot>> CommitBatch(std::vector<Request>& batch);
+
+  std::shared_ptr<Catalog> catalog_;
+  const TableIdentifier identifier_;
+  const GroupCommitOptions options_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<Request> pending_;
+  std::chrono::steady_clock::time_point oldest_pending_;
+  int64_t pending_files_ = 0;
+  bool flush_requested_ = false;
+  bool stopping_ = false;
+  std::jthread worker_;
+};
+
+}  // namespace iceberg
@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <format>
+#include <optional>
 #include <regex>
 #include <type_traits>
 #include <unordered_set>
@@ -1196,10 +1197,11 @@ Result<std::unique_ptr<TableMetadata>> TableMetadataFromJson(const nlohmann::jso
         table_metadata->refs,
         FromJsonMap<std::shared_ptr<SnapshotRef>>(json, kRefs, SnapshotRefFromJson));
   } else if (table_metadata->current_snapshot_id != Snapshot::kInvalidSnapshotId) {
-    table_metadata->refs["main"] = std::make_unique<SnapshotRef>(SnapshotRef{
-        .snapshot_id = table_metadata->current_snapshot_id,
-        .retention = SnapshotRef::Branch{},
-    });
+    table_metadata->refs[SnapshotRef::kMainBranch] =
+        std::make_unique<SnapshotRef>(SnapshotRef{
+            .snapshot_id = table_metadata->current_snapshot_id,
+            .retention = SnapshotRef::Branch{},
+        });
   }
 
   ICEBERG_ASSIGN_OR_RAISE(table_metadata->snapshots,
@@ -1238,6 +1240,483 @@ Result<std::string> ToJsonString(const nlohmann::json& json) {
   }
 }
 
+namespace {
+
+/// \brief A SAX handler that parses table metadata without building a DOM of the
+/// whole document.
+///
+/// The snapshots, the snapshot log and the metadata log, which make up most of the
+/// metadata of long-lived tables, are parsed directly into their structs as they are
+/// read. The other members of the document are small; they are collected into a DOM
+/// that is converted by TableMetadataFromJson, so that they are validated the same way.
+class TableMetadataSaxHandler : public nlohmann::json_sax<nlohmann::json> {
+ public:
+  bool null() override { return Value(nlohmann::json(nullptr)); }
+  bool boolean(bool value) override { return Value(nlohmann::json(value)); }
+  bool number_integer(number_integer_t value) override {
+    return Value(nlohmann::json(value));
+  }
+  bool number_unsigned(number_unsigned_t value) override {
+    return Value(nlohmann::json(value));
+  }
+  bool number_float(number_float_t value, const string_t& /*text*/) override {
+    return Value(nlohmann::json(value));
+  }
+  bool binary(binary_t& value) override {
+    return Value(nlohmann::json::binary(std::move(value)));
+  }
+
+  bool string(string_t& value) override {
+    if (state_ == State::kEntryValue && IsStringField(entry_key_)) {
+      if (entry_key_ == kManifestList) {
+        snapshot_.manifest_list = std::move(value);
+        has_manifest_list_ = true;
+      } else {
+        metadata_log_entry_.metadata_file = std::move(value);
+        has_metadata_file_ = true;
+      }
+      state_ = State::kEntry;
+      return true;
+    }
+    if (state_ == State::kSummaryValue) {
+      if (entry_key_ == SnapshotSummaryFields::kOperation &&
+          !kValidDataOperation.contains(value)) {
+        return Fail(JsonParseError("Invalid snapshot operation: {}", value));
+      }
+      snapshot_.summary[std::move(entry_key_)] = std::move(value);
+      state_ = State::kSummary;
+      return true;
+    }
+    return Value(nlohmann::json(std::move(value)));
+  }
+
+  bool start_object(std::size_t /*size*/) override {
+    switch (state_) {
+      case State::kStart:
+        state_ = State::kObject;
+        return true;
+      case State::kStreamedList:
+        ResetEntry();
+        state_ = State::kEntry;
+        return true;
+      case State::kEntryValue:
+        if (list_ == StreamedList::kSnapshots && entry_key_ == kSummary) {
+          snapshot_.summary.clear();
+          has_summary_ = true;
+          state_ = State::kSummary;
+          return true;
+        }
+        return SkipOrFail();
+      case State::kSkip:
+        ++skip_depth_;
+        return true;
+      case State::kSummaryValue:
+        return Fail(JsonParseError("Invalid snapshot summary field value of '{}'",
+                                   entry_key_));
+      default:
+        return StartContainer(nlohmann::json::object());
+    }
+  }
+
+  bool start_array(std::size_t /*size*/) override {
+    switch (state_) {
+      case State::kMemberValue:
+        if (member_key_ == kSnapshots) {
+          list_ = StreamedList::kSnapshots;
+          snapshots_.emplace();
+        } else if (member_key_ == kSnapshotLog) {
+          list_ = StreamedList::kSnapshotLog;
+          snapshot_log_.emplace();
+        } else if (member_key_ == kMetadataLog) {
+          list_ = StreamedList::kMetadataLog;
+          metadata_log_.emplace();
+        } else {
+          return StartContainer(nlohmann::json::array());
+        }
+        state_ = State::kStreamedList;
+        return true;
+      case State::kEntryValue:
+        return SkipOrFail();
+      case State::kSkip:
+        ++skip_depth_;
+        return true;
+      case State::kStreamedList:
+        return Fail(
+            JsonParseError("Cannot parse '{}' entry from non-object", member_key_));
+      case State::kSummaryValue:
+        return Fail(JsonParseError("Invalid snapshot summary field value of '{}'",
+                                   entry_key_));
+      default:
+        return StartContainer(nlohmann::json::array());
+    }
+  }
+
+  bool key(string_t& value) override {
+    switch (state_) {
+      case State::kObject:
+        member_key_ = std::move(value);
+        state_ = State::kMemberValue;
+        return true;
+      case State::kEntry:
+        entry_key_ = std::move(value);
+        state_ = State::kEntryValue;
+        return true;
+      case State::kSummary:
+        entry_key_ = std::move(value);
+        state_ = State::kSummaryValue;
+        return true;
+      case State::kDom:
+        dom_key_ = &(*dom_stack_.back())[std::move(value)];
+        return true;
+      default:
+        return true;
+    }
+  }
+
+  bool end_object() override {
+    switch (state_) {
+      case State::kObject:
+        state_ = State::kDone;
+        return true;
+      case State::kEntry:
+        state_ = State::kStreamedList;
+        return FinishEntry();
+      case State::kSummary:
+        state_ = State::kEntry;
+        return true;
+      default:
+        return EndContainer();
+    }
+  }
+
+  bool end_array() override {
+    if (state_ == State::kStreamedList) {
+      state_ = State::kObject;
+      return true;
+    }
+    return EndContainer();
+  }
+
+  bool parse_error(std::size_t /*position*/, const std::string& /*last_token*/,
+                   const nlohmann::json::exception& ex) override {
+    return Fail(JsonParseError("Failed to parse JSON string: {}", ex.what()));
+  }
+
+  /// \brief Returns the table metadata once the document has been parsed.
+  ///
+  /// \param parsed Whether the parser accepted the document.
+  Result<std::unique_ptr<TableMetadata>> Finish(bool parsed) && {
+    if (error_.has_value()) {
+      return std::unexpected(std::move(*error_));
+    }
+    if (!parsed) {
+      return JsonParseError("Failed to parse table metadata JSON string");
+    }
+    ICEBERG_ASSIGN_OR_RAISE(auto table_metadata, TableMetadataFromJson(document_));
+    if (snapshots_.has_value()) {
+      table_metadata->snapshots = std::move(*snapshots_);
+    }
+    if (snapshot_log_.has_value()) {
+      table_metadata->snapshot_log = std::move(*snapshot_log_);
+    }
+    if (metadata_log_.has_value()) {
+      table_metadata->metadata_log = std::move(*metadata_log_);
+    }
+    return table_metadata;
+  }
+
+ private:
+  enum class State {
+    /// Before the document.
+    kStart,
+    /// In the document object, before a member or its end.
+    kObject,
+    /// Before the value of member `member_key_` of the document object.
+    kMemberValue,
+    /// In a value that is added to the DOM.
+    kDom,
+    /// In a streamed list, before an entry or its end.
+    kStreamedList,
+    /// In an entry of a streamed list, before a field or its end.
+    kEntry,
+    /// Before the value of field `entry_key_` of an entry.
+    kEntryValue,
+    /// In the summary of a snapshot, before a field or its end.
+    kSummary,
+    /// Before the value of field `entry_key_` of the summary of a snapshot.
+    kSummaryValue,
+    /// In an unknown field of an entry, which is skipped.
+    kSkip,
+    /// After the document.
+    kDone,
+  };
+
+  enum class StreamedList { kSnapshots, kSnapshotLog, kMetadataLog };
+
+  bool Fail(Error error) {
+    if (!error_.has_value()) {
+      error_ = std::move(error);
+    }
+    return false;
+  }
+
+  bool Fail(std::unexpected<Error> error) { return Fail(std::move(error).error()); }
+
+  bool IsStringField(std::string_view key) const {
+    return (list_ == StreamedList::kSnapshots && key == kManifestList) ||
+           (list_ == StreamedList::kMetadataLog && key == kMetadataFile);
+  }
+
+  bool IsKnownField(std::string_view key) const {
+    if (key == kTimestampMs) {
+      return true;
+    }
+    switch (list_) {
+      case StreamedList::kSnapshots:
+        return key == kSnapshotId || key == kParentSnapshotId ||
+               key == kSequenceNumber || key == kManifestList || key == kSummary ||
+               key == kSchemaId;
+      case StreamedList::kSnapshotLog:
+        return key == kSnapshotId;
+      case StreamedList::kMetadataLog:
+        return key == kMetadataFile;
+    }
+    return false;
+  }
+
+  /// \brief Skip a container in an unknown field of an entry, which the DOM parser
+  /// ignores as well.
+  bool SkipOrFail() {
+    if (IsKnownField(entry_key_)) {
+      return Fail(JsonParseError("Failed to parse '{}' of '{}' entry", entry_key_,
+                                 member_key_));
+    }
+    skip_depth_ = 1;
+    state_ = State::kSkip;
+    return true;
+  }
+
+  void ResetEntry() {
+    snapshot_id_.reset();
+    timestamp_ms_.reset();
+    parent_snapshot_id_.reset();
+    sequence_number_.reset();
+    schema_id_.reset();
+    has_summary_ = false;
+    snapshot_ = Snapshot{};
+    metadata_log_entry_ = MetadataLogEntry{};
+    has_manifest_list_ = false;
+    has_metadata_file_ = false;
+  }
+
+  template <typename T>
+  bool SetField(const nlohmann::json& value, std::optional<T>& field) {
+    try {
+      field = value.get<T>();
+      return true;
+    } catch (const std::exception& ex) {
+      return Fail(JsonParseError("Failed to parse '{}' of '{}' entry: {}", entry_key_,
+                                 member_key_, ex.what()));
+    }
+  }
+
+  /// \brief Set the field `entry_key_` of the current entry.
+  bool SetEntryField(const nlohmann::json& value) {
+    state_ = State::kEntry;
+    if (entry_key_ == kTimestampMs) {
+      return SetField(value, timestamp_ms_);
+    }
+    switch (list_) {
+      case StreamedList::kSnapshots:
+        if (entry_key_ == kSnapshotId) {
+          return SetField(value, snapshot_id_);
+        }
+        if (entry_key_ == kParentSnapshotId) {
+          return SetField(value, parent_snapshot_id_);
+        }
+        if (entry_key_ == kSequenceNumber) {
+          return SetField(value, sequence_number_);
+        }
+        if (entry_key_ == kSchemaId) {
+          return SetField(value, schema_id_);
+        }
+        if (entry_key_ == kSummary && value.is_null()) {
+          snapshot_.summary.clear();
+          has_summary_ = true;
+          return true;
+        }
+        break;
+      case StreamedList::kSnapshotLog:
+        if (entry_key_ == kSnapshotId) {
+          return SetField(value, snapshot_id_);
+        }
+        break;
+      case StreamedList::kMetadataLog:
+        break;
+    }
+    if (IsKnownField(entry_key_)) {
+      return Fail(JsonParseError("Failed to parse '{}' of '{}' entry from {}",
+                                 entry_key_, member_key_, SafeDumpJson(value)));
+    }
+    return true;
+  }
+
+  bool FinishEntry() {
+    auto missing = [this](std::string_view key) {
+      return Fail(JsonParseError("Missing '{}' in '{}' entry", key, member_key_));
+    };
+    if (!timestamp_ms_.has_value()) {
+      return missing(kTimestampMs);
+    }
+    auto timestamp_ms = TimePointMsFromUnixMs(*timestamp_ms_);
+    if (!timestamp_ms.has_value()) {
+      return Fail(std::move(timestamp_ms.error()));
+    }
+
+    switch (list_) {
+      case StreamedList::kSnapshots:
+        if (!snapshot_id_.has_value()) {
+          return missing(kSnapshotId);
+        }
+        if (!has_manifest_list_) {
+          return missing(kManifestList);
+        }
+        // If summary is available but operation is missing, set operation to
+        // overwrite.
+        if (has_summary_ &&
+            !snapshot_.summary.contains(SnapshotSummaryFields::kOperation)) {
+          snapshot_.summary[SnapshotSummaryFields::kOperation] =
+              DataOperation::kOverwrite;
+        }
+        snapshot_.snapshot_id = *snapshot_id_;
+        snapshot_.parent_snapshot_id = parent_snapshot_id_;
+        snapshot_.sequence_number =
+            sequence_number_.value_or(TableMetadata::kInitialSequenceNumber);
+        snapshot_.timestamp_ms = timestamp_ms.value();
+        snapshot_.schema_id = schema_id_;
+        snapshots_->push_back(std::make_shared<Snapshot>(std::move(snapshot_)));
+        return true;
+      case StreamedList::kSnapshotLog:
+        if (!snapshot_id_.has_value()) {
+          return missing(kSnapshotId);
+        }
+        snapshot_log_->push_back(SnapshotLogEntry{.timestamp_ms = timestamp_ms.value(),
+                                                  .snapshot_id = *snapshot_id_});
+        return true;
+      case StreamedList::kMetadataLog:
+        if (!has_metadata_file_) {
+          return missing(kMetadataFile);
+        }
+        metadata_log_entry_.timestamp_ms = timestamp_ms.value();
+        metadata_log_->push_back(std::move(metadata_log_entry_));
+        return true;
+    }
+    return true;
+  }
+
+  /// \brief Handle a scalar value.
+  bool Value(nlohmann::json value) {
+    switch (state_) {
+      case State::kEntryValue:
+        return SetEntryField(value);
+      case State::kSummaryValue:
+        return Fail(JsonParseError("Invalid snapshot summary field value: {}",
+                                   SafeDumpJson(value)));
+      case State::kSkip:
+        return true;
+      case State::kStreamedList:
+        return Fail(
+            JsonParseError("Cannot parse '{}' entry from non-object", member_key_));
+      default:
+        AddToDom(std::move(value));
+        return true;
+    }
+  }
+
+  /// \brief Add a value to the DOM, as a member of the document object, as the
+  /// document if it is not an object, or to the container being built.
+  nlohmann::json* AddToDom(nlohmann::json value) {
+    nlohmann::json* slot;
+    if (state_ == State::kStart) {
+      document_ = std::move(value);
+      slot = &document_;
+      dom_is_document_ = true;
+    } else if (state_ == State::kMemberValue) {
+      slot = &document_[member_key_];
+      *slot = std::move(value);
+    } else if (dom_stack_.back()->is_array()) {
+      dom_stack_.back()->push_back(std::move(value));
+      slot = &dom_stack_.back()->back();
+    } else {
+      *dom_key_ = std::move(value);
+      slot = dom_key_;
+    }
+    if (dom_stack_.empty()) {
+      state_ = dom_is_document_ ? State::kDone : State::kObject;
+    }
+    return slot;
+  }
+
+  bool StartContainer(nlohmann::json container) {
+    dom_stack_.push_back(AddToDom(std::move(container)));
+    state_ = State::kDom;
+    return true;
+  }
+
+  bool EndContainer() {
+    if (state_ == State::kSkip) {
+      if (--skip_depth_ == 0) {
+        state_ = State::kEntry;
+      }
+      return true;
+    }
+    dom_stack_.pop_back();
+    if (dom_stack_.empty()) {
+      state_ = dom_is_document_ ? State::kDone : State::kObject;
+    }
+    return true;
+  }
+
+  State state_ = State::kStart;
+  std::optional<Error> error_;
+
+  // The members of the document that are not streamed.
+  nlohmann::json document_ = nlohmann::json::object();
+  std::vector<nlohmann::json*> dom_stack_;
+  nlohmann::json* dom_key_ = nullptr;
+  bool dom_is_document_ = false;
+  std::string member_key_;
+
+  // The streamed lists, set if they are in the document.
+  StreamedList list_ = StreamedList::kSnapshots;
+  std::optional<std::vector<std::shared_ptr<Snapshot>>> snapshots_;
+  std::optional<std::vector<SnapshotLogEntry>> snapshot_log_;
+  std::optional<std::vector<MetadataLogEntry>> metadata_log_;
+
+  // The fields of the current entry of a streamed list.
+  std::string entry_key_;
+  int32_t skip_depth_ = 0;
+  std::optional<int64_t> snapshot_id_;
+  std::optional<int64_t> timestamp_ms_;
+  std::optional<int64_t> parent_snapshot_id_;
+  std::optional<int64_t> sequence_number_;
+  std::optional<int32_t> schema_id_;
+  bool has_summary_ = false;
+  bool has_manifest_list_ = false;
+  bool has_metadata_file_ = false;
+  Snapshot snapshot_;
+  MetadataLogEntry metadata_log_entry_;
+};
+
+}  // namespace
+
+Result<std::unique_ptr<TableMetadata>> TableMetadataFromJsonString(
+    std::string_view json_string) {
+  TableMetadataSaxHandler handler;
+  bool parsed = nlohmann::json::sax_parse(json_string, &handler);
+  return std::move(handler).Finish(parsed);
+}
+
 nlohmann::json ToJson(const MappedField& field) {
   nlohmann::json json;
   if (field.field_id.has_value()) {
@@ -244,6 +244,18 @@ nlohmann::json ToJson(const TableMetadata& table_metadata);
 /// \return A `TableMetadata` object or an error if the conversion fails.
 Result<std::unique_ptr<TableMetadata>> TableMetadataFromJson(const nlohmann::json& json);
 
+/// \brief Deserializes a JSON string into a `TableMetadata` object.
+///
+/// Unlike TableMetadataFromJson(FromJsonString(json_string)), this does not build a
+/// DOM of the whole document: the snapshots, the snapshot log and the metadata log,
+/// which dominate the metadata of long-lived tables, are parsed directly into
+/// `TableMetadata` as they are read.
+///
+/// \param json_string The JSON string representing a `TableMetadata`.
+/// \return A `TableMetadata` object or an error if the parsing fails.
+Result<std::unique_ptr<TableMetadata>> TableMetadataFromJsonString(
+    std::string_view json_string);
+
 /// \brief Deserialize a JSON string into a `nlohmann::json` object.
 ///
 /// \param json_string The JSON string to deserialize.
@@ -31,15 +31,25 @@ namespace iceberg {
 // \brief Base class to append manifest metadata to Arrow array.
 class ICEBERG_EXPORT ManifestAdapter {
  public:
+  /// \brief The number of rows appended before writers finish a batch.
+  static constexpr int64_t kBatchSize = 1024;
+
   ManifestAdapter() = default;
-  virtual ~ManifestAdapter() = default;
+  virtual ~ManifestAdapter() {
+    if (array_.release != nullptr) {
+      array_.release(&array_);
+    }
+  }
+
+  ManifestAdapter(const ManifestAdapter&) = delete;
+  ManifestAdapter& operator=(const ManifestAdapter&) = delete;
 
   virtual Status StartAppending() = 0;
   virtual Result<ArrowArray> FinishAppending() = 0;
   int64_t size() const { return size_; }
 
  protected:
-  ArrowArray array_;
+  ArrowArray array_{};
   int64_t size_ = 0;
 };
 
@@ -30,7 +30,7 @@
 namespace iceberg {
 
 Status ManifestWriter::Add(const ManifestEntry& entry) {
-  if (adapter_->size() >= kBatchSize) {
+  if (adapter_->size() >= ManifestAdapter::kBatchSize) {
     ICEBERG_ASSIGN_OR_RAISE(auto array, adapter_->FinishAppending());
     ICEBERG_RETURN_UNEXPECTED(writer_->Write(array));
     ICEBERG_RETURN_UNEXPECTED(adapter_->StartAppending());
@@ -50,9 +50,11 @@ Status ManifestWriter::Close() {
     ICEBERG_ASSIGN_OR_RAISE(auto array, adapter_->FinishAppending());
     ICEBERG_RETURN_UNEXPECTED(writer_->Write(array));
   }
-  return {};
+  return writer_->Close();
 }
 
+std::optional<int64_t> ManifestWriter::length() { return writer_->length(); }
+
 Result<std::unique_ptr<Writer>> OpenFileWriter(std::string_view location,
                                                std::shared_ptr<Schema> schema,
                                                std::shared_ptr<FileIO> file_io) {
@@ -76,6 +78,7 @@ Result<std::unique_ptr<ManifestWriter>> ManifestWriter::MakeV1Writer(
   ICEBERG_ASSIGN_OR_RAISE(auto writer,
                           OpenFileWriter(manifest_location, schema, std::move(file_io)));
   auto adapter = std::make_unique<ManifestEntryAdapterV1>(snapshot_id, std::move(schema));
+  ICEBERG_RETURN_UNEXPECTED(adapter->StartAppending());
   return std::make_unique<ManifestWriter>(std::move(writer), std::move(adapter));
 }
 
@@ -91,6 +94,7 @@ Result<std::unique_ptr<ManifestWriter>> ManifestWriter::MakeV2Writer(
   ICEBERG_ASSIGN_OR_RAISE(auto writer,
                           OpenFileWriter(manifest_location, schema, std::move(file_io)));
   auto adapter = std::make_unique<ManifestEntryAdapterV2>(snapshot_id, std::move(schema));
+  ICEBERG_RETURN_UNEXPECTED(adapter->StartAppending());
   return std::make_unique<ManifestWriter>(std::move(writer), std::move(adapter));
 }
 
@@ -108,11 +112,12 @@ Result<std::unique_ptr<ManifestWriter>> ManifestWriter::MakeV3Writer(
                           OpenFileWriter(manifest_location, schema, std::move(file_io)));
   auto adapter = std::make_unique<ManifestEntryAdapterV3>(snapshot_id, first_row_id,
                                                           std::move(schema));
+  ICEBERG_RETURN_UNEXPECTED(adapter->StartAppending());
   return std::make_unique<ManifestWriter>(std::move(writer), std::move(adapter));
 }
 
 Status ManifestListWriter::Add(const ManifestFile& file) {
-  if (adapter_->size() >= kBatchSize) {
+  if (adapter_->size() >= ManifestAdapter::kBatchSize) {
     ICEBERG_ASSIGN_OR_RAISE(auto array, adapter_->FinishAppending());
     ICEBERG_RETURN_UNEXPECTED(writer_->Write(array));
     ICEBERG_RETURN_UNEXPECTED(adapter_->StartAppending());
@@ -132,7 +137,7 @@ Status ManifestListWriter::Close() {
     ICEBERG_ASSIGN_OR_RAISE(auto array, adapter_->FinishAppending());
     ICEBERG_RETURN_UNEXPECTED(writer_->Write(array));
   }
-  return {};
+  return writer_->Close();
 }
 
 Result<std::unique_ptr<ManifestListWriter>> ManifestListWriter::MakeV1Writer(
@@ -146,6 +151,7 @@ Result<std::unique_ptr<ManifestListWriter>> ManifestListWriter::MakeV1Writer(
       auto writer, OpenFileWriter(manifest_list_location, schema, std::move(file_io)));
   auto adapter = std::make_unique<ManifestFileAdapterV1>(snapshot_id, parent_snapshot_id,
                                                          std::move(schema));
+  ICEBERG_RETURN_UNEXPECTED(adapter->StartAppending());
   return std::make_unique<ManifestListWriter>(std::move(writer), std::move(adapter));
 }
 
@@ -161,6 +167,7 @@ Result<std::unique_ptr<ManifestListWriter>> ManifestListWriter::MakeV2Writer(
       auto writer, OpenFileWriter(manifest_list_location, schema, std::move(file_io)));
   auto adapter = std::make_unique<ManifestFileAdapterV2>(
       snapshot_id, parent_snapshot_id, sequence_number, std::move(schema));
+  ICEBERG_RETURN_UNEXPECTED(adapter->StartAppending());
   return std::make_unique<ManifestListWriter>(std::move(writer), std::move(adapter));
 }
 
@@ -176,6 +183,7 @@ Result<std::unique_ptr<ManifestListWriter>> ManifestListWriter::MakeV3Writer(
       auto writer, OpenFileWriter(manifest_list_location, schema, std::move(file_io)));
   auto adapter = std::make_unique<ManifestFileAdapterV3>(
       snapshot_id, parent_snapshot_id, sequence_number, first_row_id, std::move(schema));
+  ICEBERG_RETURN_UNEXPECTED(adapter->StartAppending());
   return std::make_unique<ManifestListWriter>(std::move(writer), std::move(adapter));
 }
 
@@ -51,9 +51,12 @@ class ICEBERG_EXPORT ManifestWriter {
   /// \return Status::OK() if all entries were written successfully
   Status AddAll(const std::vector<ManifestEntry>& entries);
 
-  /// \brief Close writer and flush to storage.
+  /// \brief Write the buffered entries, then close the writer and flush to storage.
   Status Close();
 
+  /// \brief Returns the length of the manifest file, which is final after Close.
+  std::optional<int64_t> length();
+
   /// \brief Creates a writer for a manifest file.
   /// \param snapshot_id ID of the snapshot.
   /// \param manifest_location Path to the manifest file.
@@ -74,7 +77,8 @@ class ICEBERG_EXPORT ManifestWriter {
 
   /// \brief Creates a writer for a manifest file.
   /// \param snapshot_id ID of the snapshot.
-  /// \param first_row_id First row ID of the snapshot.
+  /// \param first_row_id First row ID of the manifest, if known. Live data files without
+  /// a first row ID are then assigned the row IDs they would inherit from it.
   /// \param manifest_location Path to the manifest file.
   /// \param file_io File IO implementation to use.
   /// \return A Result containing the writer or an error.
@@ -84,7 +88,6 @@ class ICEBERG_EXPORT ManifestWriter {
       std::shared_ptr<Schema> partition_schema);
 
  private:
-  static constexpr int64_t kBatchSize = 1024;
   std::unique_ptr<Writer> writer_;
   std::unique_ptr<ManifestEntryAdapter> adapter_;
 };
@@ -108,7 +111,7 @@ class ICEBERG_EXPORT ManifestListWriter {
   /// \return Status::OK() if all files were written successfully
   Status AddAll(const std::vector<ManifestFile>& files);
 
-  /// \brief Close writer and flush to storage.
+  /// \brief Write the buffered files, then close the writer and flush to storage.
   Status Close();
 
   /// \brief Creates a writer for the v1 manifest list.
@@ -147,7 +150,6 @@ class ICEBERG_EXPORT ManifestListWriter {
       std::string_view manifest_list_location, std::shared_ptr<FileIO> file_io);
 
  private:
-  static constexpr int64_t kBatchSize = 1024;
   std::unique_ptr<Writer> writer_;
   std::unique_ptr<ManifestFileAdapter> adapter_;
 };
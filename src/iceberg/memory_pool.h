@@ -0,0 +1,96 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+/// \file iceberg/memory_pool.h
+/// Pluggable memory allocator for reading and writing data files.
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "iceberg/iceberg_export.h"
+#include "iceberg/result.h"
+
+namespace iceberg {
+
+/// \brief Pluggable allocator for the buffers of data read from or written to files.
+///
+/// File format implementations allocate their buffers from the pool given in
+/// ReaderOptions or WriterOptions, so that a pool per scan or per tenant can be used
+/// to track and limit memory usage. Implementations must be thread-safe. Buffers may
+/// outlive the reader or writer that allocated them, so the pool must stay alive until
+/// all data returned by them has been released.
+class ICEBERG_EXPORT MemoryPool {
+ public:
+  /// \brief The default alignment of allocated buffers in bytes.
+  static constexpr int64_t kDefaultAlignment = 64;
+
+  MemoryPool() = default;
+  virtual ~MemoryPool() = default;
+
+  MemoryPool(const MemoryPool&) = delete;
+  MemoryPool& operator=(const MemoryPool&) = delete;
+
+  /// \brief Allocate a buffer of `size` bytes aligned to `alignment` bytes.
+  virtual Result<uint8_t*> Allocate(int64_t size, int64_t alignment) = 0;
+
+  /// \brief Resize a buffer previously allocated from this pool, preserving its
+  /// content up to the smaller of the two sizes.
+  virtual Result<uint8_t*> Reallocate(uint8_t* buffer, int64_t old_size,
+                                      int64_t new_size, int64_t alignment) = 0;
+
+  /// \brief Return a buffer previously allocated from this pool.
+  virtual void Free(uint8_t* buffer, int64_t size, int64_t alignment) = 0;
+
+  /// \brief Returns the number of bytes currently allocated from this pool.
+  virtual int64_t bytes_allocated() const = 0;
+
+  /// \brief Returns the peak number of bytes allocated from this pool, or -1 if the
+  /// pool does not track it.
+  virtual int64_t max_memory() const = 0;
+
+  /// \brief Returns the name of the underlying allocator, e.g. "jemalloc".
+  virtual std::string backend_name() const = 0;
+
+  /// \brief Adapts a pool to the allocator interface of a file format library.
+  class Adapter {
+   public:
+    virtual ~Adapter() = default;
+  };
+
+  /// \brief Returns the adapter of this pool, which is created by `make` on first use
+  /// and destroyed with the pool.
+  ///
+  /// File format libraries that refer to their allocator by a raw pointer keep it in
+  /// the pool, so that it lives as long as the buffers allocated through it.
+  Adapter* GetOrCreateAdapter(const std::function<std::unique_ptr<Adapter>()>& make) {
+    std::call_once(adapter_once_, [&]() { adapter_ = make(); });
+    return adapter_.get();
+  }
+
+ private:
+  std::once_flag adapter_once_;
+  std::unique_ptr<Adapter> adapter_;
+};
+
+}  // namespace iceberg
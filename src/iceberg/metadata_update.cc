@@ -0,0 +1,93 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/metadata_update.h"
+
+#include <algorithm>
+
+#include "iceberg/snapshot.h"
+#include "iceberg/table_metadata.h"
+#include "iceberg/util/macros.h"
+
+namespace iceberg {
+
+AddSnapshot::AddSnapshot(std::shared_ptr<Snapshot> snapshot, int64_t added_rows)
+    : snapshot_(std::move(snapshot)), added_rows_(added_rows) {}
+
+Status AddSnapshot::ApplyTo(TableMetadata& metadata) const {
+  if (!snapshot_) {
+    return InvalidArgument("Cannot add a null snapshot");
+  }
+  if (std::ranges::any_of(metadata.snapshots, [&](const auto& snapshot) {
+        return snapshot->snapshot_id == snapshot_->snapshot_id;
+      })) {
+    return AlreadyExists("Snapshot already exists: {}", snapshot_->snapshot_id);
+  }
+  if (metadata.format_version > 1 &&
+      snapshot_->sequence_number <= metadata.last_sequence_number &&
+      snapshot_->parent_snapshot_id.has_value()) {
+    return CommitFailed(
+        "Cannot add snapshot with sequence number {} older than last sequence number {}",
+        snapshot_->sequence_number, metadata.last_sequence_number);
+  }
+
+  metadata.snapshots.push_back(snapshot_);
+  metadata.last_sequence_number =
+      std::max(metadata.last_sequence_number, snapshot_->sequence_number);
+  metadata.last_updated_ms = snapshot_->timestamp_ms;
+  if (metadata.format_version >= TableMetadata::kMinFormatVersionRowLineage) {
+    metadata.next_row_id += added_rows_;
+  }
+  return {};
+}
+
+SetSnapshotRef::SetSnapshotRef(std::string ref_name, int64_t snapshot_id,
+                               SnapshotRefType type)
+    : ref_name_(std::move(ref_name)), snapshot_id_(snapshot_id), type_(type) {}
+
+Status SetSnapshotRef::ApplyTo(TableMetadata& metadata) const {
+  if (ref_name_ == SnapshotRef::kMainBranch && type_ != SnapshotRefType::kBranch) {
+    return InvalidArgument("Cannot set {} to a tag", ref_name_);
+  }
+  ICEBERG_ASSIGN_OR_RAISE(auto snapshot, metadata.SnapshotById(snapshot_id_));
+
+  auto& ref = metadata.refs[ref_name_];
+  if (ref && ref->type() == type_) {
+    // Keep the retention policy of the ref when only moving it.
+    ref = std::make_shared<SnapshotRef>(
+        SnapshotRef{.snapshot_id = snapshot_id_, .retention = ref->retention});
+  } else if (type_ == SnapshotRefType::kBranch) {
+    ref = std::make_shared<SnapshotRef>(
+        SnapshotRef{.snapshot_id = snapshot_id_, .retention = SnapshotRef::Branch{}});
+  } else {
+    ref = std::make_shared<SnapshotRef>(
+        SnapshotRef{.snapshot_id = snapshot_id_, .retention = SnapshotRef::Tag{}});
+  }
+
+  if (ref_name_ == SnapshotRef::kMainBranch) {
+    metadata.current_snapshot_id = snapshot_id_;
+    metadata.last_updated_ms = std::max(metadata.last_updated_ms, snapshot->timestamp_ms);
+    metadata.snapshot_log.push_back(
+        SnapshotLogEntry{.timestamp_ms = snapshot->timestamp_ms,
+                         .snapshot_id = snapshot_id_});
+  }
+  return {};
+}
+
+}  // namespace iceberg
@@ -0,0 +1,92 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+/// \file iceberg/metadata_update.h
+/// Changes to table metadata that are committed by Catalog::UpdateTable.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "iceberg/iceberg_export.h"
+#include "iceberg/result.h"
+#include "iceberg/type_fwd.h"
+
+namespace iceberg {
+
+/// \brief A change to table metadata.
+///
+/// A catalog commits a list of updates by applying them in order to a copy of the
+/// current table metadata, after the requirements of the commit are validated against
+/// it.
+class ICEBERG_EXPORT MetadataUpdate {
+ public:
+  virtual ~MetadataUpdate() = default;
+
+  /// \brief Apply this change to the metadata that is being committed.
+  virtual Status ApplyTo(TableMetadata& metadata) const = 0;
+};
+
+/// \brief Add a snapshot to the table.
+///
+/// Adding a snapshot does not change any branch, which is done by SetSnapshotRef.
+class ICEBERG_EXPORT AddSnapshot : public MetadataUpdate {
+ public:
+  /// \brief Construct an update that adds `snapshot`.
+  ///
+  /// \param snapshot The snapshot to add.
+  /// \param added_rows The number of rows that were assigned row ids by the manifest
+  /// list of the snapshot, which advances the next row id of v3 tables.
+  explicit AddSnapshot(std::shared_ptr<Snapshot> snapshot, int64_t added_rows = 0);
+
+  const std::shared_ptr<Snapshot>& snapshot() const { return snapshot_; }
+
+  int64_t added_rows() const { return added_rows_; }
+
+  Status ApplyTo(TableMetadata& metadata) const override;
+
+ private:
+  std::shared_ptr<Snapshot> snapshot_;
+  int64_t added_rows_;
+};
+
+/// \brief Point a branch or a tag at a snapshot of the table.
+///
+/// Setting the main branch also makes the snapshot the current snapshot of the table.
+class ICEBERG_EXPORT SetSnapshotRef : public MetadataUpdate {
+ public:
+  SetSnapshotRef(std::string ref_name, int64_t snapshot_id, SnapshotRefType type);
+
+  const std::string& ref_name() const { return ref_name_; }
+
+  int64_t snapshot_id() const { return snapshot_id_; }
+
+  SnapshotRefType type() const { return type_; }
+
+  Status ApplyTo(TableMetadata& metadata) const override;
+
+ private:
+  std::string ref_name_;
+  int64_t snapshot_id_;
+  SnapshotRefType type_;
+};
+
+}  // namespace iceberg
@@ -0,0 +1,207 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/metrics_config.h"
+
+#include <charconv>
+#include <format>
+#include <utility>
+#include <vector>
+
+#include "iceberg/schema.h"
+#include "iceberg/type.h"
+#include "iceberg/util/macros.h"
+#include "iceberg/util/string_util.h"
+#include "iceberg/util/truncate_util.h"
+
+namespace iceberg {
+
+namespace {
+
+constexpr std::string_view kTruncatePrefix = "truncate(";
+
+Result<int32_t> ParseInt(std::string_view value, std::string_view what) {
+  int32_t result = 0;
+  auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), result);
+  if (ec != std::errc() || ptr != value.data() + value.size()) {
+    return InvalidArgument("Invalid {}: {}", what, value);
+  }
+  return result;
+}
+
+void CollectPrimitiveFieldIds(const Type& type, std::vector<int32_t>* field_ids) {
+  if (!type.is_nested()) {
+    return;
+  }
+  for (const auto& field : static_cast<const NestedType&>(type).fields()) {
+    if (field.type()->is_nested()) {
+      CollectPrimitiveFieldIds(*field.type(), field_ids);
+    } else {
+      field_ids->push_back(field.field_id());
+    }
+  }
+}
+
+}  // namespace
+
+Result<MetricsMode> MetricsMode::FromString(std::string_view mode) {
+  auto lower_mode = StringUtils::ToLower(mode);
+  if (lower_mode == "none") {
+    return None();
+  }
+  if (lower_mode == "counts") {
+    return Counts();
+  }
+  if (lower_mode == "full") {
+    return Full();
+  }
+  if (lower_mode.starts_with(kTruncatePrefix) && lower_mode.ends_with(')')) {
+    std::string_view length(lower_mode);
+    length.remove_prefix(kTruncatePrefix.size());
+    length.remove_suffix(1);
+    ICEBERG_ASSIGN_OR_RAISE(auto truncate_length,
+                            ParseInt(length, "metrics mode truncate length"));
+    if (truncate_length <= 0) {
+      return InvalidArgument("Truncate length should be positive: {}", mode);
+    }
+    return Truncate(truncate_length);
+  }
+  return InvalidArgument("Invalid metrics mode: {}", mode);
+}
+
+std::optional<Literal> MetricsMode::LowerBound(const Literal& value) const {
+  if (kind == Kind::kNone || kind == Kind::kCounts) {
+    return std::nullopt;
+  }
+  if (kind == Kind::kTruncate) {
+    switch (value.type()->type_id()) {
+      case TypeId::kString:
+        return Literal::String(
+            TruncateUtils::TruncateUTF8(std::get<std::string>(value.value()), length));
+      case TypeId::kBinary:
+        return Literal::Binary(TruncateUtils::TruncateBinary(
+            std::get<std::vector<uint8_t>>(value.value()), length));
+      default:
+        break;
+    }
+  }
+  return value;
+}
+
+std::optional<Literal> MetricsMode::UpperBound(const Literal& value) const {
+  if (kind == Kind::kNone || kind == Kind::kCounts) {
+    return std::nullopt;
+  }
+  if (kind == Kind::kTruncate) {
+    switch (value.type()->type_id()) {
+      case TypeId::kString: {
+        auto truncated = TruncateUtils::TruncateUTF8Max(
+            std::get<std::string>(value.value()), length);
+        if (!truncated.has_value()) {
+          return std::nullopt;
+        }
+        return Literal::String(std::move(truncated.value()));
+      }
+      case TypeId::kBinary: {
+        auto truncated = TruncateUtils::TruncateBinaryMax(
+            std::get<std::vector<uint8_t>>(value.value()), length);
+        if (!truncated.has_value()) {
+          return std::nullopt;
+        }
+        return Literal::Binary(std::move(truncated.value()));
+      }
+      default:
+        break;
+    }
+  }
+  return value;
+}
+
+std::string MetricsMode::ToString() const {
+  switch (kind) {
+    case Kind::kNone:
+      return "none";
+    case Kind::kCounts:
+      return "counts";
+    case Kind::kTruncate:
+      return std::format("truncate({})", length);
+    case Kind::kFull:
+      return "full";
+  }
+  std::unreachable();
+}
+
+Result<MetricsConfig> MetricsConfig::Make(
+    const std::unordered_map<std::string, std::string>& properties,
+    const Schema& schema) {
+  MetricsConfig config(MetricsMode::None());
+  if (auto it = properties.find(std::string(kDefaultModeKey)); it != properties.end()) {
+    ICEBERG_ASSIGN_OR_RAISE(config.default_mode_, MetricsMode::FromString(it->second));
+  } else {
+    ICEBERG_ASSIGN_OR_RAISE(auto inferred_mode,
+                            MetricsMode::FromString(kInferredDefaultMode));
+    int32_t max_inferred_columns = kDefaultMaxInferredColumnDefaults;
+    if (auto it = properties.find(std::string(kMaxInferredColumnDefaultsKey));
+        it != properties.end()) {
+      ICEBERG_ASSIGN_OR_RAISE(max_inferred_columns,
+                              ParseInt(it->second, kMaxInferredColumnDefaultsKey));
+      if (max_inferred_columns < 0) {
+        return InvalidArgument("{} should not be negative: {}",
+                               kMaxInferredColumnDefaultsKey, max_inferred_columns);
+      }
+    }
+
+    std::vector<int32_t> field_ids;
+    CollectPrimitiveFieldIds(schema, &field_ids);
+    if (field_ids.size() <= static_cast<size_t>(max_inferred_columns)) {
+      config.default_mode_ = inferred_mode;
+    } else {
+      // Only the leading columns in schema order get the inferred mode.
+      for (int32_t i = 0; i < max_inferred_columns; ++i) {
+        config.column_modes_[field_ids[i]] = inferred_mode;
+      }
+    }
+  }
+
+  for (const auto& [key, value] : properties) {
+    if (!key.starts_with(kColumnModePrefix)) {
+      continue;
+    }
+    ICEBERG_ASSIGN_OR_RAISE(auto mode, MetricsMode::FromString(value));
+    auto column_name = std::string_view(key).substr(kColumnModePrefix.size());
+    ICEBERG_ASSIGN_OR_RAISE(auto field, schema.FindFieldByName(column_name));
+    if (field.has_value() && !field->get().type()->is_nested()) {
+      config.column_modes_[field->get().field_id()] = mode;
+    }
+  }
+  return config;
+}
+
+MetricsConfig MetricsConfig::Default() {
+  return MetricsConfig(MetricsMode::Truncate(16));
+}
+
+MetricsMode MetricsConfig::ColumnMode(int32_t field_id) const {
+  if (auto it = column_modes_.find(field_id); it != column_modes_.end()) {
+    return it->second;
+  }
+  return default_mode_;
+}
+
+}  // namespace iceberg
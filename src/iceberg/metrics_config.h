@@ -0,0 +1,119 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+/// \file iceberg/metrics_config.h
+/// Configuration of the column metrics collected when writing data files.
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "iceberg/expression/literal.h"
+#include "iceberg/iceberg_export.h"
+#include "iceberg/result.h"
+#include "iceberg/type_fwd.h"
+
+namespace iceberg {
+
+/// \brief Which metrics of a column are stored in the manifest for a data file.
+struct ICEBERG_EXPORT MetricsMode {
+  enum class Kind {
+    /// \brief No metrics are stored.
+    kNone,
+    /// \brief Only value, null and NaN counts are stored.
+    kCounts,
+    /// \brief Counts and bounds are stored, string and binary bounds are truncated to
+    /// `length` characters or bytes.
+    kTruncate,
+    /// \brief Counts and untruncated bounds are stored.
+    kFull,
+  };
+
+  Kind kind = Kind::kNone;
+  /// \brief The truncation length of bounds if `kind` is `kTruncate`.
+  int32_t length = 0;
+
+  static MetricsMode None() { return {.kind = Kind::kNone}; }
+  static MetricsMode Counts() { return {.kind = Kind::kCounts}; }
+  static MetricsMode Truncate(int32_t length) {
+    return {.kind = Kind::kTruncate, .length = length};
+  }
+  static MetricsMode Full() { return {.kind = Kind::kFull}; }
+
+  /// \brief Parse a mode from "none", "counts", "full" or "truncate(N)", ignoring case.
+  static Result<MetricsMode> FromString(std::string_view mode);
+
+  /// \brief Returns the lower bound to store for a column whose smallest value is
+  /// `value`, or std::nullopt if this mode stores no bounds.
+  std::optional<Literal> LowerBound(const Literal& value) const;
+
+  /// \brief Returns the upper bound to store for a column whose largest value is
+  /// `value`, or std::nullopt if this mode stores no bounds or the truncated value
+  /// cannot be rounded up.
+  std::optional<Literal> UpperBound(const Literal& value) const;
+
+  std::string ToString() const;
+
+  bool operator==(const MetricsMode& other) const = default;
+};
+
+/// \brief The metrics modes of the columns of a schema, as configured by the
+/// `write.metadata.metrics.*` table properties.
+class ICEBERG_EXPORT MetricsConfig {
+ public:
+  /// \brief Property of the mode of the columns without a column-level mode.
+  static constexpr std::string_view kDefaultModeKey = "write.metadata.metrics.default";
+  /// \brief Prefix of the properties of column-level modes, followed by the full name of
+  /// the column, e.g. "write.metadata.metrics.column.location.lat".
+  static constexpr std::string_view kColumnModePrefix = "write.metadata.metrics.column.";
+  /// \brief Property of the number of columns that get the inferred default mode when
+  /// the default mode is not set. Other columns store no metrics, which keeps the
+  /// manifests of wide tables small.
+  static constexpr std::string_view kMaxInferredColumnDefaultsKey =
+      "write.metadata.metrics.max-inferred-column-defaults";
+  static constexpr int32_t kDefaultMaxInferredColumnDefaults = 100;
+  /// \brief The mode used when the default mode is not set.
+  static constexpr std::string_view kInferredDefaultMode = "truncate(16)";
+
+  /// \brief Resolve the metrics modes of the columns of `schema` from table properties.
+  ///
+  /// Column-level modes of columns that are not in the schema are ignored.
+  static Result<MetricsConfig> Make(
+      const std::unordered_map<std::string, std::string>& properties,
+      const Schema& schema);
+
+  /// \brief A config that stores the metrics of all columns with the inferred default
+  /// mode.
+  static MetricsConfig Default();
+
+  /// \brief Returns the mode of the primitive column with the given field id.
+  MetricsMode ColumnMode(int32_t field_id) const;
+
+ private:
+  explicit MetricsConfig(MetricsMode default_mode) : default_mode_(default_mode) {}
+
+  MetricsMode default_mode_;
+  std::unordered_map<int32_t, MetricsMode> column_modes_;
+};
+
+}  // namespace iceberg
@@ -0,0 +1,35 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <nanoarrow/nanoarrow.h>
+
+#include "iceberg/result.h"
+
+/// \brief Return an InvalidArrowData error from the enclosing function if the
+/// nanoarrow call `expr` does not return NANOARROW_OK.
+#define ICEBERG_NANOARROW_RETURN_NOT_OK(expr)                                     \
+  do {                                                                            \
+    ArrowErrorCode _code = (expr);                                                \
+    if (_code != NANOARROW_OK) [[unlikely]] {                                     \
+      return ::iceberg::InvalidArrowData("Nanoarrow error code {} from {}", _code, \
+                                         #expr);                                  \
+    }                                                                             \
+  } while (false)
@@ -0,0 +1,306 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/parallel_manifest_writer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <unordered_map>
+#include <variant>
+
+#include "iceberg/file_io.h"
+#include "iceberg/manifest_writer.h"
+#include "iceberg/partition_summary.h"
+#include "iceberg/schema.h"
+#include "iceberg/snapshot.h"
+#include "iceberg/util/macros.h"
+#include "iceberg/util/partition_key_internal.h"
+
+namespace iceberg {
+
+namespace {
+
+/// \brief Entries that are written to one manifest.
+struct Shard {
+  ManifestFile::Content content;
+  std::vector<size_t> entries;
+};
+
+/// \brief Group the entries by content and optionally partition, in the order of the
+/// first entry of each group, and cut each group into shards of about `target_size`.
+Result<std::vector<Shard>> PlanShards(const std::vector<ManifestEntry>& entries,
+                                      bool split_by_partition, int64_t target_size) {
+  std::vector<Shard> groups;
+  std::unordered_map<std::string, size_t> group_of_key;
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const auto& data_file = entries[i].data_file;
+    if (data_file == nullptr) {
+      return InvalidArgument("Manifest entry {} has no data file", i);
+    }
+    auto content = data_file->content == DataFile::Content::kData
+                       ? ManifestFile::Content::kData
+                       : ManifestFile::Content::kDeletes;
+    std::string key(1, static_cast<char>(content));
+    if (split_by_partition) {
+      ICEBERG_ASSIGN_OR_RAISE(auto partition_key, PartitionKey(data_file->partition));
+      key += partition_key;
+    }
+    auto [iter, inserted] = group_of_key.try_emplace(std::move(key), groups.size());
+    if (inserted) {
+      groups.push_back(Shard{.content = content, .entries = {}});
+    }
+    groups[iter->second].entries.push_back(i);
+  }
+
+  std::vector<Shard> shards;
+  for (auto& group : groups) {
+    Shard shard{.content = group.content, .entries = {}};
+    int64_t size = 0;
+    for (size_t index : group.entries) {
+      shard.entries.push_back(index);
+      size += ParallelManifestWriter::EstimateEncodedSize(entries[index]);
+      if (size >= target_size) {
+        shards.push_back(std::move(shard));
+        shard = Shard{.content = group.content, .entries = {}};
+        size = 0;
+      }
+    }
+    if (!shard.entries.empty()) {
+      shards.push_back(std::move(shard));
+    }
+  }
+  return shards;
+}
+
+Result<ManifestFile> WriteShard(const std::vector<ManifestEntry>& entries,
+                                const Shard& shard, const std::string& location,
+                                const ParallelManifestWriterOptions& options,
+                                const StructType& partition_type) {
+  std::unique_ptr<ManifestWriter> writer;
+  if (options.format_version == 2) {
+    ICEBERG_ASSIGN_OR_RAISE(
+        writer, ManifestWriter::MakeV2Writer(options.snapshot_id, location, options.io,
+                                             options.partition_schema));
+  } else {
+    ICEBERG_ASSIGN_OR_RAISE(
+        writer, ManifestWriter::MakeV3Writer(options.snapshot_id,
+                                             /*first_row_id=*/std::nullopt, location,
+                                             options.io, options.partition_schema));
+  }
+
+  ManifestFile manifest{
+      .manifest_path = location,
+      .partition_spec_id = options.partition_spec_id,
+      .content = shard.content,
+      .sequence_number = TableMetadata::kInvalidSequenceNumber,
+      .min_sequence_number = TableMetadata::kInvalidSequenceNumber,
+      .added_snapshot_id = options.snapshot_id.value_or(Snapshot::kInvalidSnapshotId),
+      .added_files_count = 0,
+      .existing_files_count = 0,
+      .deleted_files_count = 0,
+      .added_rows_count = 0,
+      .existing_rows_count = 0,
+      .deleted_rows_count = 0};
+  PartitionSummary summary(partition_type);
+  std::optional<int64_t> min_sequence_number;
+  // Whether all rows of a v3 data manifest already have row ids, so that the manifest
+  // list writer does not assign it a new range.
+  bool has_row_ids =
+      options.format_version >= TableMetadata::kMinFormatVersionRowLineage &&
+      shard.content == ManifestFile::Content::kData;
+  std::optional<int64_t> min_first_row_id;
+  for (size_t index : shard.entries) {
+    const ManifestEntry& entry = entries[index];
+    ICEBERG_RETURN_UNEXPECTED(writer->Add(entry));
+    ICEBERG_RETURN_UNEXPECTED(summary.Update(entry.data_file->partition));
+    const int64_t rows = entry.data_file->record_count;
+    switch (entry.status) {
+      case ManifestStatus::kAdded:
+        *manifest.added_files_count += 1;
+        *manifest.added_rows_count += rows;
+        break;
+      case ManifestStatus::kExisting:
+        *manifest.existing_files_count += 1;
+        *manifest.existing_rows_count += rows;
+        break;
+      case ManifestStatus::kDeleted:
+        *manifest.deleted_files_count += 1;
+        *manifest.deleted_rows_count += rows;
+        break;
+    }
+    if (entry.sequence_number.has_value()) {
+      min_sequence_number =
+          std::min(min_sequence_number.value_or(*entry.sequence_number),
+                   *entry.sequence_number);
+    }
+    if (const auto& first_row_id = entry.data_file->first_row_id;
+        first_row_id.has_value()) {
+      min_first_row_id =
+          std::min(min_first_row_id.value_or(*first_row_id), *first_row_id);
+    } else if (entry.status != ManifestStatus::kDeleted) {
+      has_row_ids = false;
+    }
+  }
+  ICEBERG_RETURN_UNEXPECTED(writer->Close());
+
+  auto length = writer->length();
+  if (!length.has_value()) {
+    return IOError("Failed to get the length of manifest {}", location);
+  }
+  manifest.manifest_length = *length;
+  if (min_sequence_number.has_value()) {
+    manifest.min_sequence_number = *min_sequence_number;
+  }
+  if (has_row_ids && min_first_row_id.has_value()) {
+    manifest.first_row_id = *min_first_row_id;
+  }
+  ICEBERG_ASSIGN_OR_RAISE(manifest.partitions, summary.Summaries());
+  return manifest;
+}
+
+}  // namespace
+
+ManifestWriterProperties ManifestWriterProperties::FromMap(
+    const std::unordered_map<std::string, std::string>& properties) {
+  ManifestWriterProperties manifest_properties;
+  manifest_properties.configs_ = properties;
+  return manifest_properties;
+}
+
+int64_t ParallelManifestWriter::EstimateEncodedSize(const ManifestEntry& entry) {
+  // Avro writes ints and longs as zig-zag varints, counted as 4 bytes each, and
+  // strings and bytes after their length.
+  constexpr int64_t kNumberSize = 4;
+  // Status, snapshot id, sequence numbers and their union branches.
+  int64_t size = 7 * kNumberSize;
+  if (entry.data_file == nullptr) {
+    return size;
+  }
+  const DataFile& file = *entry.data_file;
+  // Content, format, counts, sort order id, spec id and the optional fields.
+  size += 16 * kNumberSize;
+  size += static_cast<int64_t>(file.file_path.size() + file.key_metadata.size() +
+                               file.referenced_data_file.value_or("").size());
+  size += 2 * kNumberSize *
+          static_cast<int64_t>(file.column_sizes.size() + file.value_counts.size() +
+                               file.null_value_counts.size() +
+                               file.nan_value_counts.size());
+  for (const auto* bounds : {&file.lower_bounds, &file.upper_bounds}) {
+    for (const auto& [_, bound] : *bounds) {
+      size += 2 * kNumberSize + static_cast<int64_t>(bound.size());
+    }
+  }
+  size += kNumberSize *
+          static_cast<int64_t>(file.split_offsets.size() + file.equality_ids.size());
+  for (const auto& value : file.partition) {
+    size += kNumberSize;
+    if (const auto* str = std::get_if<std::string>(&value.value())) {
+      size += static_cast<int64_t>(str->size());
+    } else if (const auto* bytes = std::get_if<std::vector<uint8_t>>(&value.value())) {
+      size += static_cast<int64_t>(bytes->size());
+    }
+  }
+  return size;
+}
+
+Result<std::vector<ManifestFile>> ParallelManifestWriter::Write(
+    const std::vector<ManifestEntry>& entries,
+    const ParallelManifestWriterOptions& options) {
+  if (options.io == nullptr || !options.new_manifest_location) {
+    return InvalidArgument("FileIO and manifest locations are required");
+  }
+  if (options.format_version != 2 && options.format_version != 3) {
+    return NotSupported("Writing v{} manifests is not supported",
+                        options.format_version);
+  }
+  int64_t target_size;
+  try {
+    target_size = ManifestWriterProperties::FromMap(options.properties)
+                      .Get(ManifestWriterProperties::kTargetSizeBytes);
+  } catch (const std::exception& e) {
+    return InvalidArgument("Invalid {}: {}",
+                           ManifestWriterProperties::kTargetSizeBytes.key(), e.what());
+  }
+  if (target_size <= 0) {
+    return InvalidArgument("Invalid target manifest size: {}", target_size);
+  }
+
+  ICEBERG_ASSIGN_OR_RAISE(auto shards,
+                          PlanShards(entries, options.split_by_partition, target_size));
+  std::vector<std::string> locations;
+  locations.reserve(shards.size());
+  for (size_t i = 0; i < shards.size(); ++i) {
+    locations.push_back(options.new_manifest_location());
+  }
+  const StructType empty_partition_type({});
+  const StructType& partition_type = options.partition_schema != nullptr
+                                         ? *options.partition_schema
+                                         : empty_partition_type;
+
+  // Workers take the next shard until all are written or one of them fails, and the
+  // calling thread works as one of them.
+  std::vector<std::optional<Result<ManifestFile>>> results(shards.size());
+  std::atomic<size_t> next_shard{0};
+  std::atomic<bool> failed{false};
+  auto work = [&]() {
+    for (size_t i = next_shard++; i < shards.size() && !failed; i = next_shard++) {
+      results[i] = WriteShard(entries, shards[i], locations[i], options, partition_type);
+      if (!results[i]->has_value()) {
+        failed = true;
+      }
+    }
+  };
+  size_t concurrency = options.max_concurrency > 0
+                           ? static_cast<size_t>(options.max_concurrency)
+                           : std::max(1U, std::thread::hardware_concurrency());
+  concurrency = std::min(concurrency, shards.size());
+  {
+    std::vector<std::jthread> workers;
+    for (size_t i = 1; i < concurrency; ++i) {
+      workers.emplace_back(work);
+    }
+    work();
+  }
+
+  if (failed) {
+    std::optional<Error> error;
+    for (size_t i = 0; i < shards.size(); ++i) {
+      if (!results[i].has_value()) {
+        continue;
+      }
+      if (!results[i]->has_value() && !error.has_value()) {
+        error = results[i]->error();
+      }
+      // Best effort, the manifests are not referenced by any snapshot yet.
+      std::ignore = options.io->DeleteFile(locations[i]);
+    }
+    return std::unexpected(*error);
+  }
+
+  std::vector<ManifestFile> manifests;
+  manifests.reserve(shards.size());
+  for (auto& result : results) {
+    manifests.push_back(std::move(result->value()));
+  }
+  return manifests;
+}
+
+}  // namespace iceberg
@@ -0,0 +1,118 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+/// \file iceberg/parallel_manifest_writer.h
+/// Writes a large set of manifest entries into several manifests concurrently.
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "iceberg/iceberg_export.h"
+#include "iceberg/manifest_entry.h"
+#include "iceberg/manifest_list.h"
+#include "iceberg/partition_spec.h"
+#include "iceberg/result.h"
+#include "iceberg/table_metadata.h"
+#include "iceberg/type_fwd.h"
+#include "iceberg/util/config.h"
+
+namespace iceberg {
+
+/// \brief Well-known entries of `ParallelManifestWriterOptions::properties`.
+///
+/// The keys are the Iceberg table properties of the same name.
+class ICEBERG_EXPORT ManifestWriterProperties
+    : public ConfigBase<ManifestWriterProperties> {
+ public:
+  template <typename T>
+  using Entry = const ConfigBase<ManifestWriterProperties>::Entry<T>;
+
+  /// \brief Target size of the manifests written by a commit.
+  inline static Entry<int64_t> kTargetSizeBytes{"commit.manifest.target-size-bytes",
+                                                8 * 1024 * 1024};
+
+  /// \brief Create the properties from table properties.
+  static ManifestWriterProperties FromMap(
+      const std::unordered_map<std::string, std::string>& properties);
+};
+
+/// \brief Options for ParallelManifestWriter.
+struct ICEBERG_EXPORT ParallelManifestWriterOptions {
+  /// \brief The format version of the manifests, 2 or 3.
+  int8_t format_version = TableMetadata::kDefaultTableFormatVersion;
+  /// \brief The id of the snapshot that writes the manifests.
+  std::optional<int64_t> snapshot_id;
+  /// \brief The id of the partition spec of all entries.
+  int32_t partition_spec_id = PartitionSpec::kInitialSpecId;
+  /// \brief The partition type of the partition spec. If null, the entries are
+  /// unpartitioned.
+  std::shared_ptr<Schema> partition_schema;
+  /// \brief The FileIO to write the manifests with. This field is required.
+  std::shared_ptr<FileIO> io;
+  /// \brief Returns the location of the next manifest to write. This field is required.
+  /// It is only called from the calling thread.
+  std::function<std::string()> new_manifest_location;
+  /// \brief Table properties. ManifestWriterProperties::kTargetSizeBytes sets the
+  /// target size of each manifest.
+  std::unordered_map<std::string, std::string> properties;
+  /// \brief Whether to write the entries of each partition to separate manifests, which
+  /// makes the partition summaries of the manifests selective.
+  bool split_by_partition = false;
+  /// \brief Max number of manifests written at the same time. Zero or a negative value
+  /// uses the number of hardware threads.
+  int32_t max_concurrency = 0;
+};
+
+/// \brief Writes manifest entries into manifests of about the target size, several at
+/// a time.
+///
+/// Entries are first grouped by content, since a manifest holds either data files or
+/// delete files, and optionally by partition. Each group is cut into shards at the
+/// target manifest size, estimated from the encoded size of the entries, and the
+/// shards are written concurrently by a bounded set of worker threads.
+class ICEBERG_EXPORT ParallelManifestWriter {
+ public:
+  /// \brief Write `entries` and return the manifest of each shard, in the order of the
+  /// first entry of each shard. Entries keep their relative order within a manifest.
+  ///
+  /// The sequence number of the returned manifests is
+  /// TableMetadata::kInvalidSequenceNumber, so that it is assigned by the manifest list
+  /// writer. Their min sequence number is the smallest sequence number of the entries
+  /// that have one, or also invalid if none has. If writing any shard fails, the
+  /// manifests already written are deleted.
+  ///
+  /// A v3 data manifest whose live files all have a first row id gets the smallest of
+  /// them as its first row id, so that the manifest list writer keeps their row ids
+  /// instead of assigning a new range.
+  static Result<std::vector<ManifestFile>> Write(
+      const std::vector<ManifestEntry>& entries,
+      const ParallelManifestWriterOptions& options);
+
+  /// \brief Returns an estimate of the size of an entry in an Avro manifest.
+  static int64_t EstimateEncodedSize(const ManifestEntry& entry);
+};
+
+}  // namespace iceberg
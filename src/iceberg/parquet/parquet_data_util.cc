@@ -40,7 +40,81 @@ Result<std::shared_ptr<::arrow::Array>> ProjectNestedArray(
     const std::shared_ptr<::arrow::Array>& array,
     const std::shared_ptr<::arrow::DataType>& output_arrow_type,
     const NestedType& nested_type, std::span<const FieldProjection> projections,
-    ::arrow::MemoryPool* pool);
+    const ProjectionPassThrough& pass_through, ::arrow::MemoryPool* pool);
+
+const ProjectionPassThrough& ChildPassThrough(const ProjectionPassThrough& pass_through,
+                                              size_t index) {
+  static const ProjectionPassThrough kRebuild;
+  return index < pass_through.children.size() ? pass_through.children[index] : kRebuild;
+}
+
+/// \brief Returns the types of the arrays nested in an array of the given type, in the
+/// order of the Iceberg fields, i.e. map entries are flattened to key and value.
+std::vector<std::shared_ptr<::arrow::DataType>> NestedArrowTypes(
+    const ::arrow::DataType& type) {
+  switch (type.id()) {
+    case ::arrow::Type::STRUCT: {
+      std::vector<std::shared_ptr<::arrow::DataType>> types;
+      types.reserve(type.num_fields());
+      for (const auto& field : type.fields()) {
+        types.push_back(field->type());
+      }
+      return types;
+    }
+    case ::arrow::Type::LIST:
+      return {internal::checked_cast<const ::arrow::ListType&>(type).value_type()};
+    case ::arrow::Type::MAP: {
+      const auto& map_type = internal::checked_cast<const ::arrow::MapType&>(type);
+      return {map_type.key_type(), map_type.item_type()};
+    }
+    default:
+      return {};
+  }
+}
+
+ProjectionPassThrough MakePassThrough(const ::arrow::DataType& source_type,
+                                      const ::arrow::DataType& output_type,
+                                      std::span<const FieldProjection> projections) {
+  ProjectionPassThrough result;
+  if (source_type.id() != output_type.id()) {
+    return result;
+  }
+
+  auto source_children = NestedArrowTypes(source_type);
+  auto output_children = NestedArrowTypes(output_type);
+  if (output_children.empty()) {
+    result.enabled = source_type.Equals(output_type);
+    return result;
+  }
+  if (output_children.size() != projections.size()) {
+    return result;
+  }
+
+  // A nested array is passed through only if every child is read from the same
+  // position and is passed through as well.
+  bool enabled = source_children.size() == output_children.size();
+  result.children.reserve(projections.size());
+  for (size_t i = 0; i < projections.size(); ++i) {
+    const auto& projection = projections[i];
+    if (projection.kind != FieldProjection::Kind::kProjected) {
+      result.children.emplace_back();
+      enabled = false;
+      continue;
+    }
+    auto from = std::get<size_t>(projection.from);
+    if (from >= source_children.size()) {
+      result.children.emplace_back();
+      enabled = false;
+      continue;
+    }
+    auto child =
+        MakePassThrough(*source_children[from], *output_children[i], projection.children);
+    enabled = enabled && child.enabled && from == i;
+    result.children.emplace_back(std::move(child));
+  }
+  result.enabled = enabled && source_type.Equals(output_type);
+  return result;
+}
 
 /// \brief Create a null array of the given type and length.
 Result<std::shared_ptr<::arrow::Array>> MakeNullArray(
@@ -72,7 +146,10 @@ Result<std::shared_ptr<::arrow::Array>> ProjectStructArray(
     const std::shared_ptr<::arrow::StructArray>& struct_array,
     const std::shared_ptr<::arrow::StructType>& output_struct_type,
     const StructType& struct_type, std::span<const FieldProjection> projections,
-    ::arrow::MemoryPool* pool) {
+    const ProjectionPassThrough& pass_through, ::arrow::MemoryPool* pool) {
+  if (pass_through.enabled) {
+    return struct_array;
+  }
   if (struct_type.fields().size() != projections.size()) {
     return InvalidSchema(
         "Inconsistent number of fields ({}) and number of projections ({})",
@@ -102,13 +179,16 @@ Result<std::shared_ptr<::arrow::Array>> ProjectStructArray(
                                parquet_field_index, struct_array->num_fields());
       }
       const auto& parquet_array = struct_array->field(parquet_field_index);
-      if (projected_field.type()->is_nested()) {
+      const auto& field_pass_through = ChildPassThrough(pass_through, i);
+      if (field_pass_through.enabled) {
+        projected_array = parquet_array;
+      } else if (projected_field.type()->is_nested()) {
         const auto& nested_type =
             internal::checked_cast<const NestedType&>(*projected_field.type());
         ICEBERG_ASSIGN_OR_RAISE(
             projected_array,
             ProjectNestedArray(parquet_array, output_arrow_type, nested_type,
-                               field_projection.children, pool));
+                               field_projection.children, field_pass_through, pool));
       } else {
         ICEBERG_ASSIGN_OR_RAISE(
             projected_array,
@@ -138,7 +218,11 @@ Result<std::shared_ptr<::arrow::Array>> ProjectStructArray(
 Result<std::shared_ptr<::arrow::Array>> ProjectListArray(
     const std::shared_ptr<::arrow::ListArray>& list_array,
     const std::shared_ptr<::arrow::ListType>& output_list_type, const ListType& list_type,
-    std::span<const FieldProjection> projections, ::arrow::MemoryPool* pool) {
+    std::span<const FieldProjection> projections,
+    const ProjectionPassThrough& pass_through, ::arrow::MemoryPool* pool) {
+  if (pass_through.enabled) {
+    return list_array;
+  }
   if (projections.size() != 1) {
     return InvalidArgument("Expected 1 projection for list, got: {}", projections.size());
   }
@@ -147,14 +231,17 @@ Result<std::shared_ptr<::arrow::Array>> ProjectListArray(
   const auto& element_projection = projections[0];
   const auto& output_element_type = output_list_type->value_type();
 
+  const auto& element_pass_through = ChildPassThrough(pass_through, 0);
   std::shared_ptr<::arrow::Array> projected_values;
-  if (element_field.type()->is_nested()) {
+  if (element_pass_through.enabled) {
+    projected_values = list_array->values();
+  } else if (element_field.type()->is_nested()) {
     const auto& nested_type =
         internal::checked_cast<const NestedType&>(*element_field.type());
     ICEBERG_ASSIGN_OR_RAISE(
         projected_values,
         ProjectNestedArray(list_array->values(), output_element_type, nested_type,
-                           element_projection.children, pool));
+                           element_projection.children, element_pass_through, pool));
   } else {
     ICEBERG_ASSIGN_OR_RAISE(
         projected_values,
@@ -170,7 +257,11 @@ Result<std::shared_ptr<::arrow::Array>> ProjectListArray(
 Result<std::shared_ptr<::arrow::Array>> ProjectMapArray(
     const std::shared_ptr<::arrow::MapArray>& map_array,
     const std::shared_ptr<::arrow::MapType>& output_map_type, const MapType& map_type,
-    std::span<const FieldProjection> projections, ::arrow::MemoryPool* pool) {
+    std::span<const FieldProjection> projections,
+    const ProjectionPassThrough& pass_through, ::arrow::MemoryPool* pool) {
+  if (pass_through.enabled) {
+    return map_array;
+  }
   if (projections.size() != 2) {
     return InvalidArgument("Expected 2 projections for map, got: {}", projections.size());
   }
@@ -180,13 +271,19 @@ Result<std::shared_ptr<::arrow::Array>> ProjectMapArray(
   const auto& key_type = map_type.key().type();
   const auto& value_type = map_type.value().type();
 
+  const auto& key_pass_through = ChildPassThrough(pass_through, 0);
+  const auto& value_pass_through = ChildPassThrough(pass_through, 1);
+
   // Project keys
   std::shared_ptr<::arrow::Array> projected_keys;
-  if (key_type->is_nested()) {
+  if (key_pass_through.enabled) {
+    projected_keys = map_array->keys();
+  } else if (key_type->is_nested()) {
     const auto& nested_type = internal::checked_cast<const NestedType&>(*key_type);
     ICEBERG_ASSIGN_OR_RAISE(
-        projected_keys, ProjectNestedArray(map_array->keys(), output_map_type->key_type(),
-                                           nested_type, key_projection.children, pool));
+        projected_keys,
+        ProjectNestedArray(map_array->keys(), output_map_type->key_type(), nested_type,
+                           key_projection.children, key_pass_through, pool));
   } else {
     ICEBERG_ASSIGN_OR_RAISE(
         projected_keys,
@@ -195,12 +292,14 @@ Result<std::shared_ptr<::arrow::Array>> ProjectMapArray(
 
   // Project values
   std::shared_ptr<::arrow::Array> projected_items;
-  if (value_type->is_nested()) {
+  if (value_pass_through.enabled) {
+    projected_items = map_array->items();
+  } else if (value_type->is_nested()) {
     const auto& nested_type = internal::checked_cast<const NestedType&>(*value_type);
     ICEBERG_ASSIGN_OR_RAISE(
         projected_items,
         ProjectNestedArray(map_array->items(), output_map_type->item_type(), nested_type,
-                           value_projection.children, pool));
+                           value_projection.children, value_pass_through, pool));
   } else {
     ICEBERG_ASSIGN_OR_RAISE(
         projected_items,
@@ -217,7 +316,7 @@ Result<std::shared_ptr<::arrow::Array>> ProjectNestedArray(
     const std::shared_ptr<::arrow::Array>& array,
     const std::shared_ptr<::arrow::DataType>& output_arrow_type,
     const NestedType& nested_type, std::span<const FieldProjection> projections,
-    ::arrow::MemoryPool* pool) {
+    const ProjectionPassThrough& pass_through, ::arrow::MemoryPool* pool) {
   switch (nested_type.type_id()) {
     case TypeId::kStruct: {
       if (output_arrow_type->id() != ::arrow::Type::STRUCT) {
@@ -229,7 +328,7 @@ Result<std::shared_ptr<::arrow::Array>> ProjectNestedArray(
           internal::checked_pointer_cast<::arrow::StructType>(output_arrow_type);
       const auto& struct_type = internal::checked_cast<const StructType&>(nested_type);
       return ProjectStructArray(struct_array, output_struct_type, struct_type,
-                                projections, pool);
+                                projections, pass_through, pool);
     }
     case TypeId::kList: {
       if (output_arrow_type->id() != ::arrow::Type::LIST) {
@@ -241,7 +340,8 @@ Result<std::shared_ptr<::arrow::Array>> ProjectNestedArray(
       auto output_list_type =
           internal::checked_pointer_cast<::arrow::ListType>(output_arrow_type);
       const auto& list_type = internal::checked_cast<const ListType&>(nested_type);
-      return ProjectListArray(list_array, output_list_type, list_type, projections, pool);
+      return ProjectListArray(list_array, output_list_type, list_type, projections,
+                              pass_through, pool);
     }
     case TypeId::kMap: {
       if (output_arrow_type->id() != ::arrow::Type::MAP) {
@@ -252,7 +352,8 @@ Result<std::shared_ptr<::arrow::Array>> ProjectNestedArray(
       auto output_map_type =
           internal::checked_pointer_cast<::arrow::MapType>(output_arrow_type);
       const auto& map_type = internal::checked_cast<const MapType&>(nested_type);
-      return ProjectMapArray(map_array, output_map_type, map_type, projections, pool);
+      return ProjectMapArray(map_array, output_map_type, map_type, projections,
+                             pass_through, pool);
     }
     default:
       return InvalidSchema("Cannot project array of unsupported nested type: {}",
@@ -262,18 +363,31 @@ Result<std::shared_ptr<::arrow::Array>> ProjectNestedArray(
 
 }  // namespace
 
+ProjectionPassThrough MakeProjectionPassThrough(
+    const ::arrow::Schema& file_arrow_schema, const ::arrow::Schema& output_arrow_schema,
+    const SchemaProjection& projection) {
+  return MakePassThrough(*::arrow::struct_(file_arrow_schema.fields()),
+                         *::arrow::struct_(output_arrow_schema.fields()),
+                         projection.fields);
+}
+
 Result<std::shared_ptr<::arrow::RecordBatch>> ProjectRecordBatch(
     std::shared_ptr<::arrow::RecordBatch> record_batch,
     const std::shared_ptr<::arrow::Schema>& output_arrow_schema,
     const Schema& projected_schema, const SchemaProjection& projection,
-    ::arrow::MemoryPool* pool) {
+    ::arrow::MemoryPool* pool, const ProjectionPassThrough& pass_through) {
+  if (pass_through.enabled) {
+    return ::arrow::RecordBatch::Make(output_arrow_schema, record_batch->num_rows(),
+                                      record_batch->columns());
+  }
+
   auto array = std::make_shared<::arrow::StructArray>(
       ::arrow::struct_(record_batch->schema()->fields()), record_batch->num_rows(),
       record_batch->columns());
   ICEBERG_ASSIGN_OR_RAISE(
       auto output_array,
       ProjectNestedArray(array, ::arrow::struct_(output_arrow_schema->fields()),
-                         projected_schema, projection.fields, pool));
+                         projected_schema, projection.fields, pass_through, pool));
   auto* struct_array = internal::checked_cast<::arrow::StructArray*>(output_array.get());
   return ::arrow::RecordBatch::Make(output_arrow_schema, record_batch->num_rows(),
                                     struct_array->fields());
@@ -19,12 +19,38 @@
 
 #pragma once
 
+#include <vector>
+
 #include <arrow/type_fwd.h>
 
 #include "iceberg/schema_util.h"
 
 namespace iceberg::parquet {
 
+/// \brief Which fields of a projection can reuse the arrays read from Parquet as is.
+///
+/// It only depends on the file schema, so it is computed once per file and then
+/// applied to every record batch.
+struct ProjectionPassThrough {
+  /// \brief True if the array of the field and all of its children is returned
+  /// unchanged by the projection.
+  bool enabled = false;
+  /// \brief Pass-through state of the children of a nested field, in the order of the
+  /// projected fields. Empty if not computed.
+  std::vector<ProjectionPassThrough> children;
+};
+
+/// \brief Detect the fields of a projection that need no promotion, reordering or
+/// null-filling.
+///
+/// \param file_arrow_schema The Arrow schema of record batches read from the file.
+/// \param output_arrow_schema The Arrow schema to convert to.
+/// \param projection The projection from projected Iceberg schema to the record batch.
+/// \return The pass-through state of the top-level struct.
+ProjectionPassThrough MakeProjectionPassThrough(
+    const ::arrow::Schema& file_arrow_schema, const ::arrow::Schema& output_arrow_schema,
+    const SchemaProjection& projection);
+
 /// \brief Convert record batch read from a Parquet file to projected Iceberg Schema.
 ///
 /// \param record_batch The record batch to convert.
@@ -32,11 +58,13 @@ namespace iceberg::parquet {
 /// \param projected_schema The projected Iceberg schema.
 /// \param projection The projection from projected Iceberg schema to the record batch.
 /// \param pool The arrow memory pool.
+/// \param pass_through Fields whose arrays are passed through by reference. By default
+/// all nested arrays are rebuilt.
 /// \return The converted record batch.
 Result<std::shared_ptr<::arrow::RecordBatch>> ProjectRecordBatch(
     std::shared_ptr<::arrow::RecordBatch> record_batch,
     const std::shared_ptr<::arrow::Schema>& output_arrow_schema,
     const Schema& projected_schema, const SchemaProjection& projection,
-    ::arrow::MemoryPool* pool);
+    ::arrow::MemoryPool* pool, const ProjectionPassThrough& pass_through = {});
 
 }  // namespace iceberg::parquet
@@ -0,0 +1,319 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/parquet/parquet_metrics_internal.h"
+
+#include <cmath>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <arrow/array.h>
+#include <arrow/record_batch.h>
+#include <parquet/metadata.h>
+#include <parquet/schema.h>
+#include <parquet/statistics.h>
+
+#include "iceberg/arrow/arrow_error_transform_internal.h"
+#include "iceberg/schema.h"
+#include "iceberg/type.h"
+#include "iceberg/util/checked_cast.h"
+#include "iceberg/util/macros.h"
+
+namespace iceberg::parquet {
+
+namespace {
+
+template <typename ArrayType>
+int64_t CountNaN(const ::arrow::Array& array) {
+  const auto& typed_array = internal::checked_cast<const ArrayType&>(array);
+  int64_t count = 0;
+  for (int64_t i = 0; i < typed_array.length(); ++i) {
+    if (typed_array.IsValid(i) && std::isnan(typed_array.Value(i))) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+// Returns the values referenced by the entries of a list or map array.
+std::shared_ptr<::arrow::Array> ListValues(const ::arrow::ListArray& list_array) {
+  auto begin = list_array.value_offset(0);
+  auto end = list_array.value_offset(list_array.length());
+  return list_array.values()->Slice(begin, end - begin);
+}
+
+Status CountNaNValues(const SchemaField& field, const ::arrow::Array& array,
+                      std::unordered_map<int64_t, int64_t>* nan_value_counts) {
+  switch (field.type()->type_id()) {
+    case TypeId::kFloat:
+      (*nan_value_counts)[field.field_id()] += CountNaN<::arrow::FloatArray>(array);
+      break;
+    case TypeId::kDouble:
+      (*nan_value_counts)[field.field_id()] += CountNaN<::arrow::DoubleArray>(array);
+      break;
+    case TypeId::kStruct: {
+      const auto& struct_type = internal::checked_cast<const StructType&>(*field.type());
+      const auto& struct_array =
+          internal::checked_cast<const ::arrow::StructArray&>(array);
+      for (size_t i = 0; i < struct_type.fields().size(); ++i) {
+        // Child slots of null structs hold arbitrary values, so the child is read with
+        // the validity of the struct applied.
+        ICEBERG_ARROW_ASSIGN_OR_RETURN(
+            auto child, struct_array.GetFlattenedField(static_cast<int>(i)));
+        ICEBERG_RETURN_UNEXPECTED(
+            CountNaNValues(struct_type.fields()[i], *child, nan_value_counts));
+      }
+    } break;
+    case TypeId::kList: {
+      const auto& list_type = internal::checked_cast<const ListType&>(*field.type());
+      const auto& list_array = internal::checked_cast<const ::arrow::ListArray&>(array);
+      ICEBERG_RETURN_UNEXPECTED(
+          CountNaNValues(list_type.fields()[0], *ListValues(list_array), nan_value_counts));
+    } break;
+    case TypeId::kMap: {
+      const auto& map_type = internal::checked_cast<const MapType&>(*field.type());
+      const auto& map_array = internal::checked_cast<const ::arrow::MapArray&>(array);
+      auto entries = internal::checked_pointer_cast<::arrow::StructArray>(
+          ListValues(map_array));
+      ICEBERG_RETURN_UNEXPECTED(
+          CountNaNValues(map_type.key(), *entries->field(0), nan_value_counts));
+      ICEBERG_RETURN_UNEXPECTED(
+          CountNaNValues(map_type.value(), *entries->field(1), nan_value_counts));
+    } break;
+    default:
+      break;
+  }
+  return {};
+}
+
+template <typename StatisticsType>
+const StatisticsType& TypedStatistics(const ::parquet::Statistics& statistics) {
+  return internal::checked_cast<const StatisticsType&>(statistics);
+}
+
+std::string ToString(const ::parquet::ByteArray& value) {
+  return {reinterpret_cast<const char*>(value.ptr), value.len};
+}
+
+std::vector<uint8_t> ToBytes(const ::parquet::ByteArray& value) {
+  return {value.ptr, value.ptr + value.len};
+}
+
+// The smallest and largest values of a column chunk.
+struct Bounds {
+  Literal lower;
+  Literal upper;
+};
+
+// Convert the min and max values of column chunk statistics to literals of the Iceberg
+// type of the column. Returns std::nullopt for types whose bounds are not collected.
+std::optional<Bounds> StatisticsBounds(const PrimitiveType& type,
+                                       const ::parquet::Statistics& statistics) {
+  using PhysicalType = ::parquet::Type;
+  auto physical_type = statistics.physical_type();
+  switch (type.type_id()) {
+    case TypeId::kBoolean: {
+      if (physical_type != PhysicalType::BOOLEAN) break;
+      const auto& typed = TypedStatistics<::parquet::BoolStatistics>(statistics);
+      return Bounds{Literal::Boolean(typed.min()), Literal::Boolean(typed.max())};
+    }
+    case TypeId::kInt: {
+      if (physical_type != PhysicalType::INT32) break;
+      const auto& typed = TypedStatistics<::parquet::Int32Statistics>(statistics);
+      return Bounds{Literal::Int(typed.min()), Literal::Int(typed.max())};
+    }
+    case TypeId::kDate: {
+      if (physical_type != PhysicalType::INT32) break;
+      const auto& typed = TypedStatistics<::parquet::Int32Statistics>(statistics);
+      return Bounds{Literal::Date(typed.min()), Literal::Date(typed.max())};
+    }
+    case TypeId::kLong: {
+      if (physical_type != PhysicalType::INT64) break;
+      const auto& typed = TypedStatistics<::parquet::Int64Statistics>(statistics);
+      return Bounds{Literal::Long(typed.min()), Literal::Long(typed.max())};
+    }
+    case TypeId::kTime: {
+      if (physical_type != PhysicalType::INT64) break;
+      const auto& typed = TypedStatistics<::parquet::Int64Statistics>(statistics);
+      return Bounds{Literal::Time(typed.min()), Literal::Time(typed.max())};
+    }
+    case TypeId::kTimestamp: {
+      if (physical_type != PhysicalType::INT64) break;
+      const auto& typed = TypedStatistics<::parquet::Int64Statistics>(statistics);
+      return Bounds{Literal::Timestamp(typed.min()), Literal::Timestamp(typed.max())};
+    }
+    case TypeId::kTimestampTz: {
+      if (physical_type != PhysicalType::INT64) break;
+      const auto& typed = TypedStatistics<::parquet::Int64Statistics>(statistics);
+      return Bounds{Literal::TimestampTz(typed.min()), Literal::TimestampTz(typed.max())};
+    }
+    case TypeId::kFloat: {
+      if (physical_type != PhysicalType::FLOAT) break;
+      const auto& typed = TypedStatistics<::parquet::FloatStatistics>(statistics);
+      return Bounds{Literal::Float(typed.min()), Literal::Float(typed.max())};
+    }
+    case TypeId::kDouble: {
+      if (physical_type != PhysicalType::DOUBLE) break;
+      const auto& typed = TypedStatistics<::parquet::DoubleStatistics>(statistics);
+      return Bounds{Literal::Double(typed.min()), Literal::Double(typed.max())};
+    }
+    case TypeId::kString: {
+      if (physical_type != PhysicalType::BYTE_ARRAY) break;
+      const auto& typed = TypedStatistics<::parquet::ByteArrayStatistics>(statistics);
+      return Bounds{Literal::String(ToString(typed.min())),
+                    Literal::String(ToString(typed.max()))};
+    }
+    case TypeId::kBinary: {
+      if (physical_type != PhysicalType::BYTE_ARRAY) break;
+      const auto& typed = TypedStatistics<::parquet::ByteArrayStatistics>(statistics);
+      return Bounds{Literal::Binary(ToBytes(typed.min())),
+                    Literal::Binary(ToBytes(typed.max()))};
+    }
+    default:
+      // Bounds of fixed, uuid and decimal columns are not collected until Literal can
+      // represent their values.
+      break;
+  }
+  return std::nullopt;
+}
+
+// Metrics of a column accumulated over the row groups of a file.
+struct ColumnMetrics {
+  int64_t column_size = 0;
+  int64_t value_count = 0;
+  int64_t null_value_count = 0;
+  bool has_null_value_count = true;
+  std::optional<Bounds> bounds;
+  bool has_bounds = true;
+};
+
+void UpdateBounds(Bounds bounds, ColumnMetrics* column_metrics) {
+  if (!column_metrics->bounds.has_value()) {
+    column_metrics->bounds = std::move(bounds);
+    return;
+  }
+  if (bounds.lower < column_metrics->bounds->lower) {
+    column_metrics->bounds->lower = std::move(bounds.lower);
+  }
+  if (bounds.upper > column_metrics->bounds->upper) {
+    column_metrics->bounds->upper = std::move(bounds.upper);
+  }
+}
+
+}  // namespace
+
+Status CountNaNValues(const Schema& schema, const ::arrow::RecordBatch& batch,
+                      std::unordered_map<int64_t, int64_t>* nan_value_counts) {
+  const auto& fields = schema.fields();
+  for (size_t i = 0; i < fields.size() && i < static_cast<size_t>(batch.num_columns());
+       ++i) {
+    ICEBERG_RETURN_UNEXPECTED(
+        CountNaNValues(fields[i], *batch.column(static_cast<int>(i)), nan_value_counts));
+  }
+  return {};
+}
+
+Result<Metrics> FooterMetrics(
+    const Schema& schema, const ::parquet::FileMetaData& metadata,
+    const MetricsConfig& config,
+    const std::unordered_map<int64_t, int64_t>& nan_value_counts) {
+  Metrics metrics;
+  metrics.row_count = metadata.num_rows();
+
+  const auto* parquet_schema = metadata.schema();
+  for (int column = 0; column < metadata.num_columns(); ++column) {
+    const auto* descriptor = parquet_schema->Column(column);
+    int32_t field_id = descriptor->schema_node()->field_id();
+    if (field_id < 0) {
+      continue;
+    }
+    auto mode = config.ColumnMode(field_id);
+    if (mode.kind == MetricsMode::Kind::kNone) {
+      continue;
+    }
+    ICEBERG_ASSIGN_OR_RAISE(auto field, schema.FindFieldById(field_id));
+    if (!field.has_value() || field->get().type()->is_nested()) {
+      continue;
+    }
+    const auto& type = internal::checked_cast<const PrimitiveType&>(*field->get().type());
+    // Bounds of values in lists and maps are not useful to prune files by rows.
+    bool collect_bounds = mode.kind != MetricsMode::Kind::kCounts &&
+                          descriptor->max_repetition_level() == 0;
+    bool is_floating_point =
+        type.type_id() == TypeId::kFloat || type.type_id() == TypeId::kDouble;
+
+    ColumnMetrics column_metrics;
+    for (int row_group = 0; row_group < metadata.num_row_groups(); ++row_group) {
+      auto chunk = metadata.RowGroup(row_group)->ColumnChunk(column);
+      column_metrics.column_size += chunk->total_compressed_size();
+      column_metrics.value_count += chunk->num_values();
+
+      auto statistics = chunk->is_stats_set() ? chunk->statistics() : nullptr;
+      if (statistics == nullptr) {
+        column_metrics.has_null_value_count = false;
+        column_metrics.has_bounds = false;
+        continue;
+      }
+      if (statistics->HasNullCount()) {
+        column_metrics.null_value_count += statistics->null_count();
+      } else {
+        column_metrics.has_null_value_count = false;
+      }
+      if (!collect_bounds) {
+        continue;
+      }
+      if (statistics->HasMinMax()) {
+        if (auto bounds = StatisticsBounds(type, *statistics)) {
+          UpdateBounds(std::move(bounds.value()), &column_metrics);
+        } else {
+          column_metrics.has_bounds = false;
+        }
+      } else if (!is_floating_point && (!statistics->HasNullCount() ||
+                                        statistics->null_count() < chunk->num_values())) {
+        // Min and max are dropped when they are too large, the bounds would not cover
+        // the values of this row group. Float columns of only NaN values have no min
+        // and max either, which do not affect the bounds.
+        column_metrics.has_bounds = false;
+      }
+    }
+
+    metrics.column_sizes[field_id] = column_metrics.column_size;
+    metrics.value_counts[field_id] = column_metrics.value_count;
+    if (column_metrics.has_null_value_count) {
+      metrics.null_value_counts[field_id] = column_metrics.null_value_count;
+    }
+    if (is_floating_point) {
+      auto it = nan_value_counts.find(field_id);
+      metrics.nan_value_counts[field_id] = it != nan_value_counts.end() ? it->second : 0;
+    }
+    if (column_metrics.has_bounds && column_metrics.bounds.has_value()) {
+      if (auto lower = mode.LowerBound(column_metrics.bounds->lower)) {
+        metrics.lower_bounds.emplace(field_id, std::move(lower.value()));
+      }
+      if (auto upper = mode.UpperBound(column_metrics.bounds->upper)) {
+        metrics.upper_bounds.emplace(field_id, std::move(upper.value()));
+      }
+    }
+  }
+
+  return metrics;
+}
+
+}  // namespace iceberg::parquet
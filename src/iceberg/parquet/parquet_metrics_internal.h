@@ -0,0 +1,62 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+
+#include <arrow/type_fwd.h>
+#include <parquet/type_fwd.h>
+
+#include "iceberg/metrics.h"
+#include "iceberg/metrics_config.h"
+#include "iceberg/result.h"
+#include "iceberg/type_fwd.h"
+
+namespace iceberg::parquet {
+
+/// \brief Count the NaN values of the float and double fields of a record batch.
+///
+/// Parquet statistics do not track NaN values, so the writer counts them as batches
+/// are written.
+///
+/// \param schema The Iceberg schema of the record batch.
+/// \param batch The record batch to count.
+/// \param nan_value_counts The counts keyed by field id to add to.
+Status CountNaNValues(const Schema& schema, const ::arrow::RecordBatch& batch,
+                      std::unordered_map<int64_t, int64_t>* nan_value_counts);
+
+/// \brief Collect the metrics of a written Parquet file from the column chunk
+/// statistics of its footer.
+///
+/// Parquet columns are mapped to Iceberg fields by their field ids. Bounds are only
+/// collected for columns that are not nested in lists or maps, and are truncated
+/// according to the metrics mode of each column.
+///
+/// \param schema The Iceberg schema of the file.
+/// \param metadata The footer of the file.
+/// \param config The metrics modes of the columns.
+/// \param nan_value_counts The NaN counts collected by CountNaNValues.
+Result<Metrics> FooterMetrics(
+    const Schema& schema, const ::parquet::FileMetaData& metadata,
+    const MetricsConfig& config,
+    const std::unordered_map<int64_t, int64_t>& nan_value_counts);
+
+}  // namespace iceberg::parquet
@@ -19,13 +19,28 @@
 
 #include "iceberg/parquet/parquet_reader.h"
 
+#include <algorithm>
+#include <charconv>
+#include <format>
+#include <limits>
+#include <mutex>
 #include <numeric>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <arrow/c/bridge.h>
+#include <arrow/io/caching.h>
+#include <arrow/io/interfaces.h>
 #include <arrow/memory_pool.h>
 #include <arrow/record_batch.h>
 #include <arrow/result.h>
 #include <arrow/type.h>
+#include <arrow/util/async_generator.h>
+#include <arrow/util/future.h>
+#include <arrow/util/thread_pool.h>
 #include <parquet/arrow/reader.h>
 #include <parquet/arrow/schema.h>
 #include <parquet/file_reader.h>
@@ -33,12 +48,16 @@
 
 #include "iceberg/arrow/arrow_error_transform_internal.h"
 #include "iceberg/arrow/arrow_fs_file_io_internal.h"
+#include "iceberg/arrow/arrow_memory_pool_internal.h"
+#include "iceberg/file_metadata_cache.h"
 #include "iceberg/parquet/parquet_data_util_internal.h"
 #include "iceberg/parquet/parquet_register.h"
 #include "iceberg/parquet/parquet_schema_util_internal.h"
 #include "iceberg/result.h"
+#include "iceberg/schema.h"
 #include "iceberg/schema_internal.h"
 #include "iceberg/schema_util.h"
+#include "iceberg/type.h"
 #include "iceberg/util/checked_cast.h"
 #include "iceberg/util/macros.h"
 
@@ -46,30 +65,88 @@ namespace iceberg::parquet {
 
 namespace {
 
-Result<std::shared_ptr<::arrow::io::RandomAccessFile>> OpenInputStream(
-    const ReaderOptions& options) {
+Result<::arrow::fs::FileInfo> GetFileInfo(const ReaderOptions& options) {
+  if (options.metadata_cache != nullptr && !options.length) {
+    // The size and modification time identify the version of the file whose metadata
+    // is cached, which costs a metadata request to the file system when the caller
+    // does not know the length.
+    auto io = internal::checked_pointer_cast<arrow::ArrowFileSystemFileIO>(options.io);
+    ICEBERG_ARROW_ASSIGN_OR_RETURN(auto file_info, io->fs()->GetFileInfo(options.path));
+    return file_info;
+  }
+
   ::arrow::fs::FileInfo file_info(options.path, ::arrow::fs::FileType::File);
   if (options.length) {
     file_info.set_size(options.length.value());
   }
+  return file_info;
+}
 
+Result<std::shared_ptr<::arrow::io::RandomAccessFile>> OpenInputStream(
+    const ReaderOptions& options, const ::arrow::fs::FileInfo& file_info) {
   auto io = internal::checked_pointer_cast<arrow::ArrowFileSystemFileIO>(options.io);
   ICEBERG_ARROW_ASSIGN_OR_RETURN(auto input, io->fs()->OpenInputFile(file_info));
   return input;
 }
 
-Result<SchemaProjection> BuildProjection(::parquet::arrow::FileReader* reader,
-                                         const Schema& read_schema) {
-  auto metadata = reader->parquet_reader()->metadata();
+// The Parquet footer of a version of a file in a FileMetadataCache.
+struct CachedFooter : public FileMetadataCache::Entry {
+  explicit CachedFooter(std::shared_ptr<::parquet::FileMetaData> metadata)
+      : metadata(std::move(metadata)) {}
+
+  std::shared_ptr<::parquet::FileMetaData> metadata;
+};
+
+// The projection of a read schema onto a cached Parquet footer.
+struct CachedProjection : public FileMetadataCache::Entry {
+  explicit CachedProjection(SchemaProjection projection)
+      : projection(std::move(projection)) {}
+
+  SchemaProjection projection;
+};
 
-  if (!HasFieldIds(metadata->schema()->schema_root())) {
+// Data files are never rewritten in place, so a path and the length given by the caller
+// identify a version of a file. A probed length comes with the modification time, which
+// also tells apart versions of the same length.
+std::string FooterCacheKey(const ::arrow::fs::FileInfo& file_info) {
+  if (file_info.mtime() == ::arrow::fs::kNoTime) {
+    return std::format("parquet-footer:{}:{}", file_info.path(), file_info.size());
+  }
+  return std::format("parquet-footer:{}:{}:{}", file_info.path(), file_info.size(),
+                     file_info.mtime().time_since_epoch().count());
+}
+
+// The decoded footer is larger than its serialized size, since Thrift decodes each
+// schema element and column chunk into structs of strings, vectors and optional fields.
+int64_t FooterCharge(const ::parquet::FileMetaData& metadata) {
+  constexpr int64_t kSchemaElementCharge = 256;
+  constexpr int64_t kColumnChunkCharge = 768;
+  return static_cast<int64_t>(metadata.size()) +
+         metadata.num_schema_elements() * kSchemaElementCharge +
+         static_cast<int64_t>(metadata.num_row_groups()) * metadata.num_columns() *
+             kColumnChunkCharge;
+}
+
+int64_t ProjectionCharge(std::span<const FieldProjection> fields) {
+  int64_t charge = 0;
+  for (const auto& field : fields) {
+    charge += sizeof(FieldProjection) + ProjectionCharge(field.children);
+  }
+  return charge;
+}
+
+Result<SchemaProjection> BuildProjection(
+    const ::parquet::FileMetaData& metadata,
+    const ::parquet::ArrowReaderProperties& arrow_reader_properties,
+    const Schema& read_schema) {
+  if (!HasFieldIds(metadata.schema()->schema_root())) {
     // TODO(gangwu): apply name mapping to Parquet schema
     return NotImplemented("Applying name mapping to Parquet schema is not implemented");
   }
 
   ::parquet::arrow::SchemaManifest schema_manifest;
   ICEBERG_ARROW_RETURN_NOT_OK(::parquet::arrow::SchemaManifest::Make(
-      metadata->schema(), metadata->key_value_metadata(), reader->properties(),
+      metadata.schema(), metadata.key_value_metadata(), arrow_reader_properties,
       &schema_manifest));
 
   // Leverage SchemaManifest to project the schema
@@ -77,6 +154,152 @@ Result<SchemaProjection> BuildProjection(::parquet::arrow::FileReader* reader,
   return projection;
 }
 
+// String and binary fields to read as Arrow dictionary arrays.
+struct ReadDictionary {
+  // Whether to read all string and binary fields as dictionary arrays.
+  bool all = false;
+  // Ids of the fields to read as dictionary arrays if not all.
+  std::unordered_set<int32_t> field_ids;
+};
+
+Result<ReadDictionary> ParseReadDictionary(std::string_view value) {
+  ReadDictionary result;
+  if (value == "*") {
+    result.all = true;
+    return result;
+  }
+  for (auto part : std::views::split(value, ',')) {
+    std::string_view field_id_str(part.begin(), part.end());
+    while (!field_id_str.empty() && field_id_str.front() == ' ') {
+      field_id_str.remove_prefix(1);
+    }
+    while (!field_id_str.empty() && field_id_str.back() == ' ') {
+      field_id_str.remove_suffix(1);
+    }
+    if (field_id_str.empty()) {
+      continue;
+    }
+    int32_t field_id = 0;
+    auto [ptr, ec] = std::from_chars(field_id_str.data(),
+                                     field_id_str.data() + field_id_str.size(), field_id);
+    if (ec != std::errc() || ptr != field_id_str.data() + field_id_str.size()) {
+      return InvalidArgument("Invalid field id '{}' in {}: {}", field_id_str,
+                             ReaderProperties::kParquetReadDictionary.key(), value);
+    }
+    result.field_ids.insert(field_id);
+  }
+  return result;
+}
+
+// Collect the Parquet leaf columns of the projected string and binary fields selected
+// by `read_dictionary`, along with their field ids.
+void CollectDictionaryColumns(const NestedType& type,
+                              std::span<const FieldProjection> projections,
+                              const ReadDictionary& read_dictionary,
+                              std::vector<int32_t>* column_ids,
+                              std::unordered_set<int32_t>* field_ids) {
+  auto fields = type.fields();
+  for (size_t i = 0; i < fields.size() && i < projections.size(); ++i) {
+    const auto& field = fields[i];
+    const auto& projection = projections[i];
+    if (projection.kind != FieldProjection::Kind::kProjected) {
+      continue;
+    }
+    if (field.type()->is_nested()) {
+      CollectDictionaryColumns(internal::checked_cast<const NestedType&>(*field.type()),
+                               projection.children, read_dictionary, column_ids,
+                               field_ids);
+      continue;
+    }
+    if (field.type()->type_id() != TypeId::kString &&
+        field.type()->type_id() != TypeId::kBinary) {
+      continue;
+    }
+    if (!read_dictionary.all && !read_dictionary.field_ids.contains(field.field_id())) {
+      continue;
+    }
+    if (projection.attributes == nullptr) {
+      continue;
+    }
+    const auto& attributes =
+        internal::checked_cast<const ParquetExtraAttributes&>(*projection.attributes);
+    if (attributes.column_id) {
+      column_ids->push_back(attributes.column_id.value());
+      field_ids->insert(field.field_id());
+    }
+  }
+}
+
+// The footer length and the magic number at the end of a Parquet file.
+constexpr int64_t kFooterTrailerSize = 8;
+
+// Parquet-specific reader properties resolved from ReaderOptions::properties.
+struct ParquetReadProperties {
+  int64_t footer_read_size;
+  bool pre_buffer;
+  ::arrow::io::CacheOptions cache_options;
+  int32_t io_threads;
+  bool use_threads;
+  int32_t max_in_flight_row_groups;
+  ReadDictionary read_dictionary;
+};
+
+Result<ParquetReadProperties> ParseReadProperties(const ReaderOptions& options) {
+  auto properties = ReaderProperties::FromMap(options.properties);
+  ParquetReadProperties result;
+  try {
+    result.footer_read_size = properties.Get(ReaderProperties::kParquetFooterReadSize);
+    result.pre_buffer = properties.Get(ReaderProperties::kParquetPreBuffer);
+    // Lazy caching only fetches the ranges of a row group once it is read, so memory
+    // usage stays bounded by the row groups being decoded.
+    result.cache_options = ::arrow::io::CacheOptions::LazyDefaults();
+    result.cache_options.hole_size_limit =
+        properties.Get(ReaderProperties::kParquetIoCoalesceHoleSizeLimit);
+    result.cache_options.range_size_limit =
+        properties.Get(ReaderProperties::kParquetIoCoalesceRangeSizeLimit);
+    result.io_threads = properties.Get(ReaderProperties::kParquetIoThreads);
+    result.use_threads = properties.Get(ReaderProperties::kParquetUseThreads);
+    result.max_in_flight_row_groups =
+        properties.Get(ReaderProperties::kParquetMaxInFlightRowGroups);
+    ICEBERG_ASSIGN_OR_RAISE(
+        result.read_dictionary,
+        ParseReadDictionary(properties.Get(ReaderProperties::kParquetReadDictionary)));
+  } catch (const std::exception& e) {
+    return InvalidArgument("Invalid Parquet reader properties: {}", e.what());
+  }
+  if (result.footer_read_size < kFooterTrailerSize) {
+    return InvalidArgument("Invalid Parquet footer read size {}, it must be at least {}",
+                           result.footer_read_size, kFooterTrailerSize);
+  }
+  if (result.cache_options.hole_size_limit < 0 ||
+      result.cache_options.range_size_limit <= result.cache_options.hole_size_limit) {
+    return InvalidArgument(
+        "Invalid Parquet read coalescing limits: hole size {} and range size {}",
+        result.cache_options.hole_size_limit, result.cache_options.range_size_limit);
+  }
+  if (result.max_in_flight_row_groups < 0) {
+    return InvalidArgument("Invalid number of in-flight Parquet row groups: {}",
+                           result.max_in_flight_row_groups);
+  }
+  return result;
+}
+
+// Returns the I/O thread pool with `threads` threads. Readers with the same number of
+// I/O threads share a pool, which is created on first use and kept for the lifetime of
+// the process, so that a scan over many files does not start threads for each file.
+Result<std::shared_ptr<::arrow::internal::ThreadPool>> SharedIoThreadPool(
+    int32_t threads) {
+  static std::mutex mutex;
+  static std::unordered_map<int32_t, std::shared_ptr<::arrow::internal::ThreadPool>>
+      pools;
+  std::lock_guard lock(mutex);
+  auto& pool = pools[threads];
+  if (pool == nullptr) {
+    ICEBERG_ARROW_ASSIGN_OR_RETURN(pool, ::arrow::internal::ThreadPool::Make(threads));
+  }
+  return pool;
+}
+
 class EmptyRecordBatchReader : public ::arrow::RecordBatchReader {
  public:
   EmptyRecordBatchReader() = default;
@@ -98,15 +321,21 @@ struct ReadContext {
   // the schema of record batches returned by `record_batch_reader_`
   // when there is any schema evolution.
   std::shared_ptr<::arrow::Schema> output_arrow_schema_;
-  // The reader to read record batches from the Parquet file.
+  // The reader to read record batches from the Parquet file one row group at a time.
+  // Either this or `batch_generator_` is set.
   std::unique_ptr<::arrow::RecordBatchReader> record_batch_reader_;
+  // The generator to read record batches of multiple row groups concurrently, in the
+  // order of the row groups.
+  ::arrow::AsyncGenerator<std::shared_ptr<::arrow::RecordBatch>> batch_generator_;
+  // The fields of record batches that can be returned without projecting them. All
+  // record batches share the same schema, so it is computed from the first one.
+  std::optional<ProjectionPassThrough> pass_through_;
 };
 
 // TODO(gangwu): list of work items
-// 1. Make the memory pool configurable
-// 2. Catch ParquetException and convert to Status/Result
-// 3. Add utility to convert Arrow Status/Result to Iceberg Status/Result
-// 4. Check field ids and apply name mapping if needed
+// 1. Catch ParquetException and convert to Status/Result
+// 2. Add utility to convert Arrow Status/Result to Iceberg Status/Result
+// 3. Check field ids and apply name mapping if needed
 class ParquetReader::Impl {
  public:
   // Open the Parquet reader with the given options
@@ -117,22 +346,88 @@ class ParquetReader::Impl {
 
     split_ = options.split;
     read_schema_ = options.projection;
+    memory_pool_ = options.memory_pool;
+    ICEBERG_ASSIGN_OR_RAISE(pool_, arrow::ToArrowMemoryPool(memory_pool_));
 
     // Prepare reader properties
+    ICEBERG_ASSIGN_OR_RAISE(auto read_properties, ParseReadProperties(options));
     ::parquet::ReaderProperties reader_properties(pool_);
+    // Fetch the footer along with its length in a single read when it fits.
+    reader_properties.set_footer_read_size(
+        static_cast<size_t>(read_properties.footer_read_size));
     ::parquet::ArrowReaderProperties arrow_reader_properties;
     arrow_reader_properties.set_batch_size(options.batch_size);
     arrow_reader_properties.set_arrow_extensions_enabled(true);
+    // Decode the columns of a row group in parallel on the CPU thread pool.
+    arrow_reader_properties.set_use_threads(read_properties.use_threads);
+    max_in_flight_row_groups_ = read_properties.max_in_flight_row_groups;
+    // Pre-buffering coalesces the small reads of column chunks into a few large reads,
+    // which matters on high-latency storage such as object stores.
+    arrow_reader_properties.set_pre_buffer(read_properties.pre_buffer);
+    arrow_reader_properties.set_cache_options(read_properties.cache_options);
+    if (read_properties.io_threads > 0) {
+      ICEBERG_ASSIGN_OR_RAISE(io_thread_pool_,
+                              SharedIoThreadPool(read_properties.io_threads));
+      arrow_reader_properties.set_io_context(
+          ::arrow::io::IOContext(pool_, io_thread_pool_.get()));
+    }
 
-    // Open the Parquet file reader
-    ICEBERG_ASSIGN_OR_RAISE(input_stream_, OpenInputStream(options));
-    auto file_reader =
-        ::parquet::ParquetFileReader::Open(input_stream_, reader_properties);
-    ICEBERG_ARROW_RETURN_NOT_OK(::parquet::arrow::FileReader::Make(
-        pool_, std::move(file_reader), arrow_reader_properties, &reader_));
+    // Open the Parquet file reader, reusing the footer parsed by a previous open of the
+    // same version of the file if it is cached.
+    const auto& cache = options.metadata_cache;
+    ICEBERG_ASSIGN_OR_RAISE(auto file_info, GetFileInfo(options));
+    ICEBERG_ASSIGN_OR_RAISE(input_stream_, OpenInputStream(options, file_info));
+    std::string footer_key;
+    std::shared_ptr<::parquet::FileMetaData> cached_metadata;
+    if (cache != nullptr) {
+      footer_key = FooterCacheKey(file_info);
+      if (auto entry = cache->Get(footer_key)) {
+        cached_metadata = internal::checked_cast<const CachedFooter&>(*entry).metadata;
+      }
+    }
+    auto file_reader = ::parquet::ParquetFileReader::Open(
+        input_stream_, reader_properties, cached_metadata);
+    auto metadata = file_reader->metadata();
+    if (cache != nullptr && cached_metadata == nullptr) {
+      cache->Put(footer_key, std::make_shared<CachedFooter>(metadata),
+                 static_cast<int64_t>(footer_key.size()) + FooterCharge(*metadata));
+    }
 
     // Project read schema onto the Parquet file schema
-    ICEBERG_ASSIGN_OR_RAISE(projection_, BuildProjection(reader_.get(), *read_schema_));
+    std::string projection_key;
+    std::shared_ptr<const FileMetadataCache::Entry> cached_projection;
+    if (cache != nullptr) {
+      projection_key = footer_key + "\n" + read_schema_->ToString();
+      cached_projection = cache->Get(projection_key);
+    }
+    if (cached_projection != nullptr) {
+      projection_ =
+          internal::checked_cast<const CachedProjection&>(*cached_projection).projection;
+    } else {
+      ICEBERG_ASSIGN_OR_RAISE(projection_, BuildProjection(*metadata,
+                                                           arrow_reader_properties,
+                                                           *read_schema_));
+      if (cache != nullptr) {
+        cache->Put(projection_key, std::make_shared<CachedProjection>(projection_),
+                   static_cast<int64_t>(projection_key.size()) +
+                       ProjectionCharge(projection_.fields));
+      }
+    }
+
+    // Keep dictionary-encoded column chunks encoded, which saves decoding and copying
+    // the repeated values of low-cardinality columns.
+    std::vector<int32_t> dictionary_column_ids;
+    CollectDictionaryColumns(*read_schema_, projection_.fields,
+                             read_properties.read_dictionary, &dictionary_column_ids,
+                             &dictionary_field_ids_);
+    for (int32_t column_id : dictionary_column_ids) {
+      arrow_reader_properties.set_read_dictionary(column_id, true);
+    }
+
+    std::unique_ptr<::parquet::arrow::FileReader> reader;
+    ICEBERG_ARROW_RETURN_NOT_OK(::parquet::arrow::FileReader::Make(
+        pool_, std::move(file_reader), arrow_reader_properties, &reader));
+    reader_ = std::move(reader);
 
     return {};
   }
@@ -143,14 +438,20 @@ class ParquetReader::Impl {
       ICEBERG_RETURN_UNEXPECTED(InitReadContext());
     }
 
-    ICEBERG_ARROW_ASSIGN_OR_RETURN(auto batch, context_->record_batch_reader_->Next());
+    ICEBERG_ASSIGN_OR_RAISE(auto batch, NextRecordBatch());
     if (!batch) {
       return std::nullopt;
     }
 
+    if (!context_->pass_through_.has_value()) {
+      // Without schema evolution, record batches are returned as read from the file.
+      context_->pass_through_ = MakeProjectionPassThrough(
+          *batch->schema(), *context_->output_arrow_schema_, projection_);
+    }
     ICEBERG_ASSIGN_OR_RAISE(
         batch, ProjectRecordBatch(std::move(batch), context_->output_arrow_schema_,
-                                  *read_schema_, projection_, pool_));
+                                  *read_schema_, projection_, pool_,
+                                  context_->pass_through_.value()));
 
     ArrowArray arrow_array;
     ICEBERG_ARROW_RETURN_NOT_OK(::arrow::ExportRecordBatch(*batch, &arrow_array));
@@ -164,7 +465,9 @@ class ParquetReader::Impl {
     }
 
     if (context_ != nullptr) {
-      ICEBERG_ARROW_RETURN_NOT_OK(context_->record_batch_reader_->Close());
+      if (context_->record_batch_reader_ != nullptr) {
+        ICEBERG_ARROW_RETURN_NOT_OK(context_->record_batch_reader_->Close());
+      }
       context_.reset();
     }
 
@@ -191,7 +494,8 @@ class ParquetReader::Impl {
 
     // Build the output Arrow schema
     ArrowSchema arrow_schema;
-    ICEBERG_RETURN_UNEXPECTED(ToArrowSchema(*read_schema_, &arrow_schema));
+    ICEBERG_RETURN_UNEXPECTED(
+        ToArrowSchema(*read_schema_, dictionary_field_ids_, &arrow_schema));
     ICEBERG_ARROW_ASSIGN_OR_RETURN(context_->output_arrow_schema_,
                                    ::arrow::ImportSchema(&arrow_schema));
 
@@ -220,27 +524,71 @@ class ParquetReader::Impl {
       context_->record_batch_reader_ = std::make_unique<EmptyRecordBatchReader>();
     } else {
       auto column_indices = SelectedColumnIndices(projection_);
-      ICEBERG_ARROW_ASSIGN_OR_RETURN(
-          context_->record_batch_reader_,
-          reader_->GetRecordBatchReader(row_group_indices, column_indices));
+      if (max_in_flight_row_groups_ > 0) {
+        ICEBERG_ARROW_ASSIGN_OR_RETURN(
+            context_->batch_generator_,
+            reader_->GetRecordBatchGenerator(
+                reader_, row_group_indices, column_indices,
+                ::arrow::internal::GetCpuThreadPool(),
+                RowsToReadahead(row_group_indices, max_in_flight_row_groups_)));
+      } else {
+        ICEBERG_ARROW_ASSIGN_OR_RETURN(
+            context_->record_batch_reader_,
+            reader_->GetRecordBatchReader(row_group_indices, column_indices));
+      }
     }
 
     return {};
   }
 
+  // The generator keeps reading the next row group while fewer rows than this are in
+  // flight. Every selected row group has at least as many rows as the smallest one, so
+  // bounding by it keeps at most `max_in_flight_row_groups` in flight, and fewer when
+  // the row groups are larger.
+  int64_t RowsToReadahead(const std::vector<int>& row_group_indices,
+                          int32_t max_in_flight_row_groups) const {
+    auto metadata = reader_->parquet_reader()->metadata();
+    int64_t min_rows = std::numeric_limits<int64_t>::max();
+    for (int index : row_group_indices) {
+      min_rows = std::min(min_rows, metadata->RowGroup(index)->num_rows());
+    }
+    min_rows = std::max<int64_t>(min_rows, 1);
+    return (max_in_flight_row_groups - 1) * min_rows + 1;
+  }
+
+  Result<std::shared_ptr<::arrow::RecordBatch>> NextRecordBatch() {
+    if (context_->batch_generator_) {
+      ICEBERG_ARROW_ASSIGN_OR_RETURN(auto batch,
+                                     context_->batch_generator_().MoveResult());
+      // The end of the generator is signaled by a null batch.
+      return batch;
+    }
+    ICEBERG_ARROW_ASSIGN_OR_RETURN(auto batch, context_->record_batch_reader_->Next());
+    return batch;
+  }
+
  private:
-  // TODO(gangwu): make memory pool configurable
+  // The memory pool given by the reader options, which keeps `pool_` alive.
+  std::shared_ptr<MemoryPool> memory_pool_;
+  // The arrow memory pool to allocate record batches from.
   ::arrow::MemoryPool* pool_ = ::arrow::default_memory_pool();
+  // The shared thread pool to pre-buffer with, it must outlive `reader_`.
+  std::shared_ptr<::arrow::internal::ThreadPool> io_thread_pool_;
   // The split to read from the Parquet file.
   std::optional<Split> split_;
   // Schema to read from the Parquet file.
   std::shared_ptr<::iceberg::Schema> read_schema_;
   // The projection result to apply to the read schema.
   SchemaProjection projection_;
+  // Ids of the fields read as Arrow dictionary arrays.
+  std::unordered_set<int32_t> dictionary_field_ids_;
   // The input stream to read Parquet file.
   std::shared_ptr<::arrow::io::RandomAccessFile> input_stream_;
-  // Parquet file reader to create RecordBatchReader.
-  std::unique_ptr<::parquet::arrow::FileReader> reader_;
+  // Max number of row groups to read concurrently, or zero to read them one by one.
+  int32_t max_in_flight_row_groups_ = 0;
+  // Parquet file reader to create RecordBatchReader. It is shared with the batch
+  // generator, which may outlive a pending read.
+  std::shared_ptr<::parquet::arrow::FileReader> reader_;
   // The context to keep track of the reading progress.
   std::unique_ptr<ReadContext> context_;
 };
@@ -19,10 +19,19 @@
 
 #include "iceberg/parquet/parquet_writer.h"
 
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <limits>
 #include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
 
 #include <arrow/c/bridge.h>
 #include <arrow/record_batch.h>
+#include <arrow/util/byte_size.h>
+#include <arrow/util/compression.h>
 #include <arrow/util/key_value_metadata.h>
 #include <parquet/arrow/schema.h>
 #include <parquet/arrow/writer.h>
@@ -31,9 +40,15 @@
 
 #include "iceberg/arrow/arrow_error_transform_internal.h"
 #include "iceberg/arrow/arrow_fs_file_io_internal.h"
+#include "iceberg/arrow/arrow_memory_pool_internal.h"
+#include "iceberg/metrics_config.h"
+#include "iceberg/parquet/parquet_metrics_internal.h"
+#include "iceberg/schema.h"
 #include "iceberg/schema_internal.h"
 #include "iceberg/util/checked_cast.h"
+#include "iceberg/util/formatter.h"  // IWYU pragma: keep
 #include "iceberg/util/macros.h"
+#include "iceberg/util/string_util.h"
 
 namespace iceberg::parquet {
 
@@ -46,23 +61,213 @@ Result<std::shared_ptr<::arrow::io::OutputStream>> OpenOutputStream(
   return output;
 }
 
+Result<int32_t> ParseInt(std::string_view value, std::string_view key) {
+  int32_t result = 0;
+  auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), result);
+  if (ec != std::errc() || ptr != value.data() + value.size()) {
+    return InvalidArgument("Invalid value of {}: {}", key, value);
+  }
+  return result;
+}
+
+Result<::arrow::Compression::type> ParseCompressionCodec(std::string_view value,
+                                                         std::string_view key) {
+  auto name = StringUtils::ToLower(value);
+  // Arrow writes the LZ4 codec in the deprecated Hadoop framing, so "lz4" is written as
+  // LZ4_RAW, which Parquet readers support.
+  if (name == "lz4") {
+    name = "lz4_raw";
+  }
+  auto codec = ::arrow::util::Codec::GetCompressionType(name);
+  if (!codec.ok()) {
+    return InvalidArgument("Invalid value of {}: {}", key, value);
+  }
+  if (!::arrow::util::Codec::IsAvailable(*codec)) {
+    return NotSupported(
+        "Parquet compression codec {} is not available in this build, set {} to "
+        "another codec",
+        value, key);
+  }
+  return *codec;
+}
+
+Result<bool> ParseBool(std::string_view value, std::string_view key) {
+  auto lower = StringUtils::ToLower(value);
+  if (lower == "true") {
+    return true;
+  }
+  if (lower == "false") {
+    return false;
+  }
+  return InvalidArgument("Invalid value of {}: {}", key, value);
+}
+
+// Settings of a column that override the file-level ones.
+struct ColumnWriteProperties {
+  std::optional<::arrow::Compression::type> compression_codec;
+  std::optional<int32_t> compression_level;
+  std::optional<bool> dict_enabled;
+};
+
+// Parquet-specific writer properties resolved from WriterOptions::properties.
+struct ParquetWriteProperties {
+  ::arrow::Compression::type compression_codec;
+  std::optional<int32_t> compression_level;
+  int64_t row_group_size_bytes;
+  int64_t page_size_bytes;
+  int64_t dict_size_bytes;
+  // Column-level settings keyed by field id.
+  std::unordered_map<int32_t, ColumnWriteProperties> columns;
+};
+
+// Returns the column-level settings to update if `key` starts with `prefix` followed
+// by the name of a column in `schema`, or nullptr otherwise.
+Result<ColumnWriteProperties*> ColumnProperties(std::string_view key,
+                                                std::string_view prefix,
+                                                const Schema& schema,
+                                                ParquetWriteProperties* properties) {
+  if (!key.starts_with(prefix)) {
+    return nullptr;
+  }
+  // Settings of columns that are not in the schema are ignored, as they may refer to
+  // columns that were dropped.
+  ICEBERG_ASSIGN_OR_RAISE(auto field, schema.FindFieldByName(key.substr(prefix.size())));
+  if (!field.has_value()) {
+    return nullptr;
+  }
+  return &properties->columns[field->get().field_id()];
+}
+
+Result<ParquetWriteProperties> ParseWriteProperties(const WriterOptions& options,
+                                                    const Schema& schema) {
+  auto properties = WriterProperties::FromMap(options.properties);
+  ParquetWriteProperties result;
+  try {
+    result.row_group_size_bytes =
+        properties.Get(WriterProperties::kParquetRowGroupSizeBytes);
+    result.page_size_bytes = properties.Get(WriterProperties::kParquetPageSizeBytes);
+    result.dict_size_bytes = properties.Get(WriterProperties::kParquetDictSizeBytes);
+  } catch (const std::exception& e) {
+    return InvalidArgument("Invalid Parquet writer properties: {}", e.what());
+  }
+  if (result.row_group_size_bytes <= 0 || result.page_size_bytes <= 0 ||
+      result.dict_size_bytes <= 0) {
+    return InvalidArgument(
+        "Invalid Parquet writer sizes: row group {}, page {} and dictionary {} bytes",
+        result.row_group_size_bytes, result.page_size_bytes, result.dict_size_bytes);
+  }
+
+  const auto& codec_entry = WriterProperties::kParquetCompressionCodec;
+  auto codec = ParseCompressionCodec(properties.Get(codec_entry), codec_entry.key());
+  if (!codec.has_value() && codec.error().kind == ErrorKind::kNotSupported &&
+      !options.properties.contains(codec_entry.key())) {
+    // Builds without the default codec write uncompressed files rather than failing.
+    codec = ::arrow::Compression::UNCOMPRESSED;
+  }
+  ICEBERG_ASSIGN_OR_RAISE(result.compression_codec, codec);
+  const auto& level_entry = WriterProperties::kParquetCompressionLevel;
+  if (auto level = properties.Get(level_entry); !level.empty()) {
+    ICEBERG_ASSIGN_OR_RAISE(result.compression_level,
+                            ParseInt(level, level_entry.key()));
+  }
+
+  for (const auto& [key, value] : options.properties) {
+    ICEBERG_ASSIGN_OR_RAISE(
+        auto* column,
+        ColumnProperties(key, WriterProperties::kParquetColumnCompressionCodecPrefix,
+                         schema, &result));
+    if (column != nullptr) {
+      ICEBERG_ASSIGN_OR_RAISE(column->compression_codec,
+                              ParseCompressionCodec(value, key));
+      continue;
+    }
+    ICEBERG_ASSIGN_OR_RAISE(
+        column,
+        ColumnProperties(key, WriterProperties::kParquetColumnCompressionLevelPrefix,
+                         schema, &result));
+    if (column != nullptr) {
+      ICEBERG_ASSIGN_OR_RAISE(column->compression_level, ParseInt(value, key));
+      continue;
+    }
+    ICEBERG_ASSIGN_OR_RAISE(
+        column, ColumnProperties(key, WriterProperties::kParquetColumnDictEnabledPrefix,
+                                 schema, &result));
+    if (column != nullptr) {
+      ICEBERG_ASSIGN_OR_RAISE(column->dict_enabled, ParseBool(value, key));
+    }
+  }
+  return result;
+}
+
+// Build the Parquet writer properties. Column-level settings apply to the leaf columns
+// of `schema_descriptor` with their field ids.
+std::shared_ptr<::parquet::WriterProperties> MakeWriterProperties(
+    const ParquetWriteProperties& properties,
+    const ::parquet::SchemaDescriptor& schema_descriptor, ::arrow::MemoryPool* pool) {
+  ::parquet::WriterProperties::Builder builder;
+  // Row groups are cut by size in ParquetWriter::Impl::WriteRowGroups, not by the
+  // default limit of 1M rows.
+  builder.memory_pool(pool)
+      ->max_row_group_length(std::numeric_limits<int64_t>::max())
+      ->compression(properties.compression_codec)
+      ->data_pagesize(properties.page_size_bytes)
+      ->dictionary_pagesize_limit(properties.dict_size_bytes);
+  if (properties.compression_level.has_value()) {
+    builder.compression_level(properties.compression_level.value());
+  }
+
+  for (int i = 0; i < schema_descriptor.num_columns(); ++i) {
+    const auto* column = schema_descriptor.Column(i);
+    auto it = properties.columns.find(column->schema_node()->field_id());
+    if (it == properties.columns.end()) {
+      continue;
+    }
+    auto path = column->path()->ToDotString();
+    const auto& column_properties = it->second;
+    if (column_properties.compression_codec.has_value()) {
+      builder.compression(path, column_properties.compression_codec.value());
+    }
+    if (column_properties.compression_level.has_value()) {
+      builder.compression_level(path, column_properties.compression_level.value());
+    }
+    if (column_properties.dict_enabled.has_value()) {
+      if (column_properties.dict_enabled.value()) {
+        builder.enable_dictionary(path);
+      } else {
+        builder.disable_dictionary(path);
+      }
+    }
+  }
+  return builder.build();
+}
+
 }  // namespace
 
 class ParquetWriter::Impl {
  public:
   Status Open(const WriterOptions& options) {
-    auto writer_properties =
-        ::parquet::WriterProperties::Builder().memory_pool(pool_)->build();
+    schema_ = options.schema;
+    ICEBERG_ASSIGN_OR_RAISE(metrics_config_,
+                            MetricsConfig::Make(options.properties, *schema_));
+    memory_pool_ = options.memory_pool;
+    ICEBERG_ASSIGN_OR_RAISE(pool_, arrow::ToArrowMemoryPool(memory_pool_));
+    ICEBERG_ASSIGN_OR_RAISE(auto write_properties,
+                            ParseWriteProperties(options, *schema_));
+    row_group_size_bytes_ = write_properties.row_group_size_bytes;
     auto arrow_writer_properties = ::parquet::default_arrow_writer_properties();
 
     ArrowSchema c_schema;
     ICEBERG_RETURN_UNEXPECTED(ToArrowSchema(*options.schema, &c_schema));
     ICEBERG_ARROW_ASSIGN_OR_RETURN(arrow_schema_, ::arrow::ImportSchema(&c_schema));
 
+    // The schema conversion does not depend on the compression and sizing settings,
+    // which need the converted schema to resolve the paths of column-level settings.
     std::shared_ptr<::parquet::SchemaDescriptor> schema_descriptor;
-    ICEBERG_ARROW_RETURN_NOT_OK(
-        ::parquet::arrow::ToParquetSchema(arrow_schema_.get(), *writer_properties,
-                                          *arrow_writer_properties, &schema_descriptor));
+    ICEBERG_ARROW_RETURN_NOT_OK(::parquet::arrow::ToParquetSchema(
+        arrow_schema_.get(), *::parquet::default_writer_properties(),
+        *arrow_writer_properties, &schema_descriptor));
+    auto writer_properties =
+        MakeWriterProperties(write_properties, *schema_descriptor, pool_);
     auto schema_node = std::static_pointer_cast<::parquet::schema::GroupNode>(
         schema_descriptor->schema_root());
 
@@ -80,7 +285,8 @@ class ParquetWriter::Impl {
     ICEBERG_ARROW_ASSIGN_OR_RETURN(auto batch,
                                    ::arrow::ImportRecordBatch(&array, arrow_schema_));
 
-    ICEBERG_ARROW_RETURN_NOT_OK(writer_->WriteRecordBatch(*batch));
+    ICEBERG_RETURN_UNEXPECTED(WriteRowGroups(*batch));
+    ICEBERG_RETURN_UNEXPECTED(CountNaNValues(*schema_, *batch, &nan_value_counts_));
 
     return {};
   }
@@ -97,6 +303,8 @@ class ParquetWriter::Impl {
     for (int i = 0; i < metadata->num_row_groups(); ++i) {
       split_offsets_.push_back(metadata->RowGroup(i)->file_offset());
     }
+    ICEBERG_ASSIGN_OR_RAISE(
+        metrics_, FooterMetrics(*schema_, *metadata, metrics_config_, nan_value_counts_));
     writer_.reset();
 
     ICEBERG_ARROW_ASSIGN_OR_RETURN(total_bytes_, output_stream_->Tell());
@@ -106,19 +314,101 @@ class ParquetWriter::Impl {
 
   bool Closed() const { return writer_ == nullptr; }
 
-  int64_t length() const { return total_bytes_; }
+  std::optional<int64_t> length() const {
+    if (writer_ == nullptr) {
+      return total_bytes_;
+    }
+    // The closed row groups are in the output stream, the size of the buffered one is
+    // estimated.
+    auto position = output_stream_->Tell();
+    if (!position.ok()) {
+      return std::nullopt;
+    }
+    return *position + EstimatedRowGroupBytes();
+  }
 
   std::vector<int64_t> split_offsets() const { return split_offsets_; }
 
+  const Metrics& metrics() const { return metrics_; }
+
  private:
-  // TODO(gangwu): make memory pool configurable
+  // Write a batch into the buffered row group, and start a new row group when the
+  // buffered one reaches the target size. The batch is split when it does not fit.
+  Status WriteRowGroups(const ::arrow::RecordBatch& batch) {
+    if (batch.num_rows() == 0) {
+      return {};
+    }
+    const double row_size = std::max<double>(
+        1.0, static_cast<double>(::arrow::util::TotalBufferSize(batch)) /
+                 static_cast<double>(batch.num_rows()));
+    int64_t offset = 0;
+    while (offset < batch.num_rows()) {
+      if (EstimatedRowGroupBytes() >= row_group_size_bytes_) {
+        ICEBERG_RETURN_UNEXPECTED(NewRowGroup());
+      }
+      auto remaining_rows = std::ceil(
+          static_cast<double>(row_group_size_bytes_ - EstimatedRowGroupBytes()) /
+          (row_size * encoded_ratio_));
+      int64_t rows = std::clamp<int64_t>(static_cast<int64_t>(remaining_rows), 1,
+                                         batch.num_rows() - offset);
+      auto slice = batch.Slice(offset, rows);
+      ICEBERG_ARROW_RETURN_NOT_OK(writer_->WriteRecordBatch(*slice));
+      row_group_memory_bytes_ += static_cast<double>(rows) * row_size;
+      offset += rows;
+    }
+    return {};
+  }
+
+  // The encoded size of the buffered row group, estimated from the in-memory size of
+  // its rows and the ratio of the encoded to the in-memory size of the closed ones.
+  int64_t EstimatedRowGroupBytes() const {
+    return static_cast<int64_t>(row_group_memory_bytes_ * encoded_ratio_);
+  }
+
+  // Close the buffered row group, which writes it to the output stream, and update the
+  // ratio of encoded to in-memory size with its size. Started lazily, so that closing
+  // the file does not write an empty row group.
+  Status NewRowGroup() {
+    ICEBERG_ARROW_ASSIGN_OR_RETURN(auto start, output_stream_->Tell());
+    ICEBERG_ARROW_RETURN_NOT_OK(writer_->NewBufferedRowGroup());
+    ICEBERG_ARROW_ASSIGN_OR_RETURN(auto end, output_stream_->Tell());
+    written_memory_bytes_ += row_group_memory_bytes_;
+    written_encoded_bytes_ += static_cast<double>(end - start);
+    if (written_memory_bytes_ > 0 && written_encoded_bytes_ > 0) {
+      encoded_ratio_ = written_encoded_bytes_ / written_memory_bytes_;
+    }
+    row_group_memory_bytes_ = 0;
+    return {};
+  }
+
+  // The memory pool given by the writer options, which keeps `pool_` alive.
+  std::shared_ptr<MemoryPool> memory_pool_;
+  // The arrow memory pool to allocate encoding buffers from.
   ::arrow::MemoryPool* pool_ = ::arrow::default_memory_pool();
+  // Iceberg schema of the written data.
+  std::shared_ptr<Schema> schema_;
   // Schema to write from the Parquet file.
   std::shared_ptr<::arrow::Schema> arrow_schema_;
+  // The metrics modes of the columns, from the writer properties.
+  MetricsConfig metrics_config_ = MetricsConfig::Default();
+  // NaN counts of float and double fields, which Parquet statistics do not track.
+  std::unordered_map<int64_t, int64_t> nan_value_counts_;
+  // Metrics collected from the footer when the file is closed.
+  Metrics metrics_;
   // The output stream to write Parquet file.
   std::shared_ptr<::arrow::io::OutputStream> output_stream_;
   // Parquet file writer to write ArrowArray.
   std::unique_ptr<::parquet::arrow::FileWriter> writer_;
+  // Target size of a row group in bytes.
+  int64_t row_group_size_bytes_ = 0;
+  // In-memory size of the rows of the buffered row group in bytes.
+  double row_group_memory_bytes_ = 0;
+  // In-memory and encoded sizes of the closed row groups in bytes.
+  double written_memory_bytes_ = 0;
+  double written_encoded_bytes_ = 0;
+  // Ratio of the encoded to the in-memory size of rows, assumed to be 1 until the first
+  // row group is closed.
+  double encoded_ratio_ = 1;
   // Total length of the written Parquet file.
   int64_t total_bytes_{0};
   // Row group start offsets in the Parquet file.
@@ -140,15 +430,10 @@ std::optional<Metrics> ParquetWriter::metrics() {
   if (!impl_->Closed()) {
     return std::nullopt;
   }
-  return {};
+  return impl_->metrics();
 }
 
-std::optional<int64_t> ParquetWriter::length() {
-  if (!impl_->Closed()) {
-    return std::nullopt;
-  }
-  return impl_->length();
-}
+std::optional<int64_t> ParquetWriter::length() { return impl_->length(); }
 
 std::vector<int64_t> ParquetWriter::split_offsets() {
   if (!impl_->Closed()) {
@@ -24,7 +24,10 @@
 #include <ranges>
 
 #include "iceberg/schema.h"
+#include "iceberg/transform.h"
+#include "iceberg/transform_function.h"
 #include "iceberg/util/formatter.h"  // IWYU pragma: keep
+#include "iceberg/util/macros.h"
 
 namespace iceberg {
 
@@ -57,6 +60,26 @@ int32_t PartitionSpec::spec_id() const { return spec_id_; }
 
 std::span<const PartitionField> PartitionSpec::fields() const { return fields_; }
 
+Result<std::shared_ptr<Schema>> PartitionSpec::PartitionSchema() const {
+  std::vector<SchemaField> partition_fields;
+  partition_fields.reserve(fields_.size());
+  for (const auto& field : fields_) {
+    if (!schema_) {
+      return InvalidSchema("Partition spec {} has no schema", spec_id_);
+    }
+    ICEBERG_ASSIGN_OR_RAISE(auto source_field, schema_->FindFieldById(field.source_id()));
+    if (!source_field.has_value()) {
+      return InvalidSchema("Cannot find source field {} of partition field {}",
+                           field.source_id(), field.name());
+    }
+    ICEBERG_ASSIGN_OR_RAISE(auto transform,
+                            field.transform()->Bind(source_field->get().type()));
+    partition_fields.push_back(SchemaField::MakeOptional(
+        field.field_id(), std::string(field.name()), transform->ResultType()));
+  }
+  return std::make_shared<Schema>(std::move(partition_fields));
+}
+
 std::string PartitionSpec::ToString() const {
   std::string repr = std::format("partition_spec[spec_id<{}>,\n", spec_id_);
   for (const auto& field : fields_) {
@@ -30,6 +30,7 @@
 
 #include "iceberg/iceberg_export.h"
 #include "iceberg/partition_field.h"
+#include "iceberg/result.h"
 #include "iceberg/util/formattable.h"
 
 namespace iceberg {
@@ -67,6 +68,12 @@ class ICEBERG_EXPORT PartitionSpec : public util::Formattable {
   /// \brief Get a view of the partition fields.
   std::span<const PartitionField> fields() const;
 
+  /// \brief Get the partition type of this spec as a schema, whose fields are the
+  /// optional results of the partition transforms, in the order of the partition fields.
+  ///
+  /// This is the partition schema that manifest readers and writers expect.
+  Result<std::shared_ptr<Schema>> PartitionSchema() const;
+
   std::string ToString() const override;
 
   int32_t last_assigned_field_id() const { return last_assigned_field_id_; }
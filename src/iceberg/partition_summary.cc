@@ -0,0 +1,113 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/partition_summary.h"
+
+#include <cmath>
+#include <variant>
+
+#include "iceberg/type.h"
+#include "iceberg/util/macros.h"
+
+namespace iceberg {
+
+namespace {
+
+bool IsNaN(const Literal& value) {
+  if (const auto* f = std::get_if<float>(&value.value())) {
+    return std::isnan(*f);
+  }
+  if (const auto* d = std::get_if<double>(&value.value())) {
+    return std::isnan(*d);
+  }
+  return false;
+}
+
+}  // namespace
+
+PartitionSummary::PartitionSummary(const StructType& partition_type)
+    : fields_(partition_type.fields().size()) {}
+
+void PartitionSummary::UpdateField(FieldStats& stats, const Literal& value) {
+  if (value.IsNull()) {
+    stats.contains_null = true;
+    return;
+  }
+  if (IsNaN(value)) {
+    stats.contains_nan = true;
+    return;
+  }
+  if (!stats.lower_bound.has_value() || value < *stats.lower_bound) {
+    stats.lower_bound = value;
+  }
+  if (!stats.upper_bound.has_value() || value > *stats.upper_bound) {
+    stats.upper_bound = value;
+  }
+}
+
+Status PartitionSummary::Update(const std::vector<Literal>& partition) {
+  if (partition.size() != fields_.size()) {
+    return InvalidArgument("Expected {} partition values but got {}", fields_.size(),
+                           partition.size());
+  }
+  for (size_t i = 0; i < fields_.size(); ++i) {
+    UpdateField(fields_[i], partition[i]);
+  }
+  return {};
+}
+
+Status PartitionSummary::Merge(const PartitionSummary& other) {
+  if (other.fields_.size() != fields_.size()) {
+    return InvalidArgument("Cannot merge partition summaries of {} and {} fields",
+                           fields_.size(), other.fields_.size());
+  }
+  for (size_t i = 0; i < fields_.size(); ++i) {
+    const FieldStats& from = other.fields_[i];
+    FieldStats& to = fields_[i];
+    to.contains_null |= from.contains_null;
+    to.contains_nan |= from.contains_nan;
+    if (from.lower_bound.has_value()) {
+      UpdateField(to, *from.lower_bound);
+    }
+    if (from.upper_bound.has_value()) {
+      UpdateField(to, *from.upper_bound);
+    }
+  }
+  return {};
+}
+
+Result<std::vector<PartitionFieldSummary>> PartitionSummary::Summaries() const {
+  std::vector<PartitionFieldSummary> summaries;
+  summaries.reserve(fields_.size());
+  for (const auto& stats : fields_) {
+    PartitionFieldSummary summary;
+    summary.contains_null = stats.contains_null;
+    summary.contains_nan = stats.contains_nan;
+    if (stats.lower_bound.has_value()) {
+      ICEBERG_ASSIGN_OR_RAISE(summary.lower_bound, stats.lower_bound->Serialize());
+    }
+    if (stats.upper_bound.has_value()) {
+      ICEBERG_ASSIGN_OR_RAISE(summary.upper_bound, stats.upper_bound->Serialize());
+    }
+    summaries.push_back(std::move(summary));
+  }
+  return summaries;
+}
+
+}  // namespace iceberg
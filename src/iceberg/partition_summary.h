@@ -0,0 +1,70 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+/// \file iceberg/partition_summary.h
+/// Summaries of the partition values of the files in a manifest.
+
+#include <optional>
+#include <vector>
+
+#include "iceberg/expression/literal.h"
+#include "iceberg/iceberg_export.h"
+#include "iceberg/manifest_list.h"
+#include "iceberg/result.h"
+#include "iceberg/type_fwd.h"
+
+namespace iceberg {
+
+/// \brief Accumulates the `PartitionFieldSummary` of each partition field over the
+/// partition tuples of the files added to a manifest.
+///
+/// Bounds ignore null and NaN values, which are tracked by `contains_null` and
+/// `contains_nan`. Manifest lists store the bounds in their single-value binary
+/// serialization.
+class ICEBERG_EXPORT PartitionSummary {
+ public:
+  /// \param partition_type The partition type of the partition spec of the manifest.
+  explicit PartitionSummary(const StructType& partition_type);
+
+  /// \brief Add the partition tuple of a file.
+  Status Update(const std::vector<Literal>& partition);
+
+  /// \brief Add the summaries accumulated by another PartitionSummary of the same
+  /// partition type.
+  Status Merge(const PartitionSummary& other);
+
+  /// \brief Returns the summary of each partition field.
+  Result<std::vector<PartitionFieldSummary>> Summaries() const;
+
+ private:
+  struct FieldStats {
+    bool contains_null = false;
+    bool contains_nan = false;
+    std::optional<Literal> lower_bound;
+    std::optional<Literal> upper_bound;
+  };
+
+  void UpdateField(FieldStats& stats, const Literal& value);
+
+  std::vector<FieldStats> fields_;
+};
+
+}  // namespace iceberg
@@ -0,0 +1,272 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/rewrite_manifests.h"
+
+#include <algorithm>
+#include <cmath>
+#include <compare>
+#include <map>
+#include <optional>
+#include <unordered_set>
+
+#include "iceberg/expression/literal.h"
+#include "iceberg/manifest_entry.h"
+#include "iceberg/manifest_reader.h"
+#include "iceberg/parallel_manifest_writer.h"
+#include "iceberg/partition_spec.h"
+#include "iceberg/schema.h"
+#include "iceberg/snapshot.h"
+#include "iceberg/table_metadata.h"
+#include "iceberg/util/macros.h"
+
+namespace iceberg {
+
+namespace {
+
+bool IsNaN(const Literal& value) {
+  if (const auto* f = std::get_if<float>(&value.value())) {
+    return std::isnan(*f);
+  }
+  if (const auto* d = std::get_if<double>(&value.value())) {
+    return std::isnan(*d);
+  }
+  return false;
+}
+
+/// \brief Orders partition values with nulls first and NaN last.
+std::weak_ordering ComparePartitionValues(const Literal& lhs, const Literal& rhs) {
+  if (lhs.IsNull() || rhs.IsNull()) {
+    return rhs.IsNull() <=> lhs.IsNull();
+  }
+  auto order = lhs <=> rhs;
+  if (order == std::partial_ordering::less) {
+    return std::weak_ordering::less;
+  }
+  if (order == std::partial_ordering::greater) {
+    return std::weak_ordering::greater;
+  }
+  if (order == std::partial_ordering::equivalent) {
+    return std::weak_ordering::equivalent;
+  }
+  return IsNaN(lhs) <=> IsNaN(rhs);
+}
+
+bool PartitionLess(const ManifestEntry& lhs, const ManifestEntry& rhs) {
+  const auto& left = lhs.data_file->partition;
+  const auto& right = rhs.data_file->partition;
+  for (size_t i = 0; i < std::min(left.size(), right.size()); ++i) {
+    auto order = ComparePartitionValues(left[i], right[i]);
+    if (order != 0) {
+      return order < 0;
+    }
+  }
+  return left.size() < right.size();
+}
+
+}  // namespace
+
+RewriteManifests::RewriteManifests(const Table& table) : SnapshotProducer(table) {}
+
+RewriteManifests& RewriteManifests::RewriteIf(
+    std::function<bool(const ManifestFile&)> predicate) {
+  predicate_ = std::move(predicate);
+  return *this;
+}
+
+RewriteManifests& RewriteManifests::MaxConcurrency(int32_t max_concurrency) {
+  max_concurrency_ = max_concurrency;
+  return *this;
+}
+
+std::string RewriteManifests::operation() const { return DataOperation::kReplace; }
+
+Result<std::vector<ManifestFile>> RewriteManifests::Apply(
+    const TableMetadata& base, const std::shared_ptr<Snapshot>& parent) {
+  if (parent == nullptr) {
+    return std::vector<ManifestFile>{};
+  }
+  ICEBERG_ASSIGN_OR_RAISE(auto manifest_list_reader,
+                          ManifestListReader::Make(parent->manifest_list, io()));
+  ICEBERG_ASSIGN_OR_RAISE(auto manifests, manifest_list_reader->Files());
+
+  std::vector<ManifestFile> kept;
+  if (rewritten_manifests_.empty()) {
+    processed_entries_count_ = 0;
+    ICEBERG_ASSIGN_OR_RAISE(kept, RewriteSelected(base, std::move(manifests)));
+  } else {
+    // A retry: Validate() checked that the rewritten manifests are still in the
+    // table, so the rewrite is reused and the other manifests are kept, including
+    // those added concurrently.
+    std::unordered_set<std::string_view> rewritten;
+    for (const auto& manifest : rewritten_manifests_) {
+      rewritten.insert(manifest.manifest_path);
+    }
+    for (auto& manifest : manifests) {
+      if (!rewritten.contains(manifest.manifest_path)) {
+        kept.push_back(std::move(manifest));
+      }
+    }
+  }
+
+  kept_manifests_count_ = static_cast<int64_t>(kept.size());
+  std::vector<ManifestFile> result = added_manifests_;
+  std::ranges::move(kept, std::back_inserter(result));
+  return result;
+}
+
+Result<std::vector<ManifestFile>> RewriteManifests::RewriteSelected(
+    const TableMetadata& base, std::vector<ManifestFile> manifests) {
+  int64_t target_size;
+  try {
+    target_size = ManifestWriterProperties::FromMap(base.properties)
+                      .Get(ManifestWriterProperties::kTargetSizeBytes);
+  } catch (const std::exception& e) {
+    return InvalidArgument("Invalid {}: {}",
+                           ManifestWriterProperties::kTargetSizeBytes.key(), e.what());
+  }
+  auto selected = [&](const ManifestFile& manifest) {
+    if (manifest.content != ManifestFile::Content::kData) {
+      return false;
+    }
+    return predicate_ ? predicate_(manifest) : manifest.manifest_length < target_size;
+  };
+
+  // Manifests to rewrite by partition spec, ordered by spec id so that the rewrite is
+  // deterministic.
+  std::map<int32_t, std::vector<ManifestFile>> manifests_by_spec;
+  std::vector<ManifestFile> kept;
+  for (auto& manifest : manifests) {
+    if (selected(manifest)) {
+      manifests_by_spec[manifest.partition_spec_id].push_back(std::move(manifest));
+    } else {
+      kept.push_back(std::move(manifest));
+    }
+  }
+
+  for (auto& [spec_id, spec_manifests] : manifests_by_spec) {
+    if (spec_manifests.size() < 2) {
+      std::ranges::move(spec_manifests, std::back_inserter(kept));
+      continue;
+    }
+
+    auto spec = std::ranges::find_if(base.partition_specs, [spec_id](const auto& spec) {
+      return spec->spec_id() == spec_id;
+    });
+    if (spec == base.partition_specs.end()) {
+      return InvalidManifestList("Cannot find partition spec {} of manifest {}", spec_id,
+                                 spec_manifests.front().manifest_path);
+    }
+    ICEBERG_ASSIGN_OR_RAISE(auto partition_schema, (*spec)->PartitionSchema());
+
+    std::vector<ManifestEntry> entries;
+    for (const auto& manifest : spec_manifests) {
+      ICEBERG_ASSIGN_OR_RAISE(auto reader,
+                              ManifestReader::Make(manifest, io(), partition_schema));
+      ICEBERG_ASSIGN_OR_RAISE(auto manifest_entries, reader->Entries());
+      processed_entries_count_ += static_cast<int64_t>(manifest_entries.size());
+      // Live files without a first row id inherit the row ids following the first
+      // row id of their manifest, in order. Assign them before the files move to a
+      // new manifest, which would otherwise be assigned a new range of row ids.
+      std::optional<int64_t> next_row_id;
+      if (base.format_version >= TableMetadata::kMinFormatVersionRowLineage) {
+        next_row_id = manifest.first_row_id;
+      }
+      for (auto& entry : manifest_entries) {
+        if (entry.status == ManifestStatus::kDeleted) {
+          continue;
+        }
+        if (entry.data_file == nullptr) {
+          return InvalidManifest("Manifest entry in {} has no data file",
+                                 manifest.manifest_path);
+        }
+        if (next_row_id.has_value() && !entry.data_file->first_row_id.has_value()) {
+          entry.data_file->first_row_id = *next_row_id;
+          *next_row_id += entry.data_file->record_count;
+        }
+        entry.status = ManifestStatus::kExisting;
+        entries.push_back(std::move(entry));
+      }
+    }
+    std::ranges::stable_sort(entries, PartitionLess);
+
+    ParallelManifestWriterOptions options{
+        .format_version = base.format_version,
+        .snapshot_id = snapshot_id(),
+        .partition_spec_id = spec_id,
+        .partition_schema = std::move(partition_schema),
+        .io = io(),
+        .new_manifest_location = [this]() { return NewManifestLocation(); },
+        .properties = base.properties,
+        .split_by_partition = false,
+        .max_concurrency = max_concurrency_,
+    };
+    ICEBERG_ASSIGN_OR_RAISE(auto written,
+                            ParallelManifestWriter::Write(entries, options));
+    std::ranges::move(written, std::back_inserter(added_manifests_));
+    std::ranges::move(spec_manifests, std::back_inserter(rewritten_manifests_));
+  }
+  return kept;
+}
+
+std::unordered_map<std::string, std::string> RewriteManifests::Summary() const {
+  return {
+      {SnapshotSummaryFields::kCreatedManifestsCount,
+       std::to_string(added_manifests_.size())},
+      {SnapshotSummaryFields::kKeptManifestsCount, std::to_string(kept_manifests_count_)},
+      {SnapshotSummaryFields::kReplacedManifestsCount,
+       std::to_string(rewritten_manifests_.size())},
+      {SnapshotSummaryFields::kProcessedManifestEntries,
+       std::to_string(processed_entries_count_)},
+  };
+}
+
+Status RewriteManifests::Validate(const TableMetadata& current,
+                                  const std::shared_ptr<Snapshot>& /*base_snapshot*/) {
+  if (rewritten_manifests_.empty()) {
+    return {};
+  }
+  if (current.current_snapshot_id == Snapshot::kInvalidSnapshotId) {
+    return ValidationFailed("Cannot rewrite manifests of a table without snapshots");
+  }
+  ICEBERG_ASSIGN_OR_RAISE(auto snapshot, current.Snapshot());
+  ICEBERG_ASSIGN_OR_RAISE(auto manifest_list_reader,
+                          ManifestListReader::Make(snapshot->manifest_list, io()));
+  ICEBERG_ASSIGN_OR_RAISE(auto manifests, manifest_list_reader->Files());
+  std::unordered_set<std::string_view> current_paths;
+  for (const auto& manifest : manifests) {
+    current_paths.insert(manifest.manifest_path);
+  }
+  for (const auto& manifest : rewritten_manifests_) {
+    if (!current_paths.contains(manifest.manifest_path)) {
+      return ValidationFailed("Manifest {} was removed or rewritten concurrently",
+                              manifest.manifest_path);
+    }
+  }
+  return {};
+}
+
+void RewriteManifests::CleanUncommitted(const std::vector<ManifestFile>& committed) {
+  DeleteUncommittedManifests(added_manifests_, committed);
+  if (committed.empty()) {
+    rewritten_manifests_.clear();
+  }
+}
+
+}  // namespace iceberg
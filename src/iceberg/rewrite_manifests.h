@@ -0,0 +1,106 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+/// \file iceberg/rewrite_manifests.h
+/// Rewrites the manifests of a table to merge small manifests and cluster entries by
+/// partition.
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "iceberg/iceberg_export.h"
+#include "iceberg/manifest_list.h"
+#include "iceberg/result.h"
+#include "iceberg/snapshot_producer.h"
+#include "iceberg/type_fwd.h"
+
+namespace iceberg {
+
+/// \brief Replaces data manifests of the current snapshot with fewer manifests that
+/// hold the same live files, and commits them as a "replace" snapshot.
+///
+/// The entries of the rewritten manifests of each partition spec are sorted by their
+/// partition tuple before they are cut into manifests of the target manifest size
+/// (ManifestWriterProperties::kTargetSizeBytes), so each new manifest covers a narrow
+/// range of partitions and its partition summaries prune well during scan planning.
+/// Entries keep their snapshot ids and sequence numbers with the EXISTING status, and
+/// deleted entries are dropped.
+///
+/// If the commit is retried after a concurrent commit, the rewrite is kept as long as
+/// the rewritten manifests are still in the table, and the manifests added
+/// concurrently are carried into the new snapshot. Otherwise the commit fails with
+/// ErrorKind::kValidationFailed.
+class ICEBERG_EXPORT RewriteManifests : public SnapshotProducer {
+ public:
+  explicit RewriteManifests(const Table& table);
+
+  /// \brief Only rewrite the data manifests for which `predicate` returns true.
+  ///
+  /// By default, data manifests smaller than the target manifest size are rewritten.
+  /// Manifests of a partition spec are only rewritten if at least two are selected,
+  /// since a single manifest would be replaced by one like it.
+  RewriteManifests& RewriteIf(std::function<bool(const ManifestFile&)> predicate);
+
+  /// \brief Set the max number of manifests written at the same time. Zero, the
+  /// default, uses the number of hardware threads.
+  RewriteManifests& MaxConcurrency(int32_t max_concurrency);
+
+  /// \brief Returns the manifests replaced by the committed snapshot.
+  const std::vector<ManifestFile>& rewritten_manifests() const {
+    return rewritten_manifests_;
+  }
+
+  /// \brief Returns the manifests written for the committed snapshot.
+  const std::vector<ManifestFile>& added_manifests() const { return added_manifests_; }
+
+ protected:
+  std::string operation() const override;
+
+  Result<std::vector<ManifestFile>> Apply(
+      const TableMetadata& base, const std::shared_ptr<Snapshot>& parent) override;
+
+  std::unordered_map<std::string, std::string> Summary() const override;
+
+  Status Validate(const TableMetadata& current,
+                  const std::shared_ptr<Snapshot>& base_snapshot) override;
+
+  void CleanUncommitted(const std::vector<ManifestFile>& committed) override;
+
+  bool HasChanges() const override { return !rewritten_manifests_.empty(); }
+
+ private:
+  /// \brief Choose the manifests of `manifests` to rewrite and write their entries into
+  /// new manifests. Returns the manifests that are kept.
+  Result<std::vector<ManifestFile>> RewriteSelected(const TableMetadata& base,
+                                                    std::vector<ManifestFile> manifests);
+
+  std::function<bool(const ManifestFile&)> predicate_;
+  int32_t max_concurrency_ = 0;
+  std::vector<ManifestFile> rewritten_manifests_;
+  std::vector<ManifestFile> added_manifests_;
+  int64_t kept_manifests_count_ = 0;
+  int64_t processed_entries_count_ = 0;
+};
+
+}  // namespace iceberg
@@ -0,0 +1,169 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/rolling_file_writer.h"
+
+#include <utility>
+
+#include "iceberg/util/formatter.h"  // IWYU pragma: keep
+#include "iceberg/util/macros.h"
+
+namespace iceberg {
+
+namespace {
+
+template <typename T>
+std::map<int32_t, T> ToFieldIdMap(const std::unordered_map<int64_t, T>& values) {
+  std::map<int32_t, T> result;
+  for (const auto& [field_id, value] : values) {
+    result.emplace(static_cast<int32_t>(field_id), value);
+  }
+  return result;
+}
+
+Result<std::map<int32_t, std::vector<uint8_t>>> SerializeBounds(
+    const std::unordered_map<int64_t, Literal>& bounds) {
+  std::map<int32_t, std::vector<uint8_t>> result;
+  for (const auto& [field_id, bound] : bounds) {
+    ICEBERG_ASSIGN_OR_RAISE(auto serialized, bound.Serialize());
+    result.emplace(static_cast<int32_t>(field_id), std::move(serialized));
+  }
+  return result;
+}
+
+}  // namespace
+
+RollingFileWriter::RollingFileWriter(RollingFileWriterOptions options,
+                                     int64_t target_file_size_bytes)
+    : options_(std::move(options)), target_file_size_bytes_(target_file_size_bytes) {}
+
+RollingFileWriter::~RollingFileWriter() = default;
+
+Result<std::unique_ptr<RollingFileWriter>> RollingFileWriter::Make(
+    RollingFileWriterOptions options) {
+  if (!options.new_file_path) {
+    return InvalidArgument("Rolling file writer requires a file path generator");
+  }
+  int64_t target_file_size_bytes = 0;
+  try {
+    target_file_size_bytes =
+        WriterProperties::FromMap(options.writer_options.properties)
+            .Get(WriterProperties::kTargetFileSizeBytes);
+  } catch (const std::exception& e) {
+    return InvalidArgument("Invalid {}: {}", WriterProperties::kTargetFileSizeBytes.key(),
+                           e.what());
+  }
+  if (target_file_size_bytes <= 0) {
+    return InvalidArgument("Invalid {}: {}", WriterProperties::kTargetFileSizeBytes.key(),
+                           target_file_size_bytes);
+  }
+  return std::unique_ptr<RollingFileWriter>(
+      new RollingFileWriter(std::move(options), target_file_size_bytes));
+}
+
+Status RollingFileWriter::Write(ArrowArray data) {
+  if (data.length == 0) {
+    // Do not create empty files.
+    if (data.release != nullptr) {
+      data.release(&data);
+    }
+    return {};
+  }
+  if (writer_ == nullptr) {
+    auto status = OpenFile();
+    if (!status.has_value()) {
+      // The batch is owned by this writer and was not handed to a file writer.
+      data.release(&data);
+      return status;
+    }
+  }
+  // The file writer releases the batch even if writing fails.
+  const int64_t num_rows = data.length;
+  ICEBERG_RETURN_UNEXPECTED(writer_->Write(data));
+  record_count_ += num_rows;
+  auto length = writer_->length();
+  if (length.has_value() && length.value() >= target_file_size_bytes_) {
+    return CloseFile();
+  }
+  return {};
+}
+
+Status RollingFileWriter::Close() {
+  if (writer_ == nullptr) {
+    return {};
+  }
+  return CloseFile();
+}
+
+int64_t RollingFileWriter::length() const {
+  int64_t length = 0;
+  for (const auto& data_file : data_files_) {
+    length += data_file.file_size_in_bytes;
+  }
+  if (writer_ != nullptr) {
+    length += writer_->length().value_or(0);
+  }
+  return length;
+}
+
+Status RollingFileWriter::OpenFile() {
+  auto writer_options = options_.writer_options;
+  writer_options.path = options_.new_file_path();
+  path_ = writer_options.path;
+  record_count_ = 0;
+  ICEBERG_ASSIGN_OR_RAISE(writer_,
+                          WriterFactoryRegistry::Open(options_.format, writer_options));
+  return {};
+}
+
+Status RollingFileWriter::CloseFile() {
+  // The writer is released even if closing fails, the file is then incomplete and
+  // must not be committed.
+  auto writer = std::move(writer_);
+  ICEBERG_RETURN_UNEXPECTED(writer->Close());
+
+  DataFile data_file;
+  data_file.content = DataFile::Content::kData;
+  data_file.file_path = path_;
+  data_file.file_format = options_.format;
+  data_file.partition = options_.partition;
+  data_file.partition_spec_id = options_.partition_spec_id;
+  data_file.sort_order_id = options_.sort_order_id;
+  data_file.record_count = record_count_;
+  auto length = writer->length();
+  if (!length.has_value()) {
+    return Invalid("Unknown length of data file {}", path_);
+  }
+  data_file.file_size_in_bytes = length.value();
+  data_file.split_offsets = writer->split_offsets();
+  if (auto metrics = writer->metrics()) {
+    data_file.column_sizes = ToFieldIdMap(metrics->column_sizes);
+    data_file.value_counts = ToFieldIdMap(metrics->value_counts);
+    data_file.null_value_counts = ToFieldIdMap(metrics->null_value_counts);
+    data_file.nan_value_counts = ToFieldIdMap(metrics->nan_value_counts);
+    ICEBERG_ASSIGN_OR_RAISE(data_file.lower_bounds,
+                            SerializeBounds(metrics->lower_bounds));
+    ICEBERG_ASSIGN_OR_RAISE(data_file.upper_bounds,
+                            SerializeBounds(metrics->upper_bounds));
+  }
+  data_files_.push_back(std::move(data_file));
+  return {};
+}
+
+}  // namespace iceberg
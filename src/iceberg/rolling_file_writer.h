@@ -0,0 +1,110 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+/// \file iceberg/rolling_file_writer.h
+/// A data file writer that rolls over to a new file at a target size.
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "iceberg/arrow_c_data.h"
+#include "iceberg/expression/literal.h"
+#include "iceberg/file_format.h"
+#include "iceberg/file_writer.h"
+#include "iceberg/iceberg_export.h"
+#include "iceberg/manifest_entry.h"
+#include "iceberg/partition_spec.h"
+#include "iceberg/result.h"
+
+namespace iceberg {
+
+/// \brief Options for creating a RollingFileWriter.
+struct ICEBERG_EXPORT RollingFileWriterOptions {
+  /// \brief The file format of the data files.
+  FileFormatType format = FileFormatType::kParquet;
+  /// \brief Options to open each data file with. `path` is ignored, and
+  /// WriterProperties::kTargetFileSizeBytes of `properties` sets the target file size.
+  WriterOptions writer_options;
+  /// \brief Returns the path of the next data file to write. This field is required.
+  std::function<std::string()> new_file_path;
+  /// \brief The id of the partition spec of the data files.
+  int32_t partition_spec_id = PartitionSpec::kInitialSpecId;
+  /// \brief The partition values of the data files.
+  std::vector<Literal> partition;
+  /// \brief The sort order id of the data files, if they are sorted.
+  std::optional<int32_t> sort_order_id;
+};
+
+/// \brief Writes data into files of about the target file size.
+///
+/// A file is closed and the next batch starts a new one as soon as the estimated
+/// length reported by the file writer reaches the target size. Files are only rolled
+/// between batches, so a file exceeds the target by at most one batch.
+class ICEBERG_EXPORT RollingFileWriter {
+ public:
+  /// \brief Make a rolling writer. No file is created until data is written.
+  static Result<std::unique_ptr<RollingFileWriter>> Make(
+      RollingFileWriterOptions options);
+
+  ~RollingFileWriter();
+
+  RollingFileWriter(const RollingFileWriter&) = delete;
+  RollingFileWriter& operator=(const RollingFileWriter&) = delete;
+
+  /// \brief Write a batch to the current file, which is closed once it reaches the
+  /// target size.
+  ///
+  /// The batch is released even if writing fails, and its rows are then not counted.
+  Status Write(ArrowArray data);
+
+  /// \brief Close the current file.
+  Status Close();
+
+  /// \brief Returns the data files closed so far, with their metrics and split offsets.
+  const std::vector<DataFile>& data_files() const { return data_files_; }
+
+  /// \brief Returns the estimated length of the data files written so far, including
+  /// the open one.
+  int64_t length() const;
+
+  /// \brief Returns the size at which files are rolled over.
+  int64_t target_file_size_bytes() const { return target_file_size_bytes_; }
+
+ private:
+  RollingFileWriter(RollingFileWriterOptions options, int64_t target_file_size_bytes);
+
+  Status OpenFile();
+  Status CloseFile();
+
+  RollingFileWriterOptions options_;
+  int64_t target_file_size_bytes_;
+  // The writer, path and number of records of the open file, if any.
+  std::unique_ptr<Writer> writer_;
+  std::string path_;
+  int64_t record_count_ = 0;
+  std::vector<DataFile> data_files_;
+};
+
+}  // namespace iceberg
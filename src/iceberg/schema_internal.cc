@@ -23,6 +23,7 @@
 #include <cstring>
 #include <optional>
 #include <string>
+#include <unordered_set>
 
 #include "iceberg/constants.h"
 #include "iceberg/schema.h"
@@ -39,9 +40,23 @@ constexpr const char* kArrowExtensionMetadata = "ARROW:extension:metadata";
 constexpr const char* kArrowUuidExtensionName = "arrow.uuid";
 constexpr int32_t kUnknownFieldId = -1;
 
+// Set a string or binary type, dictionary-encoded with int32 indices if requested.
+ArrowErrorCode SetBinaryType(ArrowType value_type, bool dictionary_encoded,
+                             ArrowSchema* schema) {
+  if (!dictionary_encoded) {
+    return ArrowSchemaSetType(schema, value_type);
+  }
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaSetType(schema, NANOARROW_TYPE_INT32));
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaAllocateDictionary(schema));
+  ArrowSchemaInit(schema->dictionary);
+  return ArrowSchemaSetType(schema->dictionary, value_type);
+}
+
 // Convert an Iceberg type to Arrow schema. Return value is Nanoarrow error code.
 ArrowErrorCode ToArrowSchema(const Type& type, bool optional, std::string_view name,
-                             std::optional<int32_t> field_id, ArrowSchema* schema) {
+                             std::optional<int32_t> field_id,
+                             const std::unordered_set<int32_t>& dictionary_field_ids,
+                             ArrowSchema* schema) {
   ArrowBuffer metadata_buffer;
   NANOARROW_RETURN_NOT_OK(ArrowMetadataBuilderInit(&metadata_buffer, nullptr));
   if (field_id.has_value()) {
@@ -60,7 +75,7 @@ ArrowErrorCode ToArrowSchema(const Type& type, bool optional, std::string_view n
         const auto& field = fields[i];
         NANOARROW_RETURN_NOT_OK(ToArrowSchema(*field.type(), field.optional(),
                                               field.name(), field.field_id(),
-                                              schema->children[i]));
+                                              dictionary_field_ids, schema->children[i]));
       }
     } break;
     case TypeId::kList: {
@@ -70,7 +85,7 @@ ArrowErrorCode ToArrowSchema(const Type& type, bool optional, std::string_view n
       const auto& elem_field = list_type.fields()[0];
       NANOARROW_RETURN_NOT_OK(ToArrowSchema(*elem_field.type(), elem_field.optional(),
                                             elem_field.name(), elem_field.field_id(),
-                                            schema->children[0]));
+                                            dictionary_field_ids, schema->children[0]));
     } break;
     case TypeId::kMap: {
       NANOARROW_RETURN_NOT_OK(ArrowSchemaSetType(schema, NANOARROW_TYPE_MAP));
@@ -80,9 +95,11 @@ ArrowErrorCode ToArrowSchema(const Type& type, bool optional, std::string_view n
       const auto& value_field = map_type.value();
       NANOARROW_RETURN_NOT_OK(ToArrowSchema(*key_field.type(), key_field.optional(),
                                             key_field.name(), key_field.field_id(),
+                                            dictionary_field_ids,
                                             schema->children[0]->children[0]));
       NANOARROW_RETURN_NOT_OK(ToArrowSchema(*value_field.type(), value_field.optional(),
                                             value_field.name(), value_field.field_id(),
+                                            dictionary_field_ids,
                                             schema->children[0]->children[1]));
     } break;
     case TypeId::kBoolean:
@@ -124,11 +141,13 @@ ArrowErrorCode ToArrowSchema(const Type& type, bool optional, std::string_view n
           schema, NANOARROW_TYPE_TIMESTAMP, NANOARROW_TIME_UNIT_MICRO, "UTC"));
     } break;
     case TypeId::kString:
-      NANOARROW_RETURN_NOT_OK(ArrowSchemaSetType(schema, NANOARROW_TYPE_STRING));
-      break;
-    case TypeId::kBinary:
-      NANOARROW_RETURN_NOT_OK(ArrowSchemaSetType(schema, NANOARROW_TYPE_BINARY));
-      break;
+    case TypeId::kBinary: {
+      auto value_type = type.type_id() == TypeId::kString ? NANOARROW_TYPE_STRING
+                                                          : NANOARROW_TYPE_BINARY;
+      bool dictionary_encoded =
+          field_id.has_value() && dictionary_field_ids.contains(field_id.value());
+      NANOARROW_RETURN_NOT_OK(SetBinaryType(value_type, dictionary_encoded, schema));
+    } break;
     case TypeId::kFixed: {
       const auto& fixed_type = static_cast<const FixedType&>(type);
       NANOARROW_RETURN_NOT_OK(ArrowSchemaSetTypeFixedSize(
@@ -163,6 +182,12 @@ ArrowErrorCode ToArrowSchema(const Type& type, bool optional, std::string_view n
 }  // namespace
 
 Status ToArrowSchema(const Schema& schema, ArrowSchema* out) {
+  return ToArrowSchema(schema, /*dictionary_field_ids=*/{}, out);
+}
+
+Status ToArrowSchema(const Schema& schema,
+                     const std::unordered_set<int32_t>& dictionary_field_ids,
+                     ArrowSchema* out) {
   if (out == nullptr) [[unlikely]] {
     return InvalidArgument("Output Arrow schema cannot be null");
   }
@@ -170,7 +195,8 @@ Status ToArrowSchema(const Schema& schema, ArrowSchema* out) {
   ArrowSchemaInit(out);
 
   if (ArrowErrorCode errorCode = ToArrowSchema(schema, /*optional=*/false, /*name=*/"",
-                                               /*field_id=*/std::nullopt, out);
+                                               /*field_id=*/std::nullopt,
+                                               dictionary_field_ids, out);
       errorCode != NANOARROW_OK) {
     return InvalidSchema(
         "Failed to convert Iceberg schema to Arrow schema, error code: {}", errorCode);
@@ -223,6 +249,9 @@ Result<std::shared_ptr<Type>> FromArrowSchema(const ArrowSchema& schema) {
   }
 
   switch (schema_view.type) {
+    case NANOARROW_TYPE_DICTIONARY:
+      // Dictionary encoding does not change the logical type of the values.
+      return FromArrowSchema(*schema.dictionary);
     case NANOARROW_TYPE_STRUCT: {
       std::vector<SchemaField> fields;
       fields.reserve(schema.n_children);
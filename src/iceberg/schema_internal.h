@@ -21,6 +21,7 @@
 
 #include <memory>
 #include <optional>
+#include <unordered_set>
 
 #include <nanoarrow/nanoarrow.h>
 
@@ -37,6 +38,17 @@ namespace iceberg {
 /// \return An error if the conversion fails.
 ICEBERG_EXPORT Status ToArrowSchema(const Schema& schema, ArrowSchema* out);
 
+/// \brief Convert an Iceberg schema to an Arrow schema with dictionary fields.
+///
+/// \param[in] schema The Iceberg schema to convert.
+/// \param[in] dictionary_field_ids Ids of string and binary fields to convert to
+/// dictionary types with int32 indices; ids of fields of other types are ignored.
+/// \param[out] out The Arrow schema to convert to.
+/// \return An error if the conversion fails.
+ICEBERG_EXPORT Status ToArrowSchema(
+    const Schema& schema, const std::unordered_set<int32_t>& dictionary_field_ids,
+    ArrowSchema* out);
+
 /// \brief Convert an Arrow schema to an Iceberg schema.
 ///
 /// \param[in] schema The Arrow schema to convert.
@@ -63,6 +63,9 @@ ICEBERG_EXPORT constexpr Result<SnapshotRefType> SnapshotRefTypeFromString(
 
 /// \brief A reference to a snapshot, either a branch or a tag.
 struct ICEBERG_EXPORT SnapshotRef {
+  /// The name of the main branch, which tracks the current snapshot of the table.
+  inline static const std::string kMainBranch = "main";
+
   struct ICEBERG_EXPORT Branch {
     /// A positive number for the minimum number of snapshots to keep in a branch while
     /// expiring snapshots. Defaults to table property
@@ -182,6 +185,14 @@ struct SnapshotSummaryFields {
   inline static const std::string kDeletedDuplicatedFiles = "deleted-duplicate-files";
   /// \brief Number of partitions with files added or removed in the snapshot
   inline static const std::string kChangedPartitionCountProp = "changed-partition-count";
+  /// \brief Number of manifests created by a manifest rewrite
+  inline static const std::string kCreatedManifestsCount = "manifests-created";
+  /// \brief Number of manifests kept as they were by a manifest rewrite
+  inline static const std::string kKeptManifestsCount = "manifests-kept";
+  /// \brief Number of manifests replaced by a manifest rewrite
+  inline static const std::string kReplacedManifestsCount = "manifests-replaced";
+  /// \brief Number of manifest entries read by a manifest rewrite
+  inline static const std::string kProcessedManifestEntries = "entries-processed";
 
   /// Other Fields, see https://iceberg.apache.org/spec/#other-fields
 
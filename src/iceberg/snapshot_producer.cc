@@ -0,0 +1,415 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/snapshot_producer.h"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <format>
+#include <random>
+#include <thread>
+#include <unordered_set>
+
+#include "iceberg/catalog.h"
+#include "iceberg/file_io.h"
+#include "iceberg/manifest_entry.h"
+#include "iceberg/manifest_reader.h"
+#include "iceberg/manifest_writer.h"
+#include "iceberg/metadata_update.h"
+#include "iceberg/partition_spec.h"
+#include "iceberg/snapshot.h"
+#include "iceberg/table.h"
+#include "iceberg/table_metadata.h"
+#include "iceberg/update_requirement.h"
+#include "iceberg/util/macros.h"
+#include "iceberg/util/uuid_util.h"
+
+namespace iceberg {
+
+namespace {
+
+/// \brief A total of the table in the snapshot summary, with the summary fields of the
+/// changes that add to and remove from it.
+struct SummaryTotal {
+  const std::string& total;
+  const std::string& added;
+  const std::string& removed;
+};
+
+std::optional<int64_t> ParseSummaryValue(
+    const std::unordered_map<std::string, std::string>& summary, const std::string& key) {
+  auto it = summary.find(key);
+  if (it == summary.end()) {
+    return std::nullopt;
+  }
+  int64_t value = 0;
+  auto [ptr, ec] =
+      std::from_chars(it->second.data(), it->second.data() + it->second.size(), value);
+  if (ec != std::errc{} || ptr != it->second.data() + it->second.size()) {
+    return std::nullopt;
+  }
+  return value;
+}
+
+/// \brief Set the totals of `summary` from the totals of the parent snapshot and the
+/// changes in `summary`. A total that the parent does not have is left unset, since
+/// it is unknown.
+void UpdateTotals(std::unordered_map<std::string, std::string>& summary,
+                  const std::shared_ptr<Snapshot>& parent) {
+  static const SummaryTotal kTotals[] = {
+      {SnapshotSummaryFields::kTotalDataFiles, SnapshotSummaryFields::kAddedDataFiles,
+       SnapshotSummaryFields::kDeletedDataFiles},
+      {SnapshotSummaryFields::kTotalDeleteFiles,
+       SnapshotSummaryFields::kAddedDeleteFiles,
+       SnapshotSummaryFields::kRemovedDeleteFiles},
+      {SnapshotSummaryFields::kTotalRecords, SnapshotSummaryFields::kAddedRecords,
+       SnapshotSummaryFields::kDeletedRecords},
+      {SnapshotSummaryFields::kTotalFileSize, SnapshotSummaryFields::kAddedFileSize,
+       SnapshotSummaryFields::kRemovedFileSize},
+      {SnapshotSummaryFields::kTotalPosDeletes,
+       SnapshotSummaryFields::kAddedPosDeletes,
+       SnapshotSummaryFields::kRemovedPosDeletes},
+      {SnapshotSummaryFields::kTotalEqDeletes, SnapshotSummaryFields::kAddedEqDeletes,
+       SnapshotSummaryFields::kRemovedEqDeletes},
+  };
+  for (const auto& field : kTotals) {
+    int64_t total = 0;
+    if (parent != nullptr) {
+      auto parent_total = ParseSummaryValue(parent->summary, field.total);
+      if (!parent_total.has_value()) {
+        continue;
+      }
+      total = *parent_total;
+    }
+    total += ParseSummaryValue(summary, field.added).value_or(0);
+    total -= ParseSummaryValue(summary, field.removed).value_or(0);
+    summary[field.total] = std::to_string(total);
+  }
+}
+
+std::string MetadataDirectory(const TableMetadata& metadata) {
+  std::string_view location = metadata.location;
+  if (location.ends_with('/')) {
+    location.remove_suffix(1);
+  }
+  return std::format("{}/metadata", location);
+}
+
+}  // namespace
+
+CommitProperties CommitProperties::FromMap(
+    const std::unordered_map<std::string, std::string>& properties) {
+  CommitProperties commit_properties;
+  commit_properties.configs_ = properties;
+  return commit_properties;
+}
+
+int64_t GenerateSnapshotId() {
+  thread_local std::mt19937_64 generator{std::random_device{}()};
+  int64_t snapshot_id;
+  do {
+    snapshot_id = static_cast<int64_t>(generator() & 0x7FFFFFFFFFFFFFFFULL);
+  } while (snapshot_id == 0);
+  return snapshot_id;
+}
+
+SnapshotProducer::SnapshotProducer(const Table& table)
+    : identifier_(table.name()),
+      base_(table.metadata()),
+      io_(table.io()),
+      catalog_(table.catalog()),
+      commit_uuid_(UuidUtils::GenerateV4()),
+      snapshot_id_(GenerateSnapshotId()) {}
+
+std::string SnapshotProducer::NewManifestLocation() {
+  return std::format("{}/{}-m{}.avro", MetadataDirectory(*base_), commit_uuid_,
+                     manifest_count_++);
+}
+
+void SnapshotProducer::DeleteUncommittedManifests(
+    std::vector<ManifestFile>& written,
+    const std::vector<ManifestFile>& committed) const {
+  std::unordered_set<std::string_view> committed_paths;
+  for (const auto& manifest : committed) {
+    committed_paths.insert(manifest.manifest_path);
+  }
+  for (const auto& manifest : written) {
+    if (!committed_paths.contains(manifest.manifest_path)) {
+      std::ignore = io_->DeleteFile(manifest.manifest_path);
+    }
+  }
+  if (committed.empty()) {
+    written.clear();
+  }
+}
+
+Result<std::vector<std::shared_ptr<Snapshot>>> SnapshotProducer::SnapshotsSince(
+    const TableMetadata& current, const std::shared_ptr<Snapshot>& base_snapshot) {
+  std::vector<std::shared_ptr<Snapshot>> snapshots;
+  if (current.current_snapshot_id == Snapshot::kInvalidSnapshotId) {
+    if (base_snapshot != nullptr) {
+      return ValidationFailed("Snapshot {} was removed from the main branch",
+                              base_snapshot->snapshot_id);
+    }
+    return snapshots;
+  }
+
+  ICEBERG_ASSIGN_OR_RAISE(auto snapshot, current.Snapshot());
+  while (base_snapshot == nullptr ||
+         snapshot->snapshot_id != base_snapshot->snapshot_id) {
+    snapshots.push_back(snapshot);
+    if (!snapshot->parent_snapshot_id.has_value()) {
+      if (base_snapshot == nullptr) {
+        break;
+      }
+      return ValidationFailed("Snapshot {} is no longer an ancestor of the main branch",
+                              base_snapshot->snapshot_id);
+    }
+    auto parent = current.SnapshotById(*snapshot->parent_snapshot_id);
+    if (!parent.has_value()) {
+      return ValidationFailed(
+          "Cannot find the snapshots committed since {}: snapshot {} has expired",
+          base_snapshot == nullptr ? Snapshot::kInvalidSnapshotId
+                                   : base_snapshot->snapshot_id,
+          *snapshot->parent_snapshot_id);
+    }
+    snapshot = std::move(parent.value());
+  }
+  return snapshots;
+}
+
+Status SnapshotProducer::ForEachFileAddedSince(
+    const TableMetadata& current, const std::shared_ptr<Snapshot>& base_snapshot,
+    const std::function<Status(const DataFile&)>& visit) const {
+  ICEBERG_ASSIGN_OR_RAISE(auto snapshots, SnapshotsSince(current, base_snapshot));
+  for (const auto& snapshot : snapshots) {
+    auto operation = snapshot->summary.find(SnapshotSummaryFields::kOperation);
+    if (operation != snapshot->summary.end() &&
+        operation->second == DataOperation::kReplace) {
+      continue;
+    }
+
+    // Each manifest is added by one snapshot, so the manifests added by a snapshot
+    // are those of its manifest list with its id.
+    ICEBERG_ASSIGN_OR_RAISE(auto manifest_list_reader,
+                            ManifestListReader::Make(snapshot->manifest_list, io_));
+    ICEBERG_ASSIGN_OR_RAISE(auto manifests, manifest_list_reader->Files());
+    for (const auto& manifest : manifests) {
+      if (manifest.added_snapshot_id != snapshot->snapshot_id ||
+          manifest.content != ManifestFile::Content::kData ||
+          manifest.added_files_count.value_or(1) == 0) {
+        continue;
+      }
+      auto spec = std::ranges::find_if(
+          current.partition_specs, [&manifest](const auto& spec) {
+            return spec->spec_id() == manifest.partition_spec_id;
+          });
+      if (spec == current.partition_specs.end()) {
+        return InvalidManifestList("Cannot find partition spec {} of manifest {}",
+                                   manifest.partition_spec_id, manifest.manifest_path);
+      }
+      ICEBERG_ASSIGN_OR_RAISE(auto partition_schema, (*spec)->PartitionSchema());
+      ICEBERG_ASSIGN_OR_RAISE(auto reader,
+                              ManifestReader::Make(manifest, io_, partition_schema));
+      ICEBERG_ASSIGN_OR_RAISE(auto entries, reader->Entries());
+      for (const auto& entry : entries) {
+        if (entry.status == ManifestStatus::kAdded && entry.data_file != nullptr) {
+          ICEBERG_RETURN_UNEXPECTED(visit(*entry.data_file));
+        }
+      }
+    }
+  }
+  return {};
+}
+
+Status SnapshotProducer::Commit() {
+  if (catalog_ == nullptr) {
+    return NotSupported("Cannot commit to table {} without a catalog", identifier_.name);
+  }
+  if (base_->format_version < 2) {
+    return NotSupported("Cannot produce snapshots of format version {} tables",
+                        base_->format_version);
+  }
+
+  int32_t num_retries;
+  std::chrono::milliseconds min_wait;
+  std::chrono::milliseconds max_wait;
+  std::chrono::milliseconds timeout;
+  try {
+    auto properties = CommitProperties::FromMap(base_->properties);
+    num_retries = std::max(properties.Get(CommitProperties::kNumRetries), 0);
+    min_wait = std::chrono::milliseconds(
+        std::max<int64_t>(properties.Get(CommitProperties::kMinWaitMs), 0));
+    max_wait = std::chrono::milliseconds(
+        std::max<int64_t>(properties.Get(CommitProperties::kMaxWaitMs), 0));
+    timeout = std::chrono::milliseconds(
+        std::max<int64_t>(properties.Get(CommitProperties::kTotalTimeoutMs), 0));
+  } catch (const std::exception& e) {
+    return InvalidArgument("Invalid commit properties: {}", e.what());
+  }
+  auto deadline = std::chrono::steady_clock::now() + timeout;
+
+  // The snapshot the changes were last validated against. Before each retry, only
+  // the snapshots committed after it are checked for conflicts.
+  std::shared_ptr<Snapshot> base_snapshot;
+  if (base_->current_snapshot_id != Snapshot::kInvalidSnapshotId) {
+    ICEBERG_ASSIGN_OR_RAISE(base_snapshot, base_->Snapshot());
+  }
+
+  thread_local std::mt19937_64 generator{std::random_device{}()};
+  auto wait = min_wait;
+  for (int32_t attempt = 1;; ++attempt) {
+    auto status = CommitOnce(attempt);
+    if (status.has_value()) {
+      return status;
+    }
+    if (status.error().kind == ErrorKind::kCommitStateUnknown) {
+      // The files may be referenced by the table.
+      return status;
+    }
+    if (status.error().kind != ErrorKind::kCommitFailed || attempt > num_retries) {
+      CleanUncommitted({});
+      return status;
+    }
+
+    // Exponential backoff with up to 10% of jitter, so that writers that failed
+    // together do not retry together.
+    auto jitter = std::chrono::milliseconds(std::uniform_int_distribution<int64_t>(
+        0, wait.count() / 10)(generator));
+    if (std::chrono::steady_clock::now() + wait + jitter > deadline) {
+      CleanUncommitted({});
+      return status;
+    }
+    std::this_thread::sleep_for(wait + jitter);
+    wait = std::min(wait * 2, max_wait);
+
+    auto refreshed = catalog_->LoadTable(identifier_);
+    if (!refreshed.has_value()) {
+      CleanUncommitted({});
+      return std::unexpected(refreshed.error());
+    }
+    auto current = refreshed.value()->metadata();
+    if (current->table_uuid != base_->table_uuid) {
+      CleanUncommitted({});
+      return CommitFailed("Table {} was replaced concurrently", identifier_.name);
+    }
+    status = Validate(*current, base_snapshot);
+    if (!status.has_value()) {
+      CleanUncommitted({});
+      return status;
+    }
+    base_snapshot.reset();
+    if (current->current_snapshot_id != Snapshot::kInvalidSnapshotId) {
+      auto snapshot = current->Snapshot();
+      if (!snapshot.has_value()) {
+        CleanUncommitted({});
+        return std::unexpected(snapshot.error());
+      }
+      base_snapshot = std::move(snapshot.value());
+    }
+    base_ = std::move(current);
+  }
+}
+
+Status SnapshotProducer::CommitOnce(int32_t attempt) {
+  std::shared_ptr<Snapshot> parent;
+  if (base_->current_snapshot_id != Snapshot::kInvalidSnapshotId) {
+    ICEBERG_ASSIGN_OR_RAISE(parent, base_->Snapshot());
+  }
+  ICEBERG_ASSIGN_OR_RAISE(auto manifests, Apply(*base_, parent));
+  if (!HasChanges()) {
+    CleanUncommitted({});
+    return {};
+  }
+
+  std::optional<int64_t> parent_snapshot_id;
+  if (parent != nullptr) {
+    parent_snapshot_id = parent->snapshot_id;
+  }
+  int64_t sequence_number = base_->last_sequence_number + 1;
+  auto manifest_list = std::format("{}/snap-{}-{}-{}.avro", MetadataDirectory(*base_),
+                                   snapshot_id_, attempt, commit_uuid_);
+
+  // Manifests without a first row id are assigned the row ids following
+  // next_row_id by the v3 manifest list writer, in order.
+  int64_t added_rows = 0;
+  std::unique_ptr<ManifestListWriter> writer;
+  if (base_->format_version >= TableMetadata::kMinFormatVersionRowLineage) {
+    for (const auto& manifest : manifests) {
+      if (manifest.content == ManifestFile::Content::kData &&
+          !manifest.first_row_id.has_value()) {
+        added_rows += manifest.added_rows_count.value_or(0) +
+                      manifest.existing_rows_count.value_or(0);
+      }
+    }
+    ICEBERG_ASSIGN_OR_RAISE(
+        writer, ManifestListWriter::MakeV3Writer(snapshot_id_, parent_snapshot_id,
+                                                 sequence_number, base_->next_row_id,
+                                                 manifest_list, io_));
+  } else {
+    ICEBERG_ASSIGN_OR_RAISE(
+        writer, ManifestListWriter::MakeV2Writer(snapshot_id_, parent_snapshot_id,
+                                                 sequence_number, manifest_list, io_));
+  }
+  auto status = writer->AddAll(manifests);
+  if (status.has_value()) {
+    status = writer->Close();
+  }
+  if (!status.has_value()) {
+    std::ignore = io_->DeleteFile(manifest_list);
+    return status;
+  }
+
+  auto summary = Summary();
+  summary[SnapshotSummaryFields::kOperation] = operation();
+  UpdateTotals(summary, parent);
+  auto snapshot = std::make_shared<Snapshot>(Snapshot{
+      .snapshot_id = snapshot_id_,
+      .parent_snapshot_id = parent_snapshot_id,
+      .sequence_number = sequence_number,
+      .timestamp_ms = std::chrono::time_point_cast<std::chrono::milliseconds>(
+          std::chrono::system_clock::now()),
+      .manifest_list = manifest_list,
+      .summary = std::move(summary),
+      .schema_id = base_->current_schema_id,
+  });
+
+  std::vector<std::unique_ptr<UpdateRequirement>> requirements;
+  requirements.push_back(std::make_unique<AssertTableUUID>(base_->table_uuid));
+  requirements.push_back(std::make_unique<AssertRefSnapshotId>(SnapshotRef::kMainBranch,
+                                                               parent_snapshot_id));
+  std::vector<std::unique_ptr<MetadataUpdate>> updates;
+  updates.push_back(std::make_unique<AddSnapshot>(snapshot, added_rows));
+  updates.push_back(std::make_unique<SetSnapshotRef>(
+      SnapshotRef::kMainBranch, snapshot_id_, SnapshotRefType::kBranch));
+
+  auto committed = catalog_->UpdateTable(identifier_, requirements, updates);
+  if (!committed.has_value()) {
+    if (committed.error().kind != ErrorKind::kCommitStateUnknown) {
+      std::ignore = io_->DeleteFile(manifest_list);
+    }
+    return std::unexpected(committed.error());
+  }
+  CleanUncommitted(manifests);
+  committed_snapshot_ = std::move(snapshot);
+  return {};
+}
+
+}  // namespace iceberg
@@ -0,0 +1,181 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+/// \file iceberg/snapshot_producer.h
+/// Base class of the table operations that commit a new snapshot.
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "iceberg/iceberg_export.h"
+#include "iceberg/manifest_list.h"
+#include "iceberg/result.h"
+#include "iceberg/table_identifier.h"
+#include "iceberg/type_fwd.h"
+#include "iceberg/util/config.h"
+
+namespace iceberg {
+
+/// \brief Table properties that control how SnapshotProducer retries a commit that
+/// failed because the table changed concurrently.
+class ICEBERG_EXPORT CommitProperties : public ConfigBase<CommitProperties> {
+ public:
+  template <typename T>
+  using Entry = const ConfigBase<CommitProperties>::Entry<T>;
+
+  /// \brief Number of times a failed commit is retried.
+  inline static Entry<int32_t> kNumRetries{"commit.retry.num-retries", 4};
+  /// \brief Wait before the first retry. The wait doubles with each retry.
+  inline static Entry<int64_t> kMinWaitMs{"commit.retry.min-wait-ms", 100};
+  /// \brief Max wait between two retries.
+  inline static Entry<int64_t> kMaxWaitMs{"commit.retry.max-wait-ms", 60 * 1000};
+  /// \brief Max time spent on a commit, after which it is not retried again.
+  inline static Entry<int64_t> kTotalTimeoutMs{"commit.retry.total-timeout-ms",
+                                               30 * 60 * 1000};
+
+  /// \brief Create the properties from table properties.
+  static CommitProperties FromMap(
+      const std::unordered_map<std::string, std::string>& properties);
+};
+
+/// \brief Produces a new snapshot of a table and commits it to the main branch.
+///
+/// A subclass returns the manifests of the new snapshot from Apply(), writing any new
+/// manifests it needs. Commit() then writes the manifest list, creates the snapshot and
+/// commits it through the catalog of the table, requiring that the main branch has not
+/// moved since the table metadata the operation started from.
+///
+/// If the main branch has moved, the commit is retried with exponential backoff as
+/// configured by CommitProperties. Before each retry, the table is refreshed and
+/// Validate() checks the snapshots committed since the operation started for changes
+/// that conflict with it; only those snapshots are read, not the whole table. Apply()
+/// is then called again on the refreshed metadata, and may reuse the manifests it
+/// wrote in an earlier attempt.
+class ICEBERG_EXPORT SnapshotProducer {
+ public:
+  virtual ~SnapshotProducer() = default;
+
+  /// \brief Write the new snapshot and commit it to the table.
+  ///
+  /// \return ErrorKind::kCommitFailed if the table changed concurrently and the
+  /// retries are exhausted, or ErrorKind::kValidationFailed if a concurrent change
+  /// conflicts with this operation.
+  Status Commit();
+
+  /// \brief Returns the snapshot committed by Commit(), or null before it succeeds.
+  const std::shared_ptr<Snapshot>& committed_snapshot() const {
+    return committed_snapshot_;
+  }
+
+ protected:
+  /// \param table The table to produce a snapshot of, which must have a catalog.
+  explicit SnapshotProducer(const Table& table);
+
+  /// \brief Returns the operation of the snapshot, e.g. DataOperation::kAppend.
+  virtual std::string operation() const = 0;
+
+  /// \brief Returns the manifests of the new snapshot, based on the current snapshot
+  /// of `base`, or null if the table has no snapshot.
+  virtual Result<std::vector<ManifestFile>> Apply(
+      const TableMetadata& base, const std::shared_ptr<Snapshot>& parent) = 0;
+
+  /// \brief Returns the summary of the changes made by the new snapshot, such as
+  /// SnapshotSummaryFields::kAddedDataFiles. The totals of the table are derived from
+  /// the summary of the parent snapshot.
+  virtual std::unordered_map<std::string, std::string> Summary() const = 0;
+
+  /// \brief Check that the snapshots committed to the main branch after
+  /// `base_snapshot` do not conflict with this operation. Called with the refreshed
+  /// metadata before a retry, where `base_snapshot` is the current snapshot of the
+  /// metadata of the previous attempt.
+  ///
+  /// \return ErrorKind::kValidationFailed if the operation cannot be applied to
+  /// `current`.
+  virtual Status Validate(const TableMetadata& /*current*/,
+                          const std::shared_ptr<Snapshot>& /*base_snapshot*/) {
+    return {};
+  }
+
+  /// \brief Returns the snapshots of the main branch of `current` that were committed
+  /// after `base_snapshot`, newest first.
+  ///
+  /// \return ErrorKind::kValidationFailed if `base_snapshot` is no longer an ancestor
+  /// of the main branch.
+  static Result<std::vector<std::shared_ptr<Snapshot>>> SnapshotsSince(
+      const TableMetadata& current, const std::shared_ptr<Snapshot>& base_snapshot);
+
+  /// \brief Call `visit` for each data file added to the main branch of `current`
+  /// after `base_snapshot`.
+  ///
+  /// Only the manifests added by those snapshots are read, and snapshots that replace
+  /// files without changing the data of the table, such as RewriteManifests, are
+  /// skipped.
+  Status ForEachFileAddedSince(const TableMetadata& current,
+                               const std::shared_ptr<Snapshot>& base_snapshot,
+                               const std::function<Status(const DataFile&)>& visit) const;
+
+  /// \brief Delete the files written by Apply() that are not in `committed`, which is
+  /// empty if the operation was not committed.
+  virtual void CleanUncommitted(const std::vector<ManifestFile>& /*committed*/) {}
+
+  /// \brief Returns whether the manifests returned by the last Apply() change the
+  /// table. If not, Commit() does not produce a snapshot.
+  virtual bool HasChanges() const { return true; }
+
+  /// \brief Delete the manifests in `written` that are not in `committed`. If nothing
+  /// was committed, `written` is cleared so that a retry writes them again.
+  void DeleteUncommittedManifests(std::vector<ManifestFile>& written,
+                                  const std::vector<ManifestFile>& committed) const;
+
+  /// \brief Returns a new location for a manifest written by this operation.
+  std::string NewManifestLocation();
+
+  /// \brief Returns the id of the new snapshot.
+  int64_t snapshot_id() const { return snapshot_id_; }
+
+  /// \brief Returns the table metadata that this operation is based on, which is
+  /// refreshed before a retry.
+  const std::shared_ptr<TableMetadata>& base() const { return base_; }
+
+  const std::shared_ptr<FileIO>& io() const { return io_; }
+
+ private:
+  /// \brief Apply the operation to the base metadata and try to commit it once.
+  Status CommitOnce(int32_t attempt);
+
+  TableIdentifier identifier_;
+  std::shared_ptr<TableMetadata> base_;
+  std::shared_ptr<FileIO> io_;
+  std::shared_ptr<Catalog> catalog_;
+  std::string commit_uuid_;
+  int64_t snapshot_id_;
+  int32_t manifest_count_ = 0;
+  std::shared_ptr<Snapshot> committed_snapshot_;
+};
+
+/// \brief Returns a new random snapshot id, which is positive.
+ICEBERG_EXPORT int64_t GenerateSnapshotId();
+
+}  // namespace iceberg
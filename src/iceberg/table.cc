@@ -22,7 +22,9 @@
 #include <algorithm>
 
 #include "iceberg/catalog.h"
+#include "iceberg/fast_append.h"
 #include "iceberg/partition_spec.h"
+#include "iceberg/rewrite_manifests.h"
 #include "iceberg/schema.h"
 #include "iceberg/sort_order.h"
 #include "iceberg/table_metadata.h"
@@ -123,8 +125,22 @@ const std::vector<SnapshotLogEntry>& Table::history() const {
 
 const std::shared_ptr<FileIO>& Table::io() const { return io_; }
 
+const std::shared_ptr<TableMetadata>& Table::metadata() const { return metadata_; }
+
+const std::string& Table::metadata_location() const { return metadata_location_; }
+
+const std::shared_ptr<Catalog>& Table::catalog() const { return catalog_; }
+
 std::unique_ptr<TableScanBuilder> Table::NewScan() const {
   return std::make_unique<TableScanBuilder>(metadata_, io_);
 }
 
+std::unique_ptr<AppendFiles> Table::NewAppend() const {
+  return std::make_unique<FastAppend>(*this);
+}
+
+std::unique_ptr<RewriteManifests> Table::NewRewriteManifests() const {
+  return std::make_unique<RewriteManifests>(*this);
+}
+
 }  // namespace iceberg
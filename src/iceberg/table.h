@@ -113,9 +113,30 @@ class ICEBERG_EXPORT Table {
   /// filter data.
   virtual std::unique_ptr<TableScanBuilder> NewScan() const;
 
+  /// \brief Create a new AppendFiles to append data files to this table
+  ///
+  /// The append writes the new files into new manifests and is committed through the
+  /// catalog of this table.
+  std::unique_ptr<AppendFiles> NewAppend() const;
+
+  /// \brief Create a new RewriteManifests to compact the manifests of this table
+  ///
+  /// The rewrite is based on the current metadata of this table and is committed
+  /// through its catalog.
+  std::unique_ptr<RewriteManifests> NewRewriteManifests() const;
+
   /// \brief Returns a FileIO to read and write table data and metadata files
   const std::shared_ptr<FileIO>& io() const;
 
+  /// \brief Return the current metadata of this table
+  const std::shared_ptr<TableMetadata>& metadata() const;
+
+  /// \brief Return the location of the current metadata file of this table
+  const std::string& metadata_location() const;
+
+  /// \brief Return the catalog this table belongs to, or null if it is read-only
+  const std::shared_ptr<Catalog>& catalog() const;
+
  private:
   const TableIdentifier identifier_;
   std::shared_ptr<TableMetadata> metadata_;
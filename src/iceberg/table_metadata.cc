@@ -185,8 +185,7 @@ Result<std::unique_ptr<TableMetadata>> TableMetadataUtil::Read(
     content = result.value();
   }
 
-  ICEBERG_ASSIGN_OR_RAISE(auto json, FromJsonString(content));
-  return TableMetadataFromJson(json);
+  return TableMetadataFromJsonString(content);
 }
 
 Status TableMetadataUtil::Write(FileIO& io, const std::string& location,
@@ -22,7 +22,10 @@
 #include <cstring>
 #include <vector>
 
+#include "iceberg/arrow_array_util_internal.h"
 #include "iceberg/arrow_c_data.h"
+#include "iceberg/expression/evaluator.h"
+#include "iceberg/expression/expression.h"
 #include "iceberg/file_reader.h"
 #include "iceberg/manifest_entry.h"
 #include "iceberg/manifest_list.h"
@@ -40,15 +43,50 @@ namespace {
 struct ReaderStreamPrivateData {
   std::unique_ptr<Reader> reader;
   std::string last_error;
+  /// \brief Evaluator of the row filter, null if all rows are returned.
+  std::unique_ptr<Evaluator> evaluator;
+  /// \brief Schema of the batches, only populated if a row filter is present.
+  ArrowSchema schema{.release = nullptr};
 
   explicit ReaderStreamPrivateData(std::unique_ptr<Reader> reader_ptr)
       : reader(std::move(reader_ptr)) {}
 
   ~ReaderStreamPrivateData() {
+    if (schema.release != nullptr) {
+      schema.release(&schema);
+    }
     if (reader) {
       std::ignore = reader->Close();
     }
   }
+
+  /// \brief Read the next batch and drop the rows that do not match the filter.
+  Result<std::optional<ArrowArray>> Next() {
+    while (true) {
+      ICEBERG_ASSIGN_OR_RAISE(auto batch, reader->Next());
+      if (!batch.has_value() || evaluator == nullptr) {
+        return batch;
+      }
+
+      auto selection = evaluator->Evaluate(schema, batch.value());
+      if (!selection.has_value()) {
+        batch->release(&batch.value());
+        return std::unexpected<Error>(selection.error());
+      }
+      const int64_t num_selected = selection->CountSetBits();
+      if (num_selected == batch->length) {
+        return batch;
+      }
+      if (num_selected == 0) {
+        batch->release(&batch.value());
+        continue;
+      }
+
+      auto filtered = internal::TakeArray(schema, batch.value(), selection->ToIndices());
+      batch->release(&batch.value());
+      return filtered;
+    }
+  }
 };
 
 /// \brief Callback to get the stream schema
@@ -77,7 +115,7 @@ static int GetNext(struct ArrowArrayStream* stream, struct ArrowArray* out) {
 
   auto* private_data = static_cast<ReaderStreamPrivateData*>(stream->private_data);
 
-  auto next_result = private_data->reader->Next();
+  auto next_result = private_data->Next();
   if (!next_result.has_value()) {
     private_data->last_error = next_result.error().message;
     std::memset(out, 0, sizeof(ArrowArray));
@@ -117,12 +155,17 @@ static void Release(struct ArrowArrayStream* stream) {
   stream->release = nullptr;
 }
 
-Result<ArrowArrayStream> MakeArrowArrayStream(std::unique_ptr<Reader> reader) {
+Result<ArrowArrayStream> MakeArrowArrayStream(std::unique_ptr<Reader> reader,
+                                              std::unique_ptr<Evaluator> evaluator) {
   if (!reader) {
     return InvalidArgument("Reader cannot be null");
   }
 
   auto private_data = std::make_unique<ReaderStreamPrivateData>(std::move(reader));
+  if (evaluator != nullptr && !evaluator->IsAlwaysTrue()) {
+    ICEBERG_ASSIGN_OR_RAISE(private_data->schema, private_data->reader->Schema());
+    private_data->evaluator = std::move(evaluator);
+  }
 
   ArrowArrayStream stream{.get_schema = GetSchema,
                           .get_next = GetNext,
@@ -156,10 +199,15 @@ Result<ArrowArrayStream> FileScanTask::ToArrow(
                               .projection = projected_schema,
                               .filter = filter};
 
+  std::unique_ptr<Evaluator> evaluator;
+  if (filter != nullptr) {
+    ICEBERG_ASSIGN_OR_RAISE(evaluator, Evaluator::Make(*projected_schema, filter));
+  }
+
   ICEBERG_ASSIGN_OR_RAISE(auto reader,
                           ReaderFactoryRegistry::Open(data_file_->file_format, options));
 
-  return MakeArrowArrayStream(std::move(reader));
+  return MakeArrowArrayStream(std::move(reader), std::move(evaluator));
 }
 
 TableScanBuilder::TableScanBuilder(std::shared_ptr<TableMetadata> table_metadata,
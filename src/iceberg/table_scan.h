@@ -60,7 +60,8 @@ class ICEBERG_EXPORT FileScanTask : public ScanTask {
    *
    * \param io The FileIO instance for accessing the file data.
    * \param projected_schema The projected schema for reading the data.
-   * \param filter Optional filter expression to apply during reading.
+   * \param filter Optional filter expression to apply during reading. Only rows that
+   * match the filter are returned; it must reference columns of the projected schema.
    * \return A Result containing an ArrowArrayStream, or an error on failure.
    */
   Result<ArrowArrayStream> ToArrow(const std::shared_ptr<FileIO>& io,
@@ -26,6 +26,7 @@
 #include <utility>
 #include <variant>
 
+#include "iceberg/arrow_c_data.h"
 #include "iceberg/expression/literal.h"
 #include "iceberg/iceberg_export.h"
 #include "iceberg/result.h"
@@ -197,6 +198,13 @@ class ICEBERG_EXPORT TransformFunction {
   ///
   /// All transforms must return null for a null input value.
   virtual Result<Literal> Transform(const Literal& literal) = 0;
+  /// \brief Transform an array of values of the source type to an array of the result
+  /// type
+  ///
+  /// The input array has the Arrow layout of the source type produced by ToArrowSchema,
+  /// and the returned array has the layout of the result type. A null input value is
+  /// transformed to null. The input array is not released.
+  virtual Result<ArrowArray> Transform(const ArrowArray& array) = 0;
   /// \brief Get the transform type
   TransformType transform_type() const;
   /// \brief Get the source type of transform function
@@ -19,24 +19,247 @@
 
 #include "iceberg/transform_function.h"
 
+#include <algorithm>
 #include <cassert>
-#include <chrono>
+#include <cstring>
+#include <span>
 #include <type_traits>
 #include <utility>
 #include <variant>
+#include <vector>
 
+#include <nanoarrow/nanoarrow.h>
+
+#include "iceberg/arrow_c_data_guard_internal.h"
 #include "iceberg/expression/literal.h"
+#include "iceberg/nanoarrow_error_transform_internal.h"
+#include "iceberg/schema.h"
+#include "iceberg/schema_internal.h"
 #include "iceberg/type.h"
+#include "iceberg/util/macros.h"
 #include "iceberg/util/murmurhash3_internal.h"
+#include "iceberg/util/transform_kernels_internal.h"
 #include "iceberg/util/truncate_util.h"
 
 namespace iceberg {
 
+namespace {
+
+/// \brief Make the Arrow schema of arrays of a primitive type.
+Status MakeArrowSchema(const std::shared_ptr<Type>& type, ArrowSchema* out) {
+  Schema schema({SchemaField::MakeOptional(/*field_id=*/0, "value", type)});
+  ArrowSchema struct_schema;
+  ICEBERG_RETURN_UNEXPECTED(ToArrowSchema(schema, &struct_schema));
+  ArrowSchemaMove(struct_schema.children[0], out);
+  ArrowSchemaRelease(&struct_schema);
+  return {};
+}
+
+/// \brief Make a view over an array of a primitive type, which must be reset by the
+/// caller on success.
+Status InitArrayView(const std::shared_ptr<Type>& type, const ArrowArray& array,
+                     ArrowArrayView* view) {
+  ArrowSchema schema;
+  ICEBERG_RETURN_UNEXPECTED(MakeArrowSchema(type, &schema));
+  internal::ArrowSchemaGuard schema_guard(&schema);
+  ArrowError error;
+  if (ArrowArrayViewInitFromSchema(view, &schema, &error) != NANOARROW_OK) {
+    return InvalidArrowData("Failed to init array view: {}", error.message);
+  }
+  if (ArrowArrayViewSetArray(view, &array, &error) != NANOARROW_OK) {
+    ArrowArrayViewReset(view);
+    return InvalidArrowData("Invalid array of {}: {}", type->ToString(), error.message);
+  }
+  return {};
+}
+
+Status InitArray(ArrowType type, ArrowArray* out) {
+  ICEBERG_NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromType(out, type));
+  return {};
+}
+
+Status InitArray(const std::shared_ptr<Type>& type, ArrowArray* out) {
+  ArrowSchema schema;
+  ICEBERG_RETURN_UNEXPECTED(MakeArrowSchema(type, &schema));
+  internal::ArrowSchemaGuard schema_guard(&schema);
+  ArrowError error;
+  if (ArrowArrayInitFromSchema(out, &schema, &error) != NANOARROW_OK) {
+    return InvalidArrowData("Failed to init array from schema: {}", error.message);
+  }
+  return {};
+}
+
+/// \brief Build an array of `type` with `build`, which fills its buffers and sets its
+/// length and null count.
+template <typename ArrayType, typename Build>
+Result<ArrowArray> BuildArray(const ArrayType& type, Build&& build) {
+  ArrowArray out;
+  ICEBERG_RETURN_UNEXPECTED(InitArray(type, &out));
+  auto status = [&]() -> Status {
+    ICEBERG_NANOARROW_RETURN_NOT_OK(ArrowArrayStartAppending(&out));
+    ICEBERG_RETURN_UNEXPECTED(build(&out));
+    ArrowError error;
+    if (ArrowArrayFinishBuildingDefault(&out, &error) != NANOARROW_OK) {
+      return InvalidArrowData("Failed to finish building array: {}", error.message);
+    }
+    return {};
+  }();
+  if (!status.has_value()) {
+    ArrowArrayRelease(&out);
+    return std::unexpected(status.error());
+  }
+  return out;
+}
+
+/// \brief Copy `length` bits starting at bit `offset` of `bits`.
+Status CopyBits(const uint8_t* bits, int64_t offset, int64_t length, ArrowBuffer* out) {
+  const int64_t num_bytes = (length + 7) / 8;
+  ICEBERG_NANOARROW_RETURN_NOT_OK(ArrowBufferResize(out, num_bytes, false));
+  if (offset % 8 == 0) {
+    std::memcpy(out->data, bits + offset / 8, num_bytes);
+    return {};
+  }
+  std::memset(out->data, 0, num_bytes);
+  for (int64_t i = 0; i < length; ++i) {
+    ArrowBitSetTo(out->data, i, ArrowBitGet(bits, offset + i));
+  }
+  return {};
+}
+
+/// \brief Set the length of an output array and copy the validity of the input array
+/// to it.
+Status CopyValidity(const ArrowArrayView& view, ArrowArray* out) {
+  out->length = view.length;
+  out->null_count =
+      view.null_count >= 0 ? view.null_count : ArrowArrayViewComputeNullCount(&view);
+  if (out->null_count == 0) {
+    return {};
+  }
+  ArrowBitmap* bitmap = ArrowArrayValidityBitmap(out);
+  ICEBERG_RETURN_UNEXPECTED(CopyBits(view.buffer_views[0].data.as_uint8, view.offset,
+                                     view.length, &bitmap->buffer));
+  bitmap->size_bits = view.length;
+  return {};
+}
+
+template <typename T>
+std::span<const T> Values(const ArrowArrayView& view) {
+  return {reinterpret_cast<const T*>(view.buffer_views[1].data.data) + view.offset,
+          static_cast<size_t>(view.length)};
+}
+
+std::span<const int32_t> Offsets(const ArrowArrayView& view) {
+  if (view.length == 0) {
+    return {};
+  }
+  return {view.buffer_views[1].data.as_int32 + view.offset,
+          static_cast<size_t>(view.length + 1)};
+}
+
+/// \brief Build an array of fixed width values of type T, filled by `fill` from the
+/// values of the input array.
+template <typename T, typename ArrayType, typename Fill>
+Result<ArrowArray> MakeFixedWidthArray(const ArrayType& type, const ArrowArrayView& view,
+                                       Fill&& fill) {
+  return BuildArray(type, [&](ArrowArray* out) -> Status {
+    ICEBERG_RETURN_UNEXPECTED(CopyValidity(view, out));
+    ArrowBuffer* values = ArrowArrayBuffer(out, 1);
+    ICEBERG_NANOARROW_RETURN_NOT_OK(ArrowBufferResize(
+        values, view.length * static_cast<int64_t>(sizeof(T)), false));
+    fill(std::span<T>(reinterpret_cast<T*>(values->data), view.length));
+    return {};
+  });
+}
+
+/// \brief Build a binary or string array of the first `lengths[i]` bytes of each value
+/// of the input array.
+Result<ArrowArray> MakeBinaryArray(ArrowType type, const ArrowArrayView& view,
+                                   std::span<const int32_t> lengths) {
+  return BuildArray(type, [&](ArrowArray* out) -> Status {
+    ICEBERG_RETURN_UNEXPECTED(CopyValidity(view, out));
+    const auto offsets = Offsets(view);
+    const uint8_t* data = view.buffer_views[2].data.as_uint8;
+    ArrowBuffer* out_offsets = ArrowArrayBuffer(out, 1);
+    ArrowBuffer* out_data = ArrowArrayBuffer(out, 2);
+    ICEBERG_NANOARROW_RETURN_NOT_OK(ArrowBufferResize(
+        out_offsets, (view.length + 1) * static_cast<int64_t>(sizeof(int32_t)), false));
+    auto* dest_offsets = reinterpret_cast<int32_t*>(out_offsets->data);
+    dest_offsets[0] = 0;
+    for (int64_t i = 0; i < view.length; ++i) {
+      dest_offsets[i + 1] = dest_offsets[i] + lengths[i];
+    }
+    ICEBERG_NANOARROW_RETURN_NOT_OK(
+        ArrowBufferResize(out_data, dest_offsets[view.length], false));
+    // Values that keep their full length are followed by the next value in the input,
+    // so each run of them and the value after it are copied at once.
+    for (int64_t i = 0; i < view.length;) {
+      int64_t end = i + 1;
+      while (end < view.length && lengths[end - 1] == offsets[end] - offsets[end - 1]) {
+        ++end;
+      }
+      const int64_t size = dest_offsets[end] - dest_offsets[i];
+      if (size > 0) {
+        std::memcpy(out_data->data + dest_offsets[i], data + offsets[i], size);
+      }
+      i = end;
+    }
+    return {};
+  });
+}
+
+/// \brief Copy an array of a primitive type.
+Result<ArrowArray> CopyArray(const std::shared_ptr<Type>& type,
+                             const ArrowArrayView& view) {
+  switch (view.storage_type) {
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_BINARY: {
+      std::vector<int32_t> lengths(view.length);
+      const auto offsets = Offsets(view);
+      for (int64_t i = 0; i < view.length; ++i) {
+        lengths[i] = offsets[i + 1] - offsets[i];
+      }
+      return MakeBinaryArray(view.storage_type, view, lengths);
+    }
+    case NANOARROW_TYPE_BOOL:
+      return BuildArray(type, [&](ArrowArray* out) -> Status {
+        ICEBERG_RETURN_UNEXPECTED(CopyValidity(view, out));
+        return CopyBits(view.buffer_views[1].data.as_uint8, view.offset, view.length,
+                        ArrowArrayBuffer(out, 1));
+      });
+    default: {
+      const int64_t width = view.layout.element_size_bits[1] / 8;
+      return BuildArray(type, [&](ArrowArray* out) -> Status {
+        ICEBERG_RETURN_UNEXPECTED(CopyValidity(view, out));
+        ArrowBuffer* values = ArrowArrayBuffer(out, 1);
+        ICEBERG_NANOARROW_RETURN_NOT_OK(
+            ArrowBufferResize(values, view.length * width, false));
+        if (view.length > 0) {
+          std::memcpy(values->data,
+                      view.buffer_views[1].data.as_uint8 + view.offset * width,
+                      view.length * width);
+        }
+        return {};
+      });
+    }
+  }
+}
+
+bool IsDate(const Type& type) { return type.type_id() == TypeId::kDate; }
+
+}  // namespace
+
 IdentityTransform::IdentityTransform(std::shared_ptr<Type> const& source_type)
     : TransformFunction(TransformType::kIdentity, source_type) {}
 
 Result<Literal> IdentityTransform::Transform(const Literal& literal) { return literal; }
 
+Result<ArrowArray> IdentityTransform::Transform(const ArrowArray& array) {
+  ArrowArrayView view;
+  ICEBERG_RETURN_UNEXPECTED(InitArrayView(source_type(), array, &view));
+  internal::ArrowArrayViewGuard view_guard(&view);
+  return CopyArray(source_type(), view);
+}
+
 std::shared_ptr<Type> IdentityTransform::ResultType() const { return source_type(); }
 
 Result<std::unique_ptr<TransformFunction>> IdentityTransform::Make(
@@ -68,7 +291,9 @@ Result<Literal> BucketTransform::Transform(const Literal& literal) {
       [&](auto&& value) {
         using T = std::decay_t<decltype(value)>;
         if constexpr (std::is_same_v<T, int32_t>) {
-          MurmurHash3_x86_32(&value, sizeof(int32_t), 0, &hash_value);
+          // The spec hashes int and date values as longs.
+          int64_t long_value = value;
+          MurmurHash3_x86_32(&long_value, sizeof(int64_t), 0, &hash_value);
         } else if constexpr (std::is_same_v<T, int64_t>) {
           MurmurHash3_x86_32(&value, sizeof(int64_t), 0, &hash_value);
         } else if constexpr (std::is_same_v<T, std::array<uint8_t, 16>>) {
@@ -96,6 +321,45 @@ Result<Literal> BucketTransform::Transform(const Literal& literal) {
   return Literal::Int(bucket_index);
 }
 
+Result<ArrowArray> BucketTransform::Transform(const ArrowArray& array) {
+  ArrowArrayView view;
+  ICEBERG_RETURN_UNEXPECTED(InitArrayView(source_type(), array, &view));
+  internal::ArrowArrayViewGuard view_guard(&view);
+  return MakeFixedWidthArray<int32_t>(
+      NANOARROW_TYPE_INT32, view, [&](std::span<int32_t> out) {
+        switch (source_type()->type_id()) {
+          case TypeId::kInt:
+          case TypeId::kDate:
+            TransformKernels::BucketInt32(Values<int32_t>(view), num_buckets_, out);
+            break;
+          case TypeId::kLong:
+          case TypeId::kTime:
+          case TypeId::kTimestamp:
+          case TypeId::kTimestampTz:
+            TransformKernels::BucketInt64(Values<int64_t>(view), num_buckets_, out);
+            break;
+          case TypeId::kString:
+          case TypeId::kBinary:
+            TransformKernels::BucketBinary(
+                Offsets(view), view.buffer_views[2].data.as_uint8, num_buckets_, out);
+            break;
+          case TypeId::kFixed:
+          case TypeId::kUuid: {
+            const auto width = static_cast<int32_t>(view.layout.element_size_bits[1] / 8);
+            TransformKernels::BucketFixedSize(
+                view.buffer_views[1].data.as_uint8 + view.offset * width, width,
+                num_buckets_, out);
+          } break;
+          case TypeId::kDecimal:
+            TransformKernels::BucketDecimal128(
+                view.buffer_views[1].data.as_uint8 + view.offset * 16, num_buckets_, out);
+            break;
+          default:
+            std::unreachable();
+        }
+      });
+}
+
 std::shared_ptr<Type> BucketTransform::ResultType() const { return int32(); }
 
 Result<std::unique_ptr<TransformFunction>> BucketTransform::Make(
@@ -174,6 +438,43 @@ Result<Literal> TruncateTransform::Transform(const Literal& literal) {
   }
 }
 
+Result<ArrowArray> TruncateTransform::Transform(const ArrowArray& array) {
+  if (source_type()->type_id() == TypeId::kDecimal) {
+    return NotImplemented("Truncate for Decimal arrays is not implemented yet");
+  }
+  ArrowArrayView view;
+  ICEBERG_RETURN_UNEXPECTED(InitArrayView(source_type(), array, &view));
+  internal::ArrowArrayViewGuard view_guard(&view);
+  switch (source_type()->type_id()) {
+    case TypeId::kInt:
+      return MakeFixedWidthArray<int32_t>(
+          NANOARROW_TYPE_INT32, view, [&](std::span<int32_t> out) {
+            TransformKernels::TruncateInt32(Values<int32_t>(view), width_, out);
+          });
+    case TypeId::kLong:
+      return MakeFixedWidthArray<int64_t>(
+          NANOARROW_TYPE_INT64, view, [&](std::span<int64_t> out) {
+            TransformKernels::TruncateInt64(Values<int64_t>(view), width_, out);
+          });
+    case TypeId::kString:
+    case TypeId::kBinary: {
+      const auto offsets = Offsets(view);
+      std::vector<int32_t> lengths(view.length);
+      if (source_type()->type_id() == TypeId::kString) {
+        TransformKernels::TruncateUTF8Lengths(offsets, view.buffer_views[2].data.as_uint8,
+                                              width_, lengths);
+      } else {
+        for (int64_t i = 0; i < view.length; ++i) {
+          lengths[i] = std::min(offsets[i + 1] - offsets[i], width_);
+        }
+      }
+      return MakeBinaryArray(view.storage_type, view, lengths);
+    }
+    default:
+      std::unreachable();
+  }
+}
+
 std::shared_ptr<Type> TruncateTransform::ResultType() const { return source_type(); }
 
 Result<std::unique_ptr<TransformFunction>> TruncateTransform::Make(
@@ -212,26 +513,35 @@ Result<Literal> YearTransform::Transform(const Literal& literal) {
     return Literal::Null(int32());
   }
 
-  using namespace std::chrono;  // NOLINT
   switch (source_type()->type_id()) {
-    case TypeId::kDate: {
-      auto value = std::get<int32_t>(literal.value());
-      auto epoch = sys_days(year{1970} / January / 1);
-      auto ymd = year_month_day(epoch + days{value});
-      return Literal::Int(static_cast<int32_t>(ymd.year()));
-    }
+    case TypeId::kDate:
+      return Literal::Int(
+          TransformKernels::YearOfDays(std::get<int32_t>(literal.value())));
     case TypeId::kTimestamp:
     case TypeId::kTimestampTz: {
       auto value = std::get<int64_t>(literal.value());
-      // Convert microseconds-since-epoch into a `year_month_day` object
-      auto ymd = year_month_day(floor<days>(sys_time<microseconds>(microseconds{value})));
-      return Literal::Int(static_cast<int32_t>(ymd.year()));
+      return Literal::Int(TransformKernels::YearOfDays(
+          TransformKernels::FloorDiv(value, TransformKernels::kMicrosPerDay)));
     }
     default:
       std::unreachable();
   }
 }
 
+Result<ArrowArray> YearTransform::Transform(const ArrowArray& array) {
+  ArrowArrayView view;
+  ICEBERG_RETURN_UNEXPECTED(InitArrayView(source_type(), array, &view));
+  internal::ArrowArrayViewGuard view_guard(&view);
+  return MakeFixedWidthArray<int32_t>(
+      NANOARROW_TYPE_INT32, view, [&](std::span<int32_t> out) {
+        if (IsDate(*source_type())) {
+          TransformKernels::YearFromDays(Values<int32_t>(view), out);
+        } else {
+          TransformKernels::YearFromMicros(Values<int64_t>(view), out);
+        }
+      });
+}
+
 std::shared_ptr<Type> YearTransform::ResultType() const { return int32(); }
 
 Result<std::unique_ptr<TransformFunction>> YearTransform::Make(
@@ -265,38 +575,35 @@ Result<Literal> MonthTransform::Transform(const Literal& literal) {
     return Literal::Null(int32());
   }
 
-  using namespace std::chrono;  // NOLINT
   switch (source_type()->type_id()) {
-    case TypeId::kDate: {
-      auto value = std::get<int32_t>(literal.value());
-      auto epoch = sys_days(year{1970} / January / 1);
-      auto ymd = year_month_day(epoch + days{value});
-      auto epoch_ymd = year_month_day(epoch);
-      auto delta = ymd.year() - epoch_ymd.year();
-      // Calculate the month as months from 1970-01
-      // Note: January is month 1, so we subtract 1 to get zero-based
-      // month count.
-      return Literal::Int(static_cast<int32_t>(delta.count() * 12 +
-                                               static_cast<unsigned>(ymd.month()) - 1));
-    }
+    case TypeId::kDate:
+      return Literal::Int(
+          TransformKernels::MonthsOfDays(std::get<int32_t>(literal.value())));
     case TypeId::kTimestamp:
     case TypeId::kTimestampTz: {
       auto value = std::get<int64_t>(literal.value());
-      // Convert microseconds-since-epoch into a `year_month_day` object
-      auto ymd = year_month_day(floor<days>(sys_time<microseconds>(microseconds{value})));
-      auto epoch_ymd = year_month_day(year{1970} / January / 1);
-      auto delta = ymd.year() - epoch_ymd.year();
-      // Calculate the month as months from 1970-01
-      // Note: January is month 1, so we subtract 1 to get zero-based
-      // month count.
-      return Literal::Int(static_cast<int32_t>(delta.count() * 12 +
-                                               static_cast<unsigned>(ymd.month()) - 1));
+      return Literal::Int(TransformKernels::MonthsOfDays(
+          TransformKernels::FloorDiv(value, TransformKernels::kMicrosPerDay)));
     }
     default:
       std::unreachable();
   }
 }
 
+Result<ArrowArray> MonthTransform::Transform(const ArrowArray& array) {
+  ArrowArrayView view;
+  ICEBERG_RETURN_UNEXPECTED(InitArrayView(source_type(), array, &view));
+  internal::ArrowArrayViewGuard view_guard(&view);
+  return MakeFixedWidthArray<int32_t>(
+      NANOARROW_TYPE_INT32, view, [&](std::span<int32_t> out) {
+        if (IsDate(*source_type())) {
+          TransformKernels::MonthFromDays(Values<int32_t>(view), out);
+        } else {
+          TransformKernels::MonthFromMicros(Values<int64_t>(view), out);
+        }
+      });
+}
+
 std::shared_ptr<Type> MonthTransform::ResultType() const { return int32(); }
 
 Result<std::unique_ptr<TransformFunction>> MonthTransform::Make(
@@ -330,7 +637,6 @@ Result<Literal> DayTransform::Transform(const Literal& literal) {
     return Literal::Null(int32());
   }
 
-  using namespace std::chrono;  // NOLINT
   switch (source_type()->type_id()) {
     case TypeId::kDate: {
       return Literal::Int(std::get<int32_t>(literal.value()));
@@ -338,18 +644,28 @@ Result<Literal> DayTransform::Transform(const Literal& literal) {
     case TypeId::kTimestamp:
     case TypeId::kTimestampTz: {
       auto value = std::get<int64_t>(literal.value());
-      // Convert microseconds to `sys_days` (chronological days since epoch)
-      auto timestamp = sys_time<microseconds>(microseconds{value});
-      auto days_since_epoch = floor<days>(timestamp);
-
-      return Literal::Int(
-          static_cast<int32_t>(days_since_epoch.time_since_epoch().count()));
+      return Literal::Int(static_cast<int32_t>(
+          TransformKernels::FloorDiv(value, TransformKernels::kMicrosPerDay)));
     }
     default:
       std::unreachable();
   }
 }
 
+Result<ArrowArray> DayTransform::Transform(const ArrowArray& array) {
+  ArrowArrayView view;
+  ICEBERG_RETURN_UNEXPECTED(InitArrayView(source_type(), array, &view));
+  internal::ArrowArrayViewGuard view_guard(&view);
+  return MakeFixedWidthArray<int32_t>(
+      NANOARROW_TYPE_INT32, view, [&](std::span<int32_t> out) {
+        if (IsDate(*source_type())) {
+          std::ranges::copy(Values<int32_t>(view), out.begin());
+        } else {
+          TransformKernels::DayFromMicros(Values<int64_t>(view), out);
+        }
+      });
+}
+
 std::shared_ptr<Type> DayTransform::ResultType() const { return int32(); }
 
 Result<std::unique_ptr<TransformFunction>> DayTransform::Make(
@@ -384,24 +700,30 @@ Result<Literal> HourTransform::Transform(const Literal& literal) {
     return Literal::Null(int32());
   }
 
-  using namespace std::chrono;  // NOLINT
   switch (source_type()->type_id()) {
     case TypeId::kTimestamp:
     case TypeId::kTimestampTz: {
       auto value = std::get<int64_t>(literal.value());
-      // Create a `sys_time` object from the microseconds value
-      auto timestamp = sys_time<microseconds>(microseconds{value});
-
-      // Convert the time since epoch directly into hours
-      auto hours_since_epoch = duration_cast<hours>(timestamp.time_since_epoch()).count();
-
-      return Literal::Int(static_cast<int32_t>(hours_since_epoch));
+      // Round towards negative infinity so that timestamps before the epoch fall into
+      // the hour they belong to.
+      return Literal::Int(static_cast<int32_t>(
+          TransformKernels::FloorDiv(value, TransformKernels::kMicrosPerHour)));
     }
     default:
       std::unreachable();
   }
 }
 
+Result<ArrowArray> HourTransform::Transform(const ArrowArray& array) {
+  ArrowArrayView view;
+  ICEBERG_RETURN_UNEXPECTED(InitArrayView(source_type(), array, &view));
+  internal::ArrowArrayViewGuard view_guard(&view);
+  return MakeFixedWidthArray<int32_t>(
+      NANOARROW_TYPE_INT32, view, [&](std::span<int32_t> out) {
+        TransformKernels::HourFromMicros(Values<int64_t>(view), out);
+      });
+}
+
 std::shared_ptr<Type> HourTransform::ResultType() const { return int32(); }
 
 Result<std::unique_ptr<TransformFunction>> HourTransform::Make(
@@ -427,6 +749,13 @@ Result<Literal> VoidTransform::Transform(const Literal& literal) {
   return literal.IsNull() ? literal : Literal::Null(literal.type());
 }
 
+Result<ArrowArray> VoidTransform::Transform(const ArrowArray& array) {
+  return BuildArray(source_type(), [&](ArrowArray* out) -> Status {
+    ICEBERG_NANOARROW_RETURN_NOT_OK(ArrowArrayAppendNull(out, array.length));
+    return {};
+  });
+}
+
 std::shared_ptr<Type> VoidTransform::ResultType() const { return source_type(); }
 
 Result<std::unique_ptr<TransformFunction>> VoidTransform::Make(
@@ -33,6 +33,9 @@ class IdentityTransform : public TransformFunction {
   /// \brief Returns the same Literal as the input.
   Result<Literal> Transform(const Literal& literal) override;
 
+  /// \brief Returns a copy of the input array.
+  Result<ArrowArray> Transform(const ArrowArray& array) override;
+
   /// \brief Returns the same type as source_type.
   std::shared_ptr<Type> ResultType() const override;
 
@@ -53,9 +56,15 @@ class BucketTransform : public TransformFunction {
   /// \brief Applies the bucket hash function to the input Literal.
   Result<Literal> Transform(const Literal& literal) override;
 
+  /// \brief Applies the bucket hash function to each value of the input array.
+  Result<ArrowArray> Transform(const ArrowArray& array) override;
+
   /// \brief Returns INT32 as the output type.
   std::shared_ptr<Type> ResultType() const override;
 
+  /// \brief Returns the number of buckets.
+  int32_t num_buckets() const { return num_buckets_; }
+
   /// \brief Create a BucketTransform.
   /// \param source_type Type of the input data.
   /// \param num_buckets Number of buckets to hash into.
@@ -77,9 +86,18 @@ class TruncateTransform : public TransformFunction {
   /// \brief Truncates the input Literal to the specified width.
   Result<Literal> Transform(const Literal& literal) override;
 
+  /// \brief Truncates each value of the input array to the specified width.
+  ///
+  /// Like the literal overload, decimal arrays are not supported yet and return
+  /// NotImplemented.
+  Result<ArrowArray> Transform(const ArrowArray& array) override;
+
   /// \brief Returns the same type as source_type.
   std::shared_ptr<Type> ResultType() const override;
 
+  /// \brief Returns the width to truncate to.
+  int32_t width() const { return width_; }
+
   /// \brief Create a TruncateTransform.
   /// \param source_type Type of the input data.
   /// \param width The width to truncate to.
@@ -100,6 +118,9 @@ class YearTransform : public TransformFunction {
   /// \brief Extract a date or timestamp year, as years from 1970.
   Result<Literal> Transform(const Literal& literal) override;
 
+  /// \brief Extracts the year of each value of the input array.
+  Result<ArrowArray> Transform(const ArrowArray& array) override;
+
   /// \brief Returns INT32 as the output type.
   std::shared_ptr<Type> ResultType() const override;
 
@@ -119,6 +140,9 @@ class MonthTransform : public TransformFunction {
   /// \brief Extract a date or timestamp month, as months from 1970-01-01.
   Result<Literal> Transform(const Literal& literal) override;
 
+  /// \brief Computes the months since 1970-01 of each value of the input array.
+  Result<ArrowArray> Transform(const ArrowArray& array) override;
+
   /// \brief Returns INT32 as the output type.
   std::shared_ptr<Type> ResultType() const override;
 
@@ -138,6 +162,9 @@ class DayTransform : public TransformFunction {
   /// \brief Extract a date or timestamp day, as days from 1970-01-01.
   Result<Literal> Transform(const Literal& literal) override;
 
+  /// \brief Computes the days since the epoch of each value of the input array.
+  Result<ArrowArray> Transform(const ArrowArray& array) override;
+
   /// \brief Returns INT32 as the output type.
   std::shared_ptr<Type> ResultType() const override;
 
@@ -157,6 +184,9 @@ class HourTransform : public TransformFunction {
   /// \brief Extract a timestamp hour, as hours from 1970-01-01 00:00:00.
   Result<Literal> Transform(const Literal& literal) override;
 
+  /// \brief Computes the hours since the epoch of each value of the input array.
+  Result<ArrowArray> Transform(const ArrowArray& array) override;
+
   /// \brief Returns INT32 as the output type.
   std::shared_ptr<Type> ResultType() const override;
 
@@ -176,6 +206,9 @@ class VoidTransform : public TransformFunction {
   /// \brief Returns a null literal.
   Result<Literal> Transform(const Literal& literal) override;
 
+  /// \brief Returns an array of nulls of the same length as the input array.
+  Result<ArrowArray> Transform(const ArrowArray& array) override;
+
   /// \brief Returns the same type as source_type.
   std::shared_ptr<Type> ResultType() const override;
 
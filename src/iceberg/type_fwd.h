@@ -88,7 +88,9 @@ struct TableIdentifier;
 
 class Catalog;
 class FileIO;
+class FileMetadataCache;
 class LocationProvider;
+class MemoryPool;
 class SortField;
 class SortOrder;
 class Table;
@@ -135,10 +137,14 @@ class ManifestWriter;
 
 class Reader;
 class Writer;
+class RollingFileWriter;
 
 class StructLike;
 class MetadataUpdate;
 class UpdateRequirement;
 class AppendFiles;
+class FastAppend;
+class RewriteManifests;
+class SnapshotProducer;
 
 }  // namespace iceberg
@@ -0,0 +1,54 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/update_requirement.h"
+
+#include "iceberg/snapshot.h"
+#include "iceberg/table_metadata.h"
+
+namespace iceberg {
+
+Status AssertTableUUID::Validate(const TableMetadata& metadata) const {
+  if (metadata.table_uuid != uuid_) {
+    return CommitFailed("Requirement failed: UUID does not match: expected {} != {}",
+                        uuid_, metadata.table_uuid);
+  }
+  return {};
+}
+
+Status AssertRefSnapshotId::Validate(const TableMetadata& metadata) const {
+  auto it = metadata.refs.find(ref_name_);
+  if (it == metadata.refs.end() || !it->second) {
+    if (snapshot_id_.has_value()) {
+      return CommitFailed("Requirement failed: {} was removed, expected snapshot {}",
+                          ref_name_, *snapshot_id_);
+    }
+    return {};
+  }
+  if (!snapshot_id_.has_value()) {
+    return CommitFailed("Requirement failed: {} was created concurrently", ref_name_);
+  }
+  if (it->second->snapshot_id != *snapshot_id_) {
+    return CommitFailed("Requirement failed: {} has changed: expected id {} != {}",
+                        ref_name_, *snapshot_id_, it->second->snapshot_id);
+  }
+  return {};
+}
+
+}  // namespace iceberg
@@ -0,0 +1,82 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+/// \file iceberg/update_requirement.h
+/// Preconditions on the table metadata that a commit is based on.
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "iceberg/iceberg_export.h"
+#include "iceberg/result.h"
+#include "iceberg/type_fwd.h"
+
+namespace iceberg {
+
+/// \brief A requirement that the current table metadata must meet for a commit to be
+/// applied.
+///
+/// Requirements guard the assumptions a commit was built on, such as the snapshot a
+/// branch pointed at, so that concurrent commits are detected rather than overwritten.
+class ICEBERG_EXPORT UpdateRequirement {
+ public:
+  virtual ~UpdateRequirement() = default;
+
+  /// \brief Check the requirement against the current table metadata.
+  ///
+  /// \return ErrorKind::kCommitFailed if the requirement is not met.
+  virtual Status Validate(const TableMetadata& metadata) const = 0;
+};
+
+/// \brief Require the table to have the given UUID, i.e. not to have been replaced.
+class ICEBERG_EXPORT AssertTableUUID : public UpdateRequirement {
+ public:
+  explicit AssertTableUUID(std::string uuid) : uuid_(std::move(uuid)) {}
+
+  const std::string& uuid() const { return uuid_; }
+
+  Status Validate(const TableMetadata& metadata) const override;
+
+ private:
+  std::string uuid_;
+};
+
+/// \brief Require a branch or tag to point at the given snapshot, or not to exist when
+/// the snapshot id is nullopt.
+class ICEBERG_EXPORT AssertRefSnapshotId : public UpdateRequirement {
+ public:
+  AssertRefSnapshotId(std::string ref_name, std::optional<int64_t> snapshot_id)
+      : ref_name_(std::move(ref_name)), snapshot_id_(snapshot_id) {}
+
+  const std::string& ref_name() const { return ref_name_; }
+
+  const std::optional<int64_t>& snapshot_id() const { return snapshot_id_; }
+
+  Status Validate(const TableMetadata& metadata) const override;
+
+ private:
+  std::string ref_name_;
+  std::optional<int64_t> snapshot_id_;
+};
+
+}  // namespace iceberg
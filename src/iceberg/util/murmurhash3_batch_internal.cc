@@ -0,0 +1,414 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/util/murmurhash3_batch_internal.h"
+
+#include <cstring>
+
+#include "iceberg/util/endian.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#  define ICEBERG_MURMUR_X86_SIMD 1
+#  include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON) && \
+    __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#  define ICEBERG_MURMUR_NEON 1
+#  include <arm_neon.h>
+#endif
+
+namespace iceberg {
+
+namespace {
+
+// The constants of MurmurHash3_x86_32, see util/murmurhash3_internal.cc.
+constexpr uint32_t kC1 = 0xcc9e2d51;
+constexpr uint32_t kC2 = 0x1b873593;
+constexpr uint32_t kMixAdd = 0xe6546b64;
+constexpr uint32_t kFmix1 = 0x85ebca6b;
+constexpr uint32_t kFmix2 = 0xc2b2ae35;
+
+inline uint32_t Rotl32(uint32_t x, int r) { return (x << r) | (x >> (32 - r)); }
+
+inline uint32_t MixBlock(uint32_t h, uint32_t k) {
+  k *= kC1;
+  k = Rotl32(k, 15);
+  k *= kC2;
+  h ^= k;
+  h = Rotl32(h, 13);
+  return h * 5 + kMixAdd;
+}
+
+inline int32_t Finalize(uint32_t h, uint32_t length) {
+  h ^= length;
+  h ^= h >> 16;
+  h *= kFmix1;
+  h ^= h >> 13;
+  h *= kFmix2;
+  h ^= h >> 16;
+  return static_cast<int32_t>(h);
+}
+
+inline int32_t HashLong(int64_t key) {
+  const auto bits = static_cast<uint64_t>(key);
+  uint32_t h = MixBlock(0, static_cast<uint32_t>(bits));
+  h = MixBlock(h, static_cast<uint32_t>(bits >> 32));
+  return Finalize(h, sizeof(int64_t));
+}
+
+inline int32_t HashFixed16(const uint8_t* key) {
+  uint32_t h = 0;
+  for (int j = 0; j < 4; ++j) {
+    uint32_t word;
+    std::memcpy(&word, key + j * sizeof(uint32_t), sizeof(uint32_t));
+    h = MixBlock(h, FromLittleEndian(word));
+  }
+  return Finalize(h, 16);
+}
+
+void HashLongsScalar(const int64_t* keys, size_t length, int32_t* out) {
+  for (size_t i = 0; i < length; ++i) {
+    out[i] = HashLong(keys[i]);
+  }
+}
+
+void HashIntsAsLongsScalar(const int32_t* keys, size_t length, int32_t* out) {
+  for (size_t i = 0; i < length; ++i) {
+    out[i] = HashLong(keys[i]);
+  }
+}
+
+void HashFixed16Scalar(const uint8_t* keys, size_t length, int32_t* out) {
+  for (size_t i = 0; i < length; ++i) {
+    out[i] = HashFixed16(keys + i * 16);
+  }
+}
+
+#if defined(ICEBERG_MURMUR_X86_SIMD)
+
+// Each kernel hashes 8 (AVX2) or 16 (AVX-512) keys per iteration, one per 32-bit lane,
+// and leaves the remaining keys to the scalar loop.
+
+#  define ICEBERG_AVX2 __attribute__((target("avx2")))
+#  define ICEBERG_AVX512 __attribute__((target("avx512f")))
+
+ICEBERG_AVX2 inline __m256i Rotl32(__m256i x, int r) {
+  return _mm256_or_si256(_mm256_slli_epi32(x, r), _mm256_srli_epi32(x, 32 - r));
+}
+
+ICEBERG_AVX2 inline __m256i MixBlock(__m256i h, __m256i k) {
+  k = _mm256_mullo_epi32(k, _mm256_set1_epi32(static_cast<int32_t>(kC1)));
+  k = Rotl32(k, 15);
+  k = _mm256_mullo_epi32(k, _mm256_set1_epi32(static_cast<int32_t>(kC2)));
+  h = _mm256_xor_si256(h, k);
+  h = Rotl32(h, 13);
+  h = _mm256_add_epi32(_mm256_add_epi32(_mm256_slli_epi32(h, 2), h),
+                       _mm256_set1_epi32(static_cast<int32_t>(kMixAdd)));
+  return h;
+}
+
+ICEBERG_AVX2 inline __m256i Finalize(__m256i h, uint32_t length) {
+  h = _mm256_xor_si256(h, _mm256_set1_epi32(static_cast<int32_t>(length)));
+  h = _mm256_xor_si256(h, _mm256_srli_epi32(h, 16));
+  h = _mm256_mullo_epi32(h, _mm256_set1_epi32(static_cast<int32_t>(kFmix1)));
+  h = _mm256_xor_si256(h, _mm256_srli_epi32(h, 13));
+  h = _mm256_mullo_epi32(h, _mm256_set1_epi32(static_cast<int32_t>(kFmix2)));
+  return _mm256_xor_si256(h, _mm256_srli_epi32(h, 16));
+}
+
+ICEBERG_AVX2 void HashLongsAvx2(const int64_t* keys, size_t length, int32_t* out) {
+  // Moves the low words of the four longs of a vector to its lower half.
+  const __m256i deinterleave = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+  size_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    __m256i a = _mm256_permutevar8x32_epi32(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)), deinterleave);
+    __m256i b = _mm256_permutevar8x32_epi32(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i + 4)),
+        deinterleave);
+    __m256i low = _mm256_permute2x128_si256(a, b, 0x20);
+    __m256i high = _mm256_permute2x128_si256(a, b, 0x31);
+    __m256i h = MixBlock(_mm256_setzero_si256(), low);
+    h = Finalize(MixBlock(h, high), sizeof(int64_t));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), h);
+  }
+  HashLongsScalar(keys + i, length - i, out + i);
+}
+
+ICEBERG_AVX2 void HashIntsAsLongsAvx2(const int32_t* keys, size_t length,
+                                      int32_t* out) {
+  size_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+    // The high word of the sign-extended long.
+    __m256i high = _mm256_srai_epi32(low, 31);
+    __m256i h = MixBlock(_mm256_setzero_si256(), low);
+    h = Finalize(MixBlock(h, high), sizeof(int64_t));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), h);
+  }
+  HashIntsAsLongsScalar(keys + i, length - i, out + i);
+}
+
+ICEBERG_AVX2 void HashFixed16Avx2(const uint8_t* keys, size_t length, int32_t* out) {
+  // The word offsets of eight consecutive keys.
+  const __m256i offsets = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+  size_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    const auto* base = reinterpret_cast<const int*>(keys + i * 16);
+    __m256i h = _mm256_setzero_si256();
+    for (int j = 0; j < 4; ++j) {
+      h = MixBlock(h, _mm256_i32gather_epi32(base + j, offsets, 4));
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), Finalize(h, 16));
+  }
+  HashFixed16Scalar(keys + i * 16, length - i, out + i);
+}
+
+ICEBERG_AVX512 inline __m512i MixBlock(__m512i h, __m512i k) {
+  k = _mm512_mullo_epi32(k, _mm512_set1_epi32(static_cast<int32_t>(kC1)));
+  k = _mm512_rol_epi32(k, 15);
+  k = _mm512_mullo_epi32(k, _mm512_set1_epi32(static_cast<int32_t>(kC2)));
+  h = _mm512_xor_si512(h, k);
+  h = _mm512_rol_epi32(h, 13);
+  h = _mm512_add_epi32(_mm512_add_epi32(_mm512_slli_epi32(h, 2), h),
+                       _mm512_set1_epi32(static_cast<int32_t>(kMixAdd)));
+  return h;
+}
+
+ICEBERG_AVX512 inline __m512i Finalize(__m512i h, uint32_t length) {
+  h = _mm512_xor_si512(h, _mm512_set1_epi32(static_cast<int32_t>(length)));
+  h = _mm512_xor_si512(h, _mm512_srli_epi32(h, 16));
+  h = _mm512_mullo_epi32(h, _mm512_set1_epi32(static_cast<int32_t>(kFmix1)));
+  h = _mm512_xor_si512(h, _mm512_srli_epi32(h, 13));
+  h = _mm512_mullo_epi32(h, _mm512_set1_epi32(static_cast<int32_t>(kFmix2)));
+  return _mm512_xor_si512(h, _mm512_srli_epi32(h, 16));
+}
+
+ICEBERG_AVX512 void HashLongsAvx512(const int64_t* keys, size_t length, int32_t* out) {
+  const __m512i even = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22,
+                                         24, 26, 28, 30);
+  const __m512i odd = _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25,
+                                        27, 29, 31);
+  size_t i = 0;
+  for (; i + 16 <= length; i += 16) {
+    __m512i a = _mm512_loadu_si512(keys + i);
+    __m512i b = _mm512_loadu_si512(keys + i + 8);
+    __m512i h = MixBlock(_mm512_setzero_si512(), _mm512_permutex2var_epi32(a, even, b));
+    h = Finalize(MixBlock(h, _mm512_permutex2var_epi32(a, odd, b)), sizeof(int64_t));
+    _mm512_storeu_si512(out + i, h);
+  }
+  HashLongsAvx2(keys + i, length - i, out + i);
+}
+
+ICEBERG_AVX512 void HashIntsAsLongsAvx512(const int32_t* keys, size_t length,
+                                          int32_t* out) {
+  size_t i = 0;
+  for (; i + 16 <= length; i += 16) {
+    __m512i low = _mm512_loadu_si512(keys + i);
+    __m512i h = MixBlock(_mm512_setzero_si512(), low);
+    h = Finalize(MixBlock(h, _mm512_srai_epi32(low, 31)), sizeof(int64_t));
+    _mm512_storeu_si512(out + i, h);
+  }
+  HashIntsAsLongsAvx2(keys + i, length - i, out + i);
+}
+
+ICEBERG_AVX512 void HashFixed16Avx512(const uint8_t* keys, size_t length,
+                                      int32_t* out) {
+  const __m512i offsets = _mm512_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40,
+                                            44, 48, 52, 56, 60);
+  size_t i = 0;
+  for (; i + 16 <= length; i += 16) {
+    const auto* base = reinterpret_cast<const int*>(keys + i * 16);
+    __m512i h = _mm512_setzero_si512();
+    for (int j = 0; j < 4; ++j) {
+      h = MixBlock(h, _mm512_i32gather_epi32(offsets, base + j, 4));
+    }
+    _mm512_storeu_si512(out + i, Finalize(h, 16));
+  }
+  HashFixed16Avx2(keys + i * 16, length - i, out + i);
+}
+
+#  undef ICEBERG_AVX2
+#  undef ICEBERG_AVX512
+
+enum class SimdLevel { kScalar, kAvx2, kAvx512 };
+
+SimdLevel GetSimdLevel() {
+  static const SimdLevel level = [] {
+    __builtin_cpu_init();
+    // The AVX-512 kernels hand their remaining keys to the AVX2 kernels.
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2")) {
+      return SimdLevel::kAvx512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+      return SimdLevel::kAvx2;
+    }
+    return SimdLevel::kScalar;
+  }();
+  return level;
+}
+
+#elif defined(ICEBERG_MURMUR_NEON)
+
+// Each kernel hashes 4 keys per vector and two vectors per iteration, one key per
+// 32-bit lane, and leaves the remaining keys to the scalar loop.
+
+template <int R>
+inline uint32x4_t Rotl32(uint32x4_t x) {
+  return vsriq_n_u32(vshlq_n_u32(x, R), x, 32 - R);
+}
+
+inline uint32x4_t MixBlock(uint32x4_t h, uint32x4_t k) {
+  k = vmulq_n_u32(k, kC1);
+  k = Rotl32<15>(k);
+  k = vmulq_n_u32(k, kC2);
+  h = veorq_u32(h, k);
+  h = Rotl32<13>(h);
+  return vmlaq_n_u32(vdupq_n_u32(kMixAdd), h, 5);
+}
+
+inline uint32x4_t Finalize(uint32x4_t h, uint32_t length) {
+  h = veorq_u32(h, vdupq_n_u32(length));
+  h = veorq_u32(h, vshrq_n_u32(h, 16));
+  h = vmulq_n_u32(h, kFmix1);
+  h = veorq_u32(h, vshrq_n_u32(h, 13));
+  h = vmulq_n_u32(h, kFmix2);
+  return veorq_u32(h, vshrq_n_u32(h, 16));
+}
+
+inline void Store(int32_t* out, uint32x4_t h) {
+  vst1q_s32(out, vreinterpretq_s32_u32(h));
+}
+
+void HashLongsNeon(const int64_t* keys, size_t length, int32_t* out) {
+  const auto* words = reinterpret_cast<const uint32_t*>(keys);
+  size_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    // Loads the low and the high words of four longs into separate vectors.
+    uint32x4x2_t a = vld2q_u32(words + i * 2);
+    uint32x4x2_t b = vld2q_u32(words + i * 2 + 8);
+    uint32x4_t ha = MixBlock(MixBlock(vdupq_n_u32(0), a.val[0]), a.val[1]);
+    uint32x4_t hb = MixBlock(MixBlock(vdupq_n_u32(0), b.val[0]), b.val[1]);
+    Store(out + i, Finalize(ha, sizeof(int64_t)));
+    Store(out + i + 4, Finalize(hb, sizeof(int64_t)));
+  }
+  HashLongsScalar(keys + i, length - i, out + i);
+}
+
+void HashIntsAsLongsNeon(const int32_t* keys, size_t length, int32_t* out) {
+  size_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    int32x4_t a = vld1q_s32(keys + i);
+    int32x4_t b = vld1q_s32(keys + i + 4);
+    // The high word of the sign-extended long.
+    uint32x4_t ha = MixBlock(vdupq_n_u32(0), vreinterpretq_u32_s32(a));
+    uint32x4_t hb = MixBlock(vdupq_n_u32(0), vreinterpretq_u32_s32(b));
+    ha = MixBlock(ha, vreinterpretq_u32_s32(vshrq_n_s32(a, 31)));
+    hb = MixBlock(hb, vreinterpretq_u32_s32(vshrq_n_s32(b, 31)));
+    Store(out + i, Finalize(ha, sizeof(int64_t)));
+    Store(out + i + 4, Finalize(hb, sizeof(int64_t)));
+  }
+  HashIntsAsLongsScalar(keys + i, length - i, out + i);
+}
+
+void HashFixed16Neon(const uint8_t* keys, size_t length, int32_t* out) {
+  const auto* words = reinterpret_cast<const uint32_t*>(keys);
+  size_t i = 0;
+  for (; i + 4 <= length; i += 4) {
+    // Loads word j of four keys into vector j.
+    uint32x4x4_t k = vld4q_u32(words + i * 4);
+    uint32x4_t h = vdupq_n_u32(0);
+    for (int j = 0; j < 4; ++j) {
+      h = MixBlock(h, k.val[j]);
+    }
+    Store(out + i, Finalize(h, 16));
+  }
+  HashFixed16Scalar(keys + i * 16, length - i, out + i);
+}
+
+#endif
+
+}  // namespace
+
+void MurmurHash3_x86_32_IntsAsLongs(std::span<const int32_t> keys,
+                                    std::span<int32_t> out) {
+#if defined(ICEBERG_MURMUR_X86_SIMD)
+  switch (GetSimdLevel()) {
+    case SimdLevel::kAvx512:
+      return HashIntsAsLongsAvx512(keys.data(), keys.size(), out.data());
+    case SimdLevel::kAvx2:
+      return HashIntsAsLongsAvx2(keys.data(), keys.size(), out.data());
+    case SimdLevel::kScalar:
+      break;
+  }
+#elif defined(ICEBERG_MURMUR_NEON)
+  return HashIntsAsLongsNeon(keys.data(), keys.size(), out.data());
+#endif
+  HashIntsAsLongsScalar(keys.data(), keys.size(), out.data());
+}
+
+void MurmurHash3_x86_32_Longs(std::span<const int64_t> keys, std::span<int32_t> out) {
+#if defined(ICEBERG_MURMUR_X86_SIMD)
+  switch (GetSimdLevel()) {
+    case SimdLevel::kAvx512:
+      return HashLongsAvx512(keys.data(), keys.size(), out.data());
+    case SimdLevel::kAvx2:
+      return HashLongsAvx2(keys.data(), keys.size(), out.data());
+    case SimdLevel::kScalar:
+      break;
+  }
+#elif defined(ICEBERG_MURMUR_NEON)
+  return HashLongsNeon(keys.data(), keys.size(), out.data());
+#endif
+  HashLongsScalar(keys.data(), keys.size(), out.data());
+}
+
+void MurmurHash3_x86_32_Fixed16(const uint8_t* keys, std::span<int32_t> out) {
+#if defined(ICEBERG_MURMUR_X86_SIMD)
+  switch (GetSimdLevel()) {
+    case SimdLevel::kAvx512:
+      return HashFixed16Avx512(keys, out.size(), out.data());
+    case SimdLevel::kAvx2:
+      return HashFixed16Avx2(keys, out.size(), out.data());
+    case SimdLevel::kScalar:
+      break;
+  }
+#elif defined(ICEBERG_MURMUR_NEON)
+  return HashFixed16Neon(keys, out.size(), out.data());
+#endif
+  HashFixed16Scalar(keys, out.size(), out.data());
+}
+
+const char* MurmurHash3BatchSimdLevel() {
+#if defined(ICEBERG_MURMUR_X86_SIMD)
+  switch (GetSimdLevel()) {
+    case SimdLevel::kAvx512:
+      return "avx512";
+    case SimdLevel::kAvx2:
+      return "avx2";
+    case SimdLevel::kScalar:
+      break;
+  }
+#elif defined(ICEBERG_MURMUR_NEON)
+  return "neon";
+#endif
+  return "scalar";
+}
+
+}  // namespace iceberg
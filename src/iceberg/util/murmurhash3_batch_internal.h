@@ -0,0 +1,53 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+/// \file iceberg/util/murmurhash3_batch_internal.h
+/// Batched MurmurHash3_x86_32 of fixed-width keys, as hashed by the bucket transform.
+///
+/// The results are identical to MurmurHash3_x86_32 with seed 0 over the little-endian
+/// bytes of each key. Blocks of keys are hashed in SIMD lanes with AVX-512 or AVX2,
+/// selected at runtime, or NEON, and the remaining keys one at a time.
+
+#include <cstdint>
+#include <span>
+
+#include "iceberg/iceberg_export.h"
+
+namespace iceberg {
+
+/// \brief Hash int32 keys as 8-byte longs, as the Iceberg spec requires for int and
+/// date values.
+ICEBERG_EXPORT void MurmurHash3_x86_32_IntsAsLongs(std::span<const int32_t> keys,
+                                                   std::span<int32_t> out);
+
+/// \brief Hash 8-byte long keys.
+ICEBERG_EXPORT void MurmurHash3_x86_32_Longs(std::span<const int64_t> keys,
+                                             std::span<int32_t> out);
+
+/// \brief Hash consecutive 16-byte keys, such as uuids, one per element of `out`.
+ICEBERG_EXPORT void MurmurHash3_x86_32_Fixed16(const uint8_t* keys,
+                                               std::span<int32_t> out);
+
+/// \brief Returns the name of the SIMD instruction set used to hash keys: "avx512",
+/// "avx2", "neon" or "scalar".
+ICEBERG_EXPORT const char* MurmurHash3BatchSimdLevel();
+
+}  // namespace iceberg
@@ -0,0 +1,44 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/util/partition_key_internal.h"
+
+#include <cstdint>
+
+#include "iceberg/util/macros.h"
+
+namespace iceberg {
+
+Result<std::string> PartitionKey(const std::vector<Literal>& partition) {
+  std::string key;
+  for (const auto& value : partition) {
+    if (value.IsNull()) {
+      key.push_back('\0');
+      continue;
+    }
+    ICEBERG_ASSIGN_OR_RAISE(auto bytes, value.Serialize());
+    auto size = static_cast<uint32_t>(bytes.size());
+    key.push_back('\1');
+    key.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    key.append(bytes.begin(), bytes.end());
+  }
+  return key;
+}
+
+}  // namespace iceberg
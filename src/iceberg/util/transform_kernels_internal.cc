@@ -0,0 +1,214 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/util/transform_kernels_internal.h"
+
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <string_view>
+
+#include "iceberg/util/endian.h"
+#include "iceberg/util/murmurhash3_batch_internal.h"
+#include "iceberg/util/murmurhash3_internal.h"
+#include "iceberg/util/truncate_util.h"
+
+namespace iceberg {
+
+namespace {
+
+int32_t ToBucket(int32_t hash, int32_t num_buckets) {
+  return (hash & std::numeric_limits<int32_t>::max()) % num_buckets;
+}
+
+/// \brief Replace the hashes in `out` with their buckets.
+void ToBuckets(int32_t num_buckets, std::span<int32_t> out) {
+  for (auto& hash : out) {
+    hash = ToBucket(hash, num_buckets);
+  }
+}
+
+// The temporal kernels below are free of calendar lookups and data-dependent branches,
+// so that compilers can unroll and vectorize them.
+
+template <int64_t kUnitsPerDay>
+void YearFromTimestamps(std::span<const int64_t> values, std::span<int32_t> out) {
+  for (size_t i = 0; i < values.size(); ++i) {
+    out[i] = TransformKernels::YearOfDays(
+        TransformKernels::FloorDiv(values[i], kUnitsPerDay));
+  }
+}
+
+template <int64_t kUnitsPerDay>
+void MonthFromTimestamps(std::span<const int64_t> values, std::span<int32_t> out) {
+  for (size_t i = 0; i < values.size(); ++i) {
+    out[i] = TransformKernels::MonthsOfDays(
+        TransformKernels::FloorDiv(values[i], kUnitsPerDay));
+  }
+}
+
+template <int64_t kUnitsPerPeriod>
+void PeriodFromTimestamps(std::span<const int64_t> values, std::span<int32_t> out) {
+  for (size_t i = 0; i < values.size(); ++i) {
+    out[i] =
+        static_cast<int32_t>(TransformKernels::FloorDiv(values[i], kUnitsPerPeriod));
+  }
+}
+
+}  // namespace
+
+void TransformKernels::BucketInt32(std::span<const int32_t> values, int32_t num_buckets,
+                                   std::span<int32_t> out) {
+  MurmurHash3_x86_32_IntsAsLongs(values, out);
+  ToBuckets(num_buckets, out);
+}
+
+void TransformKernels::BucketInt64(std::span<const int64_t> values, int32_t num_buckets,
+                                   std::span<int32_t> out) {
+  MurmurHash3_x86_32_Longs(values, out);
+  ToBuckets(num_buckets, out);
+}
+
+void TransformKernels::BucketFixedSize(const uint8_t* data, int32_t byte_width,
+                                       int32_t num_buckets, std::span<int32_t> out) {
+  if (byte_width == 16) {
+    MurmurHash3_x86_32_Fixed16(data, out);
+    ToBuckets(num_buckets, out);
+    return;
+  }
+  for (size_t i = 0; i < out.size(); ++i) {
+    int32_t hash = 0;
+    MurmurHash3_x86_32(data + i * byte_width, byte_width, 0, &hash);
+    out[i] = ToBucket(hash, num_buckets);
+  }
+}
+
+void TransformKernels::BucketDecimal128(const uint8_t* data, int32_t num_buckets,
+                                        std::span<int32_t> out) {
+  for (size_t i = 0; i < out.size(); ++i) {
+    uint64_t words[2];
+    std::memcpy(words, data + i * 16, sizeof(words));
+    const uint64_t low = FromLittleEndian(words[0]);
+    const uint64_t high = FromLittleEndian(words[1]);
+    uint8_t bytes[16];
+    for (int j = 0; j < 8; ++j) {
+      bytes[j] = static_cast<uint8_t>(high >> (56 - 8 * j));
+      bytes[8 + j] = static_cast<uint8_t>(low >> (56 - 8 * j));
+    }
+    // Drop leading bytes that only repeat the sign bit of the next byte.
+    int32_t start = 0;
+    while (start < 15 && (bytes[start] == 0x00 || bytes[start] == 0xFF) &&
+           (bytes[start] & 0x80) == (bytes[start + 1] & 0x80)) {
+      ++start;
+    }
+    int32_t hash = 0;
+    MurmurHash3_x86_32(bytes + start, 16 - start, 0, &hash);
+    out[i] = ToBucket(hash, num_buckets);
+  }
+}
+
+void TransformKernels::BucketBinary(std::span<const int32_t> offsets,
+                                    const uint8_t* data, int32_t num_buckets,
+                                    std::span<int32_t> out) {
+  for (size_t i = 0; i < out.size(); ++i) {
+    int32_t hash = 0;
+    MurmurHash3_x86_32(data + offsets[i], offsets[i + 1] - offsets[i], 0, &hash);
+    out[i] = ToBucket(hash, num_buckets);
+  }
+}
+
+void TransformKernels::YearFromDays(std::span<const int32_t> days,
+                                    std::span<int32_t> out) {
+  for (size_t i = 0; i < days.size(); ++i) {
+    out[i] = YearOfDays(days[i]);
+  }
+}
+
+void TransformKernels::YearFromMicros(std::span<const int64_t> micros,
+                                      std::span<int32_t> out) {
+  YearFromTimestamps<kMicrosPerDay>(micros, out);
+}
+
+void TransformKernels::MonthFromDays(std::span<const int32_t> days,
+                                     std::span<int32_t> out) {
+  for (size_t i = 0; i < days.size(); ++i) {
+    out[i] = MonthsOfDays(days[i]);
+  }
+}
+
+void TransformKernels::MonthFromMicros(std::span<const int64_t> micros,
+                                       std::span<int32_t> out) {
+  MonthFromTimestamps<kMicrosPerDay>(micros, out);
+}
+
+void TransformKernels::DayFromMicros(std::span<const int64_t> micros,
+                                     std::span<int32_t> out) {
+  PeriodFromTimestamps<kMicrosPerDay>(micros, out);
+}
+
+void TransformKernels::HourFromMicros(std::span<const int64_t> micros,
+                                      std::span<int32_t> out) {
+  PeriodFromTimestamps<kMicrosPerHour>(micros, out);
+}
+
+void TransformKernels::YearFromNanos(std::span<const int64_t> nanos,
+                                     std::span<int32_t> out) {
+  YearFromTimestamps<kNanosPerDay>(nanos, out);
+}
+
+void TransformKernels::MonthFromNanos(std::span<const int64_t> nanos,
+                                      std::span<int32_t> out) {
+  MonthFromTimestamps<kNanosPerDay>(nanos, out);
+}
+
+void TransformKernels::DayFromNanos(std::span<const int64_t> nanos,
+                                    std::span<int32_t> out) {
+  PeriodFromTimestamps<kNanosPerDay>(nanos, out);
+}
+
+void TransformKernels::HourFromNanos(std::span<const int64_t> nanos,
+                                     std::span<int32_t> out) {
+  PeriodFromTimestamps<kNanosPerHour>(nanos, out);
+}
+
+void TransformKernels::TruncateInt32(std::span<const int32_t> values, int32_t width,
+                                     std::span<int32_t> out) {
+  for (size_t i = 0; i < values.size(); ++i) {
+    out[i] = values[i] - (((values[i] % width) + width) % width);
+  }
+}
+
+void TransformKernels::TruncateInt64(std::span<const int64_t> values, int64_t width,
+                                     std::span<int64_t> out) {
+  for (size_t i = 0; i < values.size(); ++i) {
+    out[i] = values[i] - (((values[i] % width) + width) % width);
+  }
+}
+
+void TransformKernels::TruncateUTF8Lengths(std::span<const int32_t> offsets,
+                                           const uint8_t* data, int32_t width,
+                                           std::span<int32_t> out) {
+  for (size_t i = 0; i < out.size(); ++i) {
+    std::string_view value(reinterpret_cast<const char*>(data) + offsets[i],
+                           offsets[i + 1] - offsets[i]);
+    out[i] = static_cast<int32_t>(TruncateUtils::UTF8PrefixLength(value, width));
+  }
+}
+
+}  // namespace iceberg
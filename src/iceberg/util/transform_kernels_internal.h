@@ -0,0 +1,182 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+/// \file iceberg/util/transform_kernels_internal.h
+/// Kernels that apply partition transforms to arrays of values.
+///
+/// The kernels read the values of all slots, including null ones, and write one
+/// result per slot; callers are responsible for masking the results of null slots.
+
+#include <cstdint>
+#include <span>
+
+#include "iceberg/iceberg_export.h"
+
+namespace iceberg {
+
+class ICEBERG_EXPORT TransformKernels {
+ public:
+  static constexpr int64_t kMicrosPerHour = int64_t{3600} * 1000 * 1000;
+  static constexpr int64_t kMicrosPerDay = kMicrosPerHour * 24;
+  static constexpr int64_t kNanosPerHour = kMicrosPerHour * 1000;
+  static constexpr int64_t kNanosPerDay = kNanosPerHour * 24;
+
+  /// \brief Divide rounding towards negative infinity, for a positive divisor.
+  static constexpr int64_t FloorDiv(int64_t value, int64_t divisor) {
+    return value / divisor - (value % divisor < 0 ? 1 : 0);
+  }
+
+  /// \brief The year of days since the epoch, in the proleptic Gregorian calendar.
+  static constexpr int32_t YearOfDays(int64_t days) {
+    const MarchDate date = ToMarchDate(days);
+    // January and February belong to the next civil year.
+    return static_cast<int32_t>(date.year + (date.day_of_year >= 306 ? 1 : 0) +
+                                kYearShift);
+  }
+
+  /// \brief The months since 1970-01 of days since the epoch.
+  static constexpr int32_t MonthsOfDays(int64_t days) {
+    const MarchDate date = ToMarchDate(days);
+    // Months 13 and 14 of a year are months 1 and 2 of the next one, so the months
+    // since year 0 need no correction. The arithmetic wraps like int32_t.
+    return static_cast<int32_t>((date.year + kYearShift) * 12 + date.month - 1 -
+                                1970 * 12);
+  }
+
+  /// \brief Hash int32 values into `num_buckets` buckets.
+  ///
+  /// As the spec requires, the values are hashed as longs.
+  static void BucketInt32(std::span<const int32_t> values, int32_t num_buckets,
+                          std::span<int32_t> out);
+
+  /// \brief Hash int64 values into `num_buckets` buckets.
+  static void BucketInt64(std::span<const int64_t> values, int32_t num_buckets,
+                          std::span<int32_t> out);
+
+  /// \brief Hash consecutive values of `byte_width` bytes into `num_buckets` buckets.
+  static void BucketFixedSize(const uint8_t* data, int32_t byte_width,
+                              int32_t num_buckets, std::span<int32_t> out);
+
+  /// \brief Hash 16-byte little-endian decimal values into `num_buckets` buckets.
+  ///
+  /// The spec hashes the minimum number of bytes of the big-endian two's complement
+  /// representation of the unscaled value.
+  static void BucketDecimal128(const uint8_t* data, int32_t num_buckets,
+                               std::span<int32_t> out);
+
+  /// \brief Hash variable length values into `num_buckets` buckets.
+  ///
+  /// \param offsets The offsets of the values in `data`, one more than `out.size()`.
+  static void BucketBinary(std::span<const int32_t> offsets, const uint8_t* data,
+                           int32_t num_buckets, std::span<int32_t> out);
+
+  /// \brief Extract the year of dates, as days since the epoch.
+  static void YearFromDays(std::span<const int32_t> days, std::span<int32_t> out);
+
+  /// \brief Extract the year of timestamps, as microseconds since the epoch.
+  static void YearFromMicros(std::span<const int64_t> micros, std::span<int32_t> out);
+
+  /// \brief Compute the months since 1970-01 of dates, as days since the epoch.
+  static void MonthFromDays(std::span<const int32_t> days, std::span<int32_t> out);
+
+  /// \brief Compute the months since 1970-01 of timestamps, as microseconds since the
+  /// epoch.
+  static void MonthFromMicros(std::span<const int64_t> micros, std::span<int32_t> out);
+
+  /// \brief Compute the days since the epoch of timestamps, as microseconds since the
+  /// epoch.
+  static void DayFromMicros(std::span<const int64_t> micros, std::span<int32_t> out);
+
+  /// \brief Compute the hours since the epoch of timestamps, as microseconds since the
+  /// epoch.
+  static void HourFromMicros(std::span<const int64_t> micros, std::span<int32_t> out);
+
+  /// \brief Extract the year of timestamps, as nanoseconds since the epoch.
+  static void YearFromNanos(std::span<const int64_t> nanos, std::span<int32_t> out);
+
+  /// \brief Compute the months since 1970-01 of timestamps, as nanoseconds since the
+  /// epoch.
+  static void MonthFromNanos(std::span<const int64_t> nanos, std::span<int32_t> out);
+
+  /// \brief Compute the days since the epoch of timestamps, as nanoseconds since the
+  /// epoch.
+  static void DayFromNanos(std::span<const int64_t> nanos, std::span<int32_t> out);
+
+  /// \brief Compute the hours since the epoch of timestamps, as nanoseconds since the
+  /// epoch.
+  static void HourFromNanos(std::span<const int64_t> nanos, std::span<int32_t> out);
+
+  /// \brief Truncate int32 values to a multiple of `width`, rounding down.
+  static void TruncateInt32(std::span<const int32_t> values, int32_t width,
+                            std::span<int32_t> out);
+
+  /// \brief Truncate int64 values to a multiple of `width`, rounding down.
+  static void TruncateInt64(std::span<const int64_t> values, int64_t width,
+                            std::span<int64_t> out);
+
+  /// \brief Compute the length in bytes of UTF-8 strings truncated to `width` code
+  /// points.
+  ///
+  /// \param offsets The offsets of the strings in `data`, one more than `out.size()`.
+  static void TruncateUTF8Lengths(std::span<const int32_t> offsets, const uint8_t* data,
+                                  int32_t width, std::span<int32_t> out);
+
+ private:
+  /// \brief Shifts the years of MarchDate to civil years.
+  static constexpr uint32_t kYearShift = static_cast<uint32_t>(-1468000);
+
+  /// \brief A date in a calendar whose years start in March, so that leap days end them.
+  struct MarchDate {
+    /// \brief The year, minus kYearShift.
+    uint32_t year;
+    /// \brief The month, from 3 for March to 14 for February.
+    uint32_t month;
+    /// \brief Days since March 1st, from 0 to 365.
+    uint32_t day_of_year;
+  };
+
+  /// \brief Convert days since the epoch to a MarchDate with unsigned integer
+  /// multiplications and shifts only.
+  ///
+  /// This is the civil_from_days algorithm of C. Neri and L. Schneider, "Euclidean
+  /// affine functions and their application to calendar algorithms" (2022), which
+  /// std::chrono::year_month_day also uses, so the results match it exactly.
+  static constexpr MarchDate ToMarchDate(int64_t days) {
+    // Days since 1468000-03-01 BCE, so that all int32 day counts of the std::chrono
+    // year range are positive.
+    const uint32_t shifted = static_cast<uint32_t>(days) + 536895458;
+    // Centuries and the day of the century.
+    const uint32_t n1 = 4 * shifted + 3;
+    const uint32_t century = n1 / 146097;
+    const uint32_t day_of_century = n1 % 146097 / 4;
+    // Years of the century and the day of the year.
+    const uint64_t n2 = uint64_t{2939745} * (4 * day_of_century + 3);
+    const uint32_t year_of_century = static_cast<uint32_t>(n2 >> 32);
+    const uint32_t day_of_year = static_cast<uint32_t>(n2) / 2939745 / 4;
+    // The month of the day of the year.
+    const uint32_t month = (2141 * day_of_year + 197913) >> 16;
+    return {.year = 100 * century + year_of_century,
+            .month = month,
+            .day_of_year = day_of_year};
+  }
+};
+
+}  // namespace iceberg
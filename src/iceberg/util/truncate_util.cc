@@ -0,0 +1,101 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/util/truncate_util.h"
+
+#include <bit>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#  define ICEBERG_UTF8_SSE2 1
+#  include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON) && \
+    __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#  define ICEBERG_UTF8_NEON 1
+#  include <arm_neon.h>
+#endif
+
+namespace iceberg {
+
+namespace {
+
+/// \brief Returns whether a byte starts a code point, which all bytes but the
+/// continuation bytes 10xxxxxx do.
+inline bool IsLeadingByte(uint8_t byte) { return (byte & 0xC0) != 0x80; }
+
+#if defined(ICEBERG_UTF8_SSE2)
+
+constexpr int kBitsPerByte = 1;
+
+/// \brief Returns a mask with bit i * kBitsPerByte set if byte i of 16 bytes starts a
+/// code point, and no other bits set.
+inline uint64_t LeadingByteMask(const uint8_t* data) {
+  __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+  // Continuation bytes are -128 to -65 as signed bytes.
+  __m128i leading = _mm_cmpgt_epi8(bytes, _mm_set1_epi8(-65));
+  return static_cast<uint32_t>(_mm_movemask_epi8(leading));
+}
+
+#elif defined(ICEBERG_UTF8_NEON)
+
+constexpr int kBitsPerByte = 4;
+
+inline uint64_t LeadingByteMask(const uint8_t* data) {
+  int8x16_t bytes = vld1q_s8(reinterpret_cast<const int8_t*>(data));
+  uint8x16_t leading = vcgtq_s8(bytes, vdupq_n_s8(-65));
+  // Narrow each 0x00 or 0xFF byte to a nibble, and keep one bit of each nibble.
+  uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(leading), 4);
+  return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & 0x1111111111111111ULL;
+}
+
+#endif
+
+}  // namespace
+
+size_t TruncateUtils::UTF8PrefixLength(std::string_view source, size_t L) {
+  const auto* data = reinterpret_cast<const uint8_t*>(source.data());
+  const size_t size = source.size();
+  // The number of code points that may still start before the prefix ends.
+  size_t remaining = L;
+  size_t pos = 0;
+#if defined(ICEBERG_UTF8_SSE2) || defined(ICEBERG_UTF8_NEON)
+  for (; pos + 16 <= size; pos += 16) {
+    uint64_t mask = LeadingByteMask(data + pos);
+    const auto count = static_cast<size_t>(std::popcount(mask));
+    if (count > remaining) {
+      // Code point L + 1 starts in this block, after `remaining` other code points.
+      for (size_t i = 0; i < remaining; ++i) {
+        mask &= mask - 1;
+      }
+      return pos + std::countr_zero(mask) / kBitsPerByte;
+    }
+    remaining -= count;
+  }
+#endif
+  for (; pos < size; ++pos) {
+    if (IsLeadingByte(data[pos])) {
+      if (remaining == 0) {
+        return pos;
+      }
+      --remaining;
+    }
+  }
+  return size;
+}
+
+}  // namespace iceberg
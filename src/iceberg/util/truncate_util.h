@@ -19,8 +19,13 @@
 
 #pragma once
 
+#include <cstdint>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "iceberg/iceberg_export.h"
 
@@ -36,26 +41,80 @@ class ICEBERG_EXPORT TruncateUtils {
   /// If the input string is already valid and has fewer than L code points, it is
   /// returned unchanged.
   static std::string TruncateUTF8(std::string source, size_t L) {
-    size_t code_point_count = 0;
-    size_t safe_point = 0;
+    if (L > 0) {
+      source.resize(UTF8PrefixLength(source, L));
+    }
+    return source;
+  }
+
+  /// \brief Returns the length in bytes of the longest prefix of a UTF-8 string with at
+  /// most L code points.
+  ///
+  /// Code point boundaries are found 16 bytes at a time with SSE2 or NEON where they
+  /// are available.
+  static size_t UTF8PrefixLength(std::string_view source, size_t L);
 
-    for (size_t i = 0; i < source.size(); ++i) {
-      // Start of a new UTF-8 code point
-      if ((source[i] & 0xC0) != 0x80) {
-        code_point_count++;
-        if (code_point_count > static_cast<size_t>(L)) {
-          safe_point = i;
-          break;
-        }
+  /// \brief Truncate a UTF-8 string to a string of at most L code points that is
+  /// greater than or equal to it, for use as an upper bound.
+  ///
+  /// The last code point of the truncated string that can be incremented is
+  /// incremented and the code points after it are removed.
+  ///
+  /// \return The truncated string, or std::nullopt if no code point can be incremented.
+  static std::optional<std::string> TruncateUTF8Max(std::string source, size_t L) {
+    auto truncated = TruncateUTF8(source, L);
+    if (truncated.size() == source.size()) {
+      return truncated;
+    }
+
+    size_t end = truncated.size();
+    while (end > 0) {
+      size_t start = end - 1;
+      while (start > 0 && (static_cast<uint8_t>(truncated[start]) & 0xC0) == 0x80) {
+        --start;
+      }
+      uint32_t code_point =
+          DecodeUTF8(std::string_view(truncated).substr(start, end - start));
+      uint32_t next_code_point = code_point + 1;
+      if (next_code_point >= 0xD800 && next_code_point <= 0xDFFF) {
+        // Skip the surrogates, which are not valid code points in UTF-8
+        next_code_point = 0xE000;
       }
+      if (next_code_point <= 0x10FFFF) {
+        truncated.resize(start);
+        AppendUTF8(next_code_point, &truncated);
+        return truncated;
+      }
+      end = start;
     }
+    return std::nullopt;
+  }
 
-    if (safe_point != 0) {
-      // Resize the string to the safe point
-      source.resize(safe_point);
+  /// \brief Truncate a binary value to L bytes.
+  static std::vector<uint8_t> TruncateBinary(std::vector<uint8_t> source, size_t L) {
+    if (source.size() > L) {
+      source.resize(L);
     }
+    return source;
+  }
 
-    return std::move(source);
+  /// \brief Truncate a binary value to a value of at most L bytes that is greater than
+  /// or equal to it, for use as an upper bound.
+  ///
+  /// \return The truncated value, or std::nullopt if all of the first L bytes are 0xFF.
+  static std::optional<std::vector<uint8_t>> TruncateBinaryMax(
+      std::vector<uint8_t> source, size_t L) {
+    if (source.size() <= L) {
+      return source;
+    }
+    for (size_t i = L; i > 0; --i) {
+      if (source[i - 1] != 0xFF) {
+        ++source[i - 1];
+        source.resize(i);
+        return source;
+      }
+    }
+    return std::nullopt;
   }
 
   /// \brief Truncate an integer v, either int32_t or int64_t, to v - (v % W).
@@ -64,9 +123,40 @@ class ICEBERG_EXPORT TruncateUtils {
   /// values, the correct truncate function is: v - (((v % W) + W) % W)
   template <typename T>
     requires std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>
-  static inline T TruncateInteger(T v, size_t W) {
+  static inline T TruncateInteger(T v, std::type_identity_t<T> W) {
     return v - (((v % W) + W) % W);
   }
+
+ private:
+  static uint32_t DecodeUTF8(std::string_view bytes) {
+    auto lead = static_cast<uint8_t>(bytes[0]);
+    uint32_t code_point = lead < 0x80   ? lead
+                          : lead < 0xE0 ? lead & 0x1F
+                          : lead < 0xF0 ? lead & 0x0F
+                                        : lead & 0x07;
+    for (size_t i = 1; i < bytes.size(); ++i) {
+      code_point = (code_point << 6) | (static_cast<uint8_t>(bytes[i]) & 0x3F);
+    }
+    return code_point;
+  }
+
+  static void AppendUTF8(uint32_t code_point, std::string* out) {
+    if (code_point < 0x80) {
+      out->push_back(static_cast<char>(code_point));
+    } else if (code_point < 0x800) {
+      out->push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+      out->push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else if (code_point < 0x10000) {
+      out->push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+      out->push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+      out->push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else {
+      out->push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+      out->push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+      out->push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+      out->push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+  }
 };
 
 }  // namespace iceberg
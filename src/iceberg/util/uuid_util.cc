@@ -0,0 +1,54 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/util/uuid_util.h"
+
+#include <array>
+#include <cstdint>
+#include <random>
+
+namespace iceberg {
+
+std::string UuidUtils::GenerateV4() {
+  thread_local std::mt19937_64 generator{std::random_device{}()};
+  std::array<uint8_t, 16> bytes;
+  for (size_t i = 0; i < bytes.size(); i += 8) {
+    uint64_t bits = generator();
+    for (size_t j = 0; j < 8; ++j) {
+      bytes[i + j] = static_cast<uint8_t>(bits >> (8 * j));
+    }
+  }
+  // Set the version to 4 and the variant to RFC 4122.
+  bytes[6] = static_cast<uint8_t>((bytes[6] & 0x0F) | 0x40);
+  bytes[8] = static_cast<uint8_t>((bytes[8] & 0x3F) | 0x80);
+
+  constexpr char kHexDigits[] = "0123456789abcdef";
+  std::string uuid;
+  uuid.reserve(36);
+  for (size_t i = 0; i < bytes.size(); ++i) {
+    if (i == 4 || i == 6 || i == 8 || i == 10) {
+      uuid.push_back('-');
+    }
+    uuid.push_back(kHexDigits[bytes[i] >> 4]);
+    uuid.push_back(kHexDigits[bytes[i] & 0x0F]);
+  }
+  return uuid;
+}
+
+}  // namespace iceberg
@@ -0,0 +1,730 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/v2_metadata.h"
+
+#include <array>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include <nanoarrow/nanoarrow.h>
+
+#include "iceberg/file_format.h"
+#include "iceberg/nanoarrow_error_transform_internal.h"
+#include "iceberg/schema.h"
+#include "iceberg/schema_internal.h"
+#include "iceberg/table_metadata.h"
+#include "iceberg/type.h"
+#include "iceberg/util/checked_cast.h"
+#include "iceberg/util/macros.h"
+
+namespace iceberg {
+
+namespace {
+
+/// \brief Complete `length` rows whose values have been written to the buffers of
+/// `array`. As in nanoarrow, the validity bitmap is only allocated once a null appears.
+template <typename IsValid>
+Status FinishRows(ArrowArray* array, int64_t length, int64_t null_count,
+                  IsValid&& is_valid) {
+  ArrowBitmap* validity = ArrowArrayValidityBitmap(array);
+  if (null_count > 0 && validity->size_bits == 0 && array->length > 0) {
+    ICEBERG_NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(validity, 1, array->length));
+  }
+  if (null_count > 0 || validity->size_bits > 0) {
+    ICEBERG_NANOARROW_RETURN_NOT_OK(ArrowBitmapReserve(validity, length));
+    for (int64_t i = 0; i < length; ++i) {
+      ArrowBitmapAppendUnsafe(validity, is_valid(i) ? 1 : 0, 1);
+    }
+  }
+  array->length += length;
+  array->null_count += null_count;
+  return {};
+}
+
+/// \brief Append `length` values of a fixed-width type, where `get(i)` returns the
+/// optional value of row i.
+template <typename T, typename Get>
+Status AppendValues(ArrowArray* array, int64_t length, Get&& get) {
+  ArrowBuffer* values = ArrowArrayBuffer(array, 1);
+  ICEBERG_NANOARROW_RETURN_NOT_OK(
+      ArrowBufferReserve(values, length * static_cast<int64_t>(sizeof(T))));
+  int64_t null_count = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    std::optional<T> value = get(i);
+    T raw = value.value_or(T{});
+    ArrowBufferAppendUnsafe(values, &raw, sizeof(T));
+    null_count += value.has_value() ? 0 : 1;
+  }
+  return FinishRows(array, length, null_count,
+                    [&](int64_t i) { return get(i).has_value(); });
+}
+
+/// \brief Append `length` booleans, which are bit-packed and rare enough in manifests
+/// to be appended one at a time.
+template <typename Get>
+Status AppendBooleans(ArrowArray* array, int64_t length, Get&& get) {
+  for (int64_t i = 0; i < length; ++i) {
+    std::optional<bool> value = get(i);
+    if (value.has_value()) {
+      ICEBERG_NANOARROW_RETURN_NOT_OK(ArrowArrayAppendInt(array, *value ? 1 : 0));
+    } else {
+      ICEBERG_NANOARROW_RETURN_NOT_OK(ArrowArrayAppendNull(array, 1));
+    }
+  }
+  return {};
+}
+
+/// \brief Append `length` strings or binaries, where `get(i)` returns the optional
+/// bytes of row i. The data buffer is reserved once for all rows.
+template <typename Get>
+Status AppendBinaries(ArrowArray* array, int64_t length, Get&& get) {
+  ArrowBuffer* offsets = ArrowArrayBuffer(array, 1);
+  ArrowBuffer* data = ArrowArrayBuffer(array, 2);
+  int64_t total_bytes = 0;
+  int64_t null_count = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    std::optional<std::string_view> value = get(i);
+    if (value.has_value()) {
+      total_bytes += static_cast<int64_t>(value->size());
+    } else {
+      ++null_count;
+    }
+  }
+  if (data->size_bytes + total_bytes > std::numeric_limits<int32_t>::max()) {
+    return InvalidArrowData("Binary column of {} bytes overflows int32 offsets",
+                            data->size_bytes + total_bytes);
+  }
+  ICEBERG_NANOARROW_RETURN_NOT_OK(
+      ArrowBufferReserve(offsets, length * static_cast<int64_t>(sizeof(int32_t))));
+  ICEBERG_NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(data, total_bytes));
+  auto offset = static_cast<int32_t>(data->size_bytes);
+  for (int64_t i = 0; i < length; ++i) {
+    std::optional<std::string_view> value = get(i);
+    if (value.has_value()) {
+      ArrowBufferAppendUnsafe(data, value->data(), static_cast<int64_t>(value->size()));
+      offset += static_cast<int32_t>(value->size());
+    }
+    ArrowBufferAppendUnsafe(offsets, &offset, sizeof(offset));
+  }
+  return FinishRows(array, length, null_count,
+                    [&](int64_t i) { return get(i).has_value(); });
+}
+
+std::optional<std::string_view> BytesOf(const std::vector<uint8_t>& bytes) {
+  return std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+}
+
+/// \brief Append the list offsets of `length` rows, where `size(i)` returns the number
+/// of elements of row i, and an empty list is written as null.
+template <typename Size>
+Status AppendListOffsets(ArrowArray* array, int64_t length, Size&& size) {
+  ArrowBuffer* offsets = ArrowArrayBuffer(array, 1);
+  ICEBERG_NANOARROW_RETURN_NOT_OK(
+      ArrowBufferReserve(offsets, length * static_cast<int64_t>(sizeof(int32_t))));
+  auto offset = static_cast<int32_t>(array->children[0]->length);
+  int64_t null_count = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    auto elements = static_cast<int32_t>(size(i));
+    offset += elements;
+    null_count += elements == 0 ? 1 : 0;
+    ArrowBufferAppendUnsafe(offsets, &offset, sizeof(offset));
+  }
+  return FinishRows(array, length, null_count, [&](int64_t i) { return size(i) > 0; });
+}
+
+/// \brief Append `length` lists of fixed-width values, copying the elements of each row
+/// at once.
+template <typename T, typename Get>
+Status AppendLists(ArrowArray* array, int64_t length, Get&& get) {
+  ArrowArray* elements = array->children[0];
+  int64_t total = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    total += static_cast<int64_t>(get(i).size());
+  }
+  ArrowBuffer* values = ArrowArrayBuffer(elements, 1);
+  ICEBERG_NANOARROW_RETURN_NOT_OK(
+      ArrowBufferReserve(values, total * static_cast<int64_t>(sizeof(T))));
+  ICEBERG_RETURN_UNEXPECTED(
+      AppendListOffsets(array, length, [&](int64_t i) { return get(i).size(); }));
+  for (int64_t i = 0; i < length; ++i) {
+    const std::vector<T>& list = get(i);
+    ArrowBufferAppendUnsafe(values, list.data(),
+                            static_cast<int64_t>(list.size() * sizeof(T)));
+  }
+  elements->length += total;
+  return {};
+}
+
+/// \brief Append `length` maps keyed by field id, such as the column metrics of data
+/// files. The keys and values of all rows are appended as one column each.
+template <typename V, typename Get>
+Status AppendFieldIdMaps(ArrowArray* array, int64_t length, Get&& get) {
+  ArrowArray* entries = array->children[0];
+  std::vector<int32_t> keys;
+  std::vector<const V*> values;
+  for (int64_t i = 0; i < length; ++i) {
+    for (const auto& [key, value] : get(i)) {
+      keys.push_back(key);
+      values.push_back(&value);
+    }
+  }
+  ICEBERG_RETURN_UNEXPECTED(
+      AppendListOffsets(array, length, [&](int64_t i) { return get(i).size(); }));
+  auto num_entries = static_cast<int64_t>(keys.size());
+  ICEBERG_RETURN_UNEXPECTED(
+      AppendValues<int32_t>(entries->children[0], num_entries,
+                            [&](int64_t i) { return std::optional<int32_t>(keys[i]); }));
+  if constexpr (std::is_same_v<V, int64_t>) {
+    ICEBERG_RETURN_UNEXPECTED(AppendValues<int64_t>(
+        entries->children[1], num_entries,
+        [&](int64_t i) -> std::optional<int64_t> { return *values[i]; }));
+  } else {
+    ICEBERG_RETURN_UNEXPECTED(
+        AppendBinaries(entries->children[1], num_entries,
+                       [&](int64_t i) { return BytesOf(*values[i]); }));
+  }
+  entries->length += num_entries;
+  return {};
+}
+
+/// \brief Append one partition value to the array of its partition field.
+Status AppendLiteral(ArrowArray* array, const Literal& literal) {
+  if (literal.IsNull()) {
+    ICEBERG_NANOARROW_RETURN_NOT_OK(ArrowArrayAppendNull(array, 1));
+    return {};
+  }
+  if (literal.type()->type_id() == TypeId::kDecimal) {
+    return NotImplemented("Writing decimal partition values is not supported");
+  }
+  return std::visit(
+      [&](const auto& value) -> Status {
+        using T = std::decay_t<decltype(value)>;
+        if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, int32_t> ||
+                      std::is_same_v<T, int64_t>) {
+          ICEBERG_NANOARROW_RETURN_NOT_OK(
+              ArrowArrayAppendInt(array, static_cast<int64_t>(value)));
+        } else if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+          ICEBERG_NANOARROW_RETURN_NOT_OK(
+              ArrowArrayAppendDouble(array, static_cast<double>(value)));
+        } else if constexpr (std::is_same_v<T, std::string>) {
+          ICEBERG_NANOARROW_RETURN_NOT_OK(ArrowArrayAppendString(
+              array, {value.data(), static_cast<int64_t>(value.size())}));
+        } else if constexpr (std::is_same_v<T, std::vector<uint8_t>> ||
+                             std::is_same_v<T, std::array<uint8_t, 16>>) {
+          ArrowBufferView bytes;
+          bytes.data.as_uint8 = value.data();
+          bytes.size_bytes = static_cast<int64_t>(value.size());
+          ICEBERG_NANOARROW_RETURN_NOT_OK(ArrowArrayAppendBytes(array, bytes));
+        } else {
+          return InvalidManifest("Invalid partition value {}", literal.ToString());
+        }
+        return {};
+      },
+      literal.value());
+}
+
+/// \brief Init `array` from `schema` and build it with `build`, which appends `length`
+/// rows to each top-level column. `array` is released if building fails.
+template <typename Build>
+Status BuildBatch(const ArrowSchema& schema, int64_t length, ArrowArray* array,
+                  Build&& build) {
+  ArrowError error;
+  if (ArrowArrayInitFromSchema(array, &schema, &error) != NANOARROW_OK) {
+    return InvalidArrowData("Failed to init array from schema: {}", error.message);
+  }
+  auto status = [&]() -> Status {
+    ICEBERG_NANOARROW_RETURN_NOT_OK(ArrowArrayStartAppending(array));
+    ICEBERG_NANOARROW_RETURN_NOT_OK(ArrowArrayReserve(array, length));
+    ICEBERG_RETURN_UNEXPECTED(build(array));
+    array->length = length;
+    if (ArrowArrayFinishBuildingDefault(array, &error) != NANOARROW_OK) {
+      return InvalidArrowData("Failed to finish building array: {}", error.message);
+    }
+    return {};
+  }();
+  if (!status.has_value()) {
+    ArrowArrayRelease(array);
+    *array = ArrowArray{};
+  }
+  return status;
+}
+
+const StructType& StructOf(const SchemaField& field) {
+  return internal::checked_cast<const StructType&>(*field.type());
+}
+
+/// \brief Append the partition tuples of `length` data files, one partition field at
+/// a time.
+template <typename Get>
+Status AppendPartitions(ArrowArray* array, const StructType& partition_type,
+                        int64_t length, Get&& get) {
+  auto num_fields = static_cast<int64_t>(partition_type.fields().size());
+  for (int64_t i = 0; i < length; ++i) {
+    if (static_cast<int64_t>(get(i).size()) != num_fields) {
+      return InvalidManifest("Expected {} partition values but got {}", num_fields,
+                             get(i).size());
+    }
+  }
+  for (int64_t field = 0; field < num_fields; ++field) {
+    for (int64_t i = 0; i < length; ++i) {
+      ICEBERG_RETURN_UNEXPECTED(AppendLiteral(array->children[field], get(i)[field]));
+    }
+  }
+  array->length += length;
+  return {};
+}
+
+Status AppendDataFiles(ArrowArray* array, const StructType& type, int8_t format_version,
+                       const std::vector<ManifestEntry>& entries) {
+  auto length = static_cast<int64_t>(entries.size());
+  auto file = [&](int64_t i) -> const DataFile& { return *entries[i].data_file; };
+  const auto fields = type.fields();
+  for (size_t idx = 0; idx < fields.size(); ++idx) {
+    ArrowArray* column = array->children[idx];
+    const SchemaField& field = fields[idx];
+    switch (field.field_id()) {
+      case 134:
+        ICEBERG_RETURN_UNEXPECTED(AppendValues<int32_t>(
+            column, length, [&](int64_t i) -> std::optional<int32_t> {
+              return static_cast<int32_t>(file(i).content);
+            }));
+        break;
+      case 100:
+        ICEBERG_RETURN_UNEXPECTED(AppendBinaries(
+            column, length, [&](int64_t i) -> std::optional<std::string_view> {
+              return file(i).file_path;
+            }));
+        break;
+      case 101:
+        ICEBERG_RETURN_UNEXPECTED(AppendBinaries(
+            column, length, [&](int64_t i) -> std::optional<std::string_view> {
+              return ToString(file(i).file_format);
+            }));
+        break;
+      case 102:
+        ICEBERG_RETURN_UNEXPECTED(
+            AppendPartitions(column, StructOf(field), length,
+                             [&](int64_t i) -> const std::vector<Literal>& {
+                               return file(i).partition;
+                             }));
+        break;
+      case 103:
+        ICEBERG_RETURN_UNEXPECTED(AppendValues<int64_t>(
+            column, length,
+            [&](int64_t i) -> std::optional<int64_t> { return file(i).record_count; }));
+        break;
+      case 104:
+        ICEBERG_RETURN_UNEXPECTED(AppendValues<int64_t>(
+            column, length, [&](int64_t i) -> std::optional<int64_t> {
+              return file(i).file_size_in_bytes;
+            }));
+        break;
+      case 108:
+        ICEBERG_RETURN_UNEXPECTED(AppendFieldIdMaps<int64_t>(
+            column, length,
+            [&](int64_t i) -> const auto& { return file(i).column_sizes; }));
+        break;
+      case 109:
+        ICEBERG_RETURN_UNEXPECTED(AppendFieldIdMaps<int64_t>(
+            column, length,
+            [&](int64_t i) -> const auto& { return file(i).value_counts; }));
+        break;
+      case 110:
+        ICEBERG_RETURN_UNEXPECTED(AppendFieldIdMaps<int64_t>(
+            column, length,
+            [&](int64_t i) -> const auto& { return file(i).null_value_counts; }));
+        break;
+      case 137:
+        ICEBERG_RETURN_UNEXPECTED(AppendFieldIdMaps<int64_t>(
+            column, length,
+            [&](int64_t i) -> const auto& { return file(i).nan_value_counts; }));
+        break;
+      case 125:
+        ICEBERG_RETURN_UNEXPECTED(AppendFieldIdMaps<std::vector<uint8_t>>(
+            column, length,
+            [&](int64_t i) -> const auto& { return file(i).lower_bounds; }));
+        break;
+      case 128:
+        ICEBERG_RETURN_UNEXPECTED(AppendFieldIdMaps<std::vector<uint8_t>>(
+            column, length,
+            [&](int64_t i) -> const auto& { return file(i).upper_bounds; }));
+        break;
+      case 131:
+        ICEBERG_RETURN_UNEXPECTED(AppendBinaries(
+            column, length, [&](int64_t i) -> std::optional<std::string_view> {
+              const auto& key_metadata = file(i).key_metadata;
+              return key_metadata.empty() ? std::nullopt : BytesOf(key_metadata);
+            }));
+        break;
+      case 132:
+        ICEBERG_RETURN_UNEXPECTED(AppendLists<int64_t>(
+            column, length,
+            [&](int64_t i) -> const auto& { return file(i).split_offsets; }));
+        break;
+      case 135:
+        ICEBERG_RETURN_UNEXPECTED(AppendLists<int32_t>(
+            column, length,
+            [&](int64_t i) -> const auto& { return file(i).equality_ids; }));
+        break;
+      case 140:
+        ICEBERG_RETURN_UNEXPECTED(AppendValues<int32_t>(
+            column, length, [&](int64_t i) { return file(i).sort_order_id; }));
+        break;
+      case 142:
+        ICEBERG_RETURN_UNEXPECTED(AppendValues<int64_t>(
+            column, length, [&](int64_t i) -> std::optional<int64_t> {
+              return format_version >= 3 ? file(i).first_row_id : std::nullopt;
+            }));
+        break;
+      case 143:
+        ICEBERG_RETURN_UNEXPECTED(AppendBinaries(
+            column, length, [&](int64_t i) -> std::optional<std::string_view> {
+              return file(i).referenced_data_file;
+            }));
+        break;
+      case 144:
+        ICEBERG_RETURN_UNEXPECTED(AppendValues<int64_t>(
+            column, length, [&](int64_t i) -> std::optional<int64_t> {
+              return format_version >= 3 ? file(i).content_offset : std::nullopt;
+            }));
+        break;
+      case 145:
+        ICEBERG_RETURN_UNEXPECTED(AppendValues<int64_t>(
+            column, length, [&](int64_t i) -> std::optional<int64_t> {
+              return format_version >= 3 ? file(i).content_size_in_bytes : std::nullopt;
+            }));
+        break;
+      default:
+        if (!field.optional()) {
+          return InvalidManifest("Unknown required data file field {}", field.name());
+        }
+        ICEBERG_NANOARROW_RETURN_NOT_OK(ArrowArrayAppendNull(column, length));
+        break;
+    }
+  }
+  array->length += length;
+  return {};
+}
+
+Status AppendPartitionSummaries(ArrowArray* array,
+                                const std::vector<ManifestFile>& files) {
+  std::vector<const PartitionFieldSummary*> summaries;
+  for (const auto& file : files) {
+    for (const auto& summary : file.partitions) {
+      summaries.push_back(&summary);
+    }
+  }
+  ICEBERG_RETURN_UNEXPECTED(
+      AppendListOffsets(array, static_cast<int64_t>(files.size()),
+                        [&](int64_t i) { return files[i].partitions.size(); }));
+  ArrowArray* elements = array->children[0];
+  auto length = static_cast<int64_t>(summaries.size());
+  ICEBERG_RETURN_UNEXPECTED(
+      AppendBooleans(elements->children[0], length, [&](int64_t i) {
+        return std::optional<bool>(summaries[i]->contains_null);
+      }));
+  ICEBERG_RETURN_UNEXPECTED(
+      AppendBooleans(elements->children[1], length,
+                     [&](int64_t i) { return summaries[i]->contains_nan; }));
+  ICEBERG_RETURN_UNEXPECTED(AppendBinaries(
+      elements->children[2], length, [&](int64_t i) -> std::optional<std::string_view> {
+        const auto& bound = summaries[i]->lower_bound;
+        return bound.has_value() ? BytesOf(*bound) : std::nullopt;
+      }));
+  ICEBERG_RETURN_UNEXPECTED(AppendBinaries(
+      elements->children[3], length, [&](int64_t i) -> std::optional<std::string_view> {
+        const auto& bound = summaries[i]->upper_bound;
+        return bound.has_value() ? BytesOf(*bound) : std::nullopt;
+      }));
+  elements->length += length;
+  return {};
+}
+
+template <typename Int>
+std::optional<Int> OptionalOf(Int value) {
+  return value;
+}
+
+}  // namespace
+
+ManifestEntryAdapterV2::ManifestEntryAdapterV2(std::optional<int64_t> snapshot_id,
+                                               std::shared_ptr<Schema> schema)
+    : ManifestEntryAdapterV2(/*format_version=*/2, snapshot_id, std::move(schema)) {}
+
+ManifestEntryAdapterV2::ManifestEntryAdapterV2(int8_t format_version,
+                                               std::optional<int64_t> snapshot_id,
+                                               std::shared_ptr<Schema> schema)
+    : format_version_(format_version),
+      snapshot_id_(snapshot_id),
+      manifest_schema_(std::move(schema)) {}
+
+ManifestEntryAdapterV2::~ManifestEntryAdapterV2() {
+  if (schema_.release != nullptr) {
+    schema_.release(&schema_);
+  }
+}
+
+Status ManifestEntryAdapterV2::StartAppending() {
+  if (schema_.release == nullptr) {
+    ICEBERG_RETURN_UNEXPECTED(ToArrowSchema(*manifest_schema_, &schema_));
+  }
+  entries_.clear();
+  entries_.reserve(kBatchSize);
+  size_ = 0;
+  return {};
+}
+
+Status ManifestEntryAdapterV2::Append(const ManifestEntry& entry) {
+  if (entry.data_file == nullptr) {
+    return InvalidManifest("Manifest entry has no data file");
+  }
+  if (!entry.sequence_number.has_value() || !entry.file_sequence_number.has_value()) {
+    // Unassigned sequence numbers are inherited from the snapshot that adds the entry.
+    // Entries without a snapshot id inherit it as well.
+    if (snapshot_id_.has_value() && entry.snapshot_id.has_value() &&
+        *entry.snapshot_id != *snapshot_id_) {
+      return InvalidManifest(
+          "Found unassigned sequence number for an entry from snapshot {}",
+          entry.snapshot_id.value_or(-1));
+    }
+    if (entry.status != ManifestStatus::kAdded) {
+      return InvalidManifest(
+          "Only entries with status ADDED can have unassigned sequence numbers");
+    }
+  }
+  entries_.push_back(entry);
+  ++size_;
+  return {};
+}
+
+Result<ArrowArray> ManifestEntryAdapterV2::FinishAppending() {
+  if (schema_.release == nullptr) {
+    return InvalidArgument("StartAppending must be called before FinishAppending");
+  }
+  auto length = static_cast<int64_t>(entries_.size());
+  ICEBERG_RETURN_UNEXPECTED(
+      BuildBatch(schema_, length, &array_, [&](ArrowArray* root) -> Status {
+        const auto fields = manifest_schema_->fields();
+        for (size_t idx = 0; idx < fields.size(); ++idx) {
+          ArrowArray* column = root->children[idx];
+          const SchemaField& field = fields[idx];
+          switch (field.field_id()) {
+            case 0:
+              ICEBERG_RETURN_UNEXPECTED(AppendValues<int32_t>(
+                  column, length, [&](int64_t i) -> std::optional<int32_t> {
+                    return static_cast<int32_t>(entries_[i].status);
+                  }));
+              break;
+            case 1:
+              ICEBERG_RETURN_UNEXPECTED(AppendValues<int64_t>(
+                  column, length, [&](int64_t i) { return entries_[i].snapshot_id; }));
+              break;
+            case 2:
+              ICEBERG_RETURN_UNEXPECTED(
+                  AppendDataFiles(column, StructOf(field), format_version_, entries_));
+              break;
+            case 3:
+              ICEBERG_RETURN_UNEXPECTED(AppendValues<int64_t>(
+                  column, length,
+                  [&](int64_t i) { return entries_[i].sequence_number; }));
+              break;
+            case 4:
+              ICEBERG_RETURN_UNEXPECTED(AppendValues<int64_t>(
+                  column, length,
+                  [&](int64_t i) { return entries_[i].file_sequence_number; }));
+              break;
+            default:
+              return InvalidManifest("Unknown manifest entry field {}", field.name());
+          }
+        }
+        return {};
+      }));
+  entries_.clear();
+  size_ = 0;
+  return std::exchange(array_, ArrowArray{});
+}
+
+ManifestFileAdapterV2::ManifestFileAdapterV2(int64_t snapshot_id,
+                                             std::optional<int64_t> parent_snapshot_id,
+                                             int64_t sequence_number,
+                                             std::shared_ptr<Schema> schema)
+    : ManifestFileAdapterV2(/*format_version=*/2, snapshot_id, parent_snapshot_id,
+                            sequence_number, std::move(schema)) {}
+
+ManifestFileAdapterV2::ManifestFileAdapterV2(
+    int8_t format_version, int64_t snapshot_id,
+    std::optional<int64_t> /*parent_snapshot_id*/, int64_t sequence_number,
+    std::shared_ptr<Schema> schema)
+    : format_version_(format_version),
+      snapshot_id_(snapshot_id),
+      sequence_number_(sequence_number),
+      manifest_list_schema_(std::move(schema)) {}
+
+ManifestFileAdapterV2::~ManifestFileAdapterV2() {
+  if (schema_.release != nullptr) {
+    schema_.release(&schema_);
+  }
+}
+
+Status ManifestFileAdapterV2::StartAppending() {
+  if (schema_.release == nullptr) {
+    ICEBERG_RETURN_UNEXPECTED(ToArrowSchema(*manifest_list_schema_, &schema_));
+  }
+  files_.clear();
+  files_.reserve(kBatchSize);
+  size_ = 0;
+  return {};
+}
+
+Status ManifestFileAdapterV2::Append(const ManifestFile& file) {
+  const bool unassigned =
+      file.sequence_number == TableMetadata::kInvalidSequenceNumber ||
+      file.min_sequence_number == TableMetadata::kInvalidSequenceNumber;
+  if (unassigned && file.added_snapshot_id != snapshot_id_) {
+    return InvalidManifestList(
+        "Found unassigned sequence number for a manifest from snapshot {}",
+        file.added_snapshot_id);
+  }
+  files_.push_back(file);
+  // Manifests added by this snapshot get its sequence number.
+  if (files_.back().sequence_number == TableMetadata::kInvalidSequenceNumber) {
+    files_.back().sequence_number = sequence_number_;
+  }
+  if (files_.back().min_sequence_number == TableMetadata::kInvalidSequenceNumber) {
+    files_.back().min_sequence_number = sequence_number_;
+  }
+  ++size_;
+  return {};
+}
+
+Result<ArrowArray> ManifestFileAdapterV2::FinishAppending() {
+  if (schema_.release == nullptr) {
+    return InvalidArgument("StartAppending must be called before FinishAppending");
+  }
+  auto length = static_cast<int64_t>(files_.size());
+  ICEBERG_RETURN_UNEXPECTED(
+      BuildBatch(schema_, length, &array_, [&](ArrowArray* root) -> Status {
+        const auto fields = manifest_list_schema_->fields();
+        for (size_t idx = 0; idx < fields.size(); ++idx) {
+          ArrowArray* column = root->children[idx];
+          const SchemaField& field = fields[idx];
+          switch (field.field_id()) {
+            case 500:
+              ICEBERG_RETURN_UNEXPECTED(AppendBinaries(
+                  column, length, [&](int64_t i) -> std::optional<std::string_view> {
+                    return files_[i].manifest_path;
+                  }));
+              break;
+            case 501:
+              ICEBERG_RETURN_UNEXPECTED(AppendValues<int64_t>(
+                  column, length,
+                  [&](int64_t i) { return OptionalOf(files_[i].manifest_length); }));
+              break;
+            case 502:
+              ICEBERG_RETURN_UNEXPECTED(AppendValues<int32_t>(
+                  column, length,
+                  [&](int64_t i) { return OptionalOf(files_[i].partition_spec_id); }));
+              break;
+            case 517:
+              ICEBERG_RETURN_UNEXPECTED(AppendValues<int32_t>(
+                  column, length, [&](int64_t i) {
+                    return OptionalOf(static_cast<int32_t>(files_[i].content));
+                  }));
+              break;
+            case 515:
+              ICEBERG_RETURN_UNEXPECTED(AppendValues<int64_t>(
+                  column, length,
+                  [&](int64_t i) { return OptionalOf(files_[i].sequence_number); }));
+              break;
+            case 516:
+              ICEBERG_RETURN_UNEXPECTED(AppendValues<int64_t>(
+                  column, length,
+                  [&](int64_t i) { return OptionalOf(files_[i].min_sequence_number); }));
+              break;
+            case 503:
+              ICEBERG_RETURN_UNEXPECTED(AppendValues<int64_t>(
+                  column, length,
+                  [&](int64_t i) { return OptionalOf(files_[i].added_snapshot_id); }));
+              break;
+            case 504:
+              ICEBERG_RETURN_UNEXPECTED(AppendValues<int32_t>(
+                  column, length,
+                  [&](int64_t i) { return files_[i].added_files_count; }));
+              break;
+            case 505:
+              ICEBERG_RETURN_UNEXPECTED(AppendValues<int32_t>(
+                  column, length,
+                  [&](int64_t i) { return files_[i].existing_files_count; }));
+              break;
+            case 506:
+              ICEBERG_RETURN_UNEXPECTED(AppendValues<int32_t>(
+                  column, length,
+                  [&](int64_t i) { return files_[i].deleted_files_count; }));
+              break;
+            case 512:
+              ICEBERG_RETURN_UNEXPECTED(AppendValues<int64_t>(
+                  column, length, [&](int64_t i) { return files_[i].added_rows_count; }));
+              break;
+            case 513:
+              ICEBERG_RETURN_UNEXPECTED(AppendValues<int64_t>(
+                  column, length,
+                  [&](int64_t i) { return files_[i].existing_rows_count; }));
+              break;
+            case 514:
+              ICEBERG_RETURN_UNEXPECTED(AppendValues<int64_t>(
+                  column, length,
+                  [&](int64_t i) { return files_[i].deleted_rows_count; }));
+              break;
+            case 507:
+              ICEBERG_RETURN_UNEXPECTED(AppendPartitionSummaries(column, files_));
+              break;
+            case 519:
+              ICEBERG_RETURN_UNEXPECTED(AppendBinaries(
+                  column, length, [&](int64_t i) -> std::optional<std::string_view> {
+                    const auto& key_metadata = files_[i].key_metadata;
+                    return key_metadata.empty() ? std::nullopt : BytesOf(key_metadata);
+                  }));
+              break;
+            case 520:
+              ICEBERG_RETURN_UNEXPECTED(AppendValues<int64_t>(
+                  column, length, [&](int64_t i) -> std::optional<int64_t> {
+                    return format_version_ >= 3 ? files_[i].first_row_id : std::nullopt;
+                  }));
+              break;
+            default:
+              if (!field.optional()) {
+                return InvalidManifestList("Unknown required manifest file field {}",
+                                           field.name());
+              }
+              ICEBERG_NANOARROW_RETURN_NOT_OK(ArrowArrayAppendNull(column, length));
+              break;
+          }
+        }
+        return {};
+      }));
+  files_.clear();
+  size_ = 0;
+  return std::exchange(array_, ArrowArray{});
+}
+
+}  // namespace iceberg
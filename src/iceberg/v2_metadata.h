@@ -22,41 +22,81 @@
 /// \file iceberg/v2_metadata.h
 
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include "iceberg/manifest_adapter.h"
+#include "iceberg/manifest_entry.h"
+#include "iceberg/manifest_list.h"
 
 namespace iceberg {
 
 /// \brief Adapter to convert V2 ManifestEntry to `ArrowArray`.
-class ManifestEntryAdapterV2 : public ManifestEntryAdapter {
+///
+/// Entries are buffered by Append, and FinishAppending builds each column of the batch
+/// in one pass over the entries, into buffers reserved for the whole batch.
+class ICEBERG_EXPORT ManifestEntryAdapterV2 : public ManifestEntryAdapter {
  public:
+  /// \param snapshot_id The id of the snapshot that writes the manifest.
+  /// \param schema The manifest entry schema to write.
   ManifestEntryAdapterV2(std::optional<int64_t> snapshot_id,
-                         std::shared_ptr<Schema> schema) {
-    // TODO(xiao.dong): init v2 schema
-  }
-  Status StartAppending() override { return {}; }
-  Status Append(const ManifestEntry& entry) override { return {}; }
-  Result<ArrowArray> FinishAppending() override { return {}; }
+                         std::shared_ptr<Schema> schema);
+  ~ManifestEntryAdapterV2() override;
+
+  Status StartAppending() override;
+  /// \brief Append an entry. Entries may only leave their sequence numbers to be
+  /// inherited if they are added by the snapshot of the manifest.
+  Status Append(const ManifestEntry& entry) override;
+  Result<ArrowArray> FinishAppending() override;
+
+ protected:
+  ManifestEntryAdapterV2(int8_t format_version, std::optional<int64_t> snapshot_id,
+                         std::shared_ptr<Schema> schema);
 
  private:
+  int8_t format_version_;
+  std::optional<int64_t> snapshot_id_;
   std::shared_ptr<Schema> manifest_schema_;
-  ArrowSchema schema_;  // converted from manifest_schema_
+  ArrowSchema schema_{};  // converted from manifest_schema_
+  std::vector<ManifestEntry> entries_;
 };
 
 /// \brief Adapter to convert V2 ManifestFile to `ArrowArray`.
-class ManifestFileAdapterV2 : public ManifestFileAdapter {
+///
+/// Manifests are buffered by Append, and FinishAppending builds each column of the
+/// batch in one pass over the manifests, into buffers reserved for the whole batch.
+class ICEBERG_EXPORT ManifestFileAdapterV2 : public ManifestFileAdapter {
  public:
+  /// \param snapshot_id The id of the snapshot that writes the manifest list.
+  /// \param parent_snapshot_id The id of the parent of the snapshot.
+  /// \param sequence_number The sequence number of the snapshot, which is written for
+  /// manifests with an unassigned sequence number.
+  /// \param schema The manifest file schema to write.
   ManifestFileAdapterV2(int64_t snapshot_id, std::optional<int64_t> parent_snapshot_id,
-                        int64_t sequence_number, std::shared_ptr<Schema> schema) {
-    // TODO(xiao.dong): init v2 schema
-  }
-  Status StartAppending() override { return {}; }
-  Status Append(const ManifestFile& file) override { return {}; }
-  Result<ArrowArray> FinishAppending() override { return {}; }
+                        int64_t sequence_number, std::shared_ptr<Schema> schema);
+  ~ManifestFileAdapterV2() override;
+
+  Status StartAppending() override;
+  /// \brief Append a manifest. Manifests added by the snapshot may leave their sequence
+  /// numbers unassigned, as TableMetadata::kInvalidSequenceNumber.
+  Status Append(const ManifestFile& file) override;
+  Result<ArrowArray> FinishAppending() override;
+
+ protected:
+  ManifestFileAdapterV2(int8_t format_version, int64_t snapshot_id,
+                        std::optional<int64_t> parent_snapshot_id,
+                        int64_t sequence_number, std::shared_ptr<Schema> schema);
+
+  /// \brief Returns the manifest appended last, to be completed by subclasses.
+  ManifestFile& last() { return files_.back(); }
 
  private:
+  int8_t format_version_;
+  int64_t snapshot_id_;
+  int64_t sequence_number_;
   std::shared_ptr<Schema> manifest_list_schema_;
-  ArrowSchema schema_;  // converted from manifest_list_schema_
+  ArrowSchema schema_{};  // converted from manifest_list_schema_
+  std::vector<ManifestFile> files_;
 };
 
 }  // namespace iceberg
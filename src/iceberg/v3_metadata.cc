@@ -0,0 +1,81 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/v3_metadata.h"
+
+#include <utility>
+
+#include "iceberg/manifest_entry.h"
+#include "iceberg/util/macros.h"
+
+namespace iceberg {
+
+ManifestEntryAdapterV3::ManifestEntryAdapterV3(std::optional<int64_t> snapshot_id,
+                                               std::optional<int64_t> first_row_id,
+                                               std::shared_ptr<Schema> schema)
+    : ManifestEntryAdapterV2(/*format_version=*/3, snapshot_id, std::move(schema)),
+      next_row_id_(first_row_id) {}
+
+Status ManifestEntryAdapterV3::Append(const ManifestEntry& entry) {
+  const bool assign_row_id = next_row_id_.has_value() && entry.data_file != nullptr &&
+                             entry.data_file->content == DataFile::Content::kData &&
+                             !entry.data_file->first_row_id.has_value() &&
+                             entry.status != ManifestStatus::kDeleted;
+  if (!assign_row_id) {
+    return ManifestEntryAdapterV2::Append(entry);
+  }
+  // The data file may be shared with the caller, so the row id is set on a copy.
+  ManifestEntry with_row_id = entry;
+  with_row_id.data_file = std::make_shared<DataFile>(*entry.data_file);
+  with_row_id.data_file->first_row_id = next_row_id_;
+  ICEBERG_RETURN_UNEXPECTED(ManifestEntryAdapterV2::Append(with_row_id));
+  *next_row_id_ += entry.data_file->record_count;
+  return {};
+}
+
+ManifestFileAdapterV3::ManifestFileAdapterV3(int64_t snapshot_id,
+                                             std::optional<int64_t> parent_snapshot_id,
+                                             int64_t sequence_number,
+                                             std::optional<int64_t> first_row_id,
+                                             std::shared_ptr<Schema> schema)
+    : ManifestFileAdapterV2(/*format_version=*/3, snapshot_id, parent_snapshot_id,
+                            sequence_number, std::move(schema)),
+      next_row_id_(first_row_id) {}
+
+Status ManifestFileAdapterV3::Append(const ManifestFile& file) {
+  // Data manifests without first row ids are assigned a range of row ids that covers
+  // all of their added and existing rows.
+  const bool assign_row_ids = file.content == ManifestFile::Content::kData &&
+                              !file.first_row_id.has_value() && next_row_id_.has_value();
+  if (assign_row_ids &&
+      (!file.added_rows_count.has_value() || !file.existing_rows_count.has_value())) {
+    return InvalidManifestList(
+        "Cannot assign first row id to manifest {} without added and existing rows "
+        "counts",
+        file.manifest_path);
+  }
+  ICEBERG_RETURN_UNEXPECTED(ManifestFileAdapterV2::Append(file));
+  if (assign_row_ids) {
+    last().first_row_id = next_row_id_;
+    *next_row_id_ += *file.added_rows_count + *file.existing_rows_count;
+  }
+  return {};
+}
+
+}  // namespace iceberg
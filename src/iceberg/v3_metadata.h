@@ -22,43 +22,49 @@
 /// \file iceberg/v3_metadata.h
 
 #include <memory>
+#include <optional>
 
-#include "iceberg/manifest_adapter.h"
+#include "iceberg/v2_metadata.h"
 
 namespace iceberg {
 
-/// \brief Adapter to convert V3ManifestEntry to `ArrowArray`.
-class ManifestEntryAdapterV3 : public ManifestEntryAdapter {
+/// \brief Adapter to convert V3 ManifestEntry to `ArrowArray`.
+///
+/// In addition to the V2 fields, data files carry their first row id and the location
+/// of referenced content. If the first row id of the manifest is known, live data files
+/// without a first row id are assigned the row ids they would inherit from it, in the
+/// order they are appended. Otherwise it is left null, to be inherited from the first
+/// row id that the manifest list assigns to the manifest.
+class ICEBERG_EXPORT ManifestEntryAdapterV3 : public ManifestEntryAdapterV2 {
  public:
   ManifestEntryAdapterV3(std::optional<int64_t> snapshot_id,
                          std::optional<int64_t> first_row_id,
-                         std::shared_ptr<Schema> schema) {
-    // TODO(xiao.dong): init v3 schema
-  }
-  Status StartAppending() override { return {}; }
-  Status Append(const ManifestEntry& entry) override { return {}; }
-  Result<ArrowArray> FinishAppending() override { return {}; }
+                         std::shared_ptr<Schema> schema);
+
+  Status Append(const ManifestEntry& entry) override;
 
  private:
-  std::shared_ptr<Schema> manifest_schema_;
-  ArrowSchema schema_;  // converted from manifest_schema_
+  std::optional<int64_t> next_row_id_;
 };
 
 /// \brief Adapter to convert V3 ManifestFile to `ArrowArray`.
-class ManifestFileAdapterV3 : public ManifestFileAdapter {
+///
+/// Data manifests without a first row id are assigned consecutive ranges of row ids,
+/// starting at the first row id of the snapshot, sized by their added and existing
+/// rows.
+class ICEBERG_EXPORT ManifestFileAdapterV3 : public ManifestFileAdapterV2 {
  public:
   ManifestFileAdapterV3(int64_t snapshot_id, std::optional<int64_t> parent_snapshot_id,
                         int64_t sequence_number, std::optional<int64_t> first_row_id,
-                        std::shared_ptr<Schema> schema) {
-    // TODO(xiao.dong): init v3 schema
-  }
-  Status StartAppending() override { return {}; }
-  Status Append(const ManifestFile& file) override { return {}; }
-  Result<ArrowArray> FinishAppending() override { return {}; }
+                        std::shared_ptr<Schema> schema);
+
+  Status Append(const ManifestFile& file) override;
+
+  /// \brief Returns the first row id after the rows of the manifests appended so far.
+  std::optional<int64_t> next_row_id() const { return next_row_id_; }
 
  private:
-  std::shared_ptr<Schema> manifest_list_schema_;
-  ArrowSchema schema_;  // converted from manifest_list_schema_
+  std::optional<int64_t> next_row_id_;
 };
 
 }  // namespace iceberg
@@ -227,6 +227,49 @@ TEST(ToArrowSchemaTest, MapType) {
                                           /*nullable=*/true, kValueFieldId));
 }
 
+TEST(ToArrowSchemaTest, DictionaryType) {
+  auto list_type = std::make_shared<ListType>(
+      SchemaField::MakeOptional(3, "element", iceberg::binary()));
+  Schema schema({SchemaField::MakeOptional(1, "name", iceberg::string()),
+                 SchemaField::MakeRequired(2, "tags", list_type),
+                 SchemaField::MakeRequired(4, "id", iceberg::int32())},
+                /*schema_id=*/0);
+
+  // Ids of fields that are not strings or binaries are ignored.
+  ArrowSchema arrow_schema;
+  ASSERT_THAT(ToArrowSchema(schema, /*dictionary_field_ids=*/{1, 3, 4}, &arrow_schema),
+              IsOk());
+
+  auto imported_schema = ::arrow::ImportSchema(&arrow_schema).ValueOrDie();
+  ASSERT_EQ(imported_schema->num_fields(), 3);
+
+  auto name_field = imported_schema->field(0);
+  ASSERT_NO_FATAL_FAILURE(CheckArrowField(*name_field, ::arrow::Type::DICTIONARY, "name",
+                                          /*nullable=*/true, /*field_id=*/1));
+  ASSERT_TRUE(name_field->type()->Equals(
+      ::arrow::dictionary(::arrow::int32(), ::arrow::utf8())));
+
+  auto list_field = std::static_pointer_cast<::arrow::ListType>(
+      imported_schema->field(1)->type());
+  ASSERT_NO_FATAL_FAILURE(CheckArrowField(*list_field->value_field(),
+                                          ::arrow::Type::DICTIONARY, "element",
+                                          /*nullable=*/true, /*field_id=*/3));
+  ASSERT_TRUE(list_field->value_type()->Equals(
+      ::arrow::dictionary(::arrow::int32(), ::arrow::binary())));
+
+  ASSERT_NO_FATAL_FAILURE(CheckArrowField(*imported_schema->field(2),
+                                          ::arrow::Type::INT32, "id",
+                                          /*nullable=*/false, /*field_id=*/4));
+
+  // Dictionary encoding does not change the Iceberg type.
+  ArrowSchema exported_schema;
+  ASSERT_TRUE(::arrow::ExportSchema(*imported_schema, &exported_schema).ok());
+  auto schema_result = FromArrowSchema(exported_schema, /*schema_id=*/0);
+  ArrowSchemaRelease(&exported_schema);
+  ASSERT_THAT(schema_result, IsOk());
+  ASSERT_EQ(*schema_result.value(), schema);
+}
+
 struct FromArrowSchemaParam {
   std::shared_ptr<arrow::DataType> arrow_type;
   bool optional = true;
@@ -18,6 +18,7 @@
  */
 
 #include <arrow/array/array_base.h>
+#include <arrow/array/array_nested.h>
 #include <arrow/c/bridge.h>
 #include <arrow/filesystem/localfs.h>
 #include <arrow/io/file.h>
@@ -31,7 +32,9 @@
 #include "iceberg/arrow/arrow_fs_file_io_internal.h"
 #include "iceberg/avro/avro_register.h"
 #include "iceberg/avro/avro_writer.h"
+#include "iceberg/expression/literal.h"
 #include "iceberg/file_reader.h"
+#include "iceberg/metrics.h"
 #include "iceberg/schema.h"
 #include "iceberg/schema_internal.h"
 #include "iceberg/type.h"
@@ -226,4 +229,115 @@ TEST_F(AvroReaderTest, AvroWriterNestedType) {
   WriteAndVerify(schema, expected_string);
 }
 
+TEST_F(AvroReaderTest, AvroWriterMetrics) {
+  auto schema = std::make_shared<iceberg::Schema>(std::vector<SchemaField>{
+      SchemaField::MakeRequired(1, "id", std::make_shared<IntType>()),
+      SchemaField::MakeOptional(2, "name", std::make_shared<StringType>()),
+      SchemaField::MakeOptional(3, "score", std::make_shared<DoubleType>()),
+      SchemaField::MakeOptional(4, "valid", std::make_shared<BooleanType>()),
+      SchemaField::MakeOptional(
+          5, "tags",
+          std::make_shared<ListType>(
+              SchemaField::MakeOptional(6, "element", std::make_shared<IntType>())))});
+
+  ArrowSchema arrow_c_schema;
+  ASSERT_THAT(ToArrowSchema(*schema, &arrow_c_schema), IsOk());
+  auto arrow_schema = ::arrow::ImportType(&arrow_c_schema).ValueOrDie();
+
+  auto writer_result = WriterFactoryRegistry::Open(
+      FileFormatType::kAvro,
+      {.path = temp_avro_file_,
+       .schema = schema,
+       .io = file_io_,
+       .properties = {{"write.metadata.metrics.column.name", "truncate(2)"}}});
+  ASSERT_THAT(writer_result, IsOk());
+  auto writer = std::move(writer_result.value());
+  ASSERT_FALSE(writer->metrics().has_value());
+
+  // Metrics are accumulated over batches.
+  for (const auto* batch_json : {R"([[4, "abcdef", 1.5, true, [1, 2]],
+                                     [2, null, NaN, null, null]])",
+                                 R"([[3, "abd", -2.0, true, [3]],
+                                     [7, null, null, null, [null]]])"}) {
+    auto array =
+        ::arrow::json::ArrayFromJSONString(arrow_schema, batch_json).ValueOrDie();
+    struct ArrowArray arrow_array;
+    ASSERT_TRUE(::arrow::ExportArray(*array, &arrow_array).ok());
+    ASSERT_THAT(writer->Write(arrow_array), IsOk());
+  }
+  ASSERT_THAT(writer->Close(), IsOk());
+
+  auto metrics = writer->metrics();
+  ASSERT_TRUE(metrics.has_value());
+  ASSERT_EQ(metrics->row_count, 4);
+  ASSERT_TRUE(metrics->column_sizes.empty());
+  ASSERT_EQ(metrics->value_counts.at(1), 4);
+  ASSERT_EQ(metrics->null_value_counts.at(1), 0);
+  ASSERT_EQ(metrics->null_value_counts.at(2), 2);
+  ASSERT_EQ(metrics->null_value_counts.at(3), 1);
+  ASSERT_EQ(metrics->nan_value_counts.at(3), 1);
+  ASSERT_FALSE(metrics->nan_value_counts.contains(1));
+  ASSERT_EQ(metrics->value_counts.at(6), 4);
+  ASSERT_EQ(metrics->null_value_counts.at(6), 1);
+
+  ASSERT_EQ(metrics->lower_bounds.at(1), Literal::Int(2));
+  ASSERT_EQ(metrics->upper_bounds.at(1), Literal::Int(7));
+  // String bounds are truncated, the upper bound is rounded up.
+  ASSERT_EQ(metrics->lower_bounds.at(2), Literal::String("ab"));
+  ASSERT_EQ(metrics->upper_bounds.at(2), Literal::String("ac"));
+  // NaN values do not affect the bounds.
+  ASSERT_EQ(metrics->lower_bounds.at(3), Literal::Double(-2.0));
+  ASSERT_EQ(metrics->upper_bounds.at(3), Literal::Double(1.5));
+  ASSERT_EQ(metrics->lower_bounds.at(4), Literal::Boolean(true));
+  ASSERT_EQ(metrics->upper_bounds.at(4), Literal::Boolean(true));
+  // Values in lists have no bounds.
+  ASSERT_FALSE(metrics->lower_bounds.contains(6));
+  ASSERT_FALSE(metrics->upper_bounds.contains(6));
+}
+
+TEST_F(AvroReaderTest, AvroWriterMetricsIgnoreChildrenOfNullStructs) {
+  auto schema = std::make_shared<iceberg::Schema>(std::vector<SchemaField>{
+      SchemaField::MakeRequired(1, "id", std::make_shared<IntType>()),
+      SchemaField::MakeOptional(
+          2, "point",
+          std::make_shared<StructType>(std::vector<SchemaField>{
+              SchemaField::MakeOptional(3, "x", std::make_shared<IntType>())}))});
+
+  ArrowSchema arrow_c_schema;
+  ASSERT_THAT(ToArrowSchema(*schema, &arrow_c_schema), IsOk());
+  auto arrow_schema = ::arrow::ImportType(&arrow_c_schema).ValueOrDie();
+
+  // The second struct is null, but its child slot holds a value out of the range of
+  // the others.
+  auto ids =
+      ::arrow::json::ArrayFromJSONString(::arrow::int32(), "[1, 2, 3]").ValueOrDie();
+  auto xs =
+      ::arrow::json::ArrayFromJSONString(::arrow::int32(), "[1, 100, 3]").ValueOrDie();
+  auto validity =
+      ::arrow::json::ArrayFromJSONString(::arrow::boolean(), "[true, false, true]")
+          .ValueOrDie();
+  auto points = ::arrow::StructArray::Make({xs}, arrow_schema->field(1)->type()->fields(),
+                                           validity->data()->buffers[1],
+                                           /*null_count=*/1)
+                    .ValueOrDie();
+  auto array =
+      ::arrow::StructArray::Make({ids, points}, arrow_schema->fields()).ValueOrDie();
+
+  auto writer_result = WriterFactoryRegistry::Open(
+      FileFormatType::kAvro, {.path = temp_avro_file_, .schema = schema, .io = file_io_});
+  ASSERT_THAT(writer_result, IsOk());
+  auto writer = std::move(writer_result.value());
+  struct ArrowArray arrow_array;
+  ASSERT_TRUE(::arrow::ExportArray(*array, &arrow_array).ok());
+  ASSERT_THAT(writer->Write(arrow_array), IsOk());
+  ASSERT_THAT(writer->Close(), IsOk());
+
+  auto metrics = writer->metrics();
+  ASSERT_TRUE(metrics.has_value());
+  ASSERT_EQ(metrics->value_counts.at(3), 3);
+  ASSERT_EQ(metrics->null_value_counts.at(3), 1);
+  ASSERT_EQ(metrics->lower_bounds.at(3), Literal::Int(1));
+  ASSERT_EQ(metrics->upper_bounds.at(3), Literal::Int(3));
+}
+
 }  // namespace iceberg::avro
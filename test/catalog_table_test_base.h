@@ -0,0 +1,123 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <format>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <arrow/filesystem/localfs.h>
+#include <gtest/gtest.h>
+
+#include "iceberg/arrow/arrow_fs_file_io_internal.h"
+#include "iceberg/avro/avro_register.h"
+#include "iceberg/catalog/in_memory_catalog.h"
+#include "iceberg/manifest_entry.h"
+#include "iceberg/manifest_list.h"
+#include "iceberg/manifest_reader.h"
+#include "iceberg/snapshot.h"
+#include "iceberg/snapshot_producer.h"
+#include "iceberg/table.h"
+#include "iceberg/table_metadata.h"
+#include "matchers.h"
+#include "temp_file_test_base.h"
+#include "test_common.h"
+
+namespace iceberg {
+
+/// A base class for tests that commit snapshots to a table.
+///
+/// SetUp registers `table_ident_` in an InMemoryCatalog backed by the local file
+/// system. The table is empty, partitioned by identity(x) and waits only 1 ms between
+/// commit retries.
+class CatalogTableTestBase : public TempFileTestBase {
+ protected:
+  static void SetUpTestSuite() { avro::RegisterAll(); }
+
+  void SetUp() override {
+    TempFileTestBase::SetUp();
+    file_io_ = std::make_shared<iceberg::arrow::ArrowFileSystemFileIO>(
+        std::make_shared<::arrow::fs::LocalFileSystem>());
+    catalog_ = InMemoryCatalog::Make("test_catalog", file_io_, "/tmp/warehouse/", {});
+    ASSERT_NO_FATAL_FAILURE(RegisterEmptyTable(table_ident_, /*format_version=*/2));
+  }
+
+  /// \brief Register an empty table partitioned by identity(x) as `ident`.
+  void RegisterEmptyTable(const TableIdentifier& ident, int8_t format_version) {
+    std::unique_ptr<TableMetadata> metadata;
+    ASSERT_NO_FATAL_FAILURE(ReadTableMetadata("TableMetadataV2Valid.json", &metadata));
+    metadata->format_version = format_version;
+    metadata->location = CreateTempDirectory();
+    metadata->current_snapshot_id = Snapshot::kInvalidSnapshotId;
+    metadata->snapshots.clear();
+    metadata->snapshot_log.clear();
+    metadata->refs.clear();
+    metadata->next_row_id = TableMetadata::kInitialRowId;
+    metadata->properties[CommitProperties::kMinWaitMs.key()] = "1";
+    std::filesystem::create_directories(metadata->location + "/metadata");
+    auto metadata_location = metadata->location + "/metadata/00000-test.metadata.json";
+    ASSERT_THAT(TableMetadataUtil::Write(*file_io_, metadata_location, *metadata),
+                IsOk());
+    ASSERT_THAT(catalog_->RegisterTable(ident, metadata_location), IsOk());
+  }
+
+  /// \brief A data file of 10 records in partition x = i % 3.
+  static std::shared_ptr<DataFile> MakeDataFile(int32_t i) {
+    auto data_file = std::make_shared<DataFile>();
+    data_file->file_path = std::format("s3://bucket/data/{}.parquet", i);
+    data_file->partition = {Literal::Long(i % 3)};
+    data_file->record_count = 10;
+    data_file->file_size_in_bytes = 1024;
+    return data_file;
+  }
+
+  static std::vector<std::shared_ptr<DataFile>> MakeDataFiles(int32_t first,
+                                                              int32_t count) {
+    std::vector<std::shared_ptr<DataFile>> files;
+    for (int32_t i = first; i < first + count; ++i) {
+      files.push_back(MakeDataFile(i));
+    }
+    return files;
+  }
+
+  std::unique_ptr<Table> LoadTable() { return LoadTable(table_ident_); }
+
+  std::unique_ptr<Table> LoadTable(const TableIdentifier& ident) {
+    auto table = catalog_->LoadTable(ident);
+    EXPECT_THAT(table, IsOk());
+    return std::move(table.value());
+  }
+
+  std::vector<ManifestFile> ReadManifests(const Snapshot& snapshot) {
+    auto reader = ManifestListReader::Make(snapshot.manifest_list, file_io_);
+    EXPECT_THAT(reader, IsOk());
+    auto manifests = reader.value()->Files();
+    EXPECT_THAT(manifests, IsOk());
+    return manifests.value();
+  }
+
+  TableIdentifier table_ident_{.ns = {}, .name = "t1"};
+  std::shared_ptr<FileIO> file_io_;
+  std::shared_ptr<InMemoryCatalog> catalog_;
+};
+
+}  // namespace iceberg
@@ -0,0 +1,296 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/expression/evaluator.h"
+
+#include <cmath>
+#include <limits>
+
+#include <arrow/array.h>
+#include <arrow/array/builder_primitive.h>
+#include <arrow/c/bridge.h>
+#include <arrow/json/from_string.h>
+#include <arrow/record_batch.h>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "iceberg/arrow_array_util_internal.h"
+#include "iceberg/expression/expression.h"
+#include "iceberg/expression/literal.h"
+#include "iceberg/expression/predicate.h"
+#include "iceberg/schema.h"
+#include "iceberg/type.h"
+#include "matchers.h"
+
+namespace iceberg {
+
+namespace {
+
+using ::testing::ElementsAre;
+using Op = Expression::Operation;
+
+std::shared_ptr<Expression> Pred(Op op, std::string name) {
+  return std::make_shared<UnboundPredicate>(op, std::move(name));
+}
+
+std::shared_ptr<Expression> Pred(Op op, std::string name, Literal literal) {
+  return std::make_shared<UnboundPredicate>(op, std::move(name), std::move(literal));
+}
+
+std::shared_ptr<Expression> Pred(Op op, std::string name, std::vector<Literal> literals) {
+  return std::make_shared<UnboundPredicate>(op, std::move(name), std::move(literals));
+}
+
+}  // namespace
+
+class EvaluatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    schema_ = std::make_shared<Schema>(std::vector<SchemaField>{
+        SchemaField::MakeRequired(1, "id", int32()),
+        SchemaField::MakeOptional(2, "name", string()),
+        SchemaField::MakeOptional(3, "score", float64()),
+        SchemaField::MakeOptional(
+            4, "point",
+            std::make_shared<StructType>(std::vector<SchemaField>{
+                SchemaField::MakeOptional(5, "x", int64())}))});
+
+    auto point_type = ::arrow::struct_({::arrow::field("x", ::arrow::int64())});
+    auto id = ::arrow::json::ArrayFromJSONString(::arrow::int32(), "[1, 2, 3, 4, 5]")
+                  .ValueOrDie();
+    auto name = ::arrow::json::ArrayFromJSONString(
+                    ::arrow::utf8(), R"(["Foo", null, "Bar", "Baz", "Foo"])")
+                    .ValueOrDie();
+    ::arrow::DoubleBuilder score_builder;
+    ASSERT_TRUE(score_builder
+                    .AppendValues({1.5, std::numeric_limits<double>::quiet_NaN(), -2.0,
+                                   0.0, 3.5},
+                                  {true, true, true, false, true})
+                    .ok());
+    auto score = score_builder.Finish().ValueOrDie();
+    auto point =
+        ::arrow::json::ArrayFromJSONString(
+            point_type, R"([{"x": 10}, {"x": 20}, null, {"x": null}, {"x": 30}])")
+            .ValueOrDie();
+
+    batch_ = ::arrow::RecordBatch::Make(
+        ::arrow::schema({::arrow::field("id", ::arrow::int32(), /*nullable=*/false),
+                         ::arrow::field("name", ::arrow::utf8()),
+                         ::arrow::field("score", ::arrow::float64()),
+                         ::arrow::field("point", point_type)}),
+        5, {id, name, score, point});
+  }
+
+  std::vector<int64_t> Evaluate(const std::shared_ptr<Expression>& expr,
+                                const std::shared_ptr<::arrow::RecordBatch>& batch) {
+    auto evaluator = Evaluator::Make(*schema_, expr);
+    EXPECT_THAT(evaluator, IsOk());
+    if (!evaluator.has_value()) {
+      return {};
+    }
+
+    ArrowArray array;
+    ArrowSchema schema;
+    EXPECT_TRUE(::arrow::ExportRecordBatch(*batch, &array, &schema).ok());
+    auto result = evaluator.value()->Evaluate(schema, array);
+    array.release(&array);
+    schema.release(&schema);
+
+    EXPECT_THAT(result, IsOk());
+    if (!result.has_value()) {
+      return {};
+    }
+    EXPECT_EQ(result->length(), batch->num_rows());
+    return result->ToIndices();
+  }
+
+  std::vector<int64_t> Evaluate(const std::shared_ptr<Expression>& expr) {
+    return Evaluate(expr, batch_);
+  }
+
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<::arrow::RecordBatch> batch_;
+};
+
+TEST_F(EvaluatorTest, Comparisons) {
+  EXPECT_THAT(Evaluate(Pred(Op::kLt, "id", Literal::Int(3))), ElementsAre(0, 1));
+  EXPECT_THAT(Evaluate(Pred(Op::kLtEq, "id", Literal::Int(3))), ElementsAre(0, 1, 2));
+  EXPECT_THAT(Evaluate(Pred(Op::kGt, "id", Literal::Int(3))), ElementsAre(3, 4));
+  EXPECT_THAT(Evaluate(Pred(Op::kGtEq, "id", Literal::Int(3))), ElementsAre(2, 3, 4));
+  EXPECT_THAT(Evaluate(Pred(Op::kEq, "id", Literal::Int(3))), ElementsAre(2));
+  EXPECT_THAT(Evaluate(Pred(Op::kNotEq, "id", Literal::Int(3))), ElementsAre(0, 1, 3, 4));
+
+  // Literals are converted to the column type.
+  EXPECT_THAT(Evaluate(Pred(Op::kLt, "id", Literal::Long(2))), ElementsAre(0));
+  EXPECT_THAT(
+      Evaluate(Pred(Op::kLt, "id", Literal::Long(std::numeric_limits<int64_t>::max()))),
+      ElementsAre(0, 1, 2, 3, 4));
+  EXPECT_THAT(
+      Evaluate(Pred(Op::kEq, "id", Literal::Long(std::numeric_limits<int64_t>::max()))),
+      ElementsAre());
+}
+
+TEST_F(EvaluatorTest, NullsAreNeverSelected) {
+  EXPECT_THAT(Evaluate(Pred(Op::kEq, "name", Literal::String("Foo"))), ElementsAre(0, 4));
+  EXPECT_THAT(Evaluate(Pred(Op::kNotEq, "name", Literal::String("Foo"))),
+              ElementsAre(2, 3));
+  EXPECT_THAT(
+      Evaluate(std::make_shared<Not>(Pred(Op::kEq, "name", Literal::String("Foo")))),
+      ElementsAre(2, 3));
+  EXPECT_THAT(Evaluate(Pred(Op::kIsNull, "name")), ElementsAre(1));
+  EXPECT_THAT(Evaluate(Pred(Op::kNotNull, "name")), ElementsAre(0, 2, 3, 4));
+}
+
+TEST_F(EvaluatorTest, FloatingPoint) {
+  EXPECT_THAT(Evaluate(Pred(Op::kIsNan, "score")), ElementsAre(1));
+  EXPECT_THAT(Evaluate(Pred(Op::kNotNan, "score")), ElementsAre(0, 2, 4));
+  // NaN sorts after all other values.
+  EXPECT_THAT(Evaluate(Pred(Op::kGt, "score", Literal::Double(1.0))),
+              ElementsAre(0, 1, 4));
+  EXPECT_THAT(Evaluate(Pred(Op::kLt, "score", Literal::Double(1.0))), ElementsAre(2));
+  EXPECT_THAT(Evaluate(Pred(Op::kLt, "score", Literal::Float(1.5f))), ElementsAre(2));
+}
+
+TEST_F(EvaluatorTest, SetAndStringPredicates) {
+  EXPECT_THAT(Evaluate(Pred(Op::kIn, "id", std::vector<Literal>{Literal::Int(2),
+                                                               Literal::Int(5)})),
+              ElementsAre(1, 4));
+  EXPECT_THAT(Evaluate(Pred(Op::kNotIn, "name",
+                            std::vector<Literal>{Literal::String("Foo"),
+                                                 Literal::String("Bar")})),
+              ElementsAre(3));
+  EXPECT_THAT(Evaluate(Pred(Op::kStartsWith, "name", Literal::String("Ba"))),
+              ElementsAre(2, 3));
+  EXPECT_THAT(Evaluate(Pred(Op::kNotStartsWith, "name", Literal::String("Ba"))),
+              ElementsAre(0, 4));
+}
+
+TEST_F(EvaluatorTest, NestedField) {
+  EXPECT_THAT(Evaluate(Pred(Op::kGtEq, "point.x", Literal::Long(20))), ElementsAre(1, 4));
+  // A field in a null struct is null as well.
+  EXPECT_THAT(Evaluate(Pred(Op::kIsNull, "point.x")), ElementsAre(2, 3));
+}
+
+TEST_F(EvaluatorTest, LogicalOperators) {
+  auto id_gt_1 = Pred(Op::kGt, "id", Literal::Int(1));
+  auto name_is_foo = Pred(Op::kEq, "name", Literal::String("Foo"));
+
+  EXPECT_THAT(Evaluate(std::make_shared<And>(id_gt_1, name_is_foo)), ElementsAre(4));
+  EXPECT_THAT(Evaluate(std::make_shared<Or>(id_gt_1, name_is_foo)),
+              ElementsAre(0, 1, 2, 3, 4));
+  EXPECT_THAT(
+      Evaluate(std::make_shared<Not>(std::make_shared<And>(id_gt_1, name_is_foo))),
+      ElementsAre(0, 2, 3));
+  EXPECT_THAT(Evaluate(std::make_shared<And>(True::Instance(), name_is_foo)),
+              ElementsAre(0, 4));
+  EXPECT_THAT(Evaluate(std::make_shared<Or>(False::Instance(), name_is_foo)),
+              ElementsAre(0, 4));
+
+  auto always_true =
+      Evaluator::Make(*schema_, std::make_shared<Or>(True::Instance(), id_gt_1));
+  ASSERT_THAT(always_true, IsOk());
+  EXPECT_TRUE(always_true.value()->IsAlwaysTrue());
+}
+
+TEST_F(EvaluatorTest, SlicedAndDictionaryBatches) {
+  EXPECT_THAT(Evaluate(Pred(Op::kEq, "name", Literal::String("Foo")), batch_->Slice(1)),
+              ElementsAre(3));
+  EXPECT_THAT(Evaluate(Pred(Op::kIsNull, "point.x"), batch_->Slice(2, 2)),
+              ElementsAre(0, 1));
+
+  auto dictionary_type = ::arrow::dictionary(::arrow::int32(), ::arrow::utf8());
+  auto indices =
+      ::arrow::json::ArrayFromJSONString(::arrow::int32(), "[0, null, 1, 2, 0]")
+          .ValueOrDie();
+  auto dictionary =
+      ::arrow::json::ArrayFromJSONString(::arrow::utf8(), R"(["Foo", "Bar", "Baz"])")
+          .ValueOrDie();
+  auto name = ::arrow::DictionaryArray::FromArrays(dictionary_type, indices, dictionary)
+                  .ValueOrDie();
+  auto batch = batch_->SetColumn(1, ::arrow::field("name", dictionary_type), name)
+                   .ValueOrDie();
+  EXPECT_THAT(Evaluate(Pred(Op::kStartsWith, "name", Literal::String("Ba")), batch),
+              ElementsAre(2, 3));
+  EXPECT_THAT(Evaluate(Pred(Op::kIsNull, "name"), batch), ElementsAre(1));
+}
+
+TEST_F(EvaluatorTest, BindErrors) {
+  EXPECT_THAT(Evaluator::Make(*schema_, Pred(Op::kEq, "missing", Literal::Int(1))),
+              IsError(ErrorKind::kInvalidExpression));
+  EXPECT_THAT(Evaluator::Make(*schema_, Pred(Op::kStartsWith, "id", Literal::Int(1))),
+              IsError(ErrorKind::kInvalidExpression));
+  EXPECT_THAT(Evaluator::Make(*schema_, Pred(Op::kIsNan, "id")),
+              IsError(ErrorKind::kInvalidExpression));
+  EXPECT_THAT(Evaluator::Make(*schema_, Pred(Op::kEq, "name", Literal::Int(1))),
+              IsError(ErrorKind::kInvalidExpression));
+  EXPECT_THAT(Evaluator::Make(*schema_, Pred(Op::kEq, "score", Literal::Double(NAN))),
+              IsError(ErrorKind::kInvalidExpression));
+  EXPECT_THAT(Evaluator::Make(*schema_, Pred(Op::kEq, "point", Literal::Int(1))),
+              IsError(ErrorKind::kInvalidExpression));
+}
+
+TEST_F(EvaluatorTest, TakeSelectedRows) {
+  auto evaluator = Evaluator::Make(*schema_, Pred(Op::kGtEq, "id", Literal::Int(4)));
+  ASSERT_THAT(evaluator, IsOk());
+
+  ArrowArray array;
+  ArrowSchema schema;
+  ASSERT_TRUE(::arrow::ExportRecordBatch(*batch_, &array, &schema).ok());
+  auto selection = evaluator.value()->Evaluate(schema, array);
+  ASSERT_THAT(selection, IsOk());
+  auto taken = internal::TakeArray(schema, array, selection->ToIndices());
+  array.release(&array);
+  ASSERT_THAT(taken, IsOk());
+
+  auto result = ::arrow::ImportRecordBatch(&taken.value(), &schema).ValueOrDie();
+  ASSERT_TRUE(result->Equals(*batch_->Slice(3)));
+}
+
+TEST(TakeArrayTest, TakeFromSlicedListAndMap) {
+  auto take = [](const ::arrow::Array& array, std::vector<int64_t> indices) {
+    ArrowArray c_array;
+    ArrowSchema c_schema;
+    EXPECT_TRUE(::arrow::ExportArray(array, &c_array, &c_schema).ok());
+    auto taken = internal::TakeArray(c_schema, c_array, indices);
+    c_array.release(&c_array);
+    EXPECT_THAT(taken, IsOk());
+    return ::arrow::ImportArray(&taken.value(), &c_schema).ValueOrDie();
+  };
+
+  auto list = ::arrow::json::ArrayFromJSONString(::arrow::list(::arrow::int32()),
+                                                 "[[1], [2, 3], null, [], [4, 5, 6]]")
+                  .ValueOrDie()
+                  ->Slice(1);
+  auto expected_list = ::arrow::json::ArrayFromJSONString(
+                           ::arrow::list(::arrow::int32()), "[[4, 5, 6], [2, 3], null]")
+                           .ValueOrDie();
+  EXPECT_TRUE(take(*list, {3, 0, 1})->Equals(*expected_list));
+
+  auto map_type = ::arrow::map(::arrow::utf8(), ::arrow::int32());
+  auto map = ::arrow::json::ArrayFromJSONString(
+                 map_type, R"([[["a", 1]], [["b", 2], ["c", 3]], [], [["d", 4]]])")
+                 .ValueOrDie()
+                 ->Slice(1, 3);
+  auto expected_map = ::arrow::json::ArrayFromJSONString(
+                          map_type, R"([[["d", 4]], [["b", 2], ["c", 3]]])")
+                          .ValueOrDie();
+  EXPECT_TRUE(take(*map, {2, 0})->Equals(*expected_map));
+}
+
+}  // namespace iceberg
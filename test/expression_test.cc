@@ -23,6 +23,9 @@
 
 #include <gtest/gtest.h>
 
+#include "iceberg/expression/literal.h"
+#include "iceberg/expression/predicate.h"
+
 namespace iceberg {
 
 TEST(TrueFalseTest, Basic) {
@@ -154,4 +157,66 @@ TEST(ExpressionTest, BaseClassNegateThrowsException) {
   // Should throw IcebergError when calling Negate() on base class
   EXPECT_THROW(mock_expr->Negate(), IcebergError);
 }
+
+TEST(NOTTest, Basic) {
+  auto not_expr = std::make_shared<Not>(True::Instance());
+
+  EXPECT_EQ(not_expr->op(), Expression::Operation::kNot);
+  EXPECT_EQ(not_expr->ToString(), "not(true)");
+  EXPECT_EQ(not_expr->child()->op(), Expression::Operation::kTrue);
+
+  // not(not(A)) = A
+  EXPECT_EQ(not_expr->Negate()->op(), Expression::Operation::kTrue);
+  EXPECT_TRUE(not_expr->Equals(Not(True::Instance())));
+  EXPECT_FALSE(not_expr->Equals(Not(False::Instance())));
+}
+
+TEST(UnboundPredicateTest, ToString) {
+  EXPECT_EQ(UnboundPredicate(Expression::Operation::kIsNull, "a").ToString(),
+            "a is_null");
+  EXPECT_EQ(UnboundPredicate(Expression::Operation::kLt, "a", Literal::Int(5)).ToString(),
+            "a < 5");
+  EXPECT_EQ(UnboundPredicate(Expression::Operation::kStartsWith, "s",
+                             Literal::String("abc"))
+                .ToString(),
+            "s startsWith \"abc\"");
+  EXPECT_EQ(
+      UnboundPredicate(Expression::Operation::kIn, "a",
+                       std::vector<Literal>{Literal::Long(1), Literal::Long(2)})
+          .ToString(),
+      "a in (1, 2)");
+}
+
+TEST(UnboundPredicateTest, Negate) {
+  using Op = Expression::Operation;
+  const std::vector<std::pair<Op, Op>> negations = {
+      {Op::kIsNull, Op::kNotNull}, {Op::kIsNan, Op::kNotNan},
+      {Op::kLt, Op::kGtEq},        {Op::kLtEq, Op::kGt},
+      {Op::kEq, Op::kNotEq},       {Op::kIn, Op::kNotIn},
+      {Op::kStartsWith, Op::kNotStartsWith}};
+
+  for (const auto& [op, negated_op] : negations) {
+    auto predicate = std::make_shared<UnboundPredicate>(op, "a");
+    EXPECT_EQ(predicate->Negate()->op(), negated_op);
+    EXPECT_EQ(predicate->Negate()->Negate()->op(), op);
+  }
+
+  auto predicate =
+      std::make_shared<UnboundPredicate>(Op::kEq, "a", Literal::Int(1));
+  auto negated = std::dynamic_pointer_cast<UnboundPredicate>(predicate->Negate());
+  ASSERT_NE(negated, nullptr);
+  EXPECT_EQ(negated->column_name(), "a");
+  EXPECT_EQ(negated->literals(), predicate->literals());
+}
+
+TEST(UnboundPredicateTest, Equals) {
+  using Op = Expression::Operation;
+  UnboundPredicate predicate(Op::kEq, "a", Literal::Int(1));
+
+  EXPECT_TRUE(predicate.Equals(UnboundPredicate(Op::kEq, "a", Literal::Int(1))));
+  EXPECT_FALSE(predicate.Equals(UnboundPredicate(Op::kEq, "a", Literal::Int(2))));
+  EXPECT_FALSE(predicate.Equals(UnboundPredicate(Op::kEq, "b", Literal::Int(1))));
+  EXPECT_FALSE(predicate.Equals(UnboundPredicate(Op::kNotEq, "a", Literal::Int(1))));
+}
+
 }  // namespace iceberg
@@ -0,0 +1,181 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/fast_append.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "catalog_table_test_base.h"
+#include "iceberg/manifest_entry.h"
+#include "iceberg/snapshot.h"
+#include "iceberg/table.h"
+#include "iceberg/table_metadata.h"
+#include "matchers.h"
+
+namespace iceberg {
+
+class FastAppendTest : public CatalogTableTestBase {};
+
+TEST_F(FastAppendTest, AppendFilesInOneManifest) {
+  auto table = LoadTable();
+  FastAppend append(*table);
+  for (int32_t i = 0; i < 10; ++i) {
+    append.AppendFile(MakeDataFile(i));
+  }
+  ASSERT_THAT(append.Commit(), IsOk());
+
+  auto snapshot = LoadTable()->current_snapshot();
+  ASSERT_THAT(snapshot, IsOk());
+  EXPECT_EQ(*snapshot.value(), *append.committed_snapshot());
+  EXPECT_EQ(snapshot.value()->operation(), DataOperation::kAppend);
+  EXPECT_EQ(snapshot.value()->parent_snapshot_id, std::nullopt);
+  EXPECT_EQ(snapshot.value()->sequence_number,
+            table->metadata()->last_sequence_number + 1);
+  const auto& summary = snapshot.value()->summary;
+  EXPECT_EQ(summary.at(SnapshotSummaryFields::kAddedDataFiles), "10");
+  EXPECT_EQ(summary.at(SnapshotSummaryFields::kAddedRecords), "100");
+  EXPECT_EQ(summary.at(SnapshotSummaryFields::kAddedFileSize), "10240");
+  EXPECT_EQ(summary.at(SnapshotSummaryFields::kChangedPartitionCountProp), "3");
+  EXPECT_EQ(summary.at(SnapshotSummaryFields::kTotalDataFiles), "10");
+  EXPECT_EQ(summary.at(SnapshotSummaryFields::kTotalRecords), "100");
+
+  auto manifests = ReadManifests(*snapshot.value());
+  ASSERT_EQ(manifests.size(), 1);
+  EXPECT_EQ(manifests[0].added_snapshot_id, snapshot.value()->snapshot_id);
+  EXPECT_EQ(manifests[0].sequence_number, snapshot.value()->sequence_number);
+  EXPECT_EQ(manifests[0].added_files_count, 10);
+  EXPECT_EQ(manifests[0].added_rows_count, 100);
+}
+
+TEST_F(FastAppendTest, ReuseExistingManifests) {
+  auto first = LoadTable()->NewAppend();
+  first->AppendFile(MakeDataFile(0)).AppendFile(MakeDataFile(1));
+  ASSERT_THAT(first->Commit(), IsOk());
+  auto first_snapshot = LoadTable()->current_snapshot().value();
+  auto first_manifests = ReadManifests(*first_snapshot);
+
+  auto second = LoadTable()->NewAppend();
+  second->AppendFile(MakeDataFile(2));
+  ASSERT_THAT(second->Commit(), IsOk());
+  auto second_snapshot = LoadTable()->current_snapshot().value();
+  EXPECT_EQ(second_snapshot->parent_snapshot_id, first_snapshot->snapshot_id);
+  EXPECT_EQ(second_snapshot->sequence_number, first_snapshot->sequence_number + 1);
+  EXPECT_EQ(second_snapshot->summary.at(SnapshotSummaryFields::kAddedDataFiles), "1");
+  EXPECT_EQ(second_snapshot->summary.at(SnapshotSummaryFields::kTotalDataFiles), "3");
+  EXPECT_EQ(second_snapshot->summary.at(SnapshotSummaryFields::kTotalRecords), "30");
+
+  // The new manifest is listed first, followed by the unchanged manifest of the parent.
+  auto manifests = ReadManifests(*second_snapshot);
+  ASSERT_EQ(manifests.size(), 2);
+  EXPECT_EQ(manifests[0].added_snapshot_id, second_snapshot->snapshot_id);
+  EXPECT_EQ(manifests[0].added_files_count, 1);
+  EXPECT_EQ(manifests[1], first_manifests[0]);
+}
+
+TEST_F(FastAppendTest, RejectDeleteFiles) {
+  auto delete_file = MakeDataFile(0);
+  delete_file->content = DataFile::Content::kPositionDeletes;
+  auto append = LoadTable()->NewAppend();
+  append->AppendFile(delete_file);
+  EXPECT_THAT(append->Commit(), IsError(ErrorKind::kInvalidArgument));
+  EXPECT_THAT(LoadTable()->current_snapshot(), IsError(ErrorKind::kNotFound));
+}
+
+TEST_F(FastAppendTest, ConcurrentAppendIsRetried) {
+  auto table = LoadTable();
+  FastAppend first(*table);
+  FastAppend second(*table);
+  first.AppendFile(MakeDataFile(0));
+  second.AppendFile(MakeDataFile(1));
+  ASSERT_THAT(first.Commit(), IsOk());
+
+  // The second append is based on the table before the first one was committed, so
+  // its first attempt fails and it is reapplied on top of the first append.
+  ASSERT_THAT(second.Commit(), IsOk());
+  auto snapshot = LoadTable()->current_snapshot().value();
+  EXPECT_EQ(snapshot->snapshot_id, second.committed_snapshot()->snapshot_id);
+  EXPECT_EQ(snapshot->parent_snapshot_id, first.committed_snapshot()->snapshot_id);
+  EXPECT_EQ(snapshot->sequence_number, first.committed_snapshot()->sequence_number + 1);
+  EXPECT_EQ(snapshot->summary.at(SnapshotSummaryFields::kTotalDataFiles), "2");
+
+  // The manifest written by the first attempt is reused.
+  auto manifests = ReadManifests(*snapshot);
+  ASSERT_EQ(manifests.size(), 2);
+  ASSERT_EQ(second.added_manifests().size(), 1);
+  EXPECT_EQ(manifests[0].manifest_path, second.added_manifests()[0].manifest_path);
+  EXPECT_EQ(manifests[1], ReadManifests(*first.committed_snapshot())[0]);
+}
+
+TEST_F(FastAppendTest, ConcurrentAppendFailsWithoutRetries) {
+  auto table = LoadTable();
+  table->metadata()->properties[CommitProperties::kNumRetries.key()] = "0";
+  FastAppend first(*table);
+  FastAppend second(*table);
+  first.AppendFile(MakeDataFile(0));
+  second.AppendFile(MakeDataFile(1));
+  ASSERT_THAT(first.Commit(), IsOk());
+
+  EXPECT_THAT(second.Commit(), IsError(ErrorKind::kCommitFailed));
+  EXPECT_TRUE(second.added_manifests().empty());
+  EXPECT_EQ(LoadTable()->current_snapshot().value()->snapshot_id,
+            first.committed_snapshot()->snapshot_id);
+}
+
+TEST_F(FastAppendTest, InvalidCommitProperties) {
+  auto table = LoadTable();
+  table->metadata()->properties[CommitProperties::kNumRetries.key()] = "many";
+  FastAppend append(*table);
+  append.AppendFile(MakeDataFile(0));
+  EXPECT_THAT(append.Commit(), IsError(ErrorKind::kInvalidArgument));
+  EXPECT_THAT(LoadTable()->current_snapshot(), IsError(ErrorKind::kNotFound));
+}
+
+TEST_F(FastAppendTest, ValidateNoConflictingPartitions) {
+  auto table = LoadTable();
+  FastAppend first(*table);
+  FastAppend conflicting(*table);
+  FastAppend other_partition(*table);
+  first.AppendFile(MakeDataFile(0));
+  conflicting.AppendFile(MakeDataFile(3)).ValidateNoConflictingPartitions();
+  other_partition.AppendFile(MakeDataFile(1)).ValidateNoConflictingPartitions();
+  ASSERT_THAT(first.Commit(), IsOk());
+
+  // Files 0 and 3 are both in partition x=0.
+  EXPECT_THAT(conflicting.Commit(), IsError(ErrorKind::kValidationFailed));
+  EXPECT_TRUE(conflicting.added_manifests().empty());
+  ASSERT_THAT(other_partition.Commit(), IsOk());
+  EXPECT_EQ(LoadTable()->current_snapshot().value()->parent_snapshot_id,
+            first.committed_snapshot()->snapshot_id);
+}
+
+TEST_F(FastAppendTest, ValidateNoConflictingFiles) {
+  auto table = LoadTable();
+  FastAppend first(*table);
+  FastAppend second(*table);
+  first.AppendFile(MakeDataFile(0));
+  second.AppendFile(MakeDataFile(0)).ValidateNoConflictingFiles();
+  ASSERT_THAT(first.Commit(), IsOk());
+
+  EXPECT_THAT(second.Commit(), IsError(ErrorKind::kValidationFailed));
+  EXPECT_EQ(LoadTable()->current_snapshot().value()->snapshot_id,
+            first.committed_snapshot()->snapshot_id);
+}
+
+}  // namespace iceberg
@@ -0,0 +1,132 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/file_metadata_cache.h"
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace iceberg {
+
+namespace {
+
+struct TestEntry : public FileMetadataCache::Entry {
+  explicit TestEntry(int value) : value(value) {}
+  int value;
+};
+
+int ValueOf(const std::shared_ptr<const FileMetadataCache::Entry>& entry) {
+  return static_cast<const TestEntry&>(*entry).value;
+}
+
+}  // namespace
+
+TEST(FileMetadataCacheTest, GetAndPut) {
+  FileMetadataCache cache(/*capacity_bytes=*/100);
+  ASSERT_EQ(cache.Get("a"), nullptr);
+
+  cache.Put("a", std::make_shared<TestEntry>(1), 10);
+  cache.Put("b", std::make_shared<TestEntry>(2), 20);
+  ASSERT_EQ(ValueOf(cache.Get("a")), 1);
+  ASSERT_EQ(ValueOf(cache.Get("b")), 2);
+  ASSERT_EQ(cache.size(), 2);
+  ASSERT_EQ(cache.size_bytes(), 30);
+  ASSERT_EQ(cache.hits(), 2);
+  ASSERT_EQ(cache.misses(), 1);
+
+  // Replacing an entry updates its charge.
+  cache.Put("a", std::make_shared<TestEntry>(3), 5);
+  ASSERT_EQ(ValueOf(cache.Get("a")), 3);
+  ASSERT_EQ(cache.size(), 2);
+  ASSERT_EQ(cache.size_bytes(), 25);
+
+  cache.Clear();
+  ASSERT_EQ(cache.Get("a"), nullptr);
+  ASSERT_EQ(cache.size(), 0);
+  ASSERT_EQ(cache.size_bytes(), 0);
+}
+
+TEST(FileMetadataCacheTest, EvictLeastRecentlyUsed) {
+  FileMetadataCache cache(/*capacity_bytes=*/100);
+  cache.Put("a", std::make_shared<TestEntry>(1), 40);
+  cache.Put("b", std::make_shared<TestEntry>(2), 40);
+  // Using "a" makes "b" the least recently used entry.
+  ASSERT_NE(cache.Get("a"), nullptr);
+
+  cache.Put("c", std::make_shared<TestEntry>(3), 40);
+  ASSERT_EQ(cache.Get("b"), nullptr);
+  ASSERT_EQ(ValueOf(cache.Get("a")), 1);
+  ASSERT_EQ(ValueOf(cache.Get("c")), 3);
+  ASSERT_EQ(cache.size_bytes(), 80);
+  ASSERT_EQ(cache.evictions(), 1);
+
+  // An entry larger than the capacity is not cached and does not evict others.
+  cache.Put("d", std::make_shared<TestEntry>(4), 101);
+  ASSERT_EQ(cache.Get("d"), nullptr);
+  ASSERT_EQ(cache.size(), 2);
+
+  // A large entry evicts as many entries as needed.
+  cache.Put("e", std::make_shared<TestEntry>(5), 100);
+  ASSERT_EQ(cache.size(), 1);
+  ASSERT_EQ(ValueOf(cache.Get("e")), 5);
+  ASSERT_EQ(cache.evictions(), 3);
+}
+
+TEST(FileMetadataCacheTest, EntryOutlivesEviction) {
+  FileMetadataCache cache(/*capacity_bytes=*/10);
+  cache.Put("a", std::make_shared<TestEntry>(1), 10);
+  auto entry = cache.Get("a");
+
+  cache.Put("b", std::make_shared<TestEntry>(2), 10);
+  ASSERT_EQ(cache.Get("a"), nullptr);
+  ASSERT_EQ(ValueOf(entry), 1);
+}
+
+TEST(FileMetadataCacheTest, ConcurrentAccess) {
+  constexpr int kNumThreads = 8;
+  constexpr int kNumKeys = 64;
+  FileMetadataCache cache(/*capacity_bytes=*/kNumKeys / 2);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&cache]() {
+      for (int i = 0; i < kNumKeys; ++i) {
+        auto key = std::to_string(i);
+        if (auto entry = cache.Get(key)) {
+          ASSERT_EQ(ValueOf(entry), i);
+        } else {
+          cache.Put(key, std::make_shared<TestEntry>(i), 1);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(cache.size(), kNumKeys / 2);
+  ASSERT_EQ(cache.size_bytes(), kNumKeys / 2);
+  ASSERT_EQ(cache.hits() + cache.misses(), kNumThreads * kNumKeys);
+}
+
+}  // namespace iceberg
@@ -28,6 +28,8 @@
 #include <parquet/metadata.h>
 
 #include "iceberg/arrow/arrow_fs_file_io_internal.h"
+#include "iceberg/expression/literal.h"
+#include "iceberg/expression/predicate.h"
 #include "iceberg/file_format.h"
 #include "iceberg/manifest_entry.h"
 #include "iceberg/parquet/parquet_register.h"
@@ -164,6 +166,46 @@ TEST_F(FileScanTaskTest, ReadProjectedAndReorderedSchema) {
       VerifyStreamNextBatch(&stream, R"([["Foo", null], ["Bar", null], ["Baz", null]])"));
 }
 
+TEST_F(FileScanTaskTest, ReadWithFilter) {
+  auto data_file = std::make_shared<DataFile>();
+  data_file->file_path = temp_parquet_file_;
+  data_file->file_format = FileFormatType::kParquet;
+
+  auto projected_schema = std::make_shared<Schema>(
+      std::vector<SchemaField>{SchemaField::MakeRequired(1, "id", int32()),
+                               SchemaField::MakeOptional(2, "name", string())});
+  auto filter = std::make_shared<UnboundPredicate>(Expression::Operation::kGtEq, "id",
+                                                   Literal::Int(2));
+
+  FileScanTask task(data_file);
+
+  auto stream_result = task.ToArrow(file_io_, projected_schema, filter);
+  ASSERT_THAT(stream_result, IsOk());
+  auto stream = std::move(stream_result.value());
+
+  ASSERT_NO_FATAL_FAILURE(VerifyStreamNextBatch(&stream, R"([[2, "Bar"], [3, "Baz"]])"));
+}
+
+TEST_F(FileScanTaskTest, ReadWithFilterMatchingNoRows) {
+  auto data_file = std::make_shared<DataFile>();
+  data_file->file_path = temp_parquet_file_;
+  data_file->file_format = FileFormatType::kParquet;
+
+  auto projected_schema = std::make_shared<Schema>(
+      std::vector<SchemaField>{SchemaField::MakeRequired(1, "id", int32()),
+                               SchemaField::MakeOptional(2, "name", string())});
+  auto filter = std::make_shared<UnboundPredicate>(Expression::Operation::kEq, "name",
+                                                   Literal::String("Qux"));
+
+  FileScanTask task(data_file);
+
+  auto stream_result = task.ToArrow(file_io_, projected_schema, filter);
+  ASSERT_THAT(stream_result, IsOk());
+  auto stream = std::move(stream_result.value());
+
+  ASSERT_NO_FATAL_FAILURE(VerifyStreamExhausted(&stream));
+}
+
 TEST_F(FileScanTaskTest, ReadEmptyFile) {
   CreateEmptyParquetFile();
   auto data_file = std::make_shared<DataFile>();
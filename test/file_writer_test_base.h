@@ -0,0 +1,88 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <format>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <arrow/array.h>
+#include <arrow/c/bridge.h>
+#include <arrow/json/from_string.h>
+#include <arrow/type.h>
+#include <gtest/gtest.h>
+
+#include "iceberg/arrow/arrow_fs_file_io_internal.h"
+#include "iceberg/file_writer.h"
+#include "iceberg/parquet/parquet_register.h"
+#include "iceberg/schema.h"
+#include "iceberg/schema_internal.h"
+#include "matchers.h"
+
+namespace iceberg {
+
+/// A base class for tests of writers that write Arrow batches to Parquet data files.
+///
+/// SetUp creates a mock FileIO. Derived classes call SetSchema from their SetUp, then
+/// write rows given as JSON with Write. Data files are named data-0.parquet,
+/// data-1.parquet, ... by NextFilePath.
+class FileWriterTestBase : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() { parquet::RegisterAll(); }
+
+  void SetUp() override { file_io_ = arrow::ArrowFileSystemFileIO::MakeMockFileIO(); }
+
+  /// \brief Set the schema of the written rows and its Arrow struct type.
+  void SetSchema(std::vector<SchemaField> fields) {
+    schema_ = std::make_shared<Schema>(std::move(fields));
+    ArrowSchema arrow_c_schema;
+    ASSERT_THAT(ToArrowSchema(*schema_, &arrow_c_schema), IsOk());
+    arrow_type_ = ::arrow::ImportType(&arrow_c_schema).ValueOrDie();
+  }
+
+  /// \brief Options to write Parquet files of `schema_` to `file_io_`.
+  WriterOptions MakeWriterOptions(
+      std::unordered_map<std::string, std::string> properties = {}) {
+    return {.schema = schema_, .io = file_io_, .properties = std::move(properties)};
+  }
+
+  /// \brief Returns the path of the next data file.
+  std::string NextFilePath() { return std::format("data-{}.parquet", next_file_++); }
+
+  /// \brief Write the rows of the JSON array `json`, each row a JSON array of field
+  /// values, to `writer`.
+  template <typename WriterType>
+  Status Write(WriterType& writer, std::string_view json) {
+    auto array = ::arrow::json::ArrayFromJSONString(arrow_type_, json).ValueOrDie();
+    ArrowArray arrow_array;
+    EXPECT_TRUE(::arrow::ExportArray(*array, &arrow_array).ok());
+    return writer.Write(arrow_array);
+  }
+
+  std::shared_ptr<FileIO> file_io_;
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<::arrow::DataType> arrow_type_;
+  int next_file_ = 0;
+};
+
+}  // namespace iceberg
@@ -0,0 +1,146 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/group_committer.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "catalog_table_test_base.h"
+#include "iceberg/exception.h"
+#include "iceberg/manifest_entry.h"
+#include "iceberg/snapshot.h"
+#include "iceberg/table.h"
+#include "iceberg/table_metadata.h"
+#include "matchers.h"
+
+namespace iceberg {
+
+class GroupCommitterTest : public CatalogTableTestBase {
+ protected:
+  std::shared_ptr<TableMetadata> LoadMetadata() { return LoadTable()->metadata(); }
+};
+
+TEST_F(GroupCommitterTest, FullBatchIsCommittedAsOneSnapshot) {
+  GroupCommitter committer(catalog_, table_ident_,
+                           {.max_delay = std::chrono::hours(1), .max_batch_requests = 5});
+  std::vector<std::future<Result<std::shared_ptr<Snapshot>>>> futures;
+  for (int32_t i = 0; i < 5; ++i) {
+    futures.push_back(committer.Submit(MakeDataFiles(i * 2, 2)));
+  }
+
+  std::shared_ptr<Snapshot> snapshot;
+  for (auto& future : futures) {
+    auto result = future.get();
+    ASSERT_THAT(result, IsOk());
+    if (snapshot == nullptr) {
+      snapshot = result.value();
+    }
+    EXPECT_EQ(result.value(), snapshot);
+  }
+  EXPECT_EQ(snapshot->summary.at(SnapshotSummaryFields::kAddedDataFiles), "10");
+
+  auto metadata = LoadMetadata();
+  ASSERT_EQ(metadata->snapshots.size(), 1);
+  EXPECT_EQ(metadata->current_snapshot_id, snapshot->snapshot_id);
+}
+
+TEST_F(GroupCommitterTest, ConcurrentWriters) {
+  constexpr int32_t kWriters = 8;
+  constexpr int32_t kRequestsPerWriter = 5;
+  GroupCommitter committer(catalog_, table_ident_,
+                           {.max_delay = std::chrono::milliseconds(50)});
+  std::vector<std::jthread> writers;
+  std::atomic<int32_t> committed{0};
+  for (int32_t w = 0; w < kWriters; ++w) {
+    writers.emplace_back([&, w]() {
+      for (int32_t r = 0; r < kRequestsPerWriter; ++r) {
+        auto append = committer.NewAppend();
+        for (auto& file : MakeDataFiles((w * kRequestsPerWriter + r) * 2, 2)) {
+          append->AppendFile(std::move(file));
+        }
+        if (append->Commit().has_value()) {
+          ++committed;
+        }
+      }
+    });
+  }
+  writers.clear();
+  EXPECT_EQ(committed, kWriters * kRequestsPerWriter);
+
+  auto metadata = LoadMetadata();
+  // Requests of different writers share snapshots.
+  EXPECT_LT(metadata->snapshots.size(), kWriters * kRequestsPerWriter);
+  auto current = metadata->Snapshot();
+  ASSERT_THAT(current, IsOk());
+  EXPECT_EQ(current.value()->summary.at(SnapshotSummaryFields::kTotalDataFiles),
+            std::to_string(kWriters * kRequestsPerWriter * 2));
+}
+
+TEST_F(GroupCommitterTest, FlushAndClose) {
+  auto committer = std::make_unique<GroupCommitter>(
+      catalog_, table_ident_, GroupCommitOptions{.max_delay = std::chrono::hours(1)});
+  auto first = committer->Submit(MakeDataFiles(0, 1));
+  committer->Flush();
+  ASSERT_THAT(first.get(), IsOk());
+
+  // Requests that are still buffered are committed when the committer is destroyed.
+  auto second = committer->Submit(MakeDataFiles(1, 1));
+  committer.reset();
+  ASSERT_THAT(second.get(), IsOk());
+  EXPECT_EQ(LoadMetadata()->snapshots.size(), 2);
+}
+
+TEST_F(GroupCommitterTest, RejectInvalidRequests) {
+  GroupCommitter committer(catalog_, table_ident_);
+  EXPECT_THAT(committer.Submit({}).get(), IsError(ErrorKind::kInvalidArgument));
+
+  auto files = MakeDataFiles(0, 1);
+  files[0]->content = DataFile::Content::kEqualityDeletes;
+  EXPECT_THAT(committer.Submit(files).get(), IsError(ErrorKind::kInvalidArgument));
+  EXPECT_TRUE(LoadMetadata()->snapshots.empty());
+}
+
+TEST_F(GroupCommitterTest, InvalidRequestsDoNotFailTheirBatch) {
+  GroupCommitter committer(catalog_, table_ident_,
+                           {.max_delay = std::chrono::hours(1), .max_batch_requests = 3});
+  auto unknown_spec = MakeDataFiles(0, 1);
+  unknown_spec[0]->partition_spec_id = 99;
+  auto wrong_arity = MakeDataFiles(1, 1);
+  wrong_arity[0]->partition.push_back(Literal::Long(0));
+  auto unknown_spec_result = committer.Submit(std::move(unknown_spec));
+  auto valid_result = committer.Submit(MakeDataFiles(2, 2));
+  auto wrong_arity_result = committer.Submit(std::move(wrong_arity));
+
+  EXPECT_THAT(unknown_spec_result.get(), IsError(ErrorKind::kInvalidArgument));
+  EXPECT_THAT(wrong_arity_result.get(), IsError(ErrorKind::kInvalidArgument));
+  auto snapshot = valid_result.get();
+  ASSERT_THAT(snapshot, IsOk());
+  EXPECT_EQ(snapshot.value()->summary.at(SnapshotSummaryFields::kAddedDataFiles), "2");
+  EXPECT_EQ(LoadMetadata()->snapshots.size(), 1);
+}
+
+TEST_F(GroupCommitterTest, InvalidOptions) {
+  EXPECT_THROW(GroupCommitter(catalog_, table_ident_, {.max_batch_requests = 0}),
+               IcebergError);
+  EXPECT_THROW(GroupCommitter(catalog_, table_ident_, {.max_batch_files = -1}),
+               IcebergError);
+}
+
+}  // namespace iceberg
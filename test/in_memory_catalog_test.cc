@@ -26,9 +26,12 @@
 #include <gtest/gtest.h>
 
 #include "iceberg/arrow/arrow_fs_file_io_internal.h"
+#include "iceberg/metadata_update.h"
 #include "iceberg/schema.h"
+#include "iceberg/snapshot.h"
 #include "iceberg/table.h"
 #include "iceberg/table_metadata.h"
+#include "iceberg/update_requirement.h"
 #include "matchers.h"
 #include "mock_catalog.h"
 #include "test_common.h"
@@ -167,6 +170,56 @@ TEST_F(InMemoryCatalogTest, RefreshTable) {
   ASSERT_EQ(loaded_table->current_snapshot().value()->snapshot_id, 2);
 }
 
+TEST_F(InMemoryCatalogTest, UpdateTable) {
+  TableIdentifier table_ident{.ns = {}, .name = "t1"};
+
+  std::unique_ptr<TableMetadata> metadata;
+  ASSERT_NO_FATAL_FAILURE(ReadTableMetadata("TableMetadataV2Valid.json", &metadata));
+  auto table_location = GenerateTestTableLocation(table_ident.name);
+  std::filesystem::create_directories(table_location + "metadata");
+  metadata->location = table_location;
+  auto metadata_location = std::format("{}metadata/00000-test.metadata.json",
+                                       table_location);
+  ASSERT_THAT(TableMetadataUtil::Write(*file_io_, metadata_location, *metadata),
+              IsOk());
+  ASSERT_THAT(catalog_->RegisterTable(table_ident, metadata_location), IsOk());
+
+  const int64_t base_snapshot_id = metadata->current_snapshot_id;
+  auto snapshot = std::make_shared<Snapshot>(Snapshot{
+      .snapshot_id = 42,
+      .parent_snapshot_id = base_snapshot_id,
+      .sequence_number = metadata->last_sequence_number + 1,
+      .timestamp_ms = metadata->last_updated_ms + std::chrono::milliseconds(1),
+      .manifest_list = "s3://a/b/3.avro",
+      .summary = {{SnapshotSummaryFields::kOperation, DataOperation::kAppend}},
+  });
+  std::vector<std::unique_ptr<UpdateRequirement>> requirements;
+  requirements.push_back(
+      std::make_unique<AssertRefSnapshotId>(SnapshotRef::kMainBranch, base_snapshot_id));
+  std::vector<std::unique_ptr<MetadataUpdate>> updates;
+  updates.push_back(std::make_unique<AddSnapshot>(snapshot));
+  updates.push_back(std::make_unique<SetSnapshotRef>(SnapshotRef::kMainBranch, 42,
+                                                     SnapshotRefType::kBranch));
+
+  auto table = catalog_->UpdateTable(table_ident, requirements, updates);
+  ASSERT_THAT(table, IsOk());
+  EXPECT_EQ(table.value()->current_snapshot().value()->snapshot_id, 42);
+  EXPECT_TRUE(table.value()->metadata_location().starts_with(
+      std::format("{}metadata/00001-", table_location)));
+  ASSERT_FALSE(table.value()->metadata()->metadata_log.empty());
+  EXPECT_EQ(table.value()->metadata()->metadata_log.back().metadata_file,
+            metadata_location);
+
+  auto loaded = catalog_->LoadTable(table_ident);
+  ASSERT_THAT(loaded, IsOk());
+  EXPECT_EQ(loaded.value()->metadata_location(), table.value()->metadata_location());
+  EXPECT_EQ(loaded.value()->current_snapshot().value()->snapshot_id, 42);
+
+  // The main branch has moved, so a commit based on the old snapshot fails.
+  auto stale = catalog_->UpdateTable(table_ident, requirements, {});
+  EXPECT_THAT(stale, IsError(ErrorKind::kCommitFailed));
+}
+
 TEST_F(InMemoryCatalogTest, DropTable) {
   TableIdentifier tableIdent{.ns = {}, .name = "t1"};
   auto result = catalog_->DropTable(tableIdent, false);
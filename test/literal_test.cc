@@ -383,4 +383,47 @@ TEST(LiteralTest, DoubleZeroComparison) {
   EXPECT_EQ(neg_zero <=> pos_zero, std::partial_ordering::less);
 }
 
+TEST(LiteralTest, SerializeRoundTrip) {
+  for (const auto& literal : std::vector<Literal>{
+           Literal::Boolean(true), Literal::Int(-42), Literal::Date(19000),
+           Literal::Long(std::numeric_limits<int64_t>::min()), Literal::Time(3600000000),
+           Literal::Timestamp(1700000000000000), Literal::TimestampTz(-1),
+           Literal::Float(1.5f), Literal::Double(-0.0), Literal::String("iceberg"),
+           Literal::Binary({0x00, 0x01, 0xFF})}) {
+    auto serialized = literal.Serialize();
+    ASSERT_THAT(serialized, IsOk()) << literal.ToString();
+    auto deserialized = Literal::Deserialize(serialized.value(), literal.type());
+    ASSERT_THAT(deserialized, IsOk()) << literal.ToString();
+    EXPECT_EQ(deserialized.value(), literal) << literal.ToString();
+  }
+}
+
+TEST(LiteralTest, SerializeLittleEndian) {
+  EXPECT_EQ(Literal::Int(1).Serialize().value(), (std::vector<uint8_t>{1, 0, 0, 0}));
+  EXPECT_EQ(Literal::Long(0x0102).Serialize().value(),
+            (std::vector<uint8_t>{2, 1, 0, 0, 0, 0, 0, 0}));
+  EXPECT_EQ(Literal::Float(1.0f).Serialize().value(),
+            (std::vector<uint8_t>{0x00, 0x00, 0x80, 0x3F}));
+  EXPECT_EQ(Literal::String("ab").Serialize().value(), (std::vector<uint8_t>{'a', 'b'}));
+}
+
+TEST(LiteralTest, DeserializePromotedValues) {
+  // Bounds of int and float columns promoted to long and double keep 4 bytes.
+  auto long_literal = Literal::Deserialize(Literal::Int(-7).Serialize().value(), int64());
+  ASSERT_THAT(long_literal, IsOk());
+  EXPECT_EQ(long_literal.value(), Literal::Long(-7));
+  auto double_literal =
+      Literal::Deserialize(Literal::Float(2.5f).Serialize().value(), float64());
+  ASSERT_THAT(double_literal, IsOk());
+  EXPECT_EQ(double_literal.value(), Literal::Double(2.5));
+}
+
+TEST(LiteralTest, DeserializeInvalidSize) {
+  std::vector<uint8_t> data{1, 2, 3};
+  EXPECT_THAT(Literal::Deserialize(data, int32()), IsError(ErrorKind::kInvalidArgument));
+  EXPECT_THAT(Literal::Deserialize(data, int64()), IsError(ErrorKind::kInvalidArgument));
+  EXPECT_THAT(Literal::Deserialize(data, boolean()),
+              IsError(ErrorKind::kInvalidArgument));
+}
+
 }  // namespace iceberg
@@ -0,0 +1,282 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/manifest_writer.h"
+
+#include <arrow/filesystem/localfs.h>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "iceberg/arrow/arrow_fs_file_io_internal.h"
+#include "iceberg/avro/avro_register.h"
+#include "iceberg/manifest_entry.h"
+#include "iceberg/manifest_list.h"
+#include "iceberg/manifest_reader.h"
+#include "iceberg/schema.h"
+#include "matchers.h"
+#include "temp_file_test_base.h"
+
+namespace iceberg {
+
+class ManifestWriterTest : public TempFileTestBase {
+ protected:
+  static void SetUpTestSuite() { avro::RegisterAll(); }
+
+  void SetUp() override {
+    TempFileTestBase::SetUp();
+    local_fs_ = std::make_shared<::arrow::fs::LocalFileSystem>();
+    file_io_ = std::make_shared<iceberg::arrow::ArrowFileSystemFileIO>(local_fs_);
+    partition_schema_ = std::make_shared<Schema>(
+        std::vector<SchemaField>{SchemaField::MakeOptional(1000, "id_bucket", int32())});
+  }
+
+  ManifestEntry MakeEntry(int64_t snapshot_id, int64_t sequence_number,
+                          int32_t bucket) {
+    auto data_file = std::make_shared<DataFile>();
+    data_file->file_path = "s3://bucket/data/" + std::to_string(sequence_number) +
+                           ".parquet";
+    data_file->file_format = FileFormatType::kParquet;
+    data_file->partition = {Literal::Int(bucket)};
+    data_file->record_count = 100 + sequence_number;
+    data_file->file_size_in_bytes = 4096;
+    data_file->column_sizes = {{1, 1024}, {2, 2048}};
+    data_file->value_counts = {{1, 100}, {2, 100}};
+    data_file->null_value_counts = {{1, 0}, {2, 7}};
+    data_file->lower_bounds = {{1, {0x01, 0x00, 0x00, 0x00}}};
+    data_file->upper_bounds = {{1, {0x64, 0x00, 0x00, 0x00}}};
+    data_file->split_offsets = {4, 2048};
+    data_file->sort_order_id = 0;
+    return ManifestEntry{.status = ManifestStatus::kAdded,
+                         .snapshot_id = snapshot_id,
+                         .sequence_number = sequence_number,
+                         .file_sequence_number = sequence_number,
+                         .data_file = std::move(data_file)};
+  }
+
+  std::vector<ManifestEntry> ReadEntries(const std::string& path) {
+    auto reader = ManifestReader::Make(path, file_io_, partition_schema_);
+    EXPECT_THAT(reader, IsOk());
+    auto entries = reader.value()->Entries();
+    EXPECT_THAT(entries, IsOk());
+    return entries.value();
+  }
+
+  std::vector<ManifestFile> ReadFiles(const std::string& path) {
+    auto reader = ManifestListReader::Make(path, file_io_);
+    EXPECT_THAT(reader, IsOk());
+    auto files = reader.value()->Files();
+    EXPECT_THAT(files, IsOk());
+    return files.value();
+  }
+
+  std::shared_ptr<::arrow::fs::LocalFileSystem> local_fs_;
+  std::shared_ptr<FileIO> file_io_;
+  std::shared_ptr<Schema> partition_schema_;
+};
+
+TEST_F(ManifestWriterTest, WriteV2ManifestRoundTrip) {
+  std::string path = CreateNewTempFilePathWithSuffix(".avro");
+  auto writer = ManifestWriter::MakeV2Writer(42, path, file_io_, partition_schema_);
+  ASSERT_THAT(writer, IsOk());
+
+  // More entries than one batch, ending with a delete file.
+  std::vector<ManifestEntry> entries;
+  for (int64_t i = 0; i < ManifestAdapter::kBatchSize + 3; ++i) {
+    entries.push_back(MakeEntry(42, i, static_cast<int32_t>(i % 16)));
+  }
+  entries.back().data_file->content = DataFile::Content::kEqualityDeletes;
+  entries.back().data_file->equality_ids = {1, 2};
+  entries.back().data_file->split_offsets.clear();
+  entries.back().data_file->column_sizes.clear();
+  entries.back().data_file->key_metadata = {0xCA, 0xFE};
+
+  ASSERT_THAT(writer.value()->AddAll(entries), IsOk());
+  ASSERT_THAT(writer.value()->Close(), IsOk());
+
+  EXPECT_EQ(ReadEntries(path), entries);
+}
+
+TEST_F(ManifestWriterTest, WriteV3ManifestRoundTrip) {
+  std::string path = CreateNewTempFilePathWithSuffix(".avro");
+  auto writer = ManifestWriter::MakeV3Writer(42, /*first_row_id=*/0, path, file_io_,
+                                             partition_schema_);
+  ASSERT_THAT(writer, IsOk());
+
+  auto data = MakeEntry(42, 3, 7);
+  data.data_file->first_row_id = 1000;
+  auto deletes = MakeEntry(42, 3, 7);
+  deletes.data_file->content = DataFile::Content::kPositionDeletes;
+  deletes.data_file->file_format = FileFormatType::kPuffin;
+  deletes.data_file->referenced_data_file = data.data_file->file_path;
+  deletes.data_file->content_offset = 4;
+  deletes.data_file->content_size_in_bytes = 64;
+
+  ASSERT_THAT(writer.value()->Add(data), IsOk());
+  ASSERT_THAT(writer.value()->Add(deletes), IsOk());
+  ASSERT_THAT(writer.value()->Close(), IsOk());
+
+  EXPECT_EQ(ReadEntries(path), (std::vector<ManifestEntry>{data, deletes}));
+}
+
+TEST_F(ManifestWriterTest, UnassignedSequenceNumberFromOtherSnapshot) {
+  std::string path = CreateNewTempFilePathWithSuffix(".avro");
+  auto writer = ManifestWriter::MakeV2Writer(42, path, file_io_, partition_schema_);
+  ASSERT_THAT(writer, IsOk());
+
+  auto entry = MakeEntry(41, 1, 1);
+  entry.sequence_number = std::nullopt;
+  EXPECT_THAT(writer.value()->Add(entry), IsError(ErrorKind::kInvalidManifest));
+
+  entry.snapshot_id = 42;
+  entry.status = ManifestStatus::kExisting;
+  EXPECT_THAT(writer.value()->Add(entry), IsError(ErrorKind::kInvalidManifest));
+
+  entry.status = ManifestStatus::kAdded;
+  EXPECT_THAT(writer.value()->Add(entry), IsOk());
+  ASSERT_THAT(writer.value()->Close(), IsOk());
+}
+
+TEST_F(ManifestWriterTest, UnassignedSequenceNumberWithoutSnapshotId) {
+  std::string path = CreateNewTempFilePathWithSuffix(".avro");
+  auto writer = ManifestWriter::MakeV2Writer(42, path, file_io_, partition_schema_);
+  ASSERT_THAT(writer, IsOk());
+
+  // The snapshot id is inherited along with the sequence number.
+  auto entry = MakeEntry(42, 1, 1);
+  entry.snapshot_id = std::nullopt;
+  entry.sequence_number = std::nullopt;
+  entry.file_sequence_number = std::nullopt;
+  EXPECT_THAT(writer.value()->Add(entry), IsOk());
+  ASSERT_THAT(writer.value()->Close(), IsOk());
+
+  EXPECT_EQ(ReadEntries(path), std::vector<ManifestEntry>{entry});
+}
+
+TEST_F(ManifestWriterTest, WriteV3ManifestAssignsRowIds) {
+  std::string path = CreateNewTempFilePathWithSuffix(".avro");
+  auto writer = ManifestWriter::MakeV3Writer(42, /*first_row_id=*/1000, path, file_io_,
+                                             partition_schema_);
+  ASSERT_THAT(writer, IsOk());
+
+  auto added = MakeEntry(42, 1, 1);
+  auto assigned = MakeEntry(42, 2, 1);
+  assigned.data_file->first_row_id = 7;
+  auto deleted = MakeEntry(42, 3, 1);
+  deleted.status = ManifestStatus::kDeleted;
+  auto deletes = MakeEntry(42, 4, 1);
+  deletes.data_file->content = DataFile::Content::kPositionDeletes;
+  auto existing = MakeEntry(42, 5, 1);
+  existing.status = ManifestStatus::kExisting;
+
+  ASSERT_THAT(writer.value()->AddAll({added, assigned, deleted, deletes, existing}),
+              IsOk());
+  ASSERT_THAT(writer.value()->Close(), IsOk());
+  // The entries of the caller are not modified.
+  ASSERT_FALSE(added.data_file->first_row_id.has_value());
+
+  auto entries = ReadEntries(path);
+  ASSERT_EQ(entries.size(), 5);
+  EXPECT_EQ(entries[0].data_file->first_row_id, 1000);
+  EXPECT_EQ(entries[1].data_file->first_row_id, 7);
+  EXPECT_FALSE(entries[2].data_file->first_row_id.has_value());
+  EXPECT_FALSE(entries[3].data_file->first_row_id.has_value());
+  // The record count of the first added entry is 101.
+  EXPECT_EQ(entries[4].data_file->first_row_id, 1101);
+}
+
+TEST_F(ManifestWriterTest, WriteV3ManifestListAssignsRowIds) {
+  std::string path = CreateNewTempFilePathWithSuffix(".avro");
+  auto writer = ManifestListWriter::MakeV3Writer(
+      /*snapshot_id=*/42, /*parent_snapshot_id=*/41, /*sequence_number=*/5,
+      /*first_row_id=*/1000, path, file_io_);
+  ASSERT_THAT(writer, IsOk());
+
+  ManifestFile added{.manifest_path = "s3://bucket/metadata/added-m0.avro",
+                     .manifest_length = 6185,
+                     .partition_spec_id = 0,
+                     .content = ManifestFile::Content::kData,
+                     .sequence_number = TableMetadata::kInvalidSequenceNumber,
+                     .min_sequence_number = TableMetadata::kInvalidSequenceNumber,
+                     .added_snapshot_id = 42,
+                     .added_files_count = 2,
+                     .existing_files_count = 1,
+                     .deleted_files_count = 0,
+                     .added_rows_count = 200,
+                     .existing_rows_count = 50,
+                     .deleted_rows_count = 0,
+                     .partitions = {{.contains_null = true,
+                                     .contains_nan = false,
+                                     .lower_bound = std::vector<uint8_t>{0x01},
+                                     .upper_bound = std::vector<uint8_t>{0x0F}}}};
+  ManifestFile existing = added;
+  existing.manifest_path = "s3://bucket/metadata/existing-m0.avro";
+  existing.sequence_number = 3;
+  existing.min_sequence_number = 2;
+  existing.added_snapshot_id = 40;
+  existing.partitions.clear();
+  existing.first_row_id = 10;
+  ManifestFile deletes = added;
+  deletes.manifest_path = "s3://bucket/metadata/deletes-m0.avro";
+  deletes.content = ManifestFile::Content::kDeletes;
+  deletes.partitions.push_back({.contains_null = false});
+
+  ASSERT_THAT(writer.value()->AddAll({added, existing, deletes, added}), IsOk());
+  ASSERT_THAT(writer.value()->Close(), IsOk());
+
+  auto files = ReadFiles(path);
+  ASSERT_EQ(files.size(), 4);
+  added.sequence_number = 5;
+  added.min_sequence_number = 5;
+  added.first_row_id = 1000;
+  deletes.sequence_number = 5;
+  deletes.min_sequence_number = 5;
+  EXPECT_EQ(files[0], added);
+  EXPECT_EQ(files[1], existing);
+  EXPECT_EQ(files[2], deletes);
+  added.first_row_id = 1250;
+  EXPECT_EQ(files[3], added);
+}
+
+TEST_F(ManifestWriterTest, WriteV2ManifestListDropsRowIds) {
+  std::string path = CreateNewTempFilePathWithSuffix(".avro");
+  auto writer = ManifestListWriter::MakeV2Writer(
+      /*snapshot_id=*/42, /*parent_snapshot_id=*/std::nullopt, /*sequence_number=*/1,
+      path, file_io_);
+  ASSERT_THAT(writer, IsOk());
+
+  ManifestFile file{.manifest_path = "s3://bucket/metadata/m0.avro",
+                    .manifest_length = 100,
+                    .sequence_number = 1,
+                    .min_sequence_number = 1,
+                    .added_snapshot_id = 42,
+                    .first_row_id = 7};
+  ManifestFile unassigned = file;
+  unassigned.added_snapshot_id = 41;
+  unassigned.sequence_number = TableMetadata::kInvalidSequenceNumber;
+  EXPECT_THAT(writer.value()->Add(unassigned), IsError(ErrorKind::kInvalidManifestList));
+  ASSERT_THAT(writer.value()->Add(file), IsOk());
+  ASSERT_THAT(writer.value()->Close(), IsOk());
+
+  auto files = ReadFiles(path);
+  ASSERT_EQ(files.size(), 1);
+  file.first_row_id = std::nullopt;
+  EXPECT_EQ(files[0], file);
+}
+
+}  // namespace iceberg
@@ -25,6 +25,7 @@
 #include <gtest/gtest.h>
 #include <nlohmann/json.hpp>
 
+#include "iceberg/json_internal.h"
 #include "iceberg/partition_field.h"
 #include "iceberg/partition_spec.h"
 #include "iceberg/schema.h"
@@ -35,6 +36,7 @@
 #include "iceberg/table_metadata.h"
 #include "iceberg/transform.h"
 #include "iceberg/type.h"
+#include "matchers.h"
 #include "test_common.h"
 
 namespace iceberg {
@@ -202,4 +204,63 @@ TEST_F(MetadataSerdeTest, DeserializeV2Valid) {
   }
 }
 
+TEST_F(MetadataSerdeTest, StreamingParserMatchesDomParser) {
+  for (const auto* file_name :
+       {"TableMetadataV1Valid.json", "TableMetadataV2Valid.json",
+        "TableMetadataV2ValidMinimal.json", "TableMetadataV3ValidMinimal.json",
+        "TableMetadataStatisticsFiles.json", "TableMetadataPartitionStatisticsFiles.json",
+        "TableMetadataUnsupportedVersion.json", "TableMetadataV1MissingSchemaType.json",
+        "TableMetadataV2CurrentSchemaNotFound.json",
+        "TableMetadataV2MissingLastPartitionId.json",
+        "TableMetadataV2MissingPartitionSpecs.json", "TableMetadataV2MissingSchemas.json",
+        "TableMetadataV2MissingSortOrder.json"}) {
+    SCOPED_TRACE(file_name);
+    std::string content;
+    ASSERT_NO_FATAL_FAILURE(ReadJsonFile(file_name, &content));
+    auto expected = TableMetadataFromJson(nlohmann::json::parse(content));
+    auto metadata = TableMetadataFromJsonString(content);
+    if (expected.has_value()) {
+      ASSERT_THAT(metadata, IsOk());
+      EXPECT_EQ(*metadata.value(), *expected.value());
+    } else {
+      EXPECT_THAT(metadata, IsError(ErrorKind::kJsonParseError));
+    }
+  }
+}
+
+TEST_F(MetadataSerdeTest, StreamingParserRejectsInvalidSnapshots) {
+  std::string content;
+  ASSERT_NO_FATAL_FAILURE(ReadJsonFile("TableMetadataV2Valid.json", &content));
+  const auto valid = nlohmann::json::parse(content);
+
+  auto expect_error = [](const nlohmann::json& json) {
+    EXPECT_THAT(TableMetadataFromJson(json), IsError(ErrorKind::kJsonParseError));
+    EXPECT_THAT(TableMetadataFromJsonString(json.dump()),
+                IsError(ErrorKind::kJsonParseError));
+  };
+  auto json = valid;
+  json["snapshots"][0]["snapshot-id"] = "not a number";
+  expect_error(json);
+  json = valid;
+  json["snapshots"][1].erase("manifest-list");
+  expect_error(json);
+  json = valid;
+  json["snapshots"][1]["summary"]["operation"] = "unknown";
+  expect_error(json);
+  json = valid;
+  json["snapshots"][1]["summary"]["added-data-files"] = 1;
+  expect_error(json);
+  json = valid;
+  json["snapshot-log"][0].erase("timestamp-ms");
+  expect_error(json);
+  json = valid;
+  json["metadata-log"] = nlohmann::json::array({1});
+  expect_error(json);
+
+  EXPECT_THAT(TableMetadataFromJsonString(content + "}"),
+              IsError(ErrorKind::kJsonParseError));
+  EXPECT_THAT(TableMetadataFromJsonString(content.substr(0, content.size() / 2)),
+              IsError(ErrorKind::kJsonParseError));
+}
+
 }  // namespace iceberg
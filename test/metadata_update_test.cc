@@ -0,0 +1,137 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/metadata_update.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "iceberg/snapshot.h"
+#include "iceberg/table_metadata.h"
+#include "iceberg/update_requirement.h"
+#include "matchers.h"
+
+namespace iceberg {
+
+namespace {
+
+TableMetadata MakeMetadata(int8_t format_version) {
+  return TableMetadata{
+      .format_version = format_version,
+      .table_uuid = "9c12d441-03fe-4693-9a96-a0705ddf69c1",
+      .location = "s3://bucket/test/location",
+      .last_sequence_number = 1,
+      .last_updated_ms = TimePointMs{std::chrono::milliseconds(1000)},
+      .current_snapshot_id = 1,
+      .snapshots = {std::make_shared<Snapshot>(Snapshot{
+          .snapshot_id = 1,
+          .sequence_number = 1,
+          .timestamp_ms = TimePointMs{std::chrono::milliseconds(1000)},
+      })},
+      .refs = {{SnapshotRef::kMainBranch,
+                std::make_shared<SnapshotRef>(SnapshotRef{
+                    .snapshot_id = 1, .retention = SnapshotRef::Branch{}})}},
+      .next_row_id = 100,
+  };
+}
+
+std::shared_ptr<Snapshot> MakeSnapshot(int64_t snapshot_id, int64_t sequence_number) {
+  return std::make_shared<Snapshot>(Snapshot{
+      .snapshot_id = snapshot_id,
+      .parent_snapshot_id = 1,
+      .sequence_number = sequence_number,
+      .timestamp_ms = TimePointMs{std::chrono::milliseconds(2000)},
+  });
+}
+
+}  // namespace
+
+TEST(MetadataUpdateTest, AddSnapshotAndSetMainBranch) {
+  auto metadata = MakeMetadata(/*format_version=*/2);
+  ASSERT_THAT(AddSnapshot(MakeSnapshot(2, 2)).ApplyTo(metadata), IsOk());
+  EXPECT_EQ(metadata.snapshots.size(), 2);
+  EXPECT_EQ(metadata.last_sequence_number, 2);
+  // Adding a snapshot does not move the main branch.
+  EXPECT_EQ(metadata.current_snapshot_id, 1);
+  EXPECT_EQ(metadata.refs[SnapshotRef::kMainBranch]->snapshot_id, 1);
+
+  ASSERT_THAT(SetSnapshotRef(SnapshotRef::kMainBranch, 2, SnapshotRefType::kBranch)
+                  .ApplyTo(metadata),
+              IsOk());
+  EXPECT_EQ(metadata.current_snapshot_id, 2);
+  EXPECT_EQ(metadata.refs[SnapshotRef::kMainBranch]->snapshot_id, 2);
+  EXPECT_EQ(metadata.last_updated_ms, TimePointMs{std::chrono::milliseconds(2000)});
+  ASSERT_EQ(metadata.snapshot_log.size(), 1);
+  EXPECT_EQ(metadata.snapshot_log[0].snapshot_id, 2);
+}
+
+TEST(MetadataUpdateTest, AddSnapshotAdvancesNextRowId) {
+  auto v2 = MakeMetadata(/*format_version=*/2);
+  ASSERT_THAT(AddSnapshot(MakeSnapshot(2, 2), /*added_rows=*/50).ApplyTo(v2), IsOk());
+  EXPECT_EQ(v2.next_row_id, 100);
+
+  auto v3 = MakeMetadata(/*format_version=*/3);
+  ASSERT_THAT(AddSnapshot(MakeSnapshot(2, 2), /*added_rows=*/50).ApplyTo(v3), IsOk());
+  EXPECT_EQ(v3.next_row_id, 150);
+}
+
+TEST(MetadataUpdateTest, RejectInvalidSnapshots) {
+  auto metadata = MakeMetadata(/*format_version=*/2);
+  EXPECT_THAT(AddSnapshot(MakeSnapshot(1, 2)).ApplyTo(metadata),
+              IsError(ErrorKind::kAlreadyExists));
+  EXPECT_THAT(AddSnapshot(MakeSnapshot(2, 1)).ApplyTo(metadata),
+              IsError(ErrorKind::kCommitFailed));
+  EXPECT_THAT(SetSnapshotRef(SnapshotRef::kMainBranch, 3, SnapshotRefType::kBranch)
+                  .ApplyTo(metadata),
+              IsError(ErrorKind::kNotFound));
+  EXPECT_THAT(SetSnapshotRef(SnapshotRef::kMainBranch, 1, SnapshotRefType::kTag)
+                  .ApplyTo(metadata),
+              IsError(ErrorKind::kInvalidArgument));
+}
+
+TEST(MetadataUpdateTest, SetTag) {
+  auto metadata = MakeMetadata(/*format_version=*/2);
+  ASSERT_THAT(SetSnapshotRef("v1", 1, SnapshotRefType::kTag).ApplyTo(metadata), IsOk());
+  ASSERT_TRUE(metadata.refs.contains("v1"));
+  EXPECT_EQ(metadata.refs["v1"]->type(), SnapshotRefType::kTag);
+  EXPECT_TRUE(metadata.snapshot_log.empty());
+}
+
+TEST(UpdateRequirementTest, AssertTableUUID) {
+  auto metadata = MakeMetadata(/*format_version=*/2);
+  EXPECT_THAT(AssertTableUUID(metadata.table_uuid).Validate(metadata), IsOk());
+  EXPECT_THAT(AssertTableUUID("other").Validate(metadata),
+              IsError(ErrorKind::kCommitFailed));
+}
+
+TEST(UpdateRequirementTest, AssertRefSnapshotId) {
+  auto metadata = MakeMetadata(/*format_version=*/2);
+  EXPECT_THAT(AssertRefSnapshotId(SnapshotRef::kMainBranch, 1).Validate(metadata),
+              IsOk());
+  EXPECT_THAT(AssertRefSnapshotId(SnapshotRef::kMainBranch, 2).Validate(metadata),
+              IsError(ErrorKind::kCommitFailed));
+  EXPECT_THAT(
+      AssertRefSnapshotId(SnapshotRef::kMainBranch, std::nullopt).Validate(metadata),
+      IsError(ErrorKind::kCommitFailed));
+  EXPECT_THAT(AssertRefSnapshotId("branch", std::nullopt).Validate(metadata), IsOk());
+  EXPECT_THAT(AssertRefSnapshotId("branch", 1).Validate(metadata),
+              IsError(ErrorKind::kCommitFailed));
+}
+
+}  // namespace iceberg
@@ -0,0 +1,178 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/metrics_config.h"
+
+#include <string>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include "iceberg/schema.h"
+#include "iceberg/type.h"
+#include "iceberg/util/truncate_util.h"
+#include "matchers.h"
+
+namespace iceberg {
+
+TEST(MetricsModeTest, FromString) {
+  EXPECT_EQ(MetricsMode::FromString("none"), MetricsMode::None());
+  EXPECT_EQ(MetricsMode::FromString("Counts"), MetricsMode::Counts());
+  EXPECT_EQ(MetricsMode::FromString("FULL"), MetricsMode::Full());
+  EXPECT_EQ(MetricsMode::FromString("truncate(16)"), MetricsMode::Truncate(16));
+  EXPECT_EQ(MetricsMode::Truncate(8).ToString(), "truncate(8)");
+
+  for (const auto& mode : {"", "truncate", "truncate()", "truncate(0)", "truncate(x)",
+                           "truncate(-1)", "all"}) {
+    EXPECT_THAT(MetricsMode::FromString(mode), IsError(ErrorKind::kInvalidArgument))
+        << mode;
+  }
+}
+
+TEST(MetricsModeTest, TruncateBounds) {
+  auto mode = MetricsMode::Truncate(2);
+  EXPECT_EQ(mode.LowerBound(Literal::String("abc")), Literal::String("ab"));
+  EXPECT_EQ(mode.UpperBound(Literal::String("abc")), Literal::String("ac"));
+  EXPECT_EQ(mode.UpperBound(Literal::String("ab")), Literal::String("ab"));
+  // Code points, not bytes, are counted.
+  EXPECT_EQ(mode.LowerBound(Literal::String("\u00E9\u00E9\u00E9")),
+            Literal::String("\u00E9\u00E9"));
+  EXPECT_EQ(mode.UpperBound(Literal::String("\u00E9\u00E9\u00E9")),
+            Literal::String("\u00E9\u00EA"));
+  EXPECT_EQ(mode.UpperBound(Literal::String("a\U0010FFFF\U0010FFFF")),
+            Literal::String("b"));
+  EXPECT_EQ(mode.UpperBound(Literal::String("\U0010FFFF\U0010FFFFa")), std::nullopt);
+
+  EXPECT_EQ(mode.LowerBound(Literal::Binary({1, 2, 3})), Literal::Binary({1, 2}));
+  EXPECT_EQ(mode.UpperBound(Literal::Binary({1, 2, 3})), Literal::Binary({1, 3}));
+  EXPECT_EQ(mode.UpperBound(Literal::Binary({1, 0xFF, 3})), Literal::Binary({2}));
+  EXPECT_EQ(mode.UpperBound(Literal::Binary({0xFF, 0xFF, 3})), std::nullopt);
+
+  // Other types are not truncated.
+  EXPECT_EQ(mode.LowerBound(Literal::Long(12345)), Literal::Long(12345));
+  EXPECT_EQ(mode.UpperBound(Literal::Long(12345)), Literal::Long(12345));
+
+  EXPECT_EQ(MetricsMode::Full().UpperBound(Literal::String("abc")),
+            Literal::String("abc"));
+  EXPECT_EQ(MetricsMode::Counts().LowerBound(Literal::String("abc")), std::nullopt);
+  EXPECT_EQ(MetricsMode::None().UpperBound(Literal::Long(1)), std::nullopt);
+}
+
+TEST(TruncateUtilsTest, TruncateUTF8Max) {
+  // Surrogates are skipped when rounding up.
+  EXPECT_EQ(TruncateUtils::TruncateUTF8Max("\uD7FFa", 1), "\uE000");
+  EXPECT_EQ(TruncateUtils::TruncateUTF8Max("abc", 5), "abc");
+}
+
+TEST(TruncateUtilsTest, UTF8PrefixLength) {
+  // Strings longer than the 16-byte blocks that are scanned at once, with code point
+  // boundaries in and across blocks.
+  const std::string ascii = "abcdefghijklmnopqrstuvwxyz0123456789";
+  EXPECT_EQ(TruncateUtils::UTF8PrefixLength(ascii, 0), 0);
+  EXPECT_EQ(TruncateUtils::UTF8PrefixLength(ascii, 15), 15);
+  EXPECT_EQ(TruncateUtils::UTF8PrefixLength(ascii, 16), 16);
+  EXPECT_EQ(TruncateUtils::UTF8PrefixLength(ascii, 17), 17);
+  EXPECT_EQ(TruncateUtils::UTF8PrefixLength(ascii, 36), 36);
+  EXPECT_EQ(TruncateUtils::UTF8PrefixLength(ascii, 100), 36);
+
+  // 4-byte code points between ASCII ones, starting at varying offsets in the blocks.
+  std::string emoji;
+  for (int i = 0; i < 10; ++i) {
+    emoji += "a\U0001F61C";
+  }
+  EXPECT_EQ(TruncateUtils::UTF8PrefixLength(emoji, 1), 1);
+  EXPECT_EQ(TruncateUtils::UTF8PrefixLength(emoji, 4), 10);
+  EXPECT_EQ(TruncateUtils::UTF8PrefixLength(emoji, 7), 16);
+  EXPECT_EQ(TruncateUtils::UTF8PrefixLength(emoji, 19), 46);
+  EXPECT_EQ(TruncateUtils::UTF8PrefixLength(emoji, 20), 50);
+
+  EXPECT_EQ(TruncateUtils::TruncateUTF8(emoji, 4), "a\U0001F61Ca\U0001F61C");
+  EXPECT_EQ(TruncateUtils::TruncateUTF8Max(emoji, 2), "a\U0001F61D");
+}
+
+class MetricsConfigTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    schema_ = std::make_shared<Schema>(std::vector<SchemaField>{
+        SchemaField::MakeRequired(1, "id", int64()),
+        SchemaField::MakeOptional(
+            2, "location",
+            struct_({SchemaField::MakeOptional(3, "lat", float64()),
+                     SchemaField::MakeOptional(4, "long", float64())})),
+        SchemaField::MakeOptional(5, "data", string()),
+    });
+  }
+
+  std::shared_ptr<Schema> schema_;
+};
+
+TEST_F(MetricsConfigTest, Default) {
+  auto config = MetricsConfig::Make({}, *schema_);
+  ASSERT_THAT(config, IsOk());
+  for (int32_t field_id : {1, 3, 4, 5}) {
+    EXPECT_EQ(config->ColumnMode(field_id), MetricsMode::Truncate(16));
+  }
+  EXPECT_EQ(MetricsConfig::Default().ColumnMode(1), MetricsMode::Truncate(16));
+}
+
+TEST_F(MetricsConfigTest, ColumnModes) {
+  auto config = MetricsConfig::Make(
+      {{"write.metadata.metrics.default", "counts"},
+       {"write.metadata.metrics.column.location.lat", "full"},
+       {"write.metadata.metrics.column.data", "truncate(4)"},
+       {"write.metadata.metrics.column.missing", "none"}},
+      *schema_);
+  ASSERT_THAT(config, IsOk());
+  EXPECT_EQ(config->ColumnMode(1), MetricsMode::Counts());
+  EXPECT_EQ(config->ColumnMode(3), MetricsMode::Full());
+  EXPECT_EQ(config->ColumnMode(4), MetricsMode::Counts());
+  EXPECT_EQ(config->ColumnMode(5), MetricsMode::Truncate(4));
+
+  EXPECT_THAT(
+      MetricsConfig::Make({{"write.metadata.metrics.column.data", "truncate"}}, *schema_),
+      IsError(ErrorKind::kInvalidArgument));
+}
+
+TEST_F(MetricsConfigTest, MaxInferredColumnDefaults) {
+  auto config = MetricsConfig::Make(
+      {{"write.metadata.metrics.max-inferred-column-defaults", "2"},
+       {"write.metadata.metrics.column.data", "full"}},
+      *schema_);
+  ASSERT_THAT(config, IsOk());
+  // Only the first two primitive columns get the inferred default.
+  EXPECT_EQ(config->ColumnMode(1), MetricsMode::Truncate(16));
+  EXPECT_EQ(config->ColumnMode(3), MetricsMode::Truncate(16));
+  EXPECT_EQ(config->ColumnMode(4), MetricsMode::None());
+  EXPECT_EQ(config->ColumnMode(5), MetricsMode::Full());
+
+  // The limit does not apply when the default mode is set.
+  config = MetricsConfig::Make(
+      {{"write.metadata.metrics.max-inferred-column-defaults", "2"},
+       {"write.metadata.metrics.default", "counts"}},
+      *schema_);
+  ASSERT_THAT(config, IsOk());
+  EXPECT_EQ(config->ColumnMode(4), MetricsMode::Counts());
+
+  EXPECT_THAT(
+      MetricsConfig::Make({{"write.metadata.metrics.max-inferred-column-defaults", "-1"}},
+                          *schema_),
+      IsError(ErrorKind::kInvalidArgument));
+}
+
+}  // namespace iceberg
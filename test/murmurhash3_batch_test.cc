@@ -0,0 +1,114 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/util/murmurhash3_batch_internal.h"
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "iceberg/util/murmurhash3_internal.h"
+
+namespace iceberg {
+
+namespace {
+
+// Lengths below, at and above multiples of the 4, 8 and 16 SIMD lanes.
+constexpr size_t kLengths[] = {0, 1, 3, 4, 7, 8, 9, 15, 16, 17, 31, 33, 100};
+
+int32_t Hash(const void* key, int length) {
+  int32_t hash = 0;
+  MurmurHash3_x86_32(key, length, 0, &hash);
+  return hash;
+}
+
+}  // namespace
+
+TEST(MurmurHash3BatchTest, SpecHashes) {
+  std::vector<int32_t> out(1);
+  MurmurHash3_x86_32_Longs(std::vector<int64_t>{34}, out);
+  EXPECT_EQ(out[0], 2017239379);
+  MurmurHash3_x86_32_IntsAsLongs(std::vector<int32_t>{34}, out);
+  EXPECT_EQ(out[0], 2017239379);
+  MurmurHash3_x86_32_IntsAsLongs(std::vector<int32_t>{17486}, out);
+  EXPECT_EQ(out[0], -653330422);
+  MurmurHash3_x86_32_Longs(std::vector<int64_t>{1510871468000000}, out);
+  EXPECT_EQ(out[0], -2047944441);
+  const uint8_t uuid[] = {0xf7, 0x9c, 0x3e, 0x09, 0x67, 0x7c, 0x4b, 0xbd,
+                          0xa4, 0x79, 0x3f, 0x34, 0x9c, 0xb7, 0x85, 0xe7};
+  MurmurHash3_x86_32_Fixed16(uuid, out);
+  EXPECT_EQ(out[0], 1488055340);
+}
+
+TEST(MurmurHash3BatchTest, MatchesScalarHash) {
+  SCOPED_TRACE(MurmurHash3BatchSimdLevel());
+  std::mt19937_64 rng(42);
+  for (size_t length : kLengths) {
+    SCOPED_TRACE(length);
+    std::vector<int64_t> longs(length);
+    std::vector<int32_t> ints(length);
+    std::vector<uint8_t> fixed(length * 16);
+    for (size_t i = 0; i < length; ++i) {
+      longs[i] = static_cast<int64_t>(rng());
+      ints[i] = static_cast<int32_t>(rng());
+    }
+    for (auto& byte : fixed) {
+      byte = static_cast<uint8_t>(rng());
+    }
+    if (length > 1) {
+      ints[0] = std::numeric_limits<int32_t>::min();
+      ints[1] = -1;
+    }
+
+    std::vector<int32_t> out(length);
+    MurmurHash3_x86_32_Longs(longs, out);
+    for (size_t i = 0; i < length; ++i) {
+      ASSERT_EQ(out[i], Hash(&longs[i], sizeof(int64_t))) << i;
+    }
+
+    MurmurHash3_x86_32_IntsAsLongs(ints, out);
+    for (size_t i = 0; i < length; ++i) {
+      const int64_t value = ints[i];
+      ASSERT_EQ(out[i], Hash(&value, sizeof(int64_t))) << i;
+    }
+
+    MurmurHash3_x86_32_Fixed16(fixed.data(), out);
+    for (size_t i = 0; i < length; ++i) {
+      ASSERT_EQ(out[i], Hash(fixed.data() + i * 16, 16)) << i;
+    }
+  }
+}
+
+TEST(MurmurHash3BatchTest, UnalignedKeys) {
+  // Keys are loaded without alignment requirements, as in sliced arrays.
+  std::vector<uint8_t> buffer(17 * 16 + 1);
+  for (size_t i = 0; i < buffer.size(); ++i) {
+    buffer[i] = static_cast<uint8_t>(i * 31);
+  }
+  std::vector<int32_t> out(17);
+  MurmurHash3_x86_32_Fixed16(buffer.data() + 1, out);
+  for (size_t i = 0; i < out.size(); ++i) {
+    ASSERT_EQ(out[i], Hash(buffer.data() + 1 + i * 16, 16)) << i;
+  }
+}
+
+}  // namespace iceberg
@@ -0,0 +1,176 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/parallel_manifest_writer.h"
+
+#include <set>
+
+#include <arrow/filesystem/localfs.h>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "iceberg/arrow/arrow_fs_file_io_internal.h"
+#include "iceberg/avro/avro_register.h"
+#include "iceberg/manifest_reader.h"
+#include "iceberg/schema.h"
+#include "matchers.h"
+#include "temp_file_test_base.h"
+
+namespace iceberg {
+
+class ParallelManifestWriterTest : public TempFileTestBase {
+ protected:
+  static void SetUpTestSuite() { avro::RegisterAll(); }
+
+  void SetUp() override {
+    TempFileTestBase::SetUp();
+    file_io_ = std::make_shared<iceberg::arrow::ArrowFileSystemFileIO>(
+        std::make_shared<::arrow::fs::LocalFileSystem>());
+    partition_schema_ = std::make_shared<Schema>(
+        std::vector<SchemaField>{SchemaField::MakeOptional(1000, "id_bucket", int32())});
+  }
+
+  ParallelManifestWriterOptions MakeOptions(int64_t target_size_bytes) {
+    return ParallelManifestWriterOptions{
+        .format_version = 2,
+        .snapshot_id = 42,
+        .partition_spec_id = 1,
+        .partition_schema = partition_schema_,
+        .io = file_io_,
+        .new_manifest_location =
+            [this]() { return CreateNewTempFilePathWithSuffix(".avro"); },
+        .properties = {{ManifestWriterProperties::kTargetSizeBytes.key(),
+                        std::to_string(target_size_bytes)}},
+        .max_concurrency = 4};
+  }
+
+  static ManifestEntry MakeEntry(int32_t i, DataFile::Content content) {
+    auto data_file = std::make_shared<DataFile>();
+    data_file->content = content;
+    data_file->file_path = std::format("s3://bucket/data/{}.parquet", i);
+    data_file->partition = {Literal::Int(i % 4)};
+    data_file->record_count = 10;
+    data_file->file_size_in_bytes = 1024;
+    data_file->column_sizes = {{1, 512}};
+    return ManifestEntry{.status = ManifestStatus::kAdded,
+                         .snapshot_id = 42,
+                         .sequence_number = std::nullopt,
+                         .file_sequence_number = std::nullopt,
+                         .data_file = std::move(data_file)};
+  }
+
+  std::vector<ManifestEntry> ReadEntries(const ManifestFile& manifest) {
+    auto reader = ManifestReader::Make(manifest.manifest_path, file_io_,
+                                       partition_schema_);
+    EXPECT_THAT(reader, IsOk());
+    auto entries = reader.value()->Entries();
+    EXPECT_THAT(entries, IsOk());
+    return entries.value();
+  }
+
+  std::shared_ptr<FileIO> file_io_;
+  std::shared_ptr<Schema> partition_schema_;
+};
+
+TEST_F(ParallelManifestWriterTest, ShardsByTargetSize) {
+  std::vector<ManifestEntry> entries;
+  for (int32_t i = 0; i < 100; ++i) {
+    entries.push_back(MakeEntry(i, DataFile::Content::kData));
+  }
+  const int64_t entry_size = ParallelManifestWriter::EstimateEncodedSize(entries[0]);
+  auto manifests =
+      ParallelManifestWriter::Write(entries, MakeOptions(/*target_size_bytes=*/
+                                                         entry_size * 30));
+  ASSERT_THAT(manifests, IsOk());
+  ASSERT_EQ(manifests->size(), 4);
+
+  std::vector<ManifestEntry> written;
+  for (const auto& manifest : manifests.value()) {
+    EXPECT_EQ(manifest.partition_spec_id, 1);
+    EXPECT_EQ(manifest.content, ManifestFile::Content::kData);
+    EXPECT_EQ(manifest.added_snapshot_id, 42);
+    EXPECT_EQ(manifest.sequence_number, TableMetadata::kInvalidSequenceNumber);
+    EXPECT_GT(manifest.manifest_length, 0);
+    ASSERT_EQ(manifest.partitions.size(), 1);
+    EXPECT_EQ(manifest.partitions[0].lower_bound, Literal::Int(0).Serialize().value());
+    EXPECT_EQ(manifest.partitions[0].upper_bound, Literal::Int(3).Serialize().value());
+    auto read = ReadEntries(manifest);
+    EXPECT_EQ(read.size(), manifest.added_files_count.value());
+    EXPECT_EQ(manifest.added_rows_count.value(), 10 * manifest.added_files_count.value());
+    written.insert(written.end(), read.begin(), read.end());
+  }
+  // Shards are returned in order, so the entries are read back in their input order.
+  EXPECT_EQ(written, entries);
+}
+
+TEST_F(ParallelManifestWriterTest, SplitsByContentAndPartition) {
+  std::vector<ManifestEntry> entries;
+  for (int32_t i = 0; i < 40; ++i) {
+    entries.push_back(MakeEntry(i, i % 10 == 0 ? DataFile::Content::kPositionDeletes
+                                               : DataFile::Content::kData));
+  }
+  auto options = MakeOptions(/*target_size_bytes=*/8 * 1024 * 1024);
+  options.split_by_partition = true;
+  auto manifests = ParallelManifestWriter::Write(entries, options);
+  ASSERT_THAT(manifests, IsOk());
+
+  // Data files of the 4 partitions, and delete files of partitions 0 and 2.
+  ASSERT_EQ(manifests->size(), 6);
+  std::set<std::pair<ManifestFile::Content, int32_t>> seen;
+  int32_t total_files = 0;
+  for (const auto& manifest : manifests.value()) {
+    ASSERT_EQ(manifest.partitions.size(), 1);
+    const auto& summary = manifest.partitions[0];
+    EXPECT_EQ(summary.lower_bound, summary.upper_bound);
+    auto bucket = Literal::Deserialize(*summary.lower_bound, int32());
+    ASSERT_THAT(bucket, IsOk());
+    seen.emplace(manifest.content, std::get<int32_t>(bucket->value()));
+    for (const auto& entry : ReadEntries(manifest)) {
+      EXPECT_EQ(entry.data_file->partition, std::vector<Literal>{bucket.value()});
+      EXPECT_EQ(entry.data_file->content == DataFile::Content::kData,
+                manifest.content == ManifestFile::Content::kData);
+    }
+    total_files += manifest.added_files_count.value();
+  }
+  EXPECT_EQ(seen.size(), 6);
+  EXPECT_EQ(total_files, 40);
+}
+
+TEST_F(ParallelManifestWriterTest, InvalidOptions) {
+  std::vector<ManifestEntry> entries{MakeEntry(0, DataFile::Content::kData)};
+  auto options = MakeOptions(/*target_size_bytes=*/1024);
+  options.format_version = 1;
+  EXPECT_THAT(ParallelManifestWriter::Write(entries, options),
+              IsError(ErrorKind::kNotSupported));
+
+  options = MakeOptions(/*target_size_bytes=*/0);
+  EXPECT_THAT(ParallelManifestWriter::Write(entries, options),
+              IsError(ErrorKind::kInvalidArgument));
+
+  options.properties[ManifestWriterProperties::kTargetSizeBytes.key()] = "large";
+  EXPECT_THAT(ParallelManifestWriter::Write(entries, options),
+              IsError(ErrorKind::kInvalidArgument));
+
+  options = MakeOptions(/*target_size_bytes=*/1024);
+  options.new_manifest_location = nullptr;
+  EXPECT_THAT(ParallelManifestWriter::Write(entries, options),
+              IsError(ErrorKind::kInvalidArgument));
+}
+
+}  // namespace iceberg
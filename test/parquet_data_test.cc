@@ -69,16 +69,22 @@ void VerifyProjectRecordBatch(const Schema& projected_schema, const Schema& sour
   auto projected_arrow_schema =
       ::arrow::ImportSchema(&projected_arrow_c_schema).ValueOrDie();
 
-  auto project_result =
-      ProjectRecordBatch(input_record_batch, projected_arrow_schema, projected_schema,
-                         schema_projection, ::arrow::default_memory_pool());
-  ASSERT_THAT(project_result, IsOk());
-  auto projected_record_batch = std::move(project_result.value());
-
   auto expected_record_batch = RecordBatchFromJson(projected_arrow_schema, expected_json);
-  ASSERT_TRUE(projected_record_batch->Equals(*expected_record_batch))
-      << "projected_record_batch: " << projected_record_batch->ToString()
-      << "\nexpected_record_batch: " << expected_record_batch->ToString();
+
+  // Project with and without passing through unchanged arrays.
+  auto pass_through = MakeProjectionPassThrough(
+      *source_arrow_schema, *projected_arrow_schema, schema_projection);
+  for (const auto& fields_to_pass : {ProjectionPassThrough{}, pass_through}) {
+    auto project_result = ProjectRecordBatch(
+        input_record_batch, projected_arrow_schema, projected_schema, schema_projection,
+        ::arrow::default_memory_pool(), fields_to_pass);
+    ASSERT_THAT(project_result, IsOk());
+    auto projected_record_batch = std::move(project_result.value());
+
+    ASSERT_TRUE(projected_record_batch->Equals(*expected_record_batch))
+        << "projected_record_batch: " << projected_record_batch->ToString()
+        << "\nexpected_record_batch: " << expected_record_batch->ToString();
+  }
 }
 
 class ProjectRecordBatchTest : public ::testing::TestWithParam<ProjectRecordBatchParam> {
@@ -503,4 +509,73 @@ TEST(ProjectRecordBatchTest, EmptyRecordBatch) {
       VerifyProjectRecordBatch(iceberg_schema, iceberg_schema, input_json, input_json));
 }
 
+TEST(ProjectRecordBatchTest, PassThroughUnchangedArrays) {
+  auto point_type = std::make_shared<StructType>(std::vector<SchemaField>{
+      SchemaField::MakeRequired(4, "x", int64()),
+      SchemaField::MakeRequired(5, "y", int64()),
+  });
+  auto tags_type =
+      std::make_shared<ListType>(SchemaField::MakeOptional(6, "element", string()));
+  Schema source_schema({
+      SchemaField::MakeRequired(1, "id", int32()),
+      SchemaField::MakeOptional(2, "point", point_type),
+      SchemaField::MakeOptional(3, "tags", tags_type),
+  });
+  Schema reordered_schema({
+      SchemaField::MakeOptional(3, "tags", tags_type),
+      SchemaField::MakeOptional(2, "point", point_type),
+      SchemaField::MakeRequired(1, "id", int32()),
+  });
+
+  ArrowSchema source_arrow_c_schema;
+  ASSERT_THAT(ToArrowSchema(source_schema, &source_arrow_c_schema), IsOk());
+  auto source_arrow_schema = ::arrow::ImportSchema(&source_arrow_c_schema).ValueOrDie();
+  auto input_record_batch = RecordBatchFromJson(source_arrow_schema, R"([
+    {"id": 1, "point": {"x": 1, "y": 2}, "tags": ["a", "b"]},
+    {"id": 2, "point": null, "tags": null}
+  ])");
+
+  // The identity projection returns the input arrays.
+  {
+    auto projection = Project(source_schema, source_schema, /*prune_source=*/false);
+    ASSERT_THAT(projection, IsOk());
+    auto pass_through = MakeProjectionPassThrough(*source_arrow_schema,
+                                                  *source_arrow_schema, *projection);
+    ASSERT_TRUE(pass_through.enabled);
+
+    auto result =
+        ProjectRecordBatch(input_record_batch, source_arrow_schema, source_schema,
+                           *projection, ::arrow::default_memory_pool(), pass_through);
+    ASSERT_THAT(result, IsOk());
+    for (int i = 0; i < input_record_batch->num_columns(); ++i) {
+      EXPECT_EQ(result.value()->column_data(i), input_record_batch->column_data(i));
+    }
+  }
+
+  // Reordering only rebuilds the top-level struct.
+  {
+    ArrowSchema reordered_arrow_c_schema;
+    ASSERT_THAT(ToArrowSchema(reordered_schema, &reordered_arrow_c_schema), IsOk());
+    auto reordered_arrow_schema =
+        ::arrow::ImportSchema(&reordered_arrow_c_schema).ValueOrDie();
+    auto projection = Project(reordered_schema, source_schema, /*prune_source=*/false);
+    ASSERT_THAT(projection, IsOk());
+    auto pass_through = MakeProjectionPassThrough(*source_arrow_schema,
+                                                  *reordered_arrow_schema, *projection);
+    ASSERT_FALSE(pass_through.enabled);
+    ASSERT_EQ(pass_through.children.size(), 3);
+    for (const auto& child : pass_through.children) {
+      EXPECT_TRUE(child.enabled);
+    }
+
+    auto result =
+        ProjectRecordBatch(input_record_batch, reordered_arrow_schema, reordered_schema,
+                           *projection, ::arrow::default_memory_pool(), pass_through);
+    ASSERT_THAT(result, IsOk());
+    EXPECT_EQ(result.value()->column_data(0), input_record_batch->column_data(2));
+    EXPECT_EQ(result.value()->column_data(1), input_record_batch->column_data(1));
+    EXPECT_EQ(result.value()->column_data(2), input_record_batch->column_data(0));
+  }
+}
+
 }  // namespace iceberg::parquet
@@ -17,14 +17,21 @@
  * under the License.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <format>
+#include <new>
 #include <optional>
 
 #include <arrow/array.h>
 #include <arrow/c/bridge.h>
 #include <arrow/json/from_string.h>
+#include <arrow/memory_pool.h>
 #include <arrow/record_batch.h>
 #include <arrow/table.h>
 #include <arrow/type.h>
+#include <arrow/util/compression.h>
 #include <arrow/util/key_value_metadata.h>
 #include <parquet/arrow/reader.h>
 #include <parquet/arrow/writer.h>
@@ -32,6 +39,8 @@
 
 #include "iceberg/arrow/arrow_error_transform_internal.h"
 #include "iceberg/arrow/arrow_fs_file_io_internal.h"
+#include "iceberg/arrow/arrow_memory_pool.h"
+#include "iceberg/file_metadata_cache.h"
 #include "iceberg/file_reader.h"
 #include "iceberg/file_writer.h"
 #include "iceberg/parquet/parquet_register.h"
@@ -101,6 +110,38 @@ void DoRoundtrip(std::shared_ptr<::arrow::Array> data, std::shared_ptr<Schema> s
   ASSERT_TRUE(out != nullptr) << "Reader.Next() returned no data";
 }
 
+// A memory pool that is not backed by Arrow.
+class NewDeleteMemoryPool : public MemoryPool {
+ public:
+  Result<uint8_t*> Allocate(int64_t size, int64_t alignment) override {
+    auto* buffer = static_cast<uint8_t*>(::operator new(
+        static_cast<size_t>(size), std::align_val_t(static_cast<size_t>(alignment))));
+    auto allocated = bytes_allocated_ += size;
+    if (allocated > max_memory_) {
+      max_memory_ = allocated;
+    }
+    return buffer;
+  }
+  Result<uint8_t*> Reallocate(uint8_t* buffer, int64_t old_size, int64_t new_size,
+                              int64_t alignment) override {
+    ICEBERG_ASSIGN_OR_RAISE(auto new_buffer, Allocate(new_size, alignment));
+    std::memcpy(new_buffer, buffer, static_cast<size_t>(std::min(old_size, new_size)));
+    Free(buffer, old_size, alignment);
+    return new_buffer;
+  }
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override {
+    ::operator delete(buffer, std::align_val_t(static_cast<size_t>(alignment)));
+    bytes_allocated_ -= size;
+  }
+  int64_t bytes_allocated() const override { return bytes_allocated_; }
+  int64_t max_memory() const override { return max_memory_; }
+  std::string backend_name() const override { return "new_delete"; }
+
+ private:
+  std::atomic<int64_t> bytes_allocated_{0};
+  std::atomic<int64_t> max_memory_{0};
+};
+
 }  // namespace
 
 class ParquetReaderTest : public ::testing::Test {
@@ -287,6 +328,290 @@ TEST_F(ParquetReaderTest, ReadSplit) {
   }
 }
 
+TEST_F(ParquetReaderTest, ReadWithCoalescedIo) {
+  CreateSplitParquetFile();
+
+  auto schema = std::make_shared<Schema>(
+      std::vector<SchemaField>{SchemaField::MakeOptional(2, "name", string()),
+                               SchemaField::MakeRequired(1, "id", int32())});
+
+  auto reader_result = ReaderFactoryRegistry::Open(
+      FileFormatType::kParquet,
+      {.path = temp_parquet_file_,
+       .io = file_io_,
+       .projection = schema,
+       .properties = {{ReaderProperties::kParquetPreBuffer.key(), "true"},
+                      {ReaderProperties::kParquetIoCoalesceHoleSizeLimit.key(), "1024"},
+                      {ReaderProperties::kParquetIoCoalesceRangeSizeLimit.key(), "4096"},
+                      {ReaderProperties::kParquetIoThreads.key(), "2"}}});
+  ASSERT_THAT(reader_result, IsOk());
+  auto reader = std::move(reader_result.value());
+
+  ASSERT_NO_FATAL_FAILURE(VerifyNextBatch(*reader, R"([["Foo", 1], ["Bar", 2]])"));
+  ASSERT_NO_FATAL_FAILURE(VerifyNextBatch(*reader, R"([["Baz", 3]])"));
+  ASSERT_NO_FATAL_FAILURE(VerifyExhausted(*reader));
+  ASSERT_THAT(reader->Close(), IsOk());
+}
+
+TEST_F(ParquetReaderTest, ReadRowGroupsConcurrently) {
+  CreateSplitParquetFile();
+
+  auto schema = std::make_shared<Schema>(
+      std::vector<SchemaField>{SchemaField::MakeRequired(1, "id", int32()),
+                               SchemaField::MakeOptional(2, "name", string())});
+
+  for (const auto& max_in_flight_row_groups : {"1", "2", "8"}) {
+    auto reader_result = ReaderFactoryRegistry::Open(
+        FileFormatType::kParquet,
+        {.path = temp_parquet_file_,
+         .io = file_io_,
+         .projection = schema,
+         .properties = {{ReaderProperties::kParquetUseThreads.key(), "true"},
+                        {ReaderProperties::kParquetMaxInFlightRowGroups.key(),
+                         max_in_flight_row_groups}}});
+    ASSERT_THAT(reader_result, IsOk());
+    auto reader = std::move(reader_result.value());
+
+    // Batches are returned in the order of the row groups.
+    ASSERT_NO_FATAL_FAILURE(VerifyNextBatch(*reader, R"([[1, "Foo"], [2, "Bar"]])"));
+    ASSERT_NO_FATAL_FAILURE(VerifyNextBatch(*reader, R"([[3, "Baz"]])"));
+    ASSERT_NO_FATAL_FAILURE(VerifyExhausted(*reader));
+    ASSERT_THAT(reader->Close(), IsOk());
+  }
+}
+
+TEST_F(ParquetReaderTest, ReadWithFooterReadSize) {
+  CreateSimpleParquetFile();
+
+  auto io = internal::checked_cast<arrow::ArrowFileSystemFileIO&>(*file_io_);
+  auto file_size = io.fs()->GetFileInfo(temp_parquet_file_).ValueOrDie().size();
+
+  auto schema = std::make_shared<Schema>(
+      std::vector<SchemaField>{SchemaField::MakeRequired(1, "id", int32()),
+                               SchemaField::MakeOptional(2, "name", string())});
+
+  // The footer is fetched by one read if it fits, or by two reads otherwise.
+  for (const auto& footer_read_size : {"8", "64", "65536"}) {
+    auto reader_result = ReaderFactoryRegistry::Open(
+        FileFormatType::kParquet,
+        {.path = temp_parquet_file_,
+         .length = static_cast<size_t>(file_size),
+         .io = file_io_,
+         .projection = schema,
+         .properties = {
+             {ReaderProperties::kParquetFooterReadSize.key(), footer_read_size}}});
+    ASSERT_THAT(reader_result, IsOk());
+    auto reader = std::move(reader_result.value());
+
+    ASSERT_NO_FATAL_FAILURE(
+        VerifyNextBatch(*reader, R"([[1, "Foo"], [2, "Bar"], [3, "Baz"]])"));
+    ASSERT_NO_FATAL_FAILURE(VerifyExhausted(*reader));
+    ASSERT_THAT(reader->Close(), IsOk());
+  }
+}
+
+TEST_F(ParquetReaderTest, ReadWithMetadataCache) {
+  CreateSimpleParquetFile();
+
+  auto cache = std::make_shared<FileMetadataCache>(/*capacity_bytes=*/1024 * 1024);
+  auto schema = std::make_shared<Schema>(
+      std::vector<SchemaField>{SchemaField::MakeRequired(1, "id", int32()),
+                               SchemaField::MakeOptional(2, "name", string())});
+  auto id_schema = std::make_shared<Schema>(
+      std::vector<SchemaField>{SchemaField::MakeRequired(1, "id", int32())});
+
+  auto read = [&](const std::shared_ptr<Schema>& projection,
+                  const std::vector<std::string>& expected_json) {
+    auto reader_result = ReaderFactoryRegistry::Open(FileFormatType::kParquet,
+                                                     {.path = temp_parquet_file_,
+                                                      .io = file_io_,
+                                                      .projection = projection,
+                                                      .metadata_cache = cache});
+    ASSERT_THAT(reader_result, IsOk());
+    auto reader = std::move(reader_result.value());
+    for (const auto& json : expected_json) {
+      ASSERT_NO_FATAL_FAILURE(VerifyNextBatch(*reader, json));
+    }
+    ASSERT_NO_FATAL_FAILURE(VerifyExhausted(*reader));
+    ASSERT_THAT(reader->Close(), IsOk());
+  };
+
+  // The footer and the projection are cached by the first open.
+  ASSERT_NO_FATAL_FAILURE(read(schema, {R"([[1, "Foo"], [2, "Bar"], [3, "Baz"]])"}));
+  ASSERT_EQ(cache->misses(), 2);
+  ASSERT_EQ(cache->hits(), 0);
+  ASSERT_EQ(cache->size(), 2);
+
+  ASSERT_NO_FATAL_FAILURE(read(schema, {R"([[1, "Foo"], [2, "Bar"], [3, "Baz"]])"}));
+  ASSERT_EQ(cache->misses(), 2);
+  ASSERT_EQ(cache->hits(), 2);
+
+  // Another read schema reuses the footer but not the projection.
+  ASSERT_NO_FATAL_FAILURE(read(id_schema, {R"([[1], [2], [3]])"}));
+  ASSERT_EQ(cache->misses(), 3);
+  ASSERT_EQ(cache->hits(), 3);
+  ASSERT_EQ(cache->size(), 3);
+
+  // A rewritten file does not reuse the footer of the previous version.
+  CreateSplitParquetFile();
+  ASSERT_NO_FATAL_FAILURE(
+      read(schema, {R"([[1, "Foo"], [2, "Bar"]])", R"([[3, "Baz"]])"}));
+  ASSERT_EQ(cache->misses(), 5);
+  ASSERT_EQ(cache->hits(), 3);
+  ASSERT_GT(cache->size_bytes(), 0);
+  ASSERT_LE(cache->size_bytes(), cache->capacity_bytes());
+}
+
+TEST_F(ParquetReaderTest, ReadWithMetadataCacheAndLength) {
+  CreateSimpleParquetFile();
+  auto& io = internal::checked_cast<arrow::ArrowFileSystemFileIO&>(*file_io_);
+  auto file_info = io.fs()->GetFileInfo(temp_parquet_file_).ValueOrDie();
+
+  auto cache = std::make_shared<FileMetadataCache>(/*capacity_bytes=*/1024 * 1024);
+  auto schema = std::make_shared<Schema>(
+      std::vector<SchemaField>{SchemaField::MakeRequired(1, "id", int32())});
+  for (int32_t i = 0; i < 2; ++i) {
+    auto reader_result = ReaderFactoryRegistry::Open(
+        FileFormatType::kParquet, {.path = temp_parquet_file_,
+                                   .length = static_cast<size_t>(file_info.size()),
+                                   .io = file_io_,
+                                   .projection = schema,
+                                   .metadata_cache = cache});
+    ASSERT_THAT(reader_result, IsOk());
+    auto reader = std::move(reader_result.value());
+    ASSERT_NO_FATAL_FAILURE(VerifyNextBatch(*reader, R"([[1], [2], [3]])"));
+    ASSERT_NO_FATAL_FAILURE(VerifyExhausted(*reader));
+    ASSERT_THAT(reader->Close(), IsOk());
+  }
+  // The footer and the projection are cached by the first open and reused by the
+  // second one.
+  ASSERT_EQ(cache->misses(), 2);
+  ASSERT_EQ(cache->hits(), 2);
+}
+
+TEST_F(ParquetReaderTest, ReadDictionaryColumns) {
+  CreateSplitParquetFile();
+
+  auto schema = std::make_shared<Schema>(
+      std::vector<SchemaField>{SchemaField::MakeRequired(1, "id", int32()),
+                               SchemaField::MakeOptional(2, "name", string())});
+
+  for (const auto& [read_dictionary, dictionary_encoded] :
+       std::vector<std::pair<std::string, bool>>{
+           {"*", true}, {"2", true}, {" 2, 3 ", true}, {"1", false}, {"", false}}) {
+    auto reader_result = ReaderFactoryRegistry::Open(
+        FileFormatType::kParquet,
+        {.path = temp_parquet_file_,
+         .io = file_io_,
+         .projection = schema,
+         .properties = {
+             {ReaderProperties::kParquetReadDictionary.key(), read_dictionary}}});
+    ASSERT_THAT(reader_result, IsOk());
+    auto reader = std::move(reader_result.value());
+
+    auto schema_result = reader->Schema();
+    ASSERT_THAT(schema_result, IsOk());
+    auto arrow_schema = ::arrow::ImportSchema(&schema_result.value()).ValueOrDie();
+    const auto& name_type = arrow_schema->field(1)->type();
+    if (dictionary_encoded) {
+      auto expected_type = ::arrow::dictionary(::arrow::int32(), ::arrow::utf8());
+      ASSERT_TRUE(name_type->Equals(expected_type)) << name_type->ToString();
+    } else {
+      ASSERT_TRUE(name_type->Equals(::arrow::utf8())) << name_type->ToString();
+    }
+    // The id field is never dictionary-encoded.
+    ASSERT_TRUE(arrow_schema->field(0)->type()->Equals(::arrow::int32()));
+
+    ASSERT_NO_FATAL_FAILURE(VerifyNextBatch(*reader, R"([[1, "Foo"], [2, "Bar"]])"));
+    ASSERT_NO_FATAL_FAILURE(VerifyNextBatch(*reader, R"([[3, "Baz"]])"));
+    ASSERT_NO_FATAL_FAILURE(VerifyExhausted(*reader));
+    ASSERT_THAT(reader->Close(), IsOk());
+  }
+}
+
+TEST_F(ParquetReaderTest, InvalidReadProperties) {
+  CreateSimpleParquetFile();
+
+  auto schema = std::make_shared<Schema>(
+      std::vector<SchemaField>{SchemaField::MakeRequired(1, "id", int32())});
+
+  for (const auto& properties : std::vector<std::unordered_map<std::string, std::string>>{
+           {{ReaderProperties::kParquetIoThreads.key(), "many"}},
+           {{ReaderProperties::kParquetMaxInFlightRowGroups.key(), "-1"}},
+           {{ReaderProperties::kParquetReadDictionary.key(), "2,name"}},
+           {{ReaderProperties::kParquetFooterReadSize.key(), "4"}},
+           {{ReaderProperties::kParquetIoCoalesceHoleSizeLimit.key(), "-1"}},
+           {{ReaderProperties::kParquetIoCoalesceHoleSizeLimit.key(), "4096"},
+            {ReaderProperties::kParquetIoCoalesceRangeSizeLimit.key(), "1024"}}}) {
+    auto reader_result = ReaderFactoryRegistry::Open(
+        FileFormatType::kParquet, {.path = temp_parquet_file_,
+                                   .io = file_io_,
+                                   .projection = schema,
+                                   .properties = properties});
+    ASSERT_THAT(reader_result, IsError(ErrorKind::kInvalidArgument));
+  }
+}
+
+TEST_F(ParquetReaderTest, ReadWriteWithMemoryPool) {
+  auto schema = std::make_shared<Schema>(
+      std::vector<SchemaField>{SchemaField::MakeRequired(1, "id", int32()),
+                               SchemaField::MakeOptional(2, "name", string())});
+  ArrowSchema arrow_c_schema;
+  ASSERT_THAT(ToArrowSchema(*schema, &arrow_c_schema), IsOk());
+  auto arrow_schema = ::arrow::ImportType(&arrow_c_schema).ValueOrDie();
+  auto array = ::arrow::json::ArrayFromJSONString(
+                   arrow_schema, R"([[1, "Foo"], [2, "Bar"], [3, "Baz"]])")
+                   .ValueOrDie();
+
+  ::arrow::ProxyMemoryPool write_pool(::arrow::default_memory_pool());
+  ASSERT_THAT(WriteArray(array, {.path = temp_parquet_file_,
+                                 .schema = schema,
+                                 .io = file_io_,
+                                 .memory_pool = arrow::MakeArrowMemoryPool(&write_pool)}),
+              IsOk());
+  EXPECT_GT(write_pool.max_memory(), 0);
+
+  ::arrow::ProxyMemoryPool read_pool(::arrow::default_memory_pool());
+  std::shared_ptr<::arrow::Array> out;
+  ASSERT_THAT(ReadArray(out, {.path = temp_parquet_file_,
+                              .io = file_io_,
+                              .projection = schema,
+                              .memory_pool = arrow::MakeArrowMemoryPool(&read_pool)}),
+              IsOk());
+  ASSERT_TRUE(out->Equals(*array));
+  EXPECT_GT(read_pool.bytes_allocated(), 0);
+}
+
+TEST_F(ParquetReaderTest, ReadWriteWithCustomMemoryPool) {
+  auto schema = std::make_shared<Schema>(
+      std::vector<SchemaField>{SchemaField::MakeRequired(1, "id", int32()),
+                               SchemaField::MakeOptional(2, "name", string())});
+  ArrowSchema arrow_c_schema;
+  ASSERT_THAT(ToArrowSchema(*schema, &arrow_c_schema), IsOk());
+  auto arrow_schema = ::arrow::ImportType(&arrow_c_schema).ValueOrDie();
+  auto array = ::arrow::json::ArrayFromJSONString(
+                   arrow_schema, R"([[1, "Foo"], [2, "Bar"], [3, "Baz"]])")
+                   .ValueOrDie();
+
+  auto write_pool = std::make_shared<NewDeleteMemoryPool>();
+  ASSERT_THAT(WriteArray(array, {.path = temp_parquet_file_,
+                                 .schema = schema,
+                                 .io = file_io_,
+                                 .memory_pool = write_pool}),
+              IsOk());
+  EXPECT_GT(write_pool->max_memory(), 0);
+
+  auto read_pool = std::make_shared<NewDeleteMemoryPool>();
+  std::shared_ptr<::arrow::Array> out;
+  ASSERT_THAT(ReadArray(out, {.path = temp_parquet_file_,
+                              .io = file_io_,
+                              .projection = schema,
+                              .memory_pool = read_pool}),
+              IsOk());
+  ASSERT_TRUE(out->Equals(*array));
+  EXPECT_GT(read_pool->bytes_allocated(), 0);
+}
+
 class ParquetReadWrite : public ::testing::Test {
  protected:
   static void SetUpTestSuite() { parquet::RegisterAll(); }
@@ -365,4 +690,267 @@ TEST_F(ParquetReadWrite, SimpleTypeRoundTrip) {
   ASSERT_TRUE(out->Equals(*array));
 }
 
+TEST_F(ParquetReadWrite, WriteMetrics) {
+  auto schema = std::make_shared<Schema>(std::vector<SchemaField>{
+      SchemaField::MakeRequired(1, "id", int32()),
+      SchemaField::MakeOptional(2, "name", string()),
+      SchemaField::MakeOptional(3, "score", float64()),
+      SchemaField::MakeOptional(
+          4, "tags", list(SchemaField::MakeOptional(5, "element", int32()))),
+  });
+
+  ArrowSchema arrow_c_schema;
+  ASSERT_THAT(ToArrowSchema(*schema, &arrow_c_schema), IsOk());
+  auto arrow_schema = ::arrow::ImportType(&arrow_c_schema).ValueOrDie();
+
+  auto array = ::arrow::json::ArrayFromJSONString(
+                   ::arrow::struct_(arrow_schema->fields()),
+                   R"([[1, "abcdef", 1.5, [1, 2]],
+                       [2, null, NaN, null],
+                       [3, "abd", -2.0, [3]]])")
+                   .ValueOrDie();
+
+  std::shared_ptr<FileIO> file_io = arrow::ArrowFileSystemFileIO::MakeMockFileIO();
+  auto writer_result = WriterFactoryRegistry::Open(
+      FileFormatType::kParquet,
+      {.path = "metrics.parquet",
+       .schema = schema,
+       .io = file_io,
+       .properties = {{"write.metadata.metrics.column.name", "truncate(2)"}}});
+  ASSERT_THAT(writer_result, IsOk());
+  auto writer = std::move(writer_result.value());
+  ASSERT_FALSE(writer->metrics().has_value());
+  ASSERT_THAT(WriteArray(array, *writer), IsOk());
+
+  auto metrics = writer->metrics();
+  ASSERT_TRUE(metrics.has_value());
+  ASSERT_EQ(metrics->row_count, 3);
+  for (int64_t field_id : {1, 2, 3, 5}) {
+    ASSERT_GT(metrics->column_sizes.at(field_id), 0) << field_id;
+    ASSERT_TRUE(metrics->value_counts.contains(field_id)) << field_id;
+  }
+  ASSERT_EQ(metrics->value_counts.at(1), 3);
+  ASSERT_EQ(metrics->value_counts.at(2), 3);
+  ASSERT_EQ(metrics->null_value_counts.at(1), 0);
+  ASSERT_EQ(metrics->null_value_counts.at(2), 1);
+  ASSERT_EQ(metrics->null_value_counts.at(3), 0);
+  ASSERT_EQ(metrics->nan_value_counts.at(3), 1);
+  ASSERT_FALSE(metrics->nan_value_counts.contains(1));
+
+  ASSERT_EQ(metrics->lower_bounds.at(1), Literal::Int(1));
+  ASSERT_EQ(metrics->upper_bounds.at(1), Literal::Int(3));
+  // String bounds are truncated, the upper bound is rounded up.
+  ASSERT_EQ(metrics->lower_bounds.at(2), Literal::String("ab"));
+  ASSERT_EQ(metrics->upper_bounds.at(2), Literal::String("ac"));
+  // NaN values do not affect the bounds.
+  ASSERT_EQ(metrics->lower_bounds.at(3), Literal::Double(-2.0));
+  ASSERT_EQ(metrics->upper_bounds.at(3), Literal::Double(1.5));
+  // Values in lists have no bounds.
+  ASSERT_FALSE(metrics->lower_bounds.contains(5));
+  ASSERT_FALSE(metrics->upper_bounds.contains(5));
+}
+
+TEST_F(ParquetReadWrite, WriteMetricsIgnoreNaNsOfNullStructs) {
+  auto schema = std::make_shared<Schema>(std::vector<SchemaField>{
+      SchemaField::MakeRequired(1, "id", int32()),
+      SchemaField::MakeOptional(
+          2, "point", struct_({SchemaField::MakeOptional(3, "x", float64())})),
+  });
+
+  ArrowSchema arrow_c_schema;
+  ASSERT_THAT(ToArrowSchema(*schema, &arrow_c_schema), IsOk());
+  auto arrow_schema = ::arrow::ImportType(&arrow_c_schema).ValueOrDie();
+
+  // The second struct is null, but its child slot holds a NaN.
+  auto ids =
+      ::arrow::json::ArrayFromJSONString(::arrow::int32(), "[1, 2, 3]").ValueOrDie();
+  auto xs = ::arrow::json::ArrayFromJSONString(::arrow::float64(), "[1.0, NaN, NaN]")
+                .ValueOrDie();
+  auto validity =
+      ::arrow::json::ArrayFromJSONString(::arrow::boolean(), "[true, false, true]")
+          .ValueOrDie();
+  auto points = ::arrow::StructArray::Make({xs}, arrow_schema->field(1)->type()->fields(),
+                                           validity->data()->buffers[1],
+                                           /*null_count=*/1)
+                    .ValueOrDie();
+  auto array =
+      ::arrow::StructArray::Make({ids, points}, arrow_schema->fields()).ValueOrDie();
+
+  std::shared_ptr<FileIO> file_io = arrow::ArrowFileSystemFileIO::MakeMockFileIO();
+  auto writer_result = WriterFactoryRegistry::Open(
+      FileFormatType::kParquet,
+      {.path = "metrics.parquet", .schema = schema, .io = file_io});
+  ASSERT_THAT(writer_result, IsOk());
+  auto writer = std::move(writer_result.value());
+  ASSERT_THAT(WriteArray(array, *writer), IsOk());
+
+  auto metrics = writer->metrics();
+  ASSERT_TRUE(metrics.has_value());
+  ASSERT_EQ(metrics->nan_value_counts.at(3), 1);
+}
+
+TEST_F(ParquetReadWrite, WriteMetricsWithModes) {
+  auto schema = std::make_shared<Schema>(std::vector<SchemaField>{
+      SchemaField::MakeRequired(1, "id", int32()),
+      SchemaField::MakeOptional(2, "name", string()),
+      SchemaField::MakeOptional(3, "score", float64()),
+  });
+
+  ArrowSchema arrow_c_schema;
+  ASSERT_THAT(ToArrowSchema(*schema, &arrow_c_schema), IsOk());
+  auto arrow_schema = ::arrow::ImportType(&arrow_c_schema).ValueOrDie();
+
+  auto array = ::arrow::json::ArrayFromJSONString(
+                   ::arrow::struct_(arrow_schema->fields()),
+                   R"([[1, "abcdef", 1.5], [2, null, NaN]])")
+                   .ValueOrDie();
+
+  std::shared_ptr<FileIO> file_io = arrow::ArrowFileSystemFileIO::MakeMockFileIO();
+  auto writer_result = WriterFactoryRegistry::Open(
+      FileFormatType::kParquet,
+      {.path = "metrics.parquet",
+       .schema = schema,
+       .io = file_io,
+       .properties = {{"write.metadata.metrics.default", "none"},
+                      {"write.metadata.metrics.column.name", "full"},
+                      {"write.metadata.metrics.column.score", "counts"}}});
+  ASSERT_THAT(writer_result, IsOk());
+  auto writer = std::move(writer_result.value());
+  ASSERT_THAT(WriteArray(array, *writer), IsOk());
+
+  auto metrics = writer->metrics();
+  ASSERT_TRUE(metrics.has_value());
+  ASSERT_EQ(metrics->row_count, 2);
+
+  // No metrics of the id column.
+  ASSERT_FALSE(metrics->column_sizes.contains(1));
+  ASSERT_FALSE(metrics->value_counts.contains(1));
+  ASSERT_FALSE(metrics->lower_bounds.contains(1));
+
+  // Untruncated bounds of the name column.
+  ASSERT_EQ(metrics->null_value_counts.at(2), 1);
+  ASSERT_EQ(metrics->lower_bounds.at(2), Literal::String("abcdef"));
+  ASSERT_EQ(metrics->upper_bounds.at(2), Literal::String("abcdef"));
+
+  // Only counts of the score column.
+  ASSERT_EQ(metrics->value_counts.at(3), 2);
+  ASSERT_EQ(metrics->nan_value_counts.at(3), 1);
+  ASSERT_FALSE(metrics->lower_bounds.contains(3));
+  ASSERT_FALSE(metrics->upper_bounds.contains(3));
+}
+
+TEST_F(ParquetReadWrite, InvalidMetricsMode) {
+  auto schema = std::make_shared<Schema>(
+      std::vector<SchemaField>{SchemaField::MakeRequired(1, "id", int32())});
+  std::shared_ptr<FileIO> file_io = arrow::ArrowFileSystemFileIO::MakeMockFileIO();
+  auto writer_result = WriterFactoryRegistry::Open(
+      FileFormatType::kParquet,
+      {.path = "metrics.parquet",
+       .schema = schema,
+       .io = file_io,
+       .properties = {{"write.metadata.metrics.default", "truncate(0)"}}});
+  ASSERT_THAT(writer_result, IsError(ErrorKind::kInvalidArgument));
+}
+
+TEST_F(ParquetReadWrite, WriteWithProperties) {
+  auto schema = std::make_shared<Schema>(
+      std::vector<SchemaField>{SchemaField::MakeRequired(1, "id", int64()),
+                               SchemaField::MakeOptional(2, "name", string())});
+  ArrowSchema arrow_c_schema;
+  ASSERT_THAT(ToArrowSchema(*schema, &arrow_c_schema), IsOk());
+  auto arrow_schema = ::arrow::ImportType(&arrow_c_schema).ValueOrDie();
+
+  std::string json = "[";
+  for (int i = 0; i < 100; ++i) {
+    json += std::format(R"({}[{}, "name-{}"])", i == 0 ? "" : ",", i, i % 10);
+  }
+  json += "]";
+  auto array = ::arrow::json::ArrayFromJSONString(arrow_schema, json).ValueOrDie();
+
+  std::shared_ptr<FileIO> file_io = arrow::ArrowFileSystemFileIO::MakeMockFileIO();
+  auto writer_result = WriterFactoryRegistry::Open(
+      FileFormatType::kParquet,
+      {.path = "properties.parquet",
+       .schema = schema,
+       .io = file_io,
+       .properties = {
+           {WriterProperties::kParquetCompressionCodec.key(), "GZIP"},
+           {WriterProperties::kParquetCompressionLevel.key(), "9"},
+           {WriterProperties::kParquetRowGroupSizeBytes.key(), "1024"},
+           {std::string(WriterProperties::kParquetColumnCompressionCodecPrefix) + "name",
+            "uncompressed"},
+           {std::string(WriterProperties::kParquetColumnDictEnabledPrefix) + "name",
+            "false"},
+       }});
+  ASSERT_THAT(writer_result, IsOk());
+  auto writer = std::move(writer_result.value());
+  ASSERT_THAT(WriteArray(array, *writer), IsOk());
+
+  auto io = internal::checked_cast<arrow::ArrowFileSystemFileIO&>(*file_io);
+  auto input_stream = io.fs()->OpenInputFile("properties.parquet").ValueOrDie();
+  auto metadata = ::parquet::ReadMetaData(input_stream);
+  ASSERT_EQ(metadata->num_rows(), 100);
+  // The batch is split into row groups of the target size.
+  ASSERT_GT(metadata->num_row_groups(), 1);
+  ASSERT_EQ(writer->split_offsets().size(), metadata->num_row_groups());
+  for (int i = 0; i < metadata->num_row_groups(); ++i) {
+    auto row_group = metadata->RowGroup(i);
+    ASSERT_EQ(row_group->ColumnChunk(0)->compression(), ::arrow::Compression::GZIP);
+    ASSERT_TRUE(row_group->ColumnChunk(0)->has_dictionary_page());
+    ASSERT_EQ(row_group->ColumnChunk(1)->compression(),
+              ::arrow::Compression::UNCOMPRESSED);
+    ASSERT_FALSE(row_group->ColumnChunk(1)->has_dictionary_page());
+  }
+}
+
+TEST_F(ParquetReadWrite, Lz4IsWrittenAsLz4Raw) {
+  if (!::arrow::util::Codec::IsAvailable(::arrow::Compression::LZ4_RAW)) {
+    GTEST_SKIP() << "LZ4 is not available in this build";
+  }
+  auto schema = std::make_shared<Schema>(
+      std::vector<SchemaField>{SchemaField::MakeRequired(1, "id", int32())});
+  ArrowSchema arrow_c_schema;
+  ASSERT_THAT(ToArrowSchema(*schema, &arrow_c_schema), IsOk());
+  auto arrow_schema = ::arrow::ImportType(&arrow_c_schema).ValueOrDie();
+  auto array =
+      ::arrow::json::ArrayFromJSONString(arrow_schema, "[[1], [2], [3]]").ValueOrDie();
+
+  std::shared_ptr<FileIO> file_io = arrow::ArrowFileSystemFileIO::MakeMockFileIO();
+  auto writer_result = WriterFactoryRegistry::Open(
+      FileFormatType::kParquet,
+      {.path = "lz4.parquet",
+       .schema = schema,
+       .io = file_io,
+       .properties = {{WriterProperties::kParquetCompressionCodec.key(), "lz4"}}});
+  ASSERT_THAT(writer_result, IsOk());
+  ASSERT_THAT(WriteArray(array, *writer_result.value()), IsOk());
+
+  auto io = internal::checked_cast<arrow::ArrowFileSystemFileIO&>(*file_io);
+  auto input_stream = io.fs()->OpenInputFile("lz4.parquet").ValueOrDie();
+  auto metadata = ::parquet::ReadMetaData(input_stream);
+  ASSERT_EQ(metadata->RowGroup(0)->ColumnChunk(0)->compression(),
+            ::arrow::Compression::LZ4_RAW);
+}
+
+TEST_F(ParquetReadWrite, InvalidWriteProperties) {
+  auto schema = std::make_shared<Schema>(
+      std::vector<SchemaField>{SchemaField::MakeRequired(1, "id", int32())});
+  std::shared_ptr<FileIO> file_io = arrow::ArrowFileSystemFileIO::MakeMockFileIO();
+  for (const auto& properties : std::vector<std::unordered_map<std::string, std::string>>{
+           {{WriterProperties::kParquetCompressionCodec.key(), "snappier"}},
+           {{WriterProperties::kParquetCompressionLevel.key(), "high"}},
+           {{WriterProperties::kParquetRowGroupSizeBytes.key(), "0"}},
+           {{WriterProperties::kParquetPageSizeBytes.key(), "large"}},
+           {{std::string(WriterProperties::kParquetColumnDictEnabledPrefix) + "id",
+             "maybe"}}}) {
+    auto writer_result = WriterFactoryRegistry::Open(
+        FileFormatType::kParquet,
+        {.path = "invalid.parquet",
+         .schema = schema,
+         .io = file_io,
+         .properties = properties});
+    ASSERT_THAT(writer_result, IsError(ErrorKind::kInvalidArgument));
+  }
+}
+
 }  // namespace iceberg::parquet
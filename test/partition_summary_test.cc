@@ -0,0 +1,111 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/partition_summary.h"
+
+#include <cmath>
+#include <limits>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "iceberg/schema_field.h"
+#include "iceberg/type.h"
+#include "matchers.h"
+
+namespace iceberg {
+
+namespace {
+
+std::vector<uint8_t> Bytes(const Literal& value) { return value.Serialize().value(); }
+
+}  // namespace
+
+TEST(PartitionSummaryTest, BoundsIgnoreNullsAndNaN) {
+  StructType partition_type({SchemaField::MakeOptional(1000, "id_bucket", int32()),
+                             SchemaField::MakeOptional(1001, "score", float64()),
+                             SchemaField::MakeOptional(1002, "category", string())});
+  PartitionSummary summary(partition_type);
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  ASSERT_THAT(summary.Update({Literal::Int(3), Literal::Double(nan),
+                              Literal::String("b")}),
+              IsOk());
+  ASSERT_THAT(summary.Update({Literal::Int(-1), Literal::Double(2.5),
+                              Literal::Null(string())}),
+              IsOk());
+  ASSERT_THAT(summary.Update({Literal::Int(7), Literal::Double(-0.5),
+                              Literal::String("a")}),
+              IsOk());
+
+  auto summaries = summary.Summaries();
+  ASSERT_THAT(summaries, IsOk());
+  ASSERT_EQ(summaries->size(), 3);
+
+  EXPECT_FALSE(summaries.value()[0].contains_null);
+  EXPECT_EQ(summaries.value()[0].contains_nan, false);
+  EXPECT_EQ(summaries.value()[0].lower_bound, Bytes(Literal::Int(-1)));
+  EXPECT_EQ(summaries.value()[0].upper_bound, Bytes(Literal::Int(7)));
+
+  EXPECT_FALSE(summaries.value()[1].contains_null);
+  EXPECT_EQ(summaries.value()[1].contains_nan, true);
+  EXPECT_EQ(summaries.value()[1].lower_bound, Bytes(Literal::Double(-0.5)));
+  EXPECT_EQ(summaries.value()[1].upper_bound, Bytes(Literal::Double(2.5)));
+
+  EXPECT_TRUE(summaries.value()[2].contains_null);
+  EXPECT_EQ(summaries.value()[2].lower_bound, Bytes(Literal::String("a")));
+  EXPECT_EQ(summaries.value()[2].upper_bound, Bytes(Literal::String("b")));
+}
+
+TEST(PartitionSummaryTest, AllNullHasNoBounds) {
+  StructType partition_type({SchemaField::MakeOptional(1000, "id_bucket", int32())});
+  PartitionSummary summary(partition_type);
+  ASSERT_THAT(summary.Update({Literal::Null(int32())}), IsOk());
+  auto summaries = summary.Summaries();
+  ASSERT_THAT(summaries, IsOk());
+  ASSERT_EQ(summaries->size(), 1);
+  EXPECT_TRUE(summaries.value()[0].contains_null);
+  EXPECT_FALSE(summaries.value()[0].lower_bound.has_value());
+  EXPECT_FALSE(summaries.value()[0].upper_bound.has_value());
+}
+
+TEST(PartitionSummaryTest, Merge) {
+  StructType partition_type({SchemaField::MakeOptional(1000, "id_bucket", int32())});
+  PartitionSummary left(partition_type);
+  PartitionSummary right(partition_type);
+  ASSERT_THAT(left.Update({Literal::Int(5)}), IsOk());
+  ASSERT_THAT(right.Update({Literal::Int(1)}), IsOk());
+  ASSERT_THAT(right.Update({Literal::Null(int32())}), IsOk());
+  ASSERT_THAT(left.Merge(right), IsOk());
+
+  auto summaries = left.Summaries();
+  ASSERT_THAT(summaries, IsOk());
+  EXPECT_TRUE(summaries.value()[0].contains_null);
+  EXPECT_EQ(summaries.value()[0].lower_bound, Bytes(Literal::Int(1)));
+  EXPECT_EQ(summaries.value()[0].upper_bound, Bytes(Literal::Int(5)));
+}
+
+TEST(PartitionSummaryTest, WrongArity) {
+  StructType partition_type({SchemaField::MakeOptional(1000, "id_bucket", int32())});
+  PartitionSummary summary(partition_type);
+  EXPECT_THAT(summary.Update({}), IsError(ErrorKind::kInvalidArgument));
+  EXPECT_THAT(summary.Merge(PartitionSummary(StructType({}))),
+              IsError(ErrorKind::kInvalidArgument));
+}
+
+}  // namespace iceberg
@@ -0,0 +1,196 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/arrow/partitioned_fanout_writer.h"
+
+#include <format>
+
+#include <gtest/gtest.h>
+
+#include "file_writer_test_base.h"
+#include "iceberg/partition_field.h"
+#include "iceberg/partition_spec.h"
+#include "iceberg/schema.h"
+#include "iceberg/transform.h"
+#include "iceberg/transform_function.h"
+#include "iceberg/type.h"
+#include "matchers.h"
+
+namespace iceberg::arrow {
+
+class PartitionedFanoutWriterTest : public FileWriterTestBase {
+ protected:
+  void SetUp() override {
+    FileWriterTestBase::SetUp();
+    SetSchema({SchemaField::MakeRequired(1, "id", int32()),
+               SchemaField::MakeOptional(2, "ts", timestamp()),
+               SchemaField::MakeOptional(3, "name", string()),
+               SchemaField::MakeOptional(
+                   4, "location",
+                   std::make_shared<StructType>(std::vector<SchemaField>{
+                       SchemaField::MakeOptional(5, "zip", int32())}))});
+  }
+
+  PartitionedFanoutWriterOptions MakeOptions(std::vector<PartitionField> fields,
+                                             int32_t max_open_writers = 64) {
+    return {
+        .spec = std::make_shared<PartitionSpec>(schema_, /*spec_id=*/1,
+                                                std::move(fields)),
+        .file_options = {.format = FileFormatType::kParquet,
+                         .writer_options = MakeWriterOptions()},
+        .new_file_path =
+            [this](std::span<const Literal> partition) {
+              partitions_.emplace_back(partition.begin(), partition.end());
+              return NextFilePath();
+            },
+        .max_open_writers = max_open_writers,
+    };
+  }
+
+  std::vector<std::vector<Literal>> partitions_;
+};
+
+TEST_F(PartitionedFanoutWriterTest, PartitionByIdentityAndHour) {
+  auto writer_result = PartitionedFanoutWriter::Make(
+      MakeOptions({PartitionField(3, 1000, "name", Transform::Identity()),
+                   PartitionField(2, 1001, "ts_hour", Transform::Hour())}));
+  ASSERT_THAT(writer_result, IsOk());
+  auto writer = std::move(writer_result.value());
+
+  ASSERT_THAT(Write(*writer, R"([[1, 0, "a", null],
+                                 [2, 3600000000, "a", null],
+                                 [3, 1, "a", null],
+                                 [4, null, "b", null],
+                                 [5, -1, null, null]])"),
+              IsOk());
+  ASSERT_EQ(writer->open_writers(), 4);
+  ASSERT_THAT(writer->Close(), IsOk());
+  ASSERT_EQ(writer->open_writers(), 0);
+
+  auto data_files = writer->data_files();
+  ASSERT_EQ(data_files.size(), 4);
+  ASSERT_EQ(data_files[0].partition,
+            (std::vector<Literal>{Literal::String("a"), Literal::Int(0)}));
+  ASSERT_EQ(data_files[0].record_count, 2);
+  ASSERT_EQ(data_files[0].lower_bounds.at(1), Literal::Int(1).Serialize().value());
+  ASSERT_EQ(data_files[0].upper_bounds.at(1), Literal::Int(3).Serialize().value());
+  ASSERT_EQ(data_files[1].partition,
+            (std::vector<Literal>{Literal::String("a"), Literal::Int(1)}));
+  ASSERT_EQ(data_files[1].record_count, 1);
+  ASSERT_EQ(data_files[2].partition[0], Literal::String("b"));
+  ASSERT_TRUE(data_files[2].partition[1].IsNull());
+  ASSERT_EQ(data_files[2].record_count, 1);
+  ASSERT_TRUE(data_files[3].partition[0].IsNull());
+  ASSERT_EQ(data_files[3].partition[1], Literal::Int(-1));
+  ASSERT_EQ(data_files[3].record_count, 1);
+  for (size_t i = 0; i < data_files.size(); ++i) {
+    ASSERT_EQ(data_files[i].partition_spec_id, 1);
+    ASSERT_EQ(data_files[i].file_path, std::format("data-{}.parquet", i));
+  }
+}
+
+TEST_F(PartitionedFanoutWriterTest, PartitionByNestedBucket) {
+  auto writer_result = PartitionedFanoutWriter::Make(
+      MakeOptions({PartitionField(5, 1000, "zip_bucket", Transform::Bucket(4))}));
+  ASSERT_THAT(writer_result, IsOk());
+  auto writer = std::move(writer_result.value());
+
+  ASSERT_THAT(Write(*writer, R"([[1, null, null, {"zip": 42}],
+                                 [2, null, null, {"zip": 34}],
+                                 [3, null, null, {"zip": null}],
+                                 [4, null, null, null]])"),
+              IsOk());
+  ASSERT_THAT(writer->Close(), IsOk());
+
+  // The partition values match the transform of each value.
+  auto bucket = Transform::Bucket(4)->Bind(int32()).value();
+  int64_t record_count = 0;
+  for (const auto& data_file : writer->data_files()) {
+    ASSERT_EQ(data_file.partition.size(), 1);
+    record_count += data_file.record_count;
+    const auto& partition = data_file.partition[0];
+    if (partition.IsNull()) {
+      // Rows with a null zip or a null location.
+      ASSERT_EQ(data_file.record_count, 2);
+      continue;
+    }
+    const auto& lower = data_file.lower_bounds.at(5);
+    auto zip = Literal::Deserialize(lower, int32()).value();
+    ASSERT_EQ(bucket->Transform(zip).value(), partition);
+  }
+  ASSERT_EQ(record_count, 4);
+}
+
+TEST_F(PartitionedFanoutWriterTest, CloseLeastRecentlyWrittenPartition) {
+  auto writer_result = PartitionedFanoutWriter::Make(MakeOptions(
+      {PartitionField(1, 1000, "id", Transform::Identity())}, /*max_open_writers=*/1));
+  ASSERT_THAT(writer_result, IsOk());
+  auto writer = std::move(writer_result.value());
+
+  ASSERT_THAT(Write(*writer, R"([[1, null, "a", null],
+                                 [2, null, "b", null],
+                                 [1, null, "c", null]])"),
+              IsOk());
+  ASSERT_EQ(writer->open_writers(), 1);
+  ASSERT_EQ(writer->data_files().size(), 1);
+  ASSERT_THAT(Write(*writer, R"([[1, null, "d", null]])"), IsOk());
+  ASSERT_THAT(writer->Close(), IsOk());
+
+  auto data_files = writer->data_files();
+  ASSERT_EQ(data_files.size(), 3);
+  ASSERT_EQ(data_files[0].partition[0], Literal::Int(1));
+  ASSERT_EQ(data_files[0].record_count, 2);
+  ASSERT_EQ(data_files[1].partition[0], Literal::Int(2));
+  ASSERT_EQ(data_files[1].record_count, 1);
+  ASSERT_EQ(data_files[2].partition[0], Literal::Int(1));
+  ASSERT_EQ(data_files[2].record_count, 1);
+  ASSERT_EQ(partitions_.size(), 3);
+  ASSERT_EQ(partitions_[2], std::vector<Literal>{Literal::Int(1)});
+}
+
+TEST_F(PartitionedFanoutWriterTest, Unpartitioned) {
+  auto writer_result = PartitionedFanoutWriter::Make(MakeOptions({}));
+  ASSERT_THAT(writer_result, IsOk());
+  auto writer = std::move(writer_result.value());
+
+  ASSERT_THAT(Write(*writer, R"([[1, null, "a", null], [2, null, "b", null]])"),
+              IsOk());
+  ASSERT_THAT(writer->Close(), IsOk());
+  auto data_files = writer->data_files();
+  ASSERT_EQ(data_files.size(), 1);
+  ASSERT_TRUE(data_files[0].partition.empty());
+  ASSERT_EQ(data_files[0].record_count, 2);
+}
+
+TEST_F(PartitionedFanoutWriterTest, InvalidOptions) {
+  auto options = MakeOptions({});
+  options.spec = nullptr;
+  ASSERT_THAT(PartitionedFanoutWriter::Make(options),
+              IsError(ErrorKind::kInvalidArgument));
+  ASSERT_THAT(PartitionedFanoutWriter::Make(MakeOptions({}, /*max_open_writers=*/0)),
+              IsError(ErrorKind::kInvalidArgument));
+  ASSERT_THAT(PartitionedFanoutWriter::Make(MakeOptions(
+                  {PartitionField(10, 1000, "missing", Transform::Identity())})),
+              IsError(ErrorKind::kInvalidArgument));
+  ASSERT_THAT(PartitionedFanoutWriter::Make(
+                  MakeOptions({PartitionField(3, 1000, "name", Transform::Hour())})),
+              IsError(ErrorKind::kNotSupported));
+}
+
+}  // namespace iceberg::arrow
@@ -0,0 +1,298 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/rewrite_manifests.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "catalog_table_test_base.h"
+#include "iceberg/manifest_entry.h"
+#include "iceberg/manifest_reader.h"
+#include "iceberg/parallel_manifest_writer.h"
+#include "iceberg/partition_spec.h"
+#include "iceberg/schema.h"
+#include "iceberg/snapshot.h"
+#include "iceberg/table.h"
+#include "iceberg/table_metadata.h"
+#include "iceberg/util/macros.h"
+#include "matchers.h"
+
+namespace iceberg {
+
+namespace {
+
+/// \brief Commits each batch of entries as one new manifest.
+class AppendManifests : public SnapshotProducer {
+ public:
+  AppendManifests(const Table& table, std::vector<std::vector<ManifestEntry>> batches)
+      : SnapshotProducer(table), batches_(std::move(batches)) {}
+
+ protected:
+  std::string operation() const override { return DataOperation::kAppend; }
+
+  Result<std::vector<ManifestFile>> Apply(
+      const TableMetadata& base, const std::shared_ptr<Snapshot>& parent) override {
+    ICEBERG_ASSIGN_OR_RAISE(auto spec, base.PartitionSpec());
+    ICEBERG_ASSIGN_OR_RAISE(auto partition_schema, spec->PartitionSchema());
+    std::vector<ManifestFile> manifests;
+    if (parent != nullptr) {
+      ICEBERG_ASSIGN_OR_RAISE(auto reader,
+                              ManifestListReader::Make(parent->manifest_list, io()));
+      ICEBERG_ASSIGN_OR_RAISE(manifests, reader->Files());
+    }
+    for (auto& batch : batches_) {
+      for (auto& entry : batch) {
+        entry.snapshot_id = snapshot_id();
+      }
+      ParallelManifestWriterOptions options{
+          .format_version = base.format_version,
+          .snapshot_id = snapshot_id(),
+          .partition_spec_id = spec->spec_id(),
+          .partition_schema = partition_schema,
+          .io = io(),
+          .new_manifest_location = [this]() { return NewManifestLocation(); },
+      };
+      ICEBERG_ASSIGN_OR_RAISE(auto written,
+                              ParallelManifestWriter::Write(batch, options));
+      manifests.insert(manifests.begin(), written.begin(), written.end());
+      added_files_ += static_cast<int64_t>(batch.size());
+    }
+    return manifests;
+  }
+
+  std::unordered_map<std::string, std::string> Summary() const override {
+    return {{SnapshotSummaryFields::kAddedDataFiles, std::to_string(added_files_)}};
+  }
+
+ private:
+  std::vector<std::vector<ManifestEntry>> batches_;
+  int64_t added_files_ = 0;
+};
+
+}  // namespace
+
+class RewriteManifestsTest : public CatalogTableTestBase {
+ protected:
+  /// \brief Append `manifest_count` manifests of 4 files each, one per partition.
+  void AppendManifestsOfAllPartitions(int32_t manifest_count) {
+    std::vector<std::vector<ManifestEntry>> batches(manifest_count);
+    for (int32_t i = 0; i < manifest_count * 4; ++i) {
+      auto data_file = std::make_shared<DataFile>();
+      data_file->file_path = std::format("s3://bucket/data/{:03d}.parquet", i);
+      data_file->partition = {Literal::Long(i % 4)};
+      data_file->record_count = 10;
+      data_file->file_size_in_bytes = 1024;
+      batches[i / 4].push_back(ManifestEntry{.status = ManifestStatus::kAdded,
+                                             .data_file = std::move(data_file)});
+    }
+    auto table = LoadTable();
+    AppendManifests append(*table, std::move(batches));
+    ASSERT_THAT(append.Commit(), IsOk());
+    append_snapshot_ = append.committed_snapshot();
+  }
+
+  std::vector<ManifestFile> CurrentManifests() {
+    auto snapshot = LoadTable()->current_snapshot();
+    EXPECT_THAT(snapshot, IsOk());
+    return ReadManifests(*snapshot.value());
+  }
+
+  std::vector<ManifestEntry> ReadEntries(const ManifestFile& manifest) {
+    auto spec = LoadTable()->spec();
+    EXPECT_THAT(spec, IsOk());
+    auto reader =
+        ManifestReader::Make(manifest, file_io_, spec.value()->PartitionSchema().value());
+    EXPECT_THAT(reader, IsOk());
+    auto entries = reader.value()->Entries();
+    EXPECT_THAT(entries, IsOk());
+    return entries.value();
+  }
+
+  static int64_t Bound(const std::vector<uint8_t>& bound) {
+    auto literal = Literal::Deserialize(bound, int64());
+    EXPECT_THAT(literal, IsOk());
+    return std::get<int64_t>(literal.value().value());
+  }
+
+  std::shared_ptr<Snapshot> append_snapshot_;
+};
+
+TEST_F(RewriteManifestsTest, MergesSmallManifests) {
+  ASSERT_NO_FATAL_FAILURE(AppendManifestsOfAllPartitions(/*manifest_count=*/6));
+  ASSERT_EQ(CurrentManifests().size(), 6);
+
+  auto rewrite = LoadTable()->NewRewriteManifests();
+  ASSERT_THAT(rewrite->Commit(), IsOk());
+  EXPECT_EQ(rewrite->rewritten_manifests().size(), 6);
+  ASSERT_EQ(rewrite->added_manifests().size(), 1);
+
+  const auto& snapshot = rewrite->committed_snapshot();
+  ASSERT_NE(snapshot, nullptr);
+  EXPECT_EQ(snapshot->operation(), DataOperation::kReplace);
+  EXPECT_EQ(snapshot->parent_snapshot_id, append_snapshot_->snapshot_id);
+  EXPECT_EQ(snapshot->summary.at(SnapshotSummaryFields::kReplacedManifestsCount), "6");
+  EXPECT_EQ(snapshot->summary.at(SnapshotSummaryFields::kCreatedManifestsCount), "1");
+  EXPECT_EQ(snapshot->summary.at(SnapshotSummaryFields::kProcessedManifestEntries),
+            "24");
+  // Rewriting manifests does not change the table contents.
+  EXPECT_EQ(snapshot->summary.at(SnapshotSummaryFields::kTotalDataFiles), "24");
+
+  auto manifests = CurrentManifests();
+  ASSERT_EQ(manifests.size(), 1);
+  EXPECT_EQ(manifests[0].sequence_number, snapshot->sequence_number);
+  EXPECT_EQ(manifests[0].min_sequence_number, append_snapshot_->sequence_number);
+  EXPECT_EQ(manifests[0].existing_files_count, 24);
+
+  auto entries = ReadEntries(manifests[0]);
+  ASSERT_EQ(entries.size(), 24);
+  for (size_t i = 0; i < entries.size(); ++i) {
+    EXPECT_EQ(entries[i].status, ManifestStatus::kExisting);
+    EXPECT_EQ(entries[i].snapshot_id, append_snapshot_->snapshot_id);
+    EXPECT_EQ(entries[i].sequence_number, append_snapshot_->sequence_number);
+    // Entries are clustered by partition.
+    EXPECT_EQ(entries[i].data_file->partition[0], Literal::Long(i / 6));
+  }
+}
+
+TEST_F(RewriteManifestsTest, ClustersEntriesByPartition) {
+  ASSERT_NO_FATAL_FAILURE(AppendManifestsOfAllPartitions(/*manifest_count=*/6));
+  auto entry = ReadEntries(CurrentManifests()[0])[0];
+  entry.status = ManifestStatus::kExisting;
+  const int64_t target_size = 6 * ParallelManifestWriter::EstimateEncodedSize(entry);
+
+  auto table = LoadTable();
+  table->metadata()->properties[ManifestWriterProperties::kTargetSizeBytes.key()] =
+      std::to_string(target_size);
+  auto rewrite = table->NewRewriteManifests();
+  rewrite->RewriteIf([](const ManifestFile&) { return true; });
+  ASSERT_THAT(rewrite->Commit(), IsOk());
+
+  auto manifests = CurrentManifests();
+  ASSERT_GT(manifests.size(), 1);
+  int64_t files = 0;
+  for (size_t i = 0; i < manifests.size(); ++i) {
+    ASSERT_EQ(manifests[i].partitions.size(), 1);
+    const auto& summary = manifests[i].partitions[0];
+    ASSERT_TRUE(summary.lower_bound.has_value());
+    ASSERT_TRUE(summary.upper_bound.has_value());
+    // Manifests cover disjoint, ascending ranges of partitions.
+    if (i > 0) {
+      EXPECT_LE(Bound(manifests[i - 1].partitions[0].upper_bound.value()),
+                Bound(summary.lower_bound.value()));
+    }
+    files += manifests[i].existing_files_count.value_or(0);
+  }
+  EXPECT_EQ(files, 24);
+}
+
+TEST_F(RewriteManifestsTest, InvalidTargetSize) {
+  ASSERT_NO_FATAL_FAILURE(AppendManifestsOfAllPartitions(/*manifest_count=*/2));
+
+  auto table = LoadTable();
+  table->metadata()->properties[ManifestWriterProperties::kTargetSizeBytes.key()] =
+      "large";
+  auto rewrite = table->NewRewriteManifests();
+  EXPECT_THAT(rewrite->Commit(), IsError(ErrorKind::kInvalidArgument));
+  EXPECT_EQ(LoadTable()->current_snapshot().value()->snapshot_id,
+            append_snapshot_->snapshot_id);
+}
+
+TEST_F(RewriteManifestsTest, KeepsRowIdsOfV3Tables) {
+  table_ident_ = TableIdentifier{.ns = {}, .name = "t3"};
+  ASSERT_NO_FATAL_FAILURE(RegisterEmptyTable(table_ident_, /*format_version=*/3));
+  ASSERT_NO_FATAL_FAILURE(AppendManifestsOfAllPartitions(/*manifest_count=*/3));
+  const int64_t next_row_id = LoadTable()->metadata()->next_row_id;
+  EXPECT_EQ(next_row_id, 120);
+
+  // Files inherit the row ids following the first row id of their manifest.
+  std::unordered_map<std::string, int64_t> row_ids;
+  for (const auto& manifest : CurrentManifests()) {
+    ASSERT_TRUE(manifest.first_row_id.has_value());
+    int64_t row_id = *manifest.first_row_id;
+    for (const auto& entry : ReadEntries(manifest)) {
+      EXPECT_EQ(entry.data_file->first_row_id, std::nullopt);
+      row_ids[entry.data_file->file_path] = row_id;
+      row_id += entry.data_file->record_count;
+    }
+  }
+  ASSERT_EQ(row_ids.size(), 12);
+
+  auto rewrite = LoadTable()->NewRewriteManifests();
+  ASSERT_THAT(rewrite->Commit(), IsOk());
+
+  // The rewritten files keep their row ids and no new row ids are assigned.
+  EXPECT_EQ(LoadTable()->metadata()->next_row_id, next_row_id);
+  auto manifests = CurrentManifests();
+  ASSERT_EQ(manifests.size(), 1);
+  EXPECT_EQ(manifests[0].first_row_id, 0);
+  auto entries = ReadEntries(manifests[0]);
+  ASSERT_EQ(entries.size(), 12);
+  for (const auto& entry : entries) {
+    EXPECT_EQ(entry.data_file->first_row_id, row_ids.at(entry.data_file->file_path));
+  }
+}
+
+TEST_F(RewriteManifestsTest, SkipsSingleManifest) {
+  ASSERT_NO_FATAL_FAILURE(AppendManifestsOfAllPartitions(/*manifest_count=*/1));
+
+  auto rewrite = LoadTable()->NewRewriteManifests();
+  ASSERT_THAT(rewrite->Commit(), IsOk());
+  EXPECT_EQ(rewrite->committed_snapshot(), nullptr);
+  EXPECT_TRUE(rewrite->added_manifests().empty());
+  EXPECT_EQ(LoadTable()->current_snapshot().value()->snapshot_id,
+            append_snapshot_->snapshot_id);
+}
+
+TEST_F(RewriteManifestsTest, RetriedAfterConcurrentAppend) {
+  ASSERT_NO_FATAL_FAILURE(AppendManifestsOfAllPartitions(/*manifest_count=*/6));
+  auto rewrite = LoadTable()->NewRewriteManifests();
+  ASSERT_NO_FATAL_FAILURE(AppendManifestsOfAllPartitions(/*manifest_count=*/1));
+  auto appended = CurrentManifests()[0];
+
+  // The rewrite is planned on the table before the second append and reapplied on top
+  // of it, keeping the appended manifest.
+  ASSERT_THAT(rewrite->Commit(), IsOk());
+  const auto& snapshot = rewrite->committed_snapshot();
+  EXPECT_EQ(snapshot->parent_snapshot_id, append_snapshot_->snapshot_id);
+  EXPECT_EQ(snapshot->summary.at(SnapshotSummaryFields::kReplacedManifestsCount), "6");
+  EXPECT_EQ(snapshot->summary.at(SnapshotSummaryFields::kKeptManifestsCount), "1");
+  EXPECT_EQ(snapshot->summary.at(SnapshotSummaryFields::kTotalDataFiles), "28");
+
+  auto manifests = CurrentManifests();
+  ASSERT_EQ(manifests.size(), 2);
+  EXPECT_EQ(manifests[0].manifest_path, rewrite->added_manifests()[0].manifest_path);
+  EXPECT_EQ(manifests[1], appended);
+}
+
+TEST_F(RewriteManifestsTest, ConcurrentRewriteFailsValidation) {
+  ASSERT_NO_FATAL_FAILURE(AppendManifestsOfAllPartitions(/*manifest_count=*/6));
+  auto table = LoadTable();
+  auto first = table->NewRewriteManifests();
+  auto second = table->NewRewriteManifests();
+  ASSERT_THAT(first->Commit(), IsOk());
+
+  // The manifests the second rewrite replaces were already replaced by the first.
+  EXPECT_THAT(second->Commit(), IsError(ErrorKind::kValidationFailed));
+  EXPECT_TRUE(second->added_manifests().empty());
+  EXPECT_EQ(LoadTable()->current_snapshot().value()->snapshot_id,
+            first->committed_snapshot()->snapshot_id);
+}
+
+}  // namespace iceberg
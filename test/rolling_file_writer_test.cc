@@ -0,0 +1,156 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/rolling_file_writer.h"
+
+#include <arrow/array.h>
+#include <arrow/c/bridge.h>
+#include <arrow/json/from_string.h>
+#include <arrow/type.h>
+#include <gtest/gtest.h>
+
+#include "file_writer_test_base.h"
+#include "iceberg/schema.h"
+#include "iceberg/type.h"
+#include "matchers.h"
+
+namespace iceberg {
+
+class RollingFileWriterTest : public FileWriterTestBase {
+ protected:
+  void SetUp() override {
+    FileWriterTestBase::SetUp();
+    SetSchema({SchemaField::MakeRequired(1, "id", int32()),
+               SchemaField::MakeOptional(2, "name", string())});
+  }
+
+  RollingFileWriterOptions MakeOptions(std::string target_file_size_bytes) {
+    return {
+        .format = FileFormatType::kParquet,
+        .writer_options = MakeWriterOptions(
+            {{WriterProperties::kTargetFileSizeBytes.key(),
+              std::move(target_file_size_bytes)}}),
+        .new_file_path = [this]() { return NextFilePath(); },
+        .partition_spec_id = 1,
+    };
+  }
+};
+
+TEST_F(RollingFileWriterTest, RollAtTargetSize) {
+  // Every batch exceeds the target size and closes its file.
+  auto writer_result = RollingFileWriter::Make(MakeOptions("1"));
+  ASSERT_THAT(writer_result, IsOk());
+  auto writer = std::move(writer_result.value());
+  ASSERT_EQ(writer->target_file_size_bytes(), 1);
+
+  ASSERT_THAT(Write(*writer, R"([[1, "a"], [2, "b"]])"), IsOk());
+  ASSERT_THAT(Write(*writer, R"([])"), IsOk());
+  ASSERT_THAT(Write(*writer, R"([[3, null]])"), IsOk());
+  ASSERT_THAT(writer->Close(), IsOk());
+
+  const auto& data_files = writer->data_files();
+  ASSERT_EQ(data_files.size(), 2);
+  ASSERT_EQ(data_files[0].file_path, "data-0.parquet");
+  ASSERT_EQ(data_files[1].file_path, "data-1.parquet");
+  ASSERT_EQ(data_files[0].record_count, 2);
+  ASSERT_EQ(data_files[1].record_count, 1);
+  ASSERT_EQ(writer->length(),
+            data_files[0].file_size_in_bytes + data_files[1].file_size_in_bytes);
+  for (const auto& data_file : data_files) {
+    ASSERT_EQ(data_file.file_format, FileFormatType::kParquet);
+    ASSERT_EQ(data_file.partition_spec_id, 1);
+    ASSERT_GT(data_file.file_size_in_bytes, 0);
+    ASSERT_EQ(data_file.split_offsets.size(), 1);
+    ASSERT_EQ(data_file.value_counts.at(1), data_file.record_count);
+  }
+  ASSERT_EQ(data_files[0].lower_bounds.at(1), Literal::Int(1).Serialize().value());
+  ASSERT_EQ(data_files[0].upper_bounds.at(1), Literal::Int(2).Serialize().value());
+  ASSERT_EQ(data_files[1].null_value_counts.at(2), 1);
+  ASSERT_FALSE(data_files[1].lower_bounds.contains(2));
+}
+
+TEST_F(RollingFileWriterTest, WriteSingleFile) {
+  auto writer_result = RollingFileWriter::Make(MakeOptions("1048576"));
+  ASSERT_THAT(writer_result, IsOk());
+  auto writer = std::move(writer_result.value());
+
+  ASSERT_THAT(Write(*writer, R"([[1, "a"], [2, "b"]])"), IsOk());
+  ASSERT_THAT(Write(*writer, R"([[3, "c"]])"), IsOk());
+  ASSERT_TRUE(writer->data_files().empty());
+  ASSERT_GT(writer->length(), 0);
+  ASSERT_THAT(writer->Close(), IsOk());
+
+  ASSERT_EQ(writer->data_files().size(), 1);
+  ASSERT_EQ(writer->data_files()[0].record_count, 3);
+  ASSERT_EQ(writer->data_files()[0].upper_bounds.at(2),
+            Literal::String("c").Serialize().value());
+}
+
+TEST_F(RollingFileWriterTest, NoDataNoFile) {
+  auto writer_result = RollingFileWriter::Make(MakeOptions("1024"));
+  ASSERT_THAT(writer_result, IsOk());
+  ASSERT_THAT(writer_result.value()->Close(), IsOk());
+  ASSERT_TRUE(writer_result.value()->data_files().empty());
+  ASSERT_EQ(next_file_, 0);
+}
+
+TEST_F(RollingFileWriterTest, InvalidOptions) {
+  ASSERT_THAT(RollingFileWriter::Make(MakeOptions("0")),
+              IsError(ErrorKind::kInvalidArgument));
+  ASSERT_THAT(RollingFileWriter::Make(MakeOptions("large")),
+              IsError(ErrorKind::kInvalidArgument));
+  auto options = MakeOptions("1024");
+  options.new_file_path = nullptr;
+  ASSERT_THAT(RollingFileWriter::Make(std::move(options)),
+              IsError(ErrorKind::kInvalidArgument));
+}
+
+TEST_F(RollingFileWriterTest, FailedWrites) {
+  // A batch whose file cannot be opened is released.
+  auto options = MakeOptions("1024");
+  options.format = FileFormatType::kOrc;
+  auto writer_result = RollingFileWriter::Make(std::move(options));
+  ASSERT_THAT(writer_result, IsOk());
+  auto array =
+      ::arrow::json::ArrayFromJSONString(arrow_type_, R"([[1, "a"]])").ValueOrDie();
+  const auto use_count = array->data().use_count();
+  ArrowArray arrow_array;
+  ASSERT_TRUE(::arrow::ExportArray(*array, &arrow_array).ok());
+  ASSERT_GT(array->data().use_count(), use_count);
+  ASSERT_THAT(writer_result.value()->Write(arrow_array),
+              IsError(ErrorKind::kNotImplemented));
+  ASSERT_EQ(array->data().use_count(), use_count);
+
+  // The rows of a batch that fails to be written are not counted.
+  writer_result = RollingFileWriter::Make(MakeOptions("1024"));
+  ASSERT_THAT(writer_result, IsOk());
+  auto writer = std::move(writer_result.value());
+  auto id_only = ::arrow::json::ArrayFromJSONString(
+                     ::arrow::struct_({::arrow::field("id", ::arrow::int32(), false)}),
+                     "[[1], [2]]")
+                     .ValueOrDie();
+  ASSERT_TRUE(::arrow::ExportArray(*id_only, &arrow_array).ok());
+  ASSERT_THAT(writer->Write(arrow_array), IsError(ErrorKind::kUnknownError));
+  ASSERT_THAT(Write(*writer, R"([[3, "c"]])"), IsOk());
+  ASSERT_THAT(writer->Close(), IsOk());
+  ASSERT_EQ(writer->data_files().size(), 1);
+  ASSERT_EQ(writer->data_files()[0].record_count, 1);
+}
+
+}  // namespace iceberg
@@ -0,0 +1,164 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "iceberg/arrow/sorted_file_writer.h"
+
+#include <filesystem>
+#include <format>
+
+#include <gtest/gtest.h>
+
+#include "file_writer_test_base.h"
+#include "iceberg/schema.h"
+#include "iceberg/sort_field.h"
+#include "iceberg/sort_order.h"
+#include "iceberg/transform.h"
+#include "iceberg/type.h"
+#include "matchers.h"
+
+namespace iceberg::arrow {
+
+class SortedFileWriterTest : public FileWriterTestBase {
+ protected:
+  void SetUp() override {
+    FileWriterTestBase::SetUp();
+    SetSchema({SchemaField::MakeRequired(1, "id", int32()),
+               SchemaField::MakeOptional(2, "name", string()),
+               SchemaField::MakeOptional(3, "score", float64())});
+
+    spill_directory_ = std::filesystem::temp_directory_path() /
+                       std::format("sorted_file_writer_test_{}",
+                                   ::testing::UnitTest::GetInstance()->random_seed());
+    std::filesystem::create_directories(spill_directory_);
+  }
+
+  void TearDown() override { std::filesystem::remove_all(spill_directory_); }
+
+  // Each batch of one row is written to its own data file, so that the bounds of the
+  // data files show the order of the rows.
+  SortedFileWriterOptions MakeOptions(std::vector<SortField> fields) {
+    return {
+        .sort_order = std::make_shared<SortOrder>(/*order_id=*/3, std::move(fields)),
+        .file_options =
+            {.format = FileFormatType::kParquet,
+             .writer_options =
+                 MakeWriterOptions({{WriterProperties::kTargetFileSizeBytes.key(), "1"}}),
+             .new_file_path = [this]() { return NextFilePath(); }},
+        .spill_directory = spill_directory_.string(),
+        .batch_rows = 1,
+    };
+  }
+
+  static std::vector<int32_t> Ids(const std::vector<DataFile>& data_files) {
+    std::vector<int32_t> ids;
+    for (const auto& data_file : data_files) {
+      EXPECT_EQ(data_file.record_count, 1);
+      auto id = Literal::Deserialize(data_file.lower_bounds.at(1), int32()).value();
+      ids.push_back(std::get<int32_t>(id.value()));
+    }
+    return ids;
+  }
+
+  std::filesystem::path spill_directory_;
+};
+
+TEST_F(SortedFileWriterTest, SortByDirectionAndNullOrder) {
+  auto writer_result = SortedFileWriter::Make(MakeOptions(
+      {SortField(2, Transform::Identity(), SortDirection::kDescending, NullOrder::kLast),
+       SortField(3, Transform::Identity(), SortDirection::kAscending,
+                 NullOrder::kFirst)}));
+  ASSERT_THAT(writer_result, IsOk());
+  auto writer = std::move(writer_result.value());
+
+  ASSERT_THAT(Write(*writer, R"([[1, "a", 1.5],
+                                 [2, null, 0.0],
+                                 [3, "ab", -2.0],
+                                 [4, "a", -0.5]])"),
+              IsOk());
+  ASSERT_THAT(Write(*writer, R"([[5, "b", null],
+                                 [6, "a", null],
+                                 [7, "a\u0000", 3.0],
+                                 [8, "ab", -2.0]])"),
+              IsOk());
+  ASSERT_TRUE(writer->data_files().empty());
+  ASSERT_THAT(writer->Close(), IsOk());
+  ASSERT_EQ(writer->spilled_runs(), 0);
+
+  // Names in descending order with nulls last, then scores in ascending order with
+  // nulls first. Rows with equal keys keep their order.
+  auto data_files = writer->data_files();
+  ASSERT_EQ(Ids(data_files), (std::vector<int32_t>{5, 3, 8, 7, 6, 4, 1, 2}));
+  for (const auto& data_file : data_files) {
+    ASSERT_EQ(data_file.sort_order_id, 3);
+  }
+}
+
+TEST_F(SortedFileWriterTest, SortByTransformWithSpilledRuns) {
+  auto options = MakeOptions(
+      {SortField(1, Transform::Truncate(10), SortDirection::kAscending,
+                 NullOrder::kFirst)});
+  options.memory_budget_bytes = 1;
+  auto writer_result = SortedFileWriter::Make(std::move(options));
+  ASSERT_THAT(writer_result, IsOk());
+  auto writer = std::move(writer_result.value());
+
+  ASSERT_THAT(Write(*writer, R"([[25, null, null], [3, null, null], [-1, null, null]])"),
+              IsOk());
+  ASSERT_THAT(Write(*writer, R"([[12, null, null], [21, null, null]])"), IsOk());
+  ASSERT_THAT(Write(*writer, R"([[5, null, null], [-10, null, null]])"), IsOk());
+  ASSERT_EQ(writer->spilled_runs(), 3);
+  ASSERT_FALSE(std::filesystem::is_empty(spill_directory_));
+  ASSERT_THAT(writer->Close(), IsOk());
+
+  // The truncated ids in ascending order, with equal values in the order written.
+  ASSERT_EQ(Ids(writer->data_files()),
+            (std::vector<int32_t>{-1, -10, 3, 5, 12, 25, 21}));
+  ASSERT_TRUE(std::filesystem::is_empty(spill_directory_));
+}
+
+TEST_F(SortedFileWriterTest, Unsorted) {
+  auto writer_result = SortedFileWriter::Make(MakeOptions({}));
+  ASSERT_THAT(writer_result, IsOk());
+  auto writer = std::move(writer_result.value());
+
+  ASSERT_THAT(Write(*writer, R"([[2, null, null], [1, null, null]])"), IsOk());
+  ASSERT_THAT(writer->Close(), IsOk());
+  auto data_files = writer->data_files();
+  ASSERT_EQ(data_files.size(), 1);
+  ASSERT_EQ(data_files[0].record_count, 2);
+  ASSERT_EQ(data_files[0].sort_order_id, 3);
+}
+
+TEST_F(SortedFileWriterTest, InvalidOptions) {
+  auto options = MakeOptions({});
+  options.sort_order = nullptr;
+  ASSERT_THAT(SortedFileWriter::Make(options), IsError(ErrorKind::kInvalidArgument));
+  options = MakeOptions({});
+  options.memory_budget_bytes = 0;
+  ASSERT_THAT(SortedFileWriter::Make(options), IsError(ErrorKind::kInvalidArgument));
+  ASSERT_THAT(SortedFileWriter::Make(MakeOptions({SortField(10, Transform::Identity(),
+                                                            SortDirection::kAscending,
+                                                            NullOrder::kFirst)})),
+              IsError(ErrorKind::kInvalidArgument));
+  ASSERT_THAT(SortedFileWriter::Make(MakeOptions({SortField(
+                  2, Transform::Hour(), SortDirection::kAscending, NullOrder::kFirst)})),
+              IsError(ErrorKind::kNotSupported));
+}
+
+}  // namespace iceberg::arrow
@@ -19,15 +19,23 @@
 
 #include "iceberg/transform.h"
 
+#include <chrono>
 #include <format>
+#include <limits>
 #include <memory>
+#include <string>
+#include <type_traits>
+#include <variant>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <nanoarrow/nanoarrow.h>
 
 #include "iceberg/expression/literal.h"
 #include "iceberg/type.h"
 #include "iceberg/util/formatter.h"  // IWYU pragma: keep
+#include "iceberg/util/transform_kernels_internal.h"
 #include "matchers.h"
 
 namespace iceberg {
@@ -254,10 +262,10 @@ TEST(TransformLiteralTest, BucketTransform) {
   const std::vector<Case> cases = {
       {.source_type = iceberg::int32(),
        .source = Literal::Int(42),
-       .expected = Literal::Int(3)},
+       .expected = Literal::Int(2)},
       {.source_type = iceberg::date(),
        .source = Literal::Date(30000),
-       .expected = Literal::Int(2)},
+       .expected = Literal::Int(1)},
       {.source_type = iceberg::int64(),
        .source = Literal::Long(1234567890),
        .expected = Literal::Int(3)},
@@ -284,6 +292,38 @@ TEST(TransformLiteralTest, BucketTransform) {
   }
 }
 
+TEST(TransformLiteralTest, BucketTransformMatchesSpecHashes) {
+  // The hash values of the spec's appendix B. With INT32_MAX buckets the bucket is the
+  // hash without its sign bit.
+  constexpr int32_t kMask = std::numeric_limits<int32_t>::max();
+  auto transform = Transform::Bucket(kMask);
+
+  struct Case {
+    std::shared_ptr<Type> source_type;
+    Literal source;
+    int32_t hash;
+  };
+
+  const std::vector<Case> cases = {
+      {int32(), Literal::Int(34), 2017239379},
+      {int64(), Literal::Long(34), 2017239379},
+      {date(), Literal::Date(17486), -653330422},
+      {time(), Literal::Time(81068000000), -662762989},
+      {timestamp(), Literal::Timestamp(1510871468000000), -2047944441},
+      {timestamp_tz(), Literal::TimestampTz(1510871468000000), -2047944441},
+      {string(), Literal::String("iceberg"), 1210000089},
+      {binary(), Literal::Binary({0x00, 0x01, 0x02, 0x03}), -188683207},
+  };
+
+  for (const auto& c : cases) {
+    auto bound = transform->Bind(c.source_type);
+    ASSERT_THAT(bound, IsOk());
+    auto result = bound.value()->Transform(c.source);
+    ASSERT_THAT(result, IsOk());
+    EXPECT_EQ(result.value(), Literal::Int(c.hash & kMask)) << c.source.ToString();
+  }
+}
+
 TEST(TransformLiteralTest, TruncateTransform) {
   struct Case {
     std::shared_ptr<Type> source_type;
@@ -297,6 +337,14 @@ TEST(TransformLiteralTest, TruncateTransform) {
        .width = 5,
        .source = Literal::Int(123456),
        .expected = Literal::Int(123455)},
+      {.source_type = iceberg::int32(),
+       .width = 10,
+       .source = Literal::Int(-1),
+       .expected = Literal::Int(-10)},
+      {.source_type = iceberg::int64(),
+       .width = 10,
+       .source = Literal::Long(-11),
+       .expected = Literal::Long(-20)},
       {.source_type = iceberg::string(),
        .width = 5,
        .source = Literal::String("Hello, World!"),
@@ -445,6 +493,10 @@ TEST(TransformLiteralTest, HourTransform) {
       {.source_type = iceberg::timestamp_tz(),
        .source = Literal::TimestampTz(1622547800000000),
        .expected = Literal::Int(450707)},
+      {.source_type = iceberg::timestamp(),
+       // 1969-12-31T23:59:59.999999Z
+       .source = Literal::Timestamp(-1),
+       .expected = Literal::Int(-1)},
   };
 
   for (const auto& c : cases) {
@@ -459,6 +511,74 @@ TEST(TransformLiteralTest, HourTransform) {
   }
 }
 
+TEST(TransformKernelsTest, CalendarMatchesChrono) {
+  using namespace std::chrono;  // NOLINT
+  auto expected_months = [](const year_month_day& ymd) {
+    return (static_cast<int32_t>(ymd.year()) - 1970) * 12 +
+           static_cast<int32_t>(static_cast<unsigned>(ymd.month())) - 1;
+  };
+
+  // Every day of 4000 years around the epoch, including all leap day rules.
+  std::vector<int32_t> dates;
+  for (int32_t day = -730000; day <= 730000; ++day) {
+    dates.push_back(day);
+  }
+  std::vector<int32_t> years(dates.size());
+  std::vector<int32_t> months(dates.size());
+  TransformKernels::YearFromDays(dates, years);
+  TransformKernels::MonthFromDays(dates, months);
+  for (size_t i = 0; i < dates.size(); ++i) {
+    auto ymd = year_month_day(sys_days(days(dates[i])));
+    ASSERT_EQ(years[i], static_cast<int32_t>(ymd.year())) << dates[i];
+    ASSERT_EQ(months[i], expected_months(ymd)) << dates[i];
+  }
+
+  // Timestamps around midnight and around the epoch.
+  std::vector<int64_t> micros;
+  for (int64_t day : {-719468, -1, 0, 1, 11016, 30000}) {
+    for (int64_t offset : {-1, 0, 1}) {
+      micros.push_back(day * TransformKernels::kMicrosPerDay + offset);
+    }
+  }
+  std::vector<int64_t> nanos;
+  for (int64_t value : micros) {
+    nanos.push_back(value * 1000 - 1);
+    nanos.push_back(value * 1000);
+  }
+
+  std::vector<int32_t> year(micros.size()), month(micros.size()), day(micros.size()),
+      hour(micros.size());
+  TransformKernels::YearFromMicros(micros, year);
+  TransformKernels::MonthFromMicros(micros, month);
+  TransformKernels::DayFromMicros(micros, day);
+  TransformKernels::HourFromMicros(micros, hour);
+  for (size_t i = 0; i < micros.size(); ++i) {
+    auto time = sys_time<microseconds>(microseconds(micros[i]));
+    auto ymd = year_month_day(floor<days>(time));
+    EXPECT_EQ(year[i], static_cast<int32_t>(ymd.year())) << micros[i];
+    EXPECT_EQ(month[i], expected_months(ymd)) << micros[i];
+    EXPECT_EQ(day[i], floor<days>(time).time_since_epoch().count()) << micros[i];
+    EXPECT_EQ(hour[i], floor<hours>(time).time_since_epoch().count()) << micros[i];
+  }
+
+  year.resize(nanos.size());
+  month.resize(nanos.size());
+  day.resize(nanos.size());
+  hour.resize(nanos.size());
+  TransformKernels::YearFromNanos(nanos, year);
+  TransformKernels::MonthFromNanos(nanos, month);
+  TransformKernels::DayFromNanos(nanos, day);
+  TransformKernels::HourFromNanos(nanos, hour);
+  for (size_t i = 0; i < nanos.size(); ++i) {
+    auto time = sys_time<nanoseconds>(nanoseconds(nanos[i]));
+    auto ymd = year_month_day(floor<days>(time));
+    EXPECT_EQ(year[i], static_cast<int32_t>(ymd.year())) << nanos[i];
+    EXPECT_EQ(month[i], expected_months(ymd)) << nanos[i];
+    EXPECT_EQ(day[i], floor<days>(time).time_since_epoch().count()) << nanos[i];
+    EXPECT_EQ(hour[i], floor<hours>(time).time_since_epoch().count()) << nanos[i];
+  }
+}
+
 TEST(TransformLiteralTest, VoidTransform) {
   auto transform = Transform::Void();
 
@@ -556,4 +676,290 @@ TEST(TransformLiteralTest, NullLiteral) {
   }
 }
 
+namespace {
+
+/// \brief Build an array of the storage type of `type` from literals.
+ArrowArray MakeArray(ArrowType type, const std::vector<Literal>& values) {
+  ArrowArray array;
+  EXPECT_EQ(ArrowArrayInitFromType(&array, type), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayStartAppending(&array), NANOARROW_OK);
+  for (const auto& value : values) {
+    if (value.IsNull()) {
+      EXPECT_EQ(ArrowArrayAppendNull(&array, 1), NANOARROW_OK);
+      continue;
+    }
+    std::visit(
+        [&](const auto& v) {
+          using T = std::decay_t<decltype(v)>;
+          if constexpr (std::is_same_v<T, std::string>) {
+            EXPECT_EQ(ArrowArrayAppendString(
+                          &array, {v.data(), static_cast<int64_t>(v.size())}),
+                      NANOARROW_OK);
+          } else if constexpr (std::is_same_v<T, std::vector<uint8_t>>) {
+            ArrowBufferView bytes;
+            bytes.data.as_uint8 = v.data();
+            bytes.size_bytes = static_cast<int64_t>(v.size());
+            EXPECT_EQ(ArrowArrayAppendBytes(&array, bytes), NANOARROW_OK);
+          } else if constexpr (std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>) {
+            EXPECT_EQ(ArrowArrayAppendInt(&array, v), NANOARROW_OK);
+          } else {
+            ADD_FAILURE() << "Unsupported literal " << value.ToString();
+          }
+        },
+        value.value());
+  }
+  EXPECT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), NANOARROW_OK);
+  return array;
+}
+
+/// \brief Read the values of an array of a primitive type as literals.
+std::vector<Literal> ReadArray(ArrowArray& array, const std::shared_ptr<Type>& type) {
+  ArrowType storage_type = NANOARROW_TYPE_INT32;
+  switch (type->type_id()) {
+    case TypeId::kLong:
+    case TypeId::kTimestamp:
+    case TypeId::kTimestampTz:
+      storage_type = NANOARROW_TYPE_INT64;
+      break;
+    case TypeId::kString:
+      storage_type = NANOARROW_TYPE_STRING;
+      break;
+    case TypeId::kBinary:
+      storage_type = NANOARROW_TYPE_BINARY;
+      break;
+    default:
+      break;
+  }
+  ArrowArrayView view;
+  EXPECT_EQ(ArrowArrayViewInitFromType(&view, storage_type), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewSetArray(&view, &array, nullptr), NANOARROW_OK);
+  auto primitive_type = std::static_pointer_cast<PrimitiveType>(type);
+  std::vector<Literal> values;
+  for (int64_t i = 0; i < view.length; ++i) {
+    if (ArrowArrayViewIsNull(&view, i)) {
+      values.push_back(Literal::Null(primitive_type));
+      continue;
+    }
+    switch (type->type_id()) {
+      case TypeId::kLong:
+        values.push_back(Literal::Long(ArrowArrayViewGetIntUnsafe(&view, i)));
+        break;
+      case TypeId::kTimestamp:
+        values.push_back(Literal::Timestamp(ArrowArrayViewGetIntUnsafe(&view, i)));
+        break;
+      case TypeId::kTimestampTz:
+        values.push_back(Literal::TimestampTz(ArrowArrayViewGetIntUnsafe(&view, i)));
+        break;
+      case TypeId::kDate:
+        values.push_back(Literal::Date(
+            static_cast<int32_t>(ArrowArrayViewGetIntUnsafe(&view, i))));
+        break;
+      case TypeId::kString: {
+        auto value = ArrowArrayViewGetStringUnsafe(&view, i);
+        values.push_back(
+            Literal::String(std::string(value.data, value.size_bytes)));
+      } break;
+      case TypeId::kBinary: {
+        auto value = ArrowArrayViewGetBytesUnsafe(&view, i);
+        values.push_back(Literal::Binary(std::vector<uint8_t>(
+            value.data.as_uint8, value.data.as_uint8 + value.size_bytes)));
+      } break;
+      default:
+        values.push_back(
+            Literal::Int(static_cast<int32_t>(ArrowArrayViewGetIntUnsafe(&view, i))));
+        break;
+    }
+  }
+  ArrowArrayViewReset(&view);
+  return values;
+}
+
+}  // namespace
+
+TEST(TransformArrayTest, MatchesLiteralTransform) {
+  struct Case {
+    std::shared_ptr<Transform> transform;
+    std::shared_ptr<Type> source_type;
+    ArrowType storage_type;
+    std::vector<Literal> values;
+  };
+
+  const std::vector<Literal> ints = {Literal::Int(1), Literal::Int(-1),
+                                     Literal::Null(int32()), Literal::Int(42),
+                                     Literal::Int(9), Literal::Int(-10)};
+  const std::vector<Literal> longs = {Literal::Long(1), Literal::Long(-11),
+                                      Literal::Null(int64()), Literal::Long(1L << 40)};
+  const std::vector<Literal> dates = {Literal::Date(0), Literal::Date(-1),
+                                      Literal::Null(date()), Literal::Date(30000)};
+  const std::vector<Literal> timestamps = {
+      Literal::Timestamp(0), Literal::Timestamp(-1), Literal::Null(timestamp()),
+      Literal::Timestamp(1622547800000000), Literal::Timestamp(-3600000001)};
+  const std::vector<Literal> strings = {
+      Literal::String("iceberg"), Literal::String(""), Literal::Null(string()),
+      Literal::String("😜🧐🤔🤪"), Literal::String("a😜b")};
+  const std::vector<Literal> binaries = {Literal::Binary({0x01, 0x02, 0x03, 0x04}),
+                                         Literal::Null(binary()), Literal::Binary({})};
+
+  const std::vector<Case> cases = {
+      {Transform::Identity(), int32(), NANOARROW_TYPE_INT32, ints},
+      {Transform::Identity(), string(), NANOARROW_TYPE_STRING, strings},
+      {Transform::Bucket(16), int32(), NANOARROW_TYPE_INT32, ints},
+      {Transform::Bucket(16), int64(), NANOARROW_TYPE_INT64, longs},
+      {Transform::Bucket(16), date(), NANOARROW_TYPE_INT32, dates},
+      {Transform::Bucket(16), timestamp(), NANOARROW_TYPE_INT64, timestamps},
+      {Transform::Bucket(16), string(), NANOARROW_TYPE_STRING, strings},
+      {Transform::Bucket(16), binary(), NANOARROW_TYPE_BINARY, binaries},
+      {Transform::Truncate(10), int32(), NANOARROW_TYPE_INT32, ints},
+      {Transform::Truncate(10), int64(), NANOARROW_TYPE_INT64, longs},
+      {Transform::Truncate(2), string(), NANOARROW_TYPE_STRING, strings},
+      {Transform::Truncate(2), binary(), NANOARROW_TYPE_BINARY, binaries},
+      {Transform::Year(), date(), NANOARROW_TYPE_INT32, dates},
+      {Transform::Year(), timestamp(), NANOARROW_TYPE_INT64, timestamps},
+      {Transform::Month(), date(), NANOARROW_TYPE_INT32, dates},
+      {Transform::Month(), timestamp(), NANOARROW_TYPE_INT64, timestamps},
+      {Transform::Day(), date(), NANOARROW_TYPE_INT32, dates},
+      {Transform::Day(), timestamp(), NANOARROW_TYPE_INT64, timestamps},
+      {Transform::Hour(), timestamp(), NANOARROW_TYPE_INT64, timestamps},
+      {Transform::Void(), int32(), NANOARROW_TYPE_INT32, ints},
+  };
+
+  for (const auto& c : cases) {
+    SCOPED_TRACE(std::format("{} of {}", *c.transform, c.source_type->ToString()));
+    auto bound = c.transform->Bind(c.source_type);
+    ASSERT_THAT(bound, IsOk());
+    auto& function = *bound.value();
+
+    auto input = MakeArray(c.storage_type, c.values);
+    auto result = function.Transform(input);
+    ASSERT_THAT(result, IsOk());
+    auto output = ReadArray(result.value(), function.ResultType());
+    ASSERT_EQ(output.size(), c.values.size());
+    for (size_t i = 0; i < c.values.size(); ++i) {
+      auto expected = function.Transform(c.values[i]);
+      ASSERT_THAT(expected, IsOk());
+      if (expected.value().IsNull()) {
+        EXPECT_TRUE(output[i].IsNull()) << "row " << i;
+      } else {
+        EXPECT_EQ(output[i], expected.value()) << "row " << i;
+      }
+    }
+    input.release(&input);
+    result.value().release(&result.value());
+  }
+}
+
+TEST(TransformArrayTest, SlicedInput) {
+  // An offset that is not a multiple of 8 exercises the unaligned validity copy.
+  auto input = MakeArray(NANOARROW_TYPE_STRING,
+                         {Literal::String("a"), Literal::String("b"),
+                          Literal::Null(string()), Literal::String("dddd"),
+                          Literal::String("eeeeee")});
+  input.offset = 1;
+  input.length = 4;
+  input.null_count = -1;
+
+  auto truncate = Transform::Truncate(3)->Bind(string()).value();
+  auto result = truncate->Transform(input);
+  ASSERT_THAT(result, IsOk());
+  EXPECT_EQ(result.value().null_count, 1);
+  auto output = ReadArray(result.value(), string());
+  ASSERT_EQ(output.size(), 4);
+  EXPECT_EQ(output[0], Literal::String("b"));
+  EXPECT_TRUE(output[1].IsNull());
+  EXPECT_EQ(output[2], Literal::String("ddd"));
+  EXPECT_EQ(output[3], Literal::String("eee"));
+  result.value().release(&result.value());
+
+  auto identity = Transform::Identity()->Bind(string()).value();
+  result = identity->Transform(input);
+  ASSERT_THAT(result, IsOk());
+  output = ReadArray(result.value(), string());
+  ASSERT_EQ(output.size(), 4);
+  EXPECT_EQ(output[3], Literal::String("eeeeee"));
+  EXPECT_TRUE(output[1].IsNull());
+  result.value().release(&result.value());
+  input.release(&input);
+}
+
+TEST(TransformArrayTest, BucketMatchesSpecHashes) {
+  constexpr int32_t kMask = std::numeric_limits<int32_t>::max();
+  auto read_buckets = [](ArrowArray& array) {
+    std::vector<int32_t> buckets;
+    for (const auto& value : ReadArray(array, int32())) {
+      buckets.push_back(std::get<int32_t>(value.value()));
+    }
+    array.release(&array);
+    return buckets;
+  };
+
+  // Enough values to fill the SIMD lanes and leave a remainder.
+  auto input =
+      MakeArray(NANOARROW_TYPE_INT32, std::vector<Literal>(19, Literal::Date(17486)));
+  auto bucket = Transform::Bucket(kMask)->Bind(date()).value();
+  auto result = bucket->Transform(input);
+  ASSERT_THAT(result, IsOk());
+  EXPECT_EQ(read_buckets(result.value()), std::vector<int32_t>(19, -653330422 & kMask));
+  input.release(&input);
+
+  input = MakeArray(NANOARROW_TYPE_INT64,
+                    std::vector<Literal>(21, Literal::Timestamp(1510871468000000)));
+  bucket = Transform::Bucket(kMask)->Bind(timestamp()).value();
+  result = bucket->Transform(input);
+  ASSERT_THAT(result, IsOk());
+  EXPECT_EQ(read_buckets(result.value()),
+            std::vector<int32_t>(21, -2047944441 & kMask));
+  input.release(&input);
+
+  // Arrays of uuids and decimals are built from schemas with their parameters.
+  ArrowSchema schema;
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeFixedSize(&schema, NANOARROW_TYPE_FIXED_SIZE_BINARY, 16),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&input, &schema, nullptr), NANOARROW_OK);
+  schema.release(&schema);
+  const std::vector<uint8_t> uuid = {0xf7, 0x9c, 0x3e, 0x09, 0x67, 0x7c, 0x4b, 0xbd,
+                                     0xa4, 0x79, 0x3f, 0x34, 0x9c, 0xb7, 0x85, 0xe7};
+  ArrowBufferView bytes;
+  bytes.data.as_uint8 = uuid.data();
+  bytes.size_bytes = static_cast<int64_t>(uuid.size());
+  ASSERT_EQ(ArrowArrayStartAppending(&input), NANOARROW_OK);
+  for (int i = 0; i < 17; ++i) {
+    ASSERT_EQ(ArrowArrayAppendBytes(&input, bytes), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&input, nullptr), NANOARROW_OK);
+  bucket = Transform::Bucket(kMask)->Bind(iceberg::uuid()).value();
+  result = bucket->Transform(input);
+  ASSERT_THAT(result, IsOk());
+  EXPECT_EQ(read_buckets(result.value()), std::vector<int32_t>(17, 1488055340 & kMask));
+  input.release(&input);
+
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeDecimal(&schema, NANOARROW_TYPE_DECIMAL128, 9, 2),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&input, &schema, nullptr), NANOARROW_OK);
+  schema.release(&schema);
+  ASSERT_EQ(ArrowArrayStartAppending(&input), NANOARROW_OK);
+  for (int64_t unscaled : {1420, -1420}) {
+    ArrowDecimal value;
+    ArrowDecimalInit(&value, 128, 9, 2);
+    ArrowDecimalSetInt(&value, unscaled);
+    ASSERT_EQ(ArrowArrayAppendDecimal(&input, &value), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&input, nullptr), NANOARROW_OK);
+  bucket = Transform::Bucket(kMask)->Bind(decimal(9, 2)).value();
+  result = bucket->Transform(input);
+  ASSERT_THAT(result, IsOk());
+  // 14.20 is hashed as the bytes 0x058c, and -14.20 as 0xfa74.
+  EXPECT_EQ(read_buckets(result.value()),
+            (std::vector<int32_t>{-500754589 & kMask, 667775751}));
+  input.release(&input);
+}
+
+TEST(TransformArrayTest, DecimalNotImplemented) {
+  auto truncate = Transform::Truncate(4)->Bind(decimal(9, 2)).value();
+  ArrowArray input = MakeArray(NANOARROW_TYPE_INT32, {});
+  EXPECT_THAT(truncate->Transform(input), IsError(ErrorKind::kNotImplemented));
+  input.release(&input);
+}
+
 }  // namespace iceberg